@@ -492,5 +492,8 @@ struct BlasBenchmark : Benchmark<dimensions> {
         operation_case["flops"] = flops / runtime;
         operation_case["bandwidth"] = mem / runtime;
         operation_case["repetitions"] = repetitions;
+        if (FLAGS_record_times) {
+            operation_case["times"] = ic.get_time_detail();
+        }
     }
 };
@@ -150,6 +150,9 @@ struct ConversionBenchmark : Benchmark<gko::device_matrix_data<etype, itype>> {
         }
         operation_case["time"] = ic.compute_time(FLAGS_timer_method);
         operation_case["repetitions"] = ic.get_num_repetitions();
+        if (FLAGS_record_times) {
+            operation_case["times"] = ic.get_time_detail();
+        }
     }
 };
 
@@ -0,0 +1,400 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+
+#include <ginkgo/ginkgo.hpp>
+
+#include "benchmark/utils/general.hpp"
+#include "benchmark/utils/iteration_control.hpp"
+#include "benchmark/utils/runner.hpp"
+#include "benchmark/utils/timer.hpp"
+#include "benchmark/utils/types.hpp"
+#include "common/unified/base/kernel_launch.hpp"
+#include "common/unified/base/kernel_launch_reduction.hpp"
+
+
+// Command-line arguments
+DEFINE_string(
+    operations, "empty,run_kernel,reduction,row_reduction,col_reduction",
+    "A comma-separated list of operations to benchmark.\nCandidates are\n"
+    "   empty (run_kernel with an empty body over n * r elements),\n"
+    "   run_kernel_1d (y_i = x_i, 1D run_kernel over n * r elements),\n"
+    "   run_kernel (Y = X, 2D run_kernel over n x r),\n"
+    "   reduction (sum of all entries of X),\n"
+    "   row_reduction (y_i = sum_j X_ij),\n"
+    "   col_reduction (y_j = sum_i X_ij)\n"
+    "The reductions also have a _cached variant (e.g. reduction_cached),\n"
+    "which reuses the temporary storage for partial results across runs.\n"
+    "X and Y have dimensions n x r, x and y have n * r entries.");
+
+DEFINE_bool(sweep, false,
+            "Ignore the input and run a sweep over n = 100, 1000, ..., 1e9 and "
+            "r = 1, 2, 4, ..., 64, up to sweep_max_elements entries");
+
+DEFINE_uint64(sweep_max_elements, 1000000000,
+              "The maximum number of entries n * r of the sweep test cases");
+
+
+namespace kernels = gko::kernels::GKO_DEVICE_NAMESPACE;
+using Vec = gko::matrix::Dense<etype>;
+
+
+class LaunchOperation {
+public:
+    virtual ~LaunchOperation() = default;
+
+    virtual gko::size_type get_memory() const = 0;
+
+    virtual void run() = 0;
+};
+
+
+class EmptyOperation : public LaunchOperation {
+public:
+    EmptyOperation(std::shared_ptr<const gko::OmpExecutor> exec,
+                   gko::size_type n, gko::size_type r)
+        : exec_{std::move(exec)}, size_{n * r}
+    {}
+
+    gko::size_type get_memory() const override { return 0; }
+
+    void run() override
+    {
+        kernels::run_kernel(exec_, [] GKO_KERNEL(auto i) {}, size_);
+    }
+
+private:
+    std::shared_ptr<const gko::OmpExecutor> exec_;
+    gko::size_type size_;
+};
+
+
+class Copy1dOperation : public LaunchOperation {
+public:
+    Copy1dOperation(std::shared_ptr<const gko::OmpExecutor> exec,
+                    gko::size_type n, gko::size_type r)
+        : exec_{exec}, x_{exec, n * r}, y_{exec, n * r}
+    {
+        x_.fill(gko::one<etype>());
+    }
+
+    gko::size_type get_memory() const override
+    {
+        return 2 * x_.get_size() * sizeof(etype);
+    }
+
+    void run() override
+    {
+        kernels::run_kernel(
+            exec_, [] GKO_KERNEL(auto i, auto x, auto y) { y[i] = x[i]; },
+            x_.get_size(), x_, y_);
+    }
+
+private:
+    std::shared_ptr<const gko::OmpExecutor> exec_;
+    gko::array<etype> x_;
+    gko::array<etype> y_;
+};
+
+
+class Copy2dOperation : public LaunchOperation {
+public:
+    Copy2dOperation(std::shared_ptr<const gko::OmpExecutor> exec,
+                    gko::size_type n, gko::size_type r)
+        : exec_{exec},
+          x_{Vec::create(exec, gko::dim<2>{n, r})},
+          y_{Vec::create(exec, gko::dim<2>{n, r})}
+    {
+        x_->fill(gko::one<etype>());
+    }
+
+    gko::size_type get_memory() const override
+    {
+        return 2 * x_->get_num_stored_elements() * sizeof(etype);
+    }
+
+    void run() override
+    {
+        kernels::run_kernel(
+            exec_,
+            [] GKO_KERNEL(auto row, auto col, auto x, auto y) {
+                y(row, col) = x(row, col);
+            },
+            x_->get_size(), x_.get(), y_.get());
+    }
+
+private:
+    std::shared_ptr<const gko::OmpExecutor> exec_;
+    std::unique_ptr<Vec> x_;
+    std::unique_ptr<Vec> y_;
+};
+
+
+enum class reduction_kind { all, row, col };
+
+
+class ReductionOperation : public LaunchOperation {
+public:
+    ReductionOperation(std::shared_ptr<const gko::OmpExecutor> exec,
+                       gko::size_type n, gko::size_type r, reduction_kind kind,
+                       bool cached)
+        : exec_{exec},
+          x_{Vec::create(exec, gko::dim<2>{n, r})},
+          result_{exec, kind == reduction_kind::all
+                            ? 1
+                            : (kind == reduction_kind::row ? n : r)},
+          tmp_{exec},
+          kind_{kind},
+          cached_{cached}
+    {
+        x_->fill(gko::one<etype>());
+    }
+
+    gko::size_type get_memory() const override
+    {
+        return (x_->get_num_stored_elements() + result_.get_size()) *
+               sizeof(etype);
+    }
+
+    void run() override
+    {
+        const auto fn = [] GKO_KERNEL(auto row, auto col, auto x) {
+            return x(row, col);
+        };
+        const auto op = [] GKO_KERNEL(auto a, auto b) { return a + b; };
+        const auto finalize = [] GKO_KERNEL(auto a) { return a; };
+        const auto size = x_->get_size();
+        auto result = result_.get_data();
+        const Vec* x = x_.get();
+        switch (kind_) {
+        case reduction_kind::all:
+            if (cached_) {
+                kernels::run_kernel_reduction_cached(exec_, fn, op, finalize,
+                                                     etype{}, result, size,
+                                                     tmp_, x);
+            } else {
+                kernels::run_kernel_reduction(exec_, fn, op, finalize,
+                                              etype{}, result, size, x);
+            }
+            break;
+        case reduction_kind::row:
+            if (cached_) {
+                kernels::run_kernel_row_reduction_cached(
+                    exec_, fn, op, finalize, etype{}, result, 1, size, tmp_,
+                    x);
+            } else {
+                kernels::run_kernel_row_reduction(exec_, fn, op, finalize,
+                                                  etype{}, result, 1, size, x);
+            }
+            break;
+        case reduction_kind::col:
+            if (cached_) {
+                kernels::run_kernel_col_reduction_cached(
+                    exec_, fn, op, finalize, etype{}, result, size, tmp_, x);
+            } else {
+                kernels::run_kernel_col_reduction(exec_, fn, op, finalize,
+                                                  etype{}, result, size, x);
+            }
+            break;
+        }
+    }
+
+private:
+    std::shared_ptr<const gko::OmpExecutor> exec_;
+    std::unique_ptr<Vec> x_;
+    gko::array<etype> result_;
+    gko::array<char> tmp_;
+    reduction_kind kind_;
+    bool cached_;
+};
+
+
+struct launch_dimensions {
+    gko::size_type n;
+    gko::size_type r;
+};
+
+
+using operation_factory = std::function<std::unique_ptr<LaunchOperation>(
+    std::shared_ptr<const gko::OmpExecutor>, launch_dimensions)>;
+
+
+template <typename Operation, typename... Args>
+operation_factory make_factory(Args... args)
+{
+    return [=](std::shared_ptr<const gko::OmpExecutor> exec,
+               launch_dimensions dims) {
+        return std::make_unique<Operation>(exec, dims.n, dims.r, args...);
+    };
+}
+
+
+const std::map<std::string, operation_factory> operation_map{
+    {"empty", make_factory<EmptyOperation>()},
+    {"run_kernel_1d", make_factory<Copy1dOperation>()},
+    {"run_kernel", make_factory<Copy2dOperation>()},
+    {"reduction", make_factory<ReductionOperation>(reduction_kind::all, false)},
+    {"reduction_cached",
+     make_factory<ReductionOperation>(reduction_kind::all, true)},
+    {"row_reduction",
+     make_factory<ReductionOperation>(reduction_kind::row, false)},
+    {"row_reduction_cached",
+     make_factory<ReductionOperation>(reduction_kind::row, true)},
+    {"col_reduction",
+     make_factory<ReductionOperation>(reduction_kind::col, false)},
+    {"col_reduction_cached",
+     make_factory<ReductionOperation>(reduction_kind::col, true)}};
+
+
+struct KernelLaunchBenchmark : Benchmark<launch_dimensions> {
+    std::string name;
+    std::vector<std::string> operations;
+
+    KernelLaunchBenchmark()
+        : name{"kernel_launch"}, operations{split(FLAGS_operations)}
+    {}
+
+    const std::string& get_name() const override { return name; }
+
+    const std::vector<std::string>& get_operations() const override
+    {
+        return operations;
+    }
+
+    bool should_print() const override { return true; }
+
+    std::string get_example_config() const override
+    {
+        return json::parse(R"([{"n": 100}, {"n": 1000000, "r": 8}])").dump(4);
+    }
+
+    bool validate_config(const json& value) const override
+    {
+        return value.contains("n") && value["n"].is_number_integer() &&
+               (!value.contains("r") || value["r"].is_number_integer());
+    }
+
+    std::string describe_config(const json& test_case) const override
+    {
+        std::stringstream ss;
+        ss << "n = " << test_case["n"].get<gko::int64>();
+        if (test_case.contains("r")) {
+            ss << " r = " << test_case["r"].get<gko::int64>();
+        }
+        return ss.str();
+    }
+
+    launch_dimensions setup(std::shared_ptr<gko::Executor> exec,
+                            json& test_case) const override
+    {
+        launch_dimensions result;
+        result.n = test_case["n"].get<gko::uint64>();
+        result.r = test_case.contains("r") ? test_case["r"].get<gko::uint64>()
+                                           : gko::uint64{1};
+        return result;
+    }
+
+    void run(std::shared_ptr<gko::Executor> exec, std::shared_ptr<Timer> timer,
+             annotate_functor annotate, launch_dimensions& dims,
+             const std::string& operation_name,
+             json& operation_case) const override
+    {
+        auto op = operation_map.at(operation_name)(
+            gko::as<gko::OmpExecutor>(exec), dims);
+
+        IterationControl ic(timer);
+
+        // warm run
+        {
+            auto range = annotate("warmup", FLAGS_warmup > 0);
+            for (auto _ : ic.warmup_run()) {
+                op->run();
+            }
+        }
+
+        // timed run
+        for (auto _ : ic.run()) {
+            auto range = annotate("repetition");
+            op->run();
+        }
+        const auto runtime = ic.compute_time(FLAGS_timer_method);
+        const auto mem = static_cast<double>(op->get_memory());
+        operation_case["time"] = runtime;
+        if (mem > 0) {
+            operation_case["bandwidth"] = mem / runtime;
+        }
+        operation_case["repetitions"] = ic.get_num_repetitions();
+        if (FLAGS_record_times) {
+            operation_case["times"] = ic.get_time_detail();
+        }
+    }
+
+    double get_memory_traffic(const json& test_case,
+                              const std::string& operation) const override
+    {
+        const auto n = test_case["n"].get<double>();
+        const auto r = test_case.contains("r") ? test_case["r"].get<double>()
+                                               : 1.0;
+        if (operation == "empty") {
+            return 0.0;
+        }
+        if (operation.find("reduction") == std::string::npos) {
+            return 2 * n * r * sizeof(etype);
+        }
+        return n * r * sizeof(etype);
+    }
+};
+
+
+json generate_sweep()
+{
+    auto test_cases = json::array();
+    for (gko::uint64 n = 100; n <= 1000000000; n *= 10) {
+        for (gko::uint64 r = 1; r <= 64; r *= 2) {
+            if (n * r <= FLAGS_sweep_max_elements) {
+                test_cases.push_back({{"n", n}, {"r", r}});
+            }
+        }
+    }
+    return test_cases;
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::string header =
+        "A benchmark for measuring the overhead of the kernel launch and "
+        "reduction\nprimitives shared by the OpenMP kernels.\n"
+        "Parameters for a benchmark case are:\n"
+        "    n: number of rows (required)\n"
+        "    r: number of columns (optional, default 1)\n";
+    std::string format = KernelLaunchBenchmark{}.get_example_config();
+    initialize_argument_parsing(&argc, &argv, header, format);
+
+    if (FLAGS_executor != "omp") {
+        std::cerr << "The kernel launch benchmark only supports the omp "
+                     "executor"
+                  << std::endl;
+        std::exit(1);
+    }
+
+    std::string extra_information = "The operations are " + FLAGS_operations;
+    auto exec = executor_factory.at(FLAGS_executor)(FLAGS_gpu_timer);
+    print_general_information(extra_information, exec);
+
+    auto test_cases =
+        FLAGS_sweep ? generate_sweep() : json::parse(get_input_stream());
+
+    run_test_cases(KernelLaunchBenchmark{}, exec,
+                   get_timer(exec, FLAGS_gpu_timer), test_cases);
+
+    std::cout << std::setw(4) << test_cases << std::endl;
+}
@@ -208,6 +208,9 @@ struct PreconditionerBenchmark : Benchmark<preconditioner_benchmark_state> {
                 ic_gen.compute_time(FLAGS_timer_method);
             precond_case["generate"]["repetitions"] =
                 ic_gen.get_num_repetitions();
+            if (FLAGS_record_times) {
+                precond_case["generate"]["times"] = ic_gen.get_time_detail();
+            }
 
             for (auto _ : ic_apply.run()) {
                 auto range = annotate("repetition apply");
@@ -218,6 +221,9 @@ struct PreconditionerBenchmark : Benchmark<preconditioner_benchmark_state> {
                 ic_apply.compute_time(FLAGS_timer_method);
             precond_case["apply"]["repetitions"] =
                 ic_apply.get_num_repetitions();
+            if (FLAGS_record_times) {
+                precond_case["apply"]["times"] = ic_apply.get_time_detail();
+            }
         }
 
         if (FLAGS_detailed) {
@@ -30,7 +30,7 @@ int main(int argc, char* argv[])
         "A benchmark for measuring performance of Ginkgo's solvers.\n";
     std::string format = solver_example_config + R"(
   "optimal":"spmv" can be one of the recognized spmv formats
-)";
+)" + solver_configs_example;
     std::string additional_json = R"(,"optimal":{"spmv":"csr"})";
     initialize_argument_parsing_matrix(&argc, &argv, header, format,
                                        additional_json);
@@ -39,10 +39,14 @@ int main(int argc, char* argv[])
     ss_rel_res_goal << std::scientific << FLAGS_rel_res_goal;
 
     std::string extra_information =
-        "Running " + FLAGS_solvers + " with " +
-        std::to_string(FLAGS_max_iters) + " iterations and residual goal of " +
-        ss_rel_res_goal.str() + "\nThe number of right hand sides is " +
-        std::to_string(FLAGS_nrhs);
+        FLAGS_solver_configs.empty()
+            ? "Running " + FLAGS_solvers + " with " +
+                  std::to_string(FLAGS_max_iters) +
+                  " iterations and residual goal of " + ss_rel_res_goal.str()
+            : "Running the solver configurations from " +
+                  FLAGS_solver_configs;
+    extra_information +=
+        "\nThe number of right hand sides is " + std::to_string(FLAGS_nrhs);
 
     auto exec = get_executor(FLAGS_gpu_timer);
     print_general_information(extra_information, exec);
@@ -6,6 +6,12 @@
 #define GINKGO_BENCHMARK_SOLVER_SOLVER_COMMON_HPP
 
 
+#include <algorithm>
+#include <optional>
+#include <set>
+
+#include <ginkgo/extensions/config/json_config.hpp>
+
 #include "benchmark/utils/formats.hpp"
 #include "benchmark/utils/general.hpp"
 #include "benchmark/utils/general_matrix.hpp"
@@ -42,6 +48,13 @@ DEFINE_string(solvers, "cg",
               "lower_trs, upper_trs, spd_direct, symm_direct, "
               "near_symm_direct, direct, overhead");
 
+DEFINE_string(
+    solver_configs, "",
+    "A JSON file with solver configurations in the format used by "
+    "examples/file-config-solver. If set, it replaces --solvers and "
+    "--preconditioners, so the configurations need to contain their own "
+    "stopping criteria. See --help for the format of the file.");
+
 DEFINE_uint32(
     nrhs, 1,
     "The number of right hand sides. Record the residual only when nrhs == 1.");
@@ -94,6 +107,157 @@ std::string solver_example_config = R"(
 )";
 
 
+std::string solver_configs_example = R"(
+  The --solver_configs file either contains a single solver configuration,
+  or named configurations and an optional parameter sweep:
+  {
+    "solvers": {
+      "cg-jacobi": {"type": "solver::Cg",
+                    "preconditioner": {"type": "preconditioner::Jacobi",
+                                       "max_block_size": 1},
+                    "criteria": [{"type": "Iteration", "max_iters": 1000}]},
+      "cg-amg": {"type": "solver::Cg",
+                 "preconditioner": {"type": "solver::Multigrid",
+                                    "mg_level": [{"type": "multigrid::Pgm"}],
+                                    "max_levels": 10,
+                                    "criteria": [{"type": "Iteration",
+                                                  "max_iters": 1}]},
+                 "criteria": [{"type": "Iteration", "max_iters": 1000}]}
+    },
+    "sweep": {
+      "/preconditioner/max_block_size": [1, 4, 8],
+      "/preconditioner/max_levels": [2, 5]
+    }
+  }
+  The sweep maps JSON pointers into the configurations to lists of values.
+  Each configuration is run with all combinations of the values of the
+  pointers that exist in it, e.g. cg-jacobi as
+  "cg-jacobi[/preconditioner/max_block_size=4]". A pointer that doesn't exist
+  in any configuration is an error. During the warmup runs, the Iteration
+  criteria of a configuration are limited to --warmup_max_iters.
+)";
+
+
+/**
+ * Reads the named solver configurations from the --solver_configs file and
+ * expands the parameter sweep, see solver_configs_example.
+ */
+std::vector<std::pair<std::string, json>> read_solver_configs(
+    const std::string& filename)
+{
+    std::ifstream stream{filename};
+    if (!stream) {
+        throw std::invalid_argument("Could not open solver config file " +
+                                    filename);
+    }
+    const auto input = json::parse(stream);
+    auto solvers = json::object();
+    auto sweep = json::object();
+    if (input.contains("solvers")) {
+        solvers = input["solvers"];
+        if (input.contains("sweep")) {
+            sweep = input["sweep"];
+        }
+    } else {
+        solvers[input.value("type", std::string{"solver"})] = input;
+    }
+    std::vector<std::pair<std::string, json>> result;
+    std::set<std::string> used_parameters;
+    for (const auto& solver : solvers.items()) {
+        // the variants are pairs of the swept values and the configuration
+        std::vector<std::pair<std::vector<std::string>, json>> variants{
+            {{}, solver.value()}};
+        for (const auto& parameter : sweep.items()) {
+            const json::json_pointer pointer{parameter.key()};
+            if (!parameter.value().is_array()) {
+                throw std::invalid_argument("The sweep values of " +
+                                            parameter.key() +
+                                            " need to be an array");
+            }
+            if (!solver.value().contains(pointer)) {
+                continue;
+            }
+            used_parameters.insert(parameter.key());
+            std::vector<std::pair<std::vector<std::string>, json>>
+                new_variants;
+            for (const auto& variant : variants) {
+                for (const auto& value : parameter.value()) {
+                    auto new_variant = variant;
+                    new_variant.first.push_back(parameter.key() + "=" +
+                                                value.dump());
+                    new_variant.second[pointer] = value;
+                    new_variants.push_back(std::move(new_variant));
+                }
+            }
+            variants = std::move(new_variants);
+        }
+        for (auto& variant : variants) {
+            auto name = solver.key();
+            for (std::size_t i = 0; i < variant.first.size(); i++) {
+                name += (i == 0 ? "[" : ",") + variant.first[i];
+            }
+            if (!variant.first.empty()) {
+                name += "]";
+            }
+            result.emplace_back(std::move(name), std::move(variant.second));
+        }
+    }
+    for (const auto& parameter : sweep.items()) {
+        if (used_parameters.count(parameter.key()) == 0) {
+            throw std::invalid_argument("The sweep parameter " +
+                                        parameter.key() +
+                                        " doesn't exist in any solver");
+        }
+    }
+    return result;
+}
+
+
+/**
+ * Returns a copy of the solver configuration whose Iteration criteria stop
+ * after at most max_iters iterations. If the configuration has other criteria
+ * only, an Iteration criterion is added to them.
+ */
+json limit_iterations(json config, std::uint32_t max_iters)
+{
+    if (!config.contains("criteria")) {
+        return config;
+    }
+    auto& criteria = config["criteria"];
+    if (criteria.is_object()) {
+        criteria = json::array({criteria});
+    }
+    if (!criteria.is_array()) {
+        return config;
+    }
+    bool has_iteration = false;
+    for (auto& criterion : criteria) {
+        if (criterion.is_object() &&
+            criterion.value("type", "") == "Iteration") {
+            has_iteration = true;
+            criterion["max_iters"] =
+                std::min(criterion.value("max_iters", max_iters), max_iters);
+        }
+    }
+    if (!has_iteration) {
+        criteria.push_back({{"type", "Iteration"}, {"max_iters", max_iters}});
+    }
+    return config;
+}
+
+
+/** Parses a solver configuration in the format of file-config-solver. */
+gko::deferred_factory_parameter<gko::LinOpFactory> parse_solver_config(
+    const json& config)
+{
+    // the config extension uses the unordered json type
+    return gko::config::parse(
+        gko::ext::config::parse_json(nlohmann::json::parse(config.dump())),
+        gko::config::registry(),
+        gko::config::make_type_descriptor<etype, itype>());
+}
+
+
 std::shared_ptr<const gko::stop::CriterionFactory> create_criterion(
     std::shared_ptr<const gko::Executor> exec, std::uint32_t max_iters)
 {
@@ -362,10 +526,18 @@ struct SolverBenchmark : Benchmark<solver_benchmark_state<Generator>> {
     std::string name;
     std::vector<std::string> precond_solvers;
     std::map<std::string, std::pair<std::string, std::string>> decoder;
+    std::map<std::string, json> configs;
     Generator generator;
 
     SolverBenchmark(Generator generator) : name{"solver"}, generator{generator}
     {
+        if (!FLAGS_solver_configs.empty()) {
+            for (auto& config : read_solver_configs(FLAGS_solver_configs)) {
+                precond_solvers.push_back(config.first);
+                configs[config.first] = std::move(config.second);
+            }
+            return;
+        }
         auto solvers = split(FLAGS_solvers, ',');
         auto preconds = split(FLAGS_preconditioners, ',');
         for (const auto& s : solvers) {
@@ -443,9 +615,33 @@ struct SolverBenchmark : Benchmark<solver_benchmark_state<Generator>> {
              const std::string& encoded_solver_name,
              json& solver_case) const override
     {
-        const auto decoded_pair = decoder.at(encoded_solver_name);
-        auto& solver_name = decoded_pair.first;
-        auto& precond_name = decoded_pair.second;
+        // configured solvers are parsed once, outside of the timed region
+        std::optional<gko::deferred_factory_parameter<gko::LinOpFactory>>
+            config;
+        std::optional<gko::deferred_factory_parameter<gko::LinOpFactory>>
+            warmup_config;
+        const auto config_it = configs.find(encoded_solver_name);
+        if (config_it != configs.end()) {
+            config = parse_solver_config(config_it->second);
+            warmup_config = parse_solver_config(
+                limit_iterations(config_it->second, FLAGS_warmup_max_iters));
+            solver_case["config"] = config_it->second;
+        }
+        auto create_solver_factory = [&](bool warmup)
+            -> std::shared_ptr<const gko::LinOpFactory> {
+            if (config) {
+                return warmup ? warmup_config->on(exec) : config->on(exec);
+            }
+            const auto max_iters =
+                warmup ? FLAGS_warmup_max_iters : FLAGS_max_iters;
+            const auto& decoded_pair = decoder.at(encoded_solver_name);
+            auto precond = precond_factory.at(decoded_pair.second)(exec);
+            return generate_solver(exec, give(precond), decoded_pair.first,
+                                   max_iters);
+        };
+        // the components of configured solvers are usually nested, e.g. the
+        // levels of a multigrid hierarchy, so we always log them separately
+        const auto nested_names = FLAGS_nested_names || config.has_value();
         solver_case["recurrent_residuals"] = json::array();
         solver_case["true_residuals"] = json::array();
         solver_case["implicit_residuals"] = json::array();
@@ -467,9 +663,7 @@ struct SolverBenchmark : Benchmark<solver_benchmark_state<Generator>> {
             auto range = annotate("warmup", FLAGS_warmup > 0);
             for (auto _ : ic.warmup_run()) {
                 auto x_clone = clone(state.x);
-                auto precond = precond_factory.at(precond_name)(exec);
-                solver = generate_solver(exec, give(precond), solver_name,
-                                         FLAGS_warmup_max_iters)
+                solver = create_solver_factory(true)
                              ->generate(state.system_matrix);
                 solver->apply(state.b, x_clone);
                 exec->synchronize();
@@ -483,16 +677,14 @@ struct SolverBenchmark : Benchmark<solver_benchmark_state<Generator>> {
 
             {
                 auto gen_logger = create_operations_logger(
-                    FLAGS_gpu_timer, FLAGS_nested_names, exec,
+                    FLAGS_gpu_timer, nested_names, exec,
                     solver_case["generate"]["components"], 1);
                 exec->add_logger(gen_logger);
                 if (exec != exec->get_master()) {
                     exec->get_master()->add_logger(gen_logger);
                 }
 
-                auto precond = precond_factory.at(precond_name)(exec);
-                solver = generate_solver(exec, give(precond), solver_name,
-                                         FLAGS_max_iters)
+                solver = create_solver_factory(false)
                              ->generate(state.system_matrix);
 
                 exec->remove_logger(gen_logger);
@@ -511,7 +703,7 @@ struct SolverBenchmark : Benchmark<solver_benchmark_state<Generator>> {
 
             {
                 auto apply_logger = create_operations_logger(
-                    FLAGS_gpu_timer, FLAGS_nested_names, exec,
+                    FLAGS_gpu_timer, nested_names, exec,
                     solver_case["apply"]["components"], 1);
                 exec->add_logger(apply_logger);
                 if (exec != exec->get_master()) {
@@ -555,9 +747,7 @@ struct SolverBenchmark : Benchmark<solver_benchmark_state<Generator>> {
 
             exec->synchronize();
             generate_timer->tic();
-            auto precond = precond_factory.at(precond_name)(exec);
-            solver = generate_solver(exec, give(precond), solver_name,
-                                     FLAGS_max_iters)
+            solver = create_solver_factory(false)
                          ->generate(state.system_matrix);
             generate_timer->toc();
 
@@ -591,6 +781,17 @@ struct SolverBenchmark : Benchmark<solver_benchmark_state<Generator>> {
         solver_case["apply"]["time"] =
             apply_timer->compute_time(FLAGS_timer_method);
         solver_case["repetitions"] = apply_timer->get_num_repetitions();
+        if (FLAGS_record_times) {
+            solver_case["generate"]["times"] =
+                generate_timer->get_time_detail();
+            solver_case["apply"]["times"] = apply_timer->get_time_detail();
+        }
+        if (config && solver_case["apply"].contains("iterations") &&
+            solver_case["apply"]["iterations"].get<gko::int64>() > 0) {
+            solver_case["apply"]["time_per_iteration"] =
+                solver_case["apply"]["time"].get<double>() /
+                solver_case["apply"]["iterations"].get<gko::int64>();
+        }
     }
 };
 
@@ -131,6 +131,9 @@ struct SparseBlasBenchmark : Benchmark<std::unique_ptr<Mtx>> {
         operation_case["flops"] = flops / runtime;
         operation_case["bandwidth"] = mem / runtime;
         operation_case["repetitions"] = repetitions;
+        if (FLAGS_record_times) {
+            operation_case["times"] = ic.get_time_detail();
+        }
 
         if (FLAGS_validate) {
             auto validation_result = op->validate();
@@ -174,6 +174,26 @@ struct SpmvBenchmark : Benchmark<spmv_benchmark_state<Generator>> {
         }
         format_case["time"] = ic.compute_time(FLAGS_timer_method);
         format_case["repetitions"] = ic.get_num_repetitions();
+        if (FLAGS_record_times) {
+            format_case["times"] = ic.get_time_detail();
+        }
+    }
+
+    double get_memory_traffic(const json& test_case,
+                              const std::string& format_name) const override
+    {
+        if (!test_case.contains("nonzeros")) {
+            return 0.0;
+        }
+        // the traffic of a Csr SpMV, which is the same for all formats
+        const auto nnz = test_case["nonzeros"].get<double>();
+        const auto rows = test_case["rows"].get<double>();
+        const auto cols = test_case["cols"].get<double>();
+        const auto value_size = static_cast<double>(sizeof(etype));
+        const auto index_size =
+            static_cast<double>(sizeof(typename Generator::index_type));
+        return nnz * (value_size + index_size) + (rows + 1) * index_size +
+               (rows + cols) * FLAGS_nrhs * value_size;
     }
 
     void postprocess(json& test_case) const override
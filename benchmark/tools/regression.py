@@ -0,0 +1,267 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+# SPDX-License-Identifier: BSD-3-Clause
+import sys
+import os
+import json
+import argparse
+import math
+import shutil
+import statistics
+import datetime
+import compare
+
+
+time_keys = {"time", "times"}
+
+
+def extract_samples(input: dict, samples: dict, context: str | None) -> None:
+    """Collects the timing samples of all benchmarks in a test case into a benchmark name -> list dict.
+    Uses the individual repetitions from "times" if available, the averaged "time" otherwise."""
+    if "times" in input.keys() and len(input["times"]) > 0:
+        samples[f"{context}/time"] = list(input["times"])
+    elif "time" in input.keys() and not isinstance(input["time"], dict):
+        samples[f"{context}/time"] = [input["time"]]
+    for key, value in input.items():
+        if key not in time_keys and isinstance(value, dict):
+            extract_samples(
+                value, samples, key if context is None else f"{context}/{key}"
+            )
+
+
+def collect_samples(filenames: list, per_run_means: bool = False) -> dict:
+    """Parses benchmark outputs into a (case key, benchmark name) -> samples dict.
+    With per_run_means, each file contributes the geometric mean of its repetitions as a single sample,
+    since the repetitions of a single run are not independent of each other.
+    Otherwise, the repetitions of all files are pooled."""
+    result = {}
+    for filename in filenames:
+        for case_key, case in compare.parse_json_matrix(filename).items():
+            samples = {}
+            extract_samples(case, samples, None)
+            for benchmark_name, values in samples.items():
+                values = [value for value in values if value > 0]
+                if len(values) > 0:
+                    if per_run_means:
+                        values = [statistics.geometric_mean(values)]
+                    result.setdefault((case_key, benchmark_name), []).extend(values)
+    return result
+
+
+def history_files(directory: str, max_history: int) -> list:
+    """Returns the most recent results stored in the history directory, ordered by name"""
+    if not os.path.isdir(directory):
+        return []
+    files = sorted(
+        os.path.join(directory, name)
+        for name in os.listdir(directory)
+        if name.endswith(".json")
+    )
+    return files[-max_history:] if max_history > 0 else files
+
+
+def t_quantile(p: float, df: float) -> float:
+    """Approximates the p-quantile of Student's t-distribution by a Cornish-Fisher expansion around the normal distribution"""
+    z = statistics.NormalDist().inv_cdf(p)
+    if math.isinf(df):
+        return z
+    return (
+        z
+        + (z**3 + z) / (4 * df)
+        + (5 * z**5 + 16 * z**3 + 3 * z) / (96 * df**2)
+        + (3 * z**7 + 19 * z**5 + 17 * z**3 - 15 * z) / (384 * df**3)
+        + (79 * z**9 + 776 * z**7 + 1482 * z**5 - 1920 * z**3 - 945 * z)
+        / (92160 * df**4)
+    )
+
+
+def ratio_interval(baseline: list, comparison: list, confidence: float) -> tuple:
+    """Computes the ratio between the geometric means of comparison and baseline times with its confidence interval.
+    The interval is the Welch t-interval of the difference of the mean log-times."""
+    log_baseline = [math.log(value) for value in baseline]
+    log_comparison = [math.log(value) for value in comparison]
+    difference = statistics.fmean(log_comparison) - statistics.fmean(log_baseline)
+    var_baseline = statistics.variance(log_baseline) / len(log_baseline)
+    var_comparison = statistics.variance(log_comparison) / len(log_comparison)
+    stderr = math.sqrt(var_baseline + var_comparison)
+    if stderr == 0:
+        df = math.inf
+    else:
+        # Welch-Satterthwaite degrees of freedom
+        df = (var_baseline + var_comparison) ** 2 / (
+            var_baseline**2 / (len(log_baseline) - 1)
+            + var_comparison**2 / (len(log_comparison) - 1)
+        )
+    half_width = t_quantile(1 - (1 - confidence) / 2, df) * stderr
+    return (
+        math.exp(difference),
+        math.exp(difference - half_width),
+        math.exp(difference + half_width),
+    )
+
+
+def classify(baseline: list, comparison: list, args) -> dict:
+    """Compares the timing samples of a single benchmark, returning the slowdown and its status"""
+    result = {
+        "baseline_samples": len(baseline),
+        "comparison_samples": len(comparison),
+    }
+    if min(len(baseline), len(comparison)) < args.min_samples:
+        result["status"] = "insufficient_data"
+        return result
+    slowdown, lower, upper = ratio_interval(baseline, comparison, args.confidence)
+    result["slowdown"] = slowdown
+    result["lower"] = lower
+    result["upper"] = upper
+    threshold = 1.0 + args.threshold / 100
+    if lower > threshold:
+        result["status"] = "regression"
+    elif upper < 1 / threshold:
+        result["status"] = "improvement"
+    else:
+        result["status"] = "unchanged"
+    return result
+
+
+def regression_main(args: list) -> int:
+    """Runs the regression check, returns the exit code"""
+    parser = argparse.ArgumentParser(
+        description="Check Ginkgo benchmark outputs for statistically significant slowdowns. "
+        "Each baseline run contributes the mean of its repetitions, so multiple baseline runs are needed. "
+        "Run the benchmarks with --repetitions=<n> --repetition_growth_factor=1 --record_times "
+        "to provide a sample for each repetition of the comparison."
+    )
+    parser.add_argument(
+        "--baseline",
+        nargs="*",
+        default=[],
+        help="Benchmark outputs to compare against, in addition to the history",
+    )
+    parser.add_argument(
+        "--history", help="Directory containing the results of previous runs"
+    )
+    parser.add_argument(
+        "--max-history",
+        type=int,
+        default=10,
+        help="How many of the most recent results from the history should be used, 0 for all",
+    )
+    parser.add_argument(
+        "--store",
+        action="store_true",
+        help="Store the comparison in the history directory after checking it, if it passed",
+    )
+    parser.add_argument(
+        "--store-on-failure",
+        action="store_true",
+        help="Together with --store, also store the comparison if it failed",
+    )
+    parser.add_argument(
+        "--label",
+        help="File name for the stored comparison, defaults to the current UTC time",
+    )
+    parser.add_argument(
+        "--confidence",
+        type=float,
+        default=0.99,
+        help="Confidence level of the intervals of the slowdown",
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=5,
+        help="By what percentage a benchmark needs to be slower (faster) at least to be reported as regression (improvement)",
+    )
+    parser.add_argument(
+        "--min-samples",
+        type=int,
+        default=3,
+        help="How many samples baseline and comparison need at least for a verdict. "
+        "Each baseline run provides a single sample, each repetition of the comparison provides one sample",
+    )
+    parser.add_argument("--output", choices=["json", "markdown"], default="json")
+    parser.add_argument("comparison")
+    args = parser.parse_args(args)
+    if args.store and args.history is None:
+        parser.error("--store requires --history")
+    if args.store_on_failure and not args.store:
+        parser.error("--store-on-failure requires --store")
+    if not 0 < args.confidence < 1:
+        parser.error("--confidence needs to be between 0 and 1")
+    args.min_samples = max(args.min_samples, 2)
+
+    baseline_files = args.baseline
+    if args.history is not None:
+        baseline_files = baseline_files + history_files(
+            args.history, args.max_history
+        )
+    baseline = collect_samples(baseline_files, per_run_means=True)
+    comparison = collect_samples([args.comparison])
+
+    results = []
+    for case_key, benchmark_name in sorted(comparison.keys(), key=str):
+        result = {
+            **case_key,
+            "benchmark": benchmark_name,
+            **classify(
+                baseline.get((case_key, benchmark_name), []),
+                comparison[(case_key, benchmark_name)],
+                args,
+            ),
+        }
+        results.append(result)
+    counts = {
+        status: sum(1 for result in results if result["status"] == status)
+        for status in ["regression", "improvement", "unchanged", "insufficient_data"]
+    }
+    verdict = "fail" if counts["regression"] > 0 else "pass"
+
+    if args.output == "json":
+        print(
+            json.dumps(
+                {
+                    "verdict": verdict,
+                    "confidence": args.confidence,
+                    "threshold": args.threshold,
+                    "baseline": baseline_files,
+                    "counts": counts,
+                    "results": results,
+                },
+                indent=4,
+            )
+        )
+    else:
+        print(f"Verdict: {verdict}\n")
+        print("| benchmark | testcase | status | slowdown | interval |")
+        print("|---|---|---|---|---|")
+        for result in results:
+            case_key = {key: result[key] for key in compare.keys if key in result}
+            interval = (
+                f"[{result['lower']:.3f}, {result['upper']:.3f}]"
+                if "lower" in result
+                else ""
+            )
+            slowdown = f"{result['slowdown']:.3f}" if "slowdown" in result else ""
+            print(
+                f"| {result['benchmark']} | {json.dumps(case_key)} | {result['status']} | {slowdown} | {interval} |"
+            )
+
+    if args.store and verdict == "fail" and not args.store_on_failure:
+        print(
+            "Not storing the comparison in the history, since it failed",
+            file=sys.stderr,
+        )
+    elif args.store:
+        os.makedirs(args.history, exist_ok=True)
+        label = args.label
+        if label is None:
+            label = datetime.datetime.now(datetime.timezone.utc).strftime(
+                "%Y%m%dT%H%M%S"
+            )
+        shutil.copyfile(args.comparison, os.path.join(args.history, label + ".json"))
+
+    return 1 if verdict == "fail" else 0
+
+
+if __name__ == "__main__":
+    sys.exit(regression_main(sys.argv[1:]))
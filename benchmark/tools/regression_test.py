@@ -0,0 +1,166 @@
+import json
+import regression
+
+
+def write_result(path, times: dict):
+    """Writes a spmv benchmark output with the given format -> times"""
+    path.write_text(
+        json.dumps(
+            [
+                {
+                    "filename": "mtx",
+                    "spmv": {
+                        name: {"time": sum(values) / len(values), "times": values}
+                        for name, values in times.items()
+                    },
+                }
+            ]
+        )
+    )
+    return str(path)
+
+
+def test_t_quantile():
+    # reference values of Student's t-distribution
+    assert abs(regression.t_quantile(0.975, 10) - 2.228) < 0.01
+    assert abs(regression.t_quantile(0.995, 30) - 2.750) < 0.01
+    assert abs(regression.t_quantile(0.975, float("inf")) - 1.960) < 0.01
+
+
+def write_baseline(tmp_path, means: list, names: list):
+    """Writes one spmv benchmark output per run mean for the given formats"""
+    return [
+        write_result(
+            tmp_path / f"baseline{i}.json",
+            {name: [mean * 0.99, mean, mean * 1.01] for name in names},
+        )
+        for i, mean in enumerate(means)
+    ]
+
+
+def test_verdict(tmp_path, capsys):
+    baseline = write_baseline(
+        tmp_path, [1.0, 1.01, 0.99, 1.0, 1.02], ["coo", "csr", "ell", "hybrid"]
+    )
+    comparison = write_result(
+        tmp_path / "comparison.json",
+        {
+            "coo": [1.5, 1.51, 1.49, 1.5, 1.52],
+            "csr": [0.5, 0.51, 0.49, 0.5, 0.52],
+            "ell": [1.01, 1.0, 0.99, 1.02, 1.0],
+            "hybrid": [1.0],
+            "sellp": [1.0, 1.0, 1.0],
+        },
+    )
+
+    assert regression.regression_main(["--baseline", *baseline, "--", comparison]) == 1
+
+    output = json.loads(capsys.readouterr().out)
+    assert output["verdict"] == "fail"
+    assert output["counts"] == {
+        "regression": 1,
+        "improvement": 1,
+        "unchanged": 1,
+        "insufficient_data": 2,
+    }
+    status = {
+        result["benchmark"]: result["status"] for result in output["results"]
+    }
+    assert status == {
+        "spmv/coo/time": "regression",
+        "spmv/csr/time": "improvement",
+        "spmv/ell/time": "unchanged",
+        "spmv/hybrid/time": "insufficient_data",
+        "spmv/sellp/time": "insufficient_data",
+    }
+    coo = output["results"][0]
+    assert coo["filename"] == "mtx"
+    assert coo["baseline_samples"] == 5
+    assert coo["comparison_samples"] == 5
+    assert coo["lower"] < 1.5 < coo["upper"]
+
+
+def test_repetitions_of_a_baseline_run_are_averaged(tmp_path, capsys):
+    # many repetitions of a single run don't make a precise baseline
+    baseline = write_result(tmp_path / "baseline.json", {"csr": [1.0] * 20})
+    comparison = write_result(tmp_path / "comparison.json", {"csr": [2.0] * 5})
+
+    assert regression.regression_main(["--baseline", baseline, "--", comparison]) == 0
+
+    output = json.loads(capsys.readouterr().out)
+    assert output["results"][0]["baseline_samples"] == 1
+    assert output["results"][0]["status"] == "insufficient_data"
+
+
+def test_noisy_slowdown_is_not_significant(tmp_path, capsys):
+    baseline = write_baseline(tmp_path, [1.0, 2.0, 1.0], ["csr"])
+    comparison = write_result(tmp_path / "comparison.json", {"csr": [2.0, 1.0, 2.0]})
+
+    assert regression.regression_main(["--baseline", *baseline, "--", comparison]) == 0
+
+    output = json.loads(capsys.readouterr().out)
+    assert output["verdict"] == "pass"
+    assert output["results"][0]["status"] == "unchanged"
+
+
+def test_history(tmp_path, capsys):
+    history = tmp_path / "history"
+    runs = [
+        write_result(
+            tmp_path / f"run{i}.json", {"csr": [mean * 0.99, mean, mean * 1.01]}
+        )
+        for i, mean in enumerate([1.0, 1.01, 0.99, 1.0])
+    ]
+    slow = write_result(tmp_path / "slow.json", {"csr": [2.0, 2.01, 1.99]})
+
+    for i, run in enumerate(runs):
+        assert (
+            regression.regression_main(
+                ["--history", str(history), "--store", "--label", str(i), run]
+            )
+            == 0
+        )
+    assert regression.regression_main(["--history", str(history), slow]) == 1
+    # only compare against the most recent stored results
+    assert (
+        regression.regression_main(
+            ["--history", str(history), "--max-history", "2", slow]
+        )
+        == 0
+    )
+
+    outputs = [
+        json.loads(output)
+        for output in capsys.readouterr().out.replace("}\n{", "}\n\0{").split("\0")
+    ]
+    # the first runs have too little history to compare against
+    assert outputs[0]["results"][0]["status"] == "insufficient_data"
+    assert outputs[2]["results"][0]["status"] == "insufficient_data"
+    assert outputs[3]["results"][0]["status"] == "unchanged"
+    assert outputs[4]["results"][0]["baseline_samples"] == 4
+    assert outputs[4]["results"][0]["status"] == "regression"
+    assert outputs[5]["results"][0]["baseline_samples"] == 2
+    assert outputs[5]["results"][0]["status"] == "insufficient_data"
+    assert sorted(path.name for path in history.iterdir()) == [
+        "0.json",
+        "1.json",
+        "2.json",
+        "3.json",
+    ]
+
+
+def test_store_only_on_pass(tmp_path, capsys):
+    history = tmp_path / "history"
+    baseline = write_baseline(tmp_path, [1.0, 1.01, 0.99], ["csr"])
+    slow = write_result(tmp_path / "slow.json", {"csr": [2.0, 2.01, 1.99]})
+    args = ["--history", str(history), "--baseline", *baseline, "--store"]
+
+    assert regression.regression_main([*args, "--label", "1", "--", slow]) == 1
+    assert not history.exists()
+    assert (
+        regression.regression_main(
+            [*args, "--store-on-failure", "--label", "2", "--", slow]
+        )
+        == 1
+    )
+    assert sorted(path.name for path in history.iterdir()) == ["2.json"]
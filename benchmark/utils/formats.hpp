@@ -22,8 +22,9 @@ namespace formats {
 
 
 std::string available_format =
-    "coo, csr, ell, ell_mixed, sellp, hybrid, hybrid0, hybrid25, hybrid33, "
-    "hybrid40, "
+    "coo, csr, deltacsr, reducedcsr, symcsr, vbcsr, ell, ell_mixed, sellp, "
+    "sellcs, "
+    "hybrid, hybrid0, hybrid25, hybrid33, hybrid40, "
     "hybrid60, hybrid80, hybridlimit0, hybridlimit25, hybridlimit33, "
     "hybridminstorage"
 #ifdef HAS_CUDA
@@ -51,11 +52,21 @@ std::string format_description =
     "csri: Ginkgo's CSR implementation with imbalance strategy.\n"
     "csrm: Ginkgo's CSR implementation with merge_path strategy.\n"
     "csrs: Ginkgo's CSR implementation with sparselib strategy.\n"
+    "deltacsr: CSR with column indices stored as 8/16 bit deltas to the\n"
+    "          previous column index of the row.\n"
+    "reducedcsr: CSR with values stored in the next lower precision, while\n"
+    "            the SpMV computes in the benchmark precision.\n"
+    "symcsr: CSR storing only the diagonal and upper triangle of a\n"
+    "        symmetric matrix.\n"
+    "vbcsr: Block CSR with variable block sizes, detected by merging\n"
+    "       consecutive rows with identical sparsity patterns.\n"
     "ell: Ellpack format according to Bell and Garland: Efficient Sparse\n"
     "     Matrix-Vector Multiplication on CUDA.\n"
     "ell_mixed: Mixed Precision Ellpack format according to Bell and Garland:\n"
     "           Efficient Sparse Matrix-Vector Multiplication on CUDA.\n"
     "sellp: Sliced Ellpack uses a default block size of 32.\n"
+    "sellcs: SELL-C-sigma with the slice size C matching the CPU SIMD width\n"
+    "        and rows sorted by length within windows of sigma = 256 rows.\n"
     "hybrid: Hybrid uses ELL and COO to represent the matrix.\n"
     "hybrid0, hybrid25, hybrid33, hybrid40, hybrid60, hybrid80:\n"
     "    Use 0%, 25%, ... quantiles of the row length distribution\n"
@@ -260,7 +271,17 @@ const std::map<std::string, std::function<std::unique_ptr<gko::LinOp>(
         {"hybridminstorage",
          create_matrix_type<hybrid>(
                      std::make_shared<hybrid::minimal_storage_limit>())},
-        {"sellp", create_matrix_type<gko::matrix::Sellp<etype, itype>>()}
+        {"deltacsr", create_matrix_type<gko::matrix::DeltaCsr<etype, itype>>()},
+        {"reducedcsr",
+         create_matrix_type<gko::matrix::ReducedCsr<etype, itype>>()},
+        {"symcsr",
+         create_matrix_type<gko::matrix::SymmetricCsr<etype, itype>>()},
+        {"vbcsr", create_matrix_type<gko::matrix::Vbcsr<etype, itype>>()},
+        {"sellp", create_matrix_type<gko::matrix::Sellp<etype, itype>>()},
+        {"sellcs", create_matrix_type<gko::matrix::Sellp<etype, itype>>(
+                       gko::dim<2>{},
+                       gko::matrix::Sellp<etype, itype>::simd_slice_size(), 1,
+                       256, 0)}
 };
 // clang-format on
 
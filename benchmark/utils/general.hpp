@@ -106,6 +106,26 @@ DEFINE_double(
     "is lower than or equal to 1, the timing region is always 1 repetition.");
 
 
+DEFINE_string(
+    scaling_threads, "",
+    "A comma-separated list of OpenMP thread counts, e.g. 1,2,4,8. If set, "
+    "all test cases are rerun for each thread count and binding policy, and "
+    "the parallel efficiency relative to the first thread count is reported. "
+    "Requires the OMP executor.");
+
+DEFINE_string(
+    scaling_binding, "none",
+    "A comma-separated list of binding policies used with --scaling_threads. "
+    "Supported values are: none (no binding), compact (bind to the first "
+    "cores, filling one NUMA node after another) and spread (distribute the "
+    "cores round-robin over the NUMA nodes). Binding requires hwloc.");
+
+DEFINE_string(scaling_mode, "strong",
+              "The kind of scaling study run by --scaling_threads. Supported "
+              "values are: strong (fixed problem size) and weak (the size or n "
+              "of generated test cases grows with the thread count)");
+
+
 std::unique_ptr<std::istream> input_stream;
 
 
@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <ginkgo/ginkgo.hpp>
 
@@ -148,6 +149,21 @@ public:
 
     IndexType get_num_repetitions() const { return status_run_.cur_it; }
 
+    /**
+     * Returns the time of each repetition of the timed run in seconds. If
+     * multiple repetitions were timed together, each of them gets their
+     * average time.
+     */
+    std::vector<double> get_time_detail() const
+    {
+        if (status_run_.managed_timer.timer->get_num_repetitions() ==
+            this->get_num_repetitions()) {
+            return status_run_.managed_timer.timer->get_time_detail();
+        }
+        return std::vector<double>(this->get_num_repetitions(),
+                                   this->compute_time());
+    }
+
 private:
     struct TimerManager {
         std::shared_ptr<Timer> timer;
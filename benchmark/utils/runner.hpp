@@ -13,6 +13,7 @@
 #include <ginkgo/ginkgo.hpp>
 
 #include "benchmark/utils/general.hpp"
+#include "benchmark/utils/scaling.hpp"
 
 
 std::shared_ptr<gko::log::ProfilerHook> create_profiler_hook(
@@ -78,13 +79,23 @@ struct Benchmark {
 
     /** Post-process test case info. */
     virtual void postprocess(json& test_case) const {}
+
+    /**
+     * The number of bytes an operation needs to read and write at least, used
+     * to compute the achieved bandwidth in scaling sweeps. Zero if unknown.
+     */
+    virtual double get_memory_traffic(const json& test_case,
+                                      const std::string& operation) const
+    {
+        return 0.0;
+    }
 };
 
 
 template <typename State>
-void run_test_cases(const Benchmark<State>& benchmark,
-                    std::shared_ptr<gko::Executor> exec,
-                    std::shared_ptr<Timer> timer, json& test_cases)
+void run_test_cases_once(const Benchmark<State>& benchmark,
+                         std::shared_ptr<gko::Executor> exec,
+                         std::shared_ptr<Timer> timer, json& test_cases)
 {
     if (!test_cases.is_array()) {
         if (benchmark.should_print()) {
@@ -170,4 +181,134 @@ void run_test_cases(const Benchmark<State>& benchmark,
 }
 
 
+/**
+ * Adds the speedup, parallel efficiency and bandwidth of each operation of a
+ * test case run in a scaling sweep, relative to the baseline run.
+ */
+template <typename State>
+void write_scaling_results(const Benchmark<State>& benchmark,
+                           json& test_case, const json& baseline,
+                           int num_threads, int base_threads)
+{
+    const auto& name = benchmark.get_name();
+    if (!test_case.contains(name) || !baseline.contains(name)) {
+        return;
+    }
+    for (auto& operation : test_case[name].items()) {
+        if (!baseline[name].contains(operation.key())) {
+            continue;
+        }
+        const auto time = get_operation_time(operation.value());
+        const auto base_time =
+            get_operation_time(baseline[name][operation.key()]);
+        if (time <= 0.0 || base_time <= 0.0) {
+            continue;
+        }
+        auto scaling = json::object();
+        const auto speedup = base_time / time;
+        if (FLAGS_scaling_mode == "strong") {
+            scaling["speedup"] = speedup;
+            scaling["parallel_efficiency"] =
+                speedup * base_threads / num_threads;
+        } else {
+            // the work per thread is constant
+            scaling["parallel_efficiency"] = speedup;
+        }
+        if (operation.value().contains("bandwidth")) {
+            scaling["bandwidth"] = operation.value()["bandwidth"];
+        } else {
+            const auto traffic =
+                benchmark.get_memory_traffic(test_case, operation.key());
+            if (traffic > 0.0) {
+                scaling["bandwidth"] = traffic / time;
+            }
+        }
+        operation.value()["scaling"] = scaling;
+    }
+}
+
+
+/**
+ * Runs all test cases once for each thread count and binding policy of the
+ * --scaling_threads sweep. The results contain a copy of each test case per
+ * configuration, annotated with its thread count and binding.
+ */
+template <typename State>
+void run_scaling_sweep(const Benchmark<State>& benchmark,
+                       std::shared_ptr<gko::Executor> exec,
+                       std::shared_ptr<Timer> timer, json& test_cases)
+{
+    if (!std::dynamic_pointer_cast<const gko::OmpExecutor>(exec) ||
+        (FLAGS_scaling_mode != "strong" && FLAGS_scaling_mode != "weak")) {
+        if (benchmark.should_print()) {
+            std::cerr << "Scaling sweeps require the OMP executor and a "
+                         "scaling mode of strong or weak"
+                      << std::endl;
+        }
+        std::exit(1);
+    }
+    const auto configs = get_scaling_configs();
+    const auto initial_threads = get_num_threads();
+    // runs with the same binding policy are consecutive
+    const auto num_thread_counts =
+        static_cast<std::size_t>(split(FLAGS_scaling_threads).size());
+    std::vector<json> runs;
+    for (const auto& config : configs) {
+        set_num_threads(config.num_threads);
+        const auto cores = bind_process(config);
+        const auto base_threads =
+            configs[runs.size() - runs.size() % num_thread_counts].num_threads;
+        if (benchmark.should_print()) {
+            std::clog << "Running with " << config.num_threads
+                      << " threads and binding " << config.binding
+                      << std::endl;
+        }
+        auto run = test_cases;
+        if (run.is_array()) {
+            for (auto& test_case : run) {
+                test_case["threads"] = config.num_threads;
+                test_case["binding"] = config.binding;
+                if (!cores.empty()) {
+                    test_case["cores"] = cores;
+                }
+                if (FLAGS_scaling_mode == "weak") {
+                    scale_test_case(test_case, config.num_threads,
+                                    base_threads);
+                }
+            }
+        }
+        run_test_cases_once(benchmark, exec, timer, run);
+        runs.push_back(std::move(run));
+    }
+    set_num_threads(initial_threads);
+    bind_process({initial_threads, "none"});
+
+    auto results = json::array();
+    for (std::size_t i = 0; i < runs.size(); i++) {
+        const auto baseline_run = i - i % num_thread_counts;
+        for (std::size_t j = 0; j < runs[i].size(); j++) {
+            write_scaling_results(benchmark, runs[i][j],
+                                  runs[baseline_run][j],
+                                  configs[i].num_threads,
+                                  configs[baseline_run].num_threads);
+            results.push_back(runs[i][j]);
+        }
+    }
+    test_cases = std::move(results);
+}
+
+
+template <typename State>
+void run_test_cases(const Benchmark<State>& benchmark,
+                    std::shared_ptr<gko::Executor> exec,
+                    std::shared_ptr<Timer> timer, json& test_cases)
+{
+    if (FLAGS_scaling_threads.empty()) {
+        run_test_cases_once(benchmark, exec, timer, test_cases);
+    } else {
+        run_scaling_sweep(benchmark, exec, timer, test_cases);
+    }
+}
+
+
 #endif  // GKO_BENCHMARK_UTILS_RUNNER_HPP_
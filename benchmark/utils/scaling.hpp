@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_BENCHMARK_UTILS_SCALING_HPP_
+#define GKO_BENCHMARK_UTILS_SCALING_HPP_
+
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <ginkgo/ginkgo.hpp>
+
+#include "benchmark/utils/general.hpp"
+
+
+/** A single configuration of a --scaling_threads sweep. */
+struct scaling_config {
+    int num_threads;
+    std::string binding;
+};
+
+
+/**
+ * Returns the configurations of the scaling sweep, ordered by binding policy
+ * and then by thread count, so the first configuration of each binding policy
+ * is the baseline for the parallel efficiency.
+ */
+std::vector<scaling_config> get_scaling_configs()
+{
+    std::vector<int> threads;
+    for (const auto& token : split(FLAGS_scaling_threads)) {
+        const auto num_threads = std::stoi(token);
+        if (num_threads <= 0) {
+            throw std::invalid_argument("Invalid thread count " + token);
+        }
+        threads.push_back(num_threads);
+    }
+    std::vector<scaling_config> result;
+    for (const auto& binding : split(FLAGS_scaling_binding)) {
+        if (binding != "none" && binding != "compact" && binding != "spread") {
+            throw std::invalid_argument("Unknown binding policy " + binding);
+        }
+        for (auto num_threads : threads) {
+            result.push_back({num_threads, binding});
+        }
+    }
+    if (result.empty()) {
+        throw std::invalid_argument(
+            "The scaling sweep needs at least one thread count and binding "
+            "policy");
+    }
+    return result;
+}
+
+
+/** Returns the number of threads used by OpenMP parallel regions. */
+int get_num_threads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+
+/** Sets the number of threads used by OpenMP parallel regions. */
+void set_num_threads(int num_threads)
+{
+#ifdef _OPENMP
+    omp_set_num_threads(num_threads);
+#else
+    if (num_threads != 1) {
+        throw std::runtime_error(
+            "Setting the number of threads requires Ginkgo to be built with "
+            "OpenMP");
+    }
+#endif
+}
+
+
+/**
+ * Binds the process according to the binding policy of the configuration.
+ *
+ * @return the ids of the cores the process was bound to, or an empty vector
+ *         if it is not bound.
+ */
+std::vector<int> bind_process(const scaling_config& config)
+{
+    const auto topology = gko::machine_topology::get_instance();
+    const auto num_cores = static_cast<int>(topology->get_num_cores());
+    std::vector<int> cores;
+    if (config.binding == "none") {
+        // undo the binding of previous configurations
+        std::vector<int> pus(topology->get_num_pus());
+        std::iota(pus.begin(), pus.end(), 0);
+        if (!pus.empty()) {
+            topology->bind_to_pus(pus, false);
+        }
+        return cores;
+    }
+    if (num_cores == 0) {
+        throw std::runtime_error(
+            "Binding the process requires Ginkgo to be built with hwloc");
+    }
+    const auto num_bound = std::min(config.num_threads, num_cores);
+    if (config.binding == "compact") {
+        // logical core ids are ordered by proximity
+        for (int core = 0; core < num_bound; core++) {
+            cores.push_back(core);
+        }
+    } else {
+        std::map<int, std::vector<int>> numa_cores;
+        for (int core = 0; core < num_cores; core++) {
+            numa_cores[topology->get_core(core)->numa].push_back(core);
+        }
+        for (std::size_t i = 0; static_cast<int>(cores.size()) < num_bound;
+             i++) {
+            for (const auto& numa : numa_cores) {
+                if (i < numa.second.size() &&
+                    static_cast<int>(cores.size()) < num_bound) {
+                    cores.push_back(numa.second[i]);
+                }
+            }
+        }
+    }
+    topology->bind_to_cores(cores, false);
+    return cores;
+}
+
+
+/**
+ * Scales the problem size of a generated test case for weak scaling, i.e.
+ * multiplies its size or n by `num_threads / base_threads`.
+ */
+void scale_test_case(json& test_case, int num_threads, int base_threads)
+{
+    for (const auto key : {"size", "n"}) {
+        if (test_case.contains(key) && test_case[key].is_number_integer()) {
+            test_case[key] =
+                test_case[key].get<gko::int64>() * num_threads / base_threads;
+            return;
+        }
+    }
+}
+
+
+/**
+ * Returns the runtime of an operation, which is either its time or the time
+ * of its apply stage, or a negative value if the operation has no runtime.
+ */
+double get_operation_time(const json& operation_case)
+{
+    if (operation_case.contains("time") && operation_case["time"].is_number()) {
+        return operation_case["time"].get<double>();
+    }
+    if (operation_case.contains("apply") &&
+        operation_case["apply"].contains("time") &&
+        operation_case["apply"]["time"].is_number()) {
+        return operation_case["apply"]["time"].get<double>();
+    }
+    return -1.0;
+}
+
+
+#endif  // GKO_BENCHMARK_UTILS_SCALING_HPP_
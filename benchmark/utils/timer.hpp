@@ -26,6 +26,12 @@ DEFINE_string(
     "average, median, min, max. Note. If repetition_growth_factor > 1, the "
     "overhead operations may be different among repetitions");
 
+DEFINE_bool(record_times, false,
+            "Additionally write the time of each repetition as \"times\", "
+            "e.g. for the confidence intervals of benchmark/tools/"
+            "regression.py. Each repetition is only timed separately if "
+            "repetition_growth_factor is 1");
+
 
 /**
  * Get the timer. If the executor does not support gpu timer, still return the
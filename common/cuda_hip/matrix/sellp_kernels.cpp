@@ -37,9 +37,9 @@ template <typename ValueType, typename IndexType>
 __global__ __launch_bounds__(default_block_size) void spmv_kernel(
     size_type num_rows, size_type num_right_hand_sides, size_type b_stride,
     size_type c_stride, size_type slice_size,
-    const size_type* __restrict__ slice_sets, const ValueType* __restrict__ a,
-    const IndexType* __restrict__ cols, const ValueType* __restrict__ b,
-    ValueType* __restrict__ c)
+    const size_type* __restrict__ slice_sets, const IndexType* __restrict__ perm,
+    const ValueType* __restrict__ a, const IndexType* __restrict__ cols,
+    const ValueType* __restrict__ b, ValueType* __restrict__ c)
 {
     const auto row = thread::get_thread_id_flat();
     const auto slice_id = row / slice_size;
@@ -54,7 +54,8 @@ __global__ __launch_bounds__(default_block_size) void spmv_kernel(
                 val += a[ind] * b[col * b_stride + column_id];
             }
         }
-        c[row * c_stride + column_id] = val;
+        const auto out_row = perm ? perm[row] : row;
+        c[out_row * c_stride + column_id] = val;
     }
 }
 
@@ -63,7 +64,7 @@ template <typename ValueType, typename IndexType>
 __global__ __launch_bounds__(default_block_size) void advanced_spmv_kernel(
     size_type num_rows, size_type num_right_hand_sides, size_type b_stride,
     size_type c_stride, size_type slice_size,
-    const size_type* __restrict__ slice_sets,
+    const size_type* __restrict__ slice_sets, const IndexType* __restrict__ perm,
     const ValueType* __restrict__ alpha, const ValueType* __restrict__ a,
     const IndexType* __restrict__ cols, const ValueType* __restrict__ b,
     const ValueType* __restrict__ beta, ValueType* __restrict__ c)
@@ -81,8 +82,9 @@ __global__ __launch_bounds__(default_block_size) void advanced_spmv_kernel(
                 val += a[ind] * b[col * b_stride + column_id];
             }
         }
-        c[row * c_stride + column_id] =
-            beta[0] * c[row * c_stride + column_id] + alpha[0] * val;
+        const auto out_row = perm ? perm[row] : row;
+        c[out_row * c_stride + column_id] =
+            beta[0] * c[out_row * c_stride + column_id] + alpha[0] * val;
     }
 }
 
@@ -99,8 +101,8 @@ void spmv(std::shared_ptr<const DefaultExecutor> exec,
         spmv_kernel<<<grid, block_size, 0, exec->get_stream()>>>(
             a->get_size()[0], b->get_size()[1], b->get_stride(),
             c->get_stride(), a->get_slice_size(), a->get_const_slice_sets(),
-            as_device_type(a->get_const_values()), a->get_const_col_idxs(),
-            as_device_type(b->get_const_values()),
+            a->get_const_permutation(), as_device_type(a->get_const_values()),
+            a->get_const_col_idxs(), as_device_type(b->get_const_values()),
             as_device_type(c->get_values()));
     }
 }
@@ -123,6 +125,7 @@ void advanced_spmv(std::shared_ptr<const DefaultExecutor> exec,
         advanced_spmv_kernel<<<grid, block_size, 0, exec->get_stream()>>>(
             a->get_size()[0], b->get_size()[1], b->get_stride(),
             c->get_stride(), a->get_slice_size(), a->get_const_slice_sets(),
+            a->get_const_permutation(),
             as_device_type(alpha->get_const_values()),
             as_device_type(a->get_const_values()), a->get_const_col_idxs(),
             as_device_type(b->get_const_values()),
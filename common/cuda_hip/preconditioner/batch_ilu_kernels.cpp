@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+namespace batch_ilu {
+
+
+template <typename ValueType, typename IndexType>
+void generate_common_pattern(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const gko::matrix::Csr<ValueType, IndexType>* first_sys_csr,
+    IndexType* diag_locs, array<IndexType>& update_ptrs,
+    array<IndexType>& update_src,
+    array<IndexType>& update_dst) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_GENERATE_COMMON_PATTERN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_factors(std::shared_ptr<const DefaultExecutor> exec,
+                     const batch::matrix::Csr<ValueType, IndexType>* sys_csr,
+                     const IndexType* diag_locs, const IndexType* update_ptrs,
+                     const IndexType* update_src, const IndexType* update_dst,
+                     ValueType* factors) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_COMPUTE_FACTORS_KERNEL);
+
+
+}  // namespace batch_ilu
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/batch_gmres_kernels.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+#include "core/base/batch_instantiation.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+namespace batch_gmres {
+
+
+template <typename ValueType, typename BatchMatrixType, typename PrecType>
+void apply(std::shared_ptr<const DefaultExecutor> exec,
+           const gko::kernels::batch_gmres::settings<remove_complex<ValueType>>&
+               settings,
+           const BatchMatrixType* mat, const PrecType* precond,
+           const batch::MultiVector<ValueType>* b,
+           batch::MultiVector<ValueType>* x,
+           batch::log::detail::log_data<remove_complex<ValueType>>& logdata)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_BATCH_VALUE_MATRIX_PRECONDITIONER_BASE(
+    GKO_DECLARE_BATCH_GMRES_APPLY_KERNEL_WRAPPER);
+
+
+}  // namespace batch_gmres
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
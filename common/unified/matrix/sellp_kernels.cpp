@@ -98,25 +98,26 @@ void fill_in_dense(std::shared_ptr<const DefaultExecutor> exec,
 {
     run_kernel(
         exec,
-        [] GKO_KERNEL(auto row, auto slice_size, auto slice_sets, auto cols,
-                      auto values, auto result) {
+        [] GKO_KERNEL(auto row, auto slice_size, auto slice_sets, auto perm,
+                      auto cols, auto values, auto result) {
             const auto slice = row / slice_size;
             const auto local_row = row % slice_size;
             const auto slice_begin = slice_sets[slice];
             const auto slice_end = slice_sets[slice + 1];
             const auto slice_length = slice_end - slice_begin;
+            const auto out_row = perm ? perm[row] : row;
             auto in_idx = slice_begin * slice_size + local_row;
             for (int64 i = 0; i < slice_length; i++) {
                 const auto col = cols[in_idx];
                 if (col != invalid_index<IndexType>()) {
-                    result(row, cols[in_idx]) = values[in_idx];
+                    result(out_row, cols[in_idx]) = values[in_idx];
                 }
                 in_idx += slice_size;
             }
         },
         source->get_size()[0], source->get_slice_size(),
-        source->get_const_slice_sets(), source->get_const_col_idxs(),
-        source->get_const_values(), result);
+        source->get_const_slice_sets(), source->get_const_permutation(),
+        source->get_const_col_idxs(), source->get_const_values(), result);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -130,8 +131,8 @@ void count_nonzeros_per_row(std::shared_ptr<const DefaultExecutor> exec,
 {
     run_kernel(
         exec,
-        [] GKO_KERNEL(auto row, auto slice_size, auto slice_sets, auto cols,
-                      auto result) {
+        [] GKO_KERNEL(auto row, auto slice_size, auto slice_sets, auto perm,
+                      auto cols, auto result) {
             const auto slice = row / slice_size;
             const auto local_row = row % slice_size;
             const auto slice_begin = slice_sets[slice];
@@ -143,10 +144,11 @@ void count_nonzeros_per_row(std::shared_ptr<const DefaultExecutor> exec,
                 row_nnz += cols[in_idx] != invalid_index<IndexType>() ? 1 : 0;
                 in_idx += slice_size;
             }
-            result[row] = row_nnz;
+            result[perm ? perm[row] : row] = row_nnz;
         },
         source->get_size()[0], source->get_slice_size(),
-        source->get_const_slice_sets(), source->get_const_col_idxs(), result);
+        source->get_const_slice_sets(), source->get_const_permutation(),
+        source->get_const_col_idxs(), result);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -160,11 +162,12 @@ void convert_to_csr(std::shared_ptr<const DefaultExecutor> exec,
 {
     run_kernel(
         exec,
-        [] GKO_KERNEL(auto row, auto slice_size, auto slice_sets, auto cols,
-                      auto values, auto out_row_ptrs, auto out_cols,
-                      auto out_vals) {
-            const auto row_begin = out_row_ptrs[row];
-            const auto row_end = out_row_ptrs[row + 1];
+        [] GKO_KERNEL(auto row, auto slice_size, auto slice_sets, auto perm,
+                      auto cols, auto values, auto out_row_ptrs,
+                      auto out_cols, auto out_vals) {
+            const auto out_row = perm ? perm[row] : row;
+            const auto row_begin = out_row_ptrs[out_row];
+            const auto row_end = out_row_ptrs[out_row + 1];
             const auto slice = row / slice_size;
             const auto local_row = row % slice_size;
             const auto slice_begin = slice_sets[slice];
@@ -178,8 +181,9 @@ void convert_to_csr(std::shared_ptr<const DefaultExecutor> exec,
             }
         },
         source->get_size()[0], source->get_slice_size(),
-        source->get_const_slice_sets(), source->get_const_col_idxs(),
-        source->get_const_values(), result->get_row_ptrs(),
+        source->get_const_slice_sets(), source->get_const_permutation(),
+        source->get_const_col_idxs(), source->get_const_values(),
+        result->get_row_ptrs(),
         result->get_col_idxs(), result->get_values());
 }
 
@@ -194,25 +198,27 @@ void extract_diagonal(std::shared_ptr<const DefaultExecutor> exec,
 {
     run_kernel(
         exec,
-        [] GKO_KERNEL(auto row, auto slice_size, auto slice_sets, auto cols,
-                      auto values, auto diag) {
+        [] GKO_KERNEL(auto row, auto slice_size, auto slice_sets, auto perm,
+                      auto cols, auto values, auto diag) {
             const auto slice = row / slice_size;
             const auto local_row = row % slice_size;
             const auto slice_begin = slice_sets[slice];
             const auto slice_end = slice_sets[slice + 1];
             const auto slice_length = slice_end - slice_begin;
+            const auto out_row = perm ? perm[row] : row;
             auto in_idx = slice_begin * slice_size + local_row;
             for (int64 i = 0; i < slice_length; i++) {
-                if (row == cols[in_idx]) {
-                    diag[row] = values[in_idx];
+                if (out_row == cols[in_idx]) {
+                    diag[out_row] = values[in_idx];
                     break;
                 }
                 in_idx += slice_size;
             }
         },
         orig->get_size()[0], orig->get_slice_size(),
-        orig->get_const_slice_sets(), orig->get_const_col_idxs(),
-        orig->get_const_values(), diag->get_values());
+        orig->get_const_slice_sets(), orig->get_const_permutation(),
+        orig->get_const_col_idxs(), orig->get_const_values(),
+        diag->get_values());
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
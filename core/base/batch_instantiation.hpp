@@ -10,6 +10,8 @@
 #include <ginkgo/core/matrix/batch_dense.hpp>
 #include <ginkgo/core/matrix/batch_ell.hpp>
 #include <ginkgo/core/matrix/batch_identity.hpp>
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
 #include <ginkgo/core/preconditioner/batch_jacobi.hpp>
 
 
@@ -20,9 +22,11 @@ namespace batch {
 // just make the call list more consistent
 #define GKO_CALL(_macro, ...) GKO_INDIRECT(_macro(__VA_ARGS__))
 
-#define GKO_BATCH_INSTANTIATE_PRECONDITIONER(_next, ...)            \
-    GKO_INDIRECT(_next(__VA_ARGS__, gko::batch::matrix::Identity)); \
-    GKO_INDIRECT(_next(__VA_ARGS__, gko::batch::preconditioner::Jacobi))
+#define GKO_BATCH_INSTANTIATE_PRECONDITIONER(_next, ...)                  \
+    GKO_INDIRECT(_next(__VA_ARGS__, gko::batch::matrix::Identity));       \
+    GKO_INDIRECT(_next(__VA_ARGS__, gko::batch::preconditioner::Jacobi)); \
+    GKO_INDIRECT(_next(__VA_ARGS__, gko::batch::preconditioner::Ilu));    \
+    GKO_INDIRECT(_next(__VA_ARGS__, gko::batch::preconditioner::Isai))
 
 #define GKO_BATCH_INSTANTIATE_MATRIX(_next, ...)                 \
     GKO_INDIRECT(_next(__VA_ARGS__, gko::batch::matrix::Ell));   \
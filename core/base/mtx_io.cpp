@@ -5,18 +5,36 @@
 #include "ginkgo/core/base/mtx_io.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <charconv>
+#include <cstdlib>
 #include <cstring>
+#include <exception>
+#include <fstream>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <regex>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <ginkgo/core/base/device_matrix_data.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/half.hpp>
 #include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 
 
 namespace gko {
@@ -39,6 +57,134 @@ namespace {
 constexpr auto max_streamsize = std::numeric_limits<std::streamsize>::max();
 
 
+/**
+ * Returns the position of the first character in [it, end) which is neither a
+ * space nor a tab.
+ */
+inline const char* skip_blanks(const char* it, const char* end)
+{
+    while (it < end && (*it == ' ' || *it == '\t')) {
+        ++it;
+    }
+    return it;
+}
+
+
+/**
+ * Returns true if the line [begin, end) contains only whitespace.
+ */
+inline bool is_blank_line(const char* begin, const char* end)
+{
+    return std::all_of(begin, end, [](unsigned char c) {
+        return std::isspace(c) != 0;
+    });
+}
+
+
+/**
+ * Parses an integer at the start of [it, end), skipping leading blanks.
+ *
+ * @return the position after the number, or nullptr if parsing failed.
+ */
+template <typename IntegerType>
+const char* parse_integer(const char* it, const char* end, IntegerType& value)
+{
+    it = skip_blanks(it, end);
+    if (it < end && *it == '+') {
+        ++it;
+    }
+    const auto result = std::from_chars(it, end, value);
+    return result.ec == std::errc{} ? result.ptr : nullptr;
+}
+
+
+/**
+ * Parses a floating point number at the start of [it, end), skipping leading
+ * blanks. If the standard library has no floating point std::from_chars,
+ * std::strtod is used instead, which requires the input to be followed by a
+ * whitespace or null character.
+ *
+ * @return the position after the number, or nullptr if parsing failed.
+ */
+inline const char* parse_double(const char* it, const char* end, double& value)
+{
+    it = skip_blanks(it, end);
+    if (it < end && *it == '+') {
+        ++it;
+    }
+    if (it == end) {
+        return nullptr;
+    }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const auto result = std::from_chars(it, end, value);
+    return result.ec == std::errc{} ? result.ptr : nullptr;
+#else
+    char* result{};
+    value = std::strtod(it, &result);
+    return result == it ? nullptr : result;
+#endif
+}
+
+
+/**
+ * Calls fn(chunk) for all chunks in [0, num_chunks) on a set of threads. An
+ * exception thrown by any of the calls is rethrown on the calling thread.
+ */
+template <typename Callable>
+void run_parallel(size_type num_chunks, Callable&& fn)
+{
+    const auto num_threads = std::min<size_type>(
+        num_chunks, std::max(std::thread::hardware_concurrency(), 1u));
+    std::vector<std::exception_ptr> errors(num_threads);
+    auto worker = [&](size_type thread_id) {
+        try {
+            for (auto chunk = thread_id; chunk < num_chunks;
+                 chunk += num_threads) {
+                fn(chunk);
+            }
+        } catch (...) {
+            errors[thread_id] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_type thread_id = 1; thread_id < num_threads; thread_id++) {
+        threads.emplace_back(worker, thread_id);
+    }
+    if (num_threads > 0) {
+        worker(0);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+
+/**
+ * Calls fn(line_begin, line_end) for every line in [begin, end) that contains
+ * anything but whitespace. line_end points to the terminating newline or end.
+ */
+template <typename Callable>
+void for_each_line(const char* begin, const char* end, Callable&& fn)
+{
+    for (auto it = begin; it < end;) {
+        auto line_end =
+            static_cast<const char*>(std::memchr(it, '\n', end - it));
+        if (!line_end) {
+            line_end = end;
+        }
+        if (!is_blank_line(it, line_end)) {
+            fn(it, line_end);
+        }
+        it = line_end + 1;
+    }
+}
+
+
 /**
  * The mtx_io class provides the functionality of reading and writing matrix
  * market format files.
@@ -76,6 +222,46 @@ public:
         return data;
     }
 
+    /**
+     * Reads a matrix from a stream into device_matrix_data on the given
+     * executor. The entries of coordinate matrices are parsed in parallel,
+     * directly into the arrays of the result, and sorted on the executor.
+     *
+     * @param is  the input stream.
+     * @param exec  the executor to store the matrix data on.
+     *
+     * @return the matrix data.
+     */
+    device_matrix_data<ValueType, IndexType> read_parallel(
+        std::istream& is, std::shared_ptr<const Executor> exec) const
+    {
+        auto parsed_header = this->read_header(is);
+        std::istringstream dimensions_stream(parsed_header.dimensions_line);
+        if (parsed_header.layout != &coordinate_layout) {
+            auto data = parsed_header.layout->read_data(
+                dimensions_stream, is, parsed_header.entry,
+                parsed_header.modifier);
+            auto result = device_matrix_data<ValueType, IndexType>::
+                create_from_host(exec, data);
+            result.sort_row_major();
+            return result;
+        }
+        size_type num_rows{};
+        size_type num_cols{};
+        size_type num_nonzeros{};
+        GKO_CHECK_STREAM(
+            dimensions_stream >> num_rows >> num_cols >> num_nonzeros,
+            "error when determining matrix size, expected: rows cols nnz");
+        auto data = parse_coordinates(
+            exec->get_master(), dim<2>{num_rows, num_cols}, num_nonzeros, is,
+            parsed_header.entry, parsed_header.modifier);
+        if (exec != exec->get_master()) {
+            data = device_matrix_data<ValueType, IndexType>(exec, data);
+        }
+        data.sort_row_major();
+        return data;
+    }
+
     /**
      * Writes a matrix to a stream.
      *
@@ -101,6 +287,12 @@ private:
      */
     struct entry_format {
         virtual ValueType read_entry(std::istream& is) const = 0;
+        /**
+         * parses an entry at the start of [begin, end), returns the position
+         * after it or nullptr if the entry could not be parsed
+         */
+        virtual const char* parse_entry(const char* begin, const char* end,
+                                        ValueType& value) const = 0;
         virtual void write_entry(std::ostream& os,
                                  const ValueType& value) const = 0;
     };
@@ -128,6 +320,24 @@ private:
             return static_cast<ValueType>(result);
         }
 
+        /**
+         * parses entry from a character range
+         *
+         * @param begin  the start of the range
+         * @param end  the end of the range
+         * @param value  the parsed matrix entry
+         *
+         * @return the position after the entry, or nullptr on failure
+         */
+        const char* parse_entry(const char* begin, const char* end,
+                                ValueType& value) const override
+        {
+            double result{};
+            const auto pos = parse_double(begin, end, result);
+            value = static_cast<ValueType>(result);
+            return pos;
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -175,6 +385,21 @@ private:
             return read_entry_impl<ValueType>(is);
         }
 
+        /**
+         * parses entry from a character range
+         *
+         * @param begin  the start of the range
+         * @param end  the end of the range
+         * @param value  the parsed matrix entry
+         *
+         * @return the position after the entry, or nullptr on failure
+         */
+        const char* parse_entry(const char* begin, const char* end,
+                                ValueType& value) const override
+        {
+            return parse_entry_impl(begin, end, value);
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -210,6 +435,28 @@ private:
                 "trying to read a complex matrix into a real storage type");
         }
 
+        template <typename T>
+        static std::enable_if_t<is_complex_s<T>::value, const char*>
+        parse_entry_impl(const char* begin, const char* end, T& value)
+        {
+            using real_type = remove_complex<T>;
+            double real{};
+            double imag{};
+            auto pos = parse_double(begin, end, real);
+            pos = pos ? parse_double(pos, end, imag) : nullptr;
+            value = {static_cast<real_type>(real),
+                     static_cast<real_type>(imag)};
+            return pos;
+        }
+
+        template <typename T>
+        static std::enable_if_t<!is_complex_s<T>::value, const char*>
+        parse_entry_impl(const char*, const char*, T&)
+        {
+            throw GKO_STREAM_ERROR(
+                "trying to read a complex matrix into a real storage type");
+        }
+
     } complex_format{};
 
     /**
@@ -228,6 +475,22 @@ private:
             return one<ValueType>();
         }
 
+        /**
+         * parses entry from a character range
+         *
+         * @param begin  the start of the range
+         * @param dummy end of the range
+         * @param value  the matrix entry(one)
+         *
+         * @return the start of the range
+         */
+        const char* parse_entry(const char* begin, const char*,
+                                ValueType& value) const override
+        {
+            value = one<ValueType>();
+            return begin;
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -254,6 +517,18 @@ private:
             matrix_data<ValueType, IndexType>& data) const = 0;
 
         virtual size_type get_row_start(size_type col) const = 0;
+
+        /**
+         * returns true if off-diagonal entries are inserted a second time at
+         * the transposed position
+         */
+        virtual bool is_mirrored() const = 0;
+
+        /**
+         * returns the value inserted at the transposed position of an
+         * off-diagonal entry
+         */
+        virtual ValueType mirror_entry(const ValueType& entry) const = 0;
     };
 
     /**
@@ -299,6 +574,19 @@ private:
          * Get the start of the rows
          */
         size_type get_row_start(size_type) const override { return 0; }
+
+        /**
+         * Whether off-diagonal entries are mirrored
+         */
+        bool is_mirrored() const override { return false; }
+
+        /**
+         * Get the value of a mirrored entry
+         */
+        ValueType mirror_entry(const ValueType& entry) const override
+        {
+            return entry;
+        }
     } general_modifier{};
 
     /**
@@ -343,6 +631,19 @@ private:
          * Get the start of the rows
          */
         size_type get_row_start(size_type col) const override { return col; }
+
+        /**
+         * Whether off-diagonal entries are mirrored
+         */
+        bool is_mirrored() const override { return true; }
+
+        /**
+         * Get the value of a mirrored entry
+         */
+        ValueType mirror_entry(const ValueType& entry) const override
+        {
+            return entry;
+        }
     } symmetric_modifier{};
 
     /**
@@ -391,6 +692,19 @@ private:
         {
             return col + 1;
         }
+
+        /**
+         * Whether off-diagonal entries are mirrored
+         */
+        bool is_mirrored() const override { return true; }
+
+        /**
+         * Get the value of a mirrored entry
+         */
+        ValueType mirror_entry(const ValueType& entry) const override
+        {
+            return -entry;
+        }
     } skew_symmetric_modifier{};
 
     /**
@@ -436,6 +750,19 @@ private:
          * Get the start of the rows
          */
         size_type get_row_start(size_type col) const override { return col; }
+
+        /**
+         * Whether off-diagonal entries are mirrored
+         */
+        bool is_mirrored() const override { return true; }
+
+        /**
+         * Get the value of a mirrored entry
+         */
+        ValueType mirror_entry(const ValueType& entry) const override
+        {
+            return conj(entry);
+        }
     } hermitian_modifier{};
 
 
@@ -652,6 +979,214 @@ private:
                      {"coordinate", &coordinate_layout}}
     {}
 
+    /**
+     * parses the entries of a coordinate matrix from the stream. The stream
+     * is read in blocks of bounded size, so the text of the file is never held
+     * in memory as a whole. Every block is parsed in parallel directly into the
+     * final positions of its entries in the output arrays, an incomplete line
+     * at its end is carried over to the next block. Mirrored entries are
+     * appended after all entries have been read.
+     *
+     * @param exec  the host executor to store the data on
+     * @param size  the matrix size
+     * @param num_nonzeros  the number of stored entries
+     * @param is  the input stream, positioned after the dimensions line
+     * @param entry_reader  the entry format in the matrix file
+     * @param modifier  the storage modifier for the matrix file
+     *
+     * @return the (unsorted) matrix data
+     */
+    static device_matrix_data<ValueType, IndexType> parse_coordinates(
+        std::shared_ptr<const Executor> exec, dim<2> size,
+        size_type num_nonzeros, std::istream& is,
+        const entry_format* entry_reader, const storage_modifier* modifier)
+    {
+        constexpr size_type block_bytes = 1 << 24;
+        device_matrix_data<ValueType, IndexType> data{exec, size,
+                                                      num_nonzeros};
+        std::vector<char> buffer;
+        size_type num_entries{};
+        // size of the incomplete line at the start of the buffer
+        size_type carry{};
+        bool at_end = false;
+        while (!at_end) {
+            buffer.resize(carry + block_bytes + 1);
+            is.read(buffer.data() + carry, block_bytes);
+            GKO_CHECK_MATCH(!is.bad(), "error when reading matrix entries");
+            at_end = !is;
+            const auto begin = buffer.data();
+            const auto end = begin + carry + is.gcount();
+            *end = '\0';
+            auto block_end = end;
+            if (!at_end) {
+                while (block_end > begin && block_end[-1] != '\n') {
+                    --block_end;
+                }
+            }
+            num_entries += parse_coordinate_block(begin, block_end,
+                                                  num_entries, entry_reader,
+                                                  data);
+            carry = static_cast<size_type>(end - block_end);
+            std::memmove(begin, block_end, carry);
+        }
+        if (num_entries < num_nonzeros) {
+            throw GKO_STREAM_ERROR(
+                "error when reading coordinates of matrix entry " +
+                std::to_string(num_entries));
+        }
+        if (modifier->is_mirrored()) {
+            data = add_mirrored_entries(std::move(data), modifier);
+        }
+        return data;
+    }
+
+    /**
+     * parses the lines in [begin, end) in parallel. The block is split at line
+     * boundaries into chunks, every non-empty line holds one entry. After
+     * counting the entries of every chunk, each chunk is parsed directly into
+     * the final position of its entries in the output arrays. Lines beyond
+     * the size of the output are counted, but not parsed.
+     *
+     * @param begin  the start of the block
+     * @param end  the end of the block, which must be followed by a null
+     *             character or be preceded by a newline
+     * @param first_entry  the index of the entry on the first line
+     * @param entry_reader  the entry format in the matrix file
+     * @param data  the output data
+     *
+     * @return the number of non-empty lines in the block
+     */
+    static size_type parse_coordinate_block(
+        const char* begin, const char* end, size_type first_entry,
+        const entry_format* entry_reader,
+        device_matrix_data<ValueType, IndexType>& data)
+    {
+        constexpr size_type min_chunk_bytes = 1 << 16;
+        const auto num_bytes = static_cast<size_type>(end - begin);
+        const auto num_chunks = std::max<size_type>(
+            std::min<size_type>(
+                4 * std::max(std::thread::hardware_concurrency(), 1u),
+                num_bytes / min_chunk_bytes),
+            1);
+        std::vector<const char*> bounds(num_chunks + 1, end);
+        bounds[0] = begin;
+        for (size_type chunk = 1; chunk < num_chunks; chunk++) {
+            const auto split = std::max(
+                begin + num_bytes * chunk / num_chunks, bounds[chunk - 1]);
+            const auto newline = static_cast<const char*>(
+                std::memchr(split, '\n', end - split));
+            bounds[chunk] = newline ? newline + 1 : end;
+        }
+        // index of the first entry of every chunk
+        std::vector<size_type> entry_offsets(num_chunks + 1);
+        run_parallel(num_chunks, [&](size_type chunk) {
+            size_type count{};
+            for_each_line(bounds[chunk], bounds[chunk + 1],
+                          [&](const char*, const char*) { count++; });
+            entry_offsets[chunk + 1] = count;
+        });
+        std::partial_sum(entry_offsets.begin(), entry_offsets.end(),
+                         entry_offsets.begin());
+        const auto num_nonzeros = data.get_num_stored_elements();
+        const auto row_idxs = data.get_row_idxs();
+        const auto col_idxs = data.get_col_idxs();
+        const auto values = data.get_values();
+        run_parallel(num_chunks, [&](size_type chunk) {
+            auto entry = first_entry + entry_offsets[chunk];
+            for_each_line(
+                bounds[chunk], bounds[chunk + 1],
+                [&](const char* line, const char* line_end) {
+                    if (entry >= num_nonzeros) {
+                        return;
+                    }
+                    IndexType row{};
+                    IndexType col{};
+                    ValueType value{};
+                    auto pos = parse_integer(line, line_end, row);
+                    pos = pos ? parse_integer(pos, line_end, col) : nullptr;
+                    if (!pos) {
+                        throw GKO_STREAM_ERROR(
+                            "error when reading coordinates of matrix entry " +
+                            std::to_string(entry));
+                    }
+                    if (!entry_reader->parse_entry(pos, line_end, value)) {
+                        throw GKO_STREAM_ERROR(
+                            "error when reading matrix entry " +
+                            std::to_string(entry));
+                    }
+                    row_idxs[entry] = row - 1;
+                    col_idxs[entry] = col - 1;
+                    values[entry] = value;
+                    entry++;
+                });
+        });
+        return entry_offsets.back();
+    }
+
+    /**
+     * returns the given entries followed by the mirrored counterparts of all
+     * off-diagonal entries, which are computed in parallel
+     *
+     * @param data  the entries read from the file
+     * @param modifier  the storage modifier for the matrix file
+     *
+     * @return the complete matrix data
+     */
+    static device_matrix_data<ValueType, IndexType> add_mirrored_entries(
+        device_matrix_data<ValueType, IndexType> data,
+        const storage_modifier* modifier)
+    {
+        constexpr size_type min_chunk_entries = 1 << 14;
+        const auto num_nonzeros = data.get_num_stored_elements();
+        const auto num_chunks = std::max<size_type>(
+            std::min<size_type>(
+                4 * std::max(std::thread::hardware_concurrency(), 1u),
+                num_nonzeros / min_chunk_entries),
+            1);
+        const auto chunk_begin = [&](size_type chunk) {
+            return num_nonzeros * chunk / num_chunks;
+        };
+        const auto row_idxs = data.get_const_row_idxs();
+        const auto col_idxs = data.get_const_col_idxs();
+        const auto values = data.get_const_values();
+        // index of the first mirrored entry of every chunk
+        std::vector<size_type> mirror_offsets(num_chunks + 1);
+        run_parallel(num_chunks, [&](size_type chunk) {
+            size_type count{};
+            for (auto entry = chunk_begin(chunk);
+                 entry < chunk_begin(chunk + 1); entry++) {
+                count += row_idxs[entry] != col_idxs[entry] ? 1 : 0;
+            }
+            mirror_offsets[chunk + 1] = count;
+        });
+        std::partial_sum(mirror_offsets.begin(), mirror_offsets.end(),
+                         mirror_offsets.begin());
+        device_matrix_data<ValueType, IndexType> result{
+            data.get_executor(), data.get_size(),
+            num_nonzeros + mirror_offsets.back()};
+        const auto out_row_idxs = result.get_row_idxs();
+        const auto out_col_idxs = result.get_col_idxs();
+        const auto out_values = result.get_values();
+        run_parallel(num_chunks, [&](size_type chunk) {
+            auto mirror = num_nonzeros + mirror_offsets[chunk];
+            for (auto entry = chunk_begin(chunk);
+                 entry < chunk_begin(chunk + 1); entry++) {
+                const auto row = row_idxs[entry];
+                const auto col = col_idxs[entry];
+                out_row_idxs[entry] = row;
+                out_col_idxs[entry] = col;
+                out_values[entry] = values[entry];
+                if (row != col) {
+                    out_row_idxs[mirror] = col;
+                    out_col_idxs[mirror] = row;
+                    out_values[mirror] = modifier->mirror_entry(values[entry]);
+                    mirror++;
+                }
+            }
+        });
+        return result;
+    }
+
     /**
      * represents the parsed header, whose components can then be used to
      * read/write the rest of the file
@@ -746,6 +1281,15 @@ matrix_data<ValueType, IndexType> read_raw(std::istream& is)
 }
 
 
+template <typename ValueType, typename IndexType>
+device_matrix_data<ValueType, IndexType> read_raw(
+    std::istream& is, std::shared_ptr<const Executor> exec)
+{
+    return mtx_io<ValueType, IndexType>::get().read_parallel(is,
+                                                             std::move(exec));
+}
+
+
 /**
  * Returns the magic number at the beginning of the binary format header for the
  * given type parameters.
@@ -921,6 +1465,21 @@ matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is)
 }
 
 
+template <typename ValueType, typename IndexType>
+device_matrix_data<ValueType, IndexType> read_generic_raw(
+    std::istream& is, std::shared_ptr<const Executor> exec)
+{
+    auto first_char = is.peek();
+    GKO_CHECK_STREAM(is, "failed reading from stream");
+    if (first_char == '%') {
+        return read_raw<ValueType, IndexType>(is, std::move(exec));
+    } else {
+        return device_matrix_data<ValueType, IndexType>::create_from_host(
+            exec, read_binary_raw<ValueType, IndexType>(is));
+    }
+}
+
+
 template <typename ValueType, typename IndexType>
 void write_binary_raw(std::ostream& os,
                       const matrix_data<ValueType, IndexType>& mtx)
@@ -971,8 +1530,248 @@ void write_raw(std::ostream& os, const matrix_data<ValueType, IndexType>& data,
 }
 
 
+/**
+ * Returns the magic number at the beginning of the binary CSR format header
+ * for the given type parameters. It uses the same type encoding as
+ * binary_format_magic, but starts with GKOCSR instead of GINKGO.
+ */
+template <typename ValueType, typename IndexType>
+static constexpr uint64 binary_csr_format_magic()
+{
+    constexpr uint64 shift = 256;
+    constexpr uint64 type_mask = shift * shift;
+    constexpr auto type_bits =
+        binary_format_magic<ValueType, IndexType>() /
+        (type_mask * type_mask * type_mask);
+    return 'G' +
+           shift *
+               ('K' +
+                shift *
+                    ('O' +
+                     shift *
+                         ('C' +
+                          shift * ('S' + shift * ('R' + shift * type_bits)))));
+}
+
+
+namespace {
+
+
+/**
+ * Alignment of the array sections in the binary CSR format.
+ */
+constexpr size_type binary_csr_alignment = 64;
+
+
+/**
+ * Size of the binary CSR format header, consisting of the magic number, the
+ * number of rows, columns and stored elements, the offsets of the row pointer,
+ * column index and value sections, and the total file size.
+ */
+constexpr size_type binary_csr_header_size = 64;
+
+
+size_type align_binary_csr_offset(size_type offset)
+{
+    return ceildiv(offset, binary_csr_alignment) * binary_csr_alignment;
+}
+
+
+/**
+ * A read-only file whose content is mapped into memory. Pages are mapped
+ * copy-on-write, so the content can be modified without affecting the file.
+ * On platforms without mmap, the file is read into memory instead.
+ */
+class mapped_file {
+public:
+    explicit mapped_file(const std::string& filename)
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        const auto fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw GKO_STREAM_ERROR("failed opening file " + filename);
+        }
+        struct stat file_stat {};
+        if (::fstat(fd, &file_stat) != 0) {
+            ::close(fd);
+            throw GKO_STREAM_ERROR("failed reading size of file " + filename);
+        }
+        size_ = static_cast<size_type>(file_stat.st_size);
+        if (size_ > 0) {
+            auto data = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                ::close(fd);
+                throw GKO_STREAM_ERROR("failed mapping file " + filename);
+            }
+            data_ = static_cast<char*>(data);
+        }
+        // the mapping stays valid after closing the file descriptor
+        ::close(fd);
+#else
+        std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+        GKO_CHECK_MATCH(stream, "failed opening file " + filename);
+        size_ = static_cast<size_type>(stream.tellg());
+        stream.seekg(0);
+        buffer_ = std::make_unique<char[]>(size_);
+        data_ = buffer_.get();
+        GKO_CHECK_STREAM(stream.read(data_, size_),
+                         "failed reading file " + filename);
+#endif
+    }
+
+    ~mapped_file()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (data_) {
+            ::munmap(data_, size_);
+        }
+#endif
+    }
+
+    mapped_file(const mapped_file&) = delete;
+
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    char* get_data() const { return data_; }
+
+    size_type get_size() const { return size_; }
+
+private:
+    char* data_{};
+    size_type size_{};
+#if !(defined(__unix__) || defined(__APPLE__))
+    std::unique_ptr<char[]> buffer_;
+#endif
+};
+
+
+/**
+ * Creates an array viewing a section of the mapped file. The array keeps the
+ * mapping alive until it is destroyed.
+ */
+template <typename T>
+array<T> make_mapped_array(std::shared_ptr<const Executor> exec,
+                           std::shared_ptr<mapped_file> file, uint64 offset,
+                           uint64 size)
+{
+    auto data = reinterpret_cast<T*>(file->get_data() + offset);
+    return array<T>(std::move(exec), static_cast<size_type>(size), data,
+                    [file](T*) {});
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* mtx)
+{
+    auto exec = mtx->get_executor();
+    auto host_mtx = make_temporary_clone(exec->get_master(), mtx);
+    const uint64 num_rows = host_mtx->get_size()[0];
+    const uint64 num_cols = host_mtx->get_size()[1];
+    const uint64 num_entries = host_mtx->get_num_stored_elements();
+    const uint64 row_ptrs_offset = binary_csr_header_size;
+    const uint64 col_idxs_offset = align_binary_csr_offset(
+        row_ptrs_offset + (num_rows + 1) * sizeof(IndexType));
+    const uint64 values_offset = align_binary_csr_offset(
+        col_idxs_offset + num_entries * sizeof(IndexType));
+    const uint64 file_size = values_offset + num_entries * sizeof(ValueType);
+    std::array<uint64, binary_csr_header_size / sizeof(uint64)> header{
+        binary_csr_format_magic<ValueType, IndexType>(),
+        num_rows,
+        num_cols,
+        num_entries,
+        row_ptrs_offset,
+        col_idxs_offset,
+        values_offset,
+        file_size};
+    GKO_CHECK_STREAM(os.write(reinterpret_cast<const char*>(header.data()),
+                              binary_csr_header_size),
+                     "failed writing header");
+    uint64 position = binary_csr_header_size;
+    const auto write_section = [&](const void* data, uint64 offset,
+                                   uint64 size, const char* name) {
+        const std::array<char, binary_csr_alignment> padding{};
+        GKO_CHECK_STREAM(os.write(padding.data(), offset - position),
+                         std::string{"failed writing padding before "} + name);
+        GKO_CHECK_STREAM(os.write(static_cast<const char*>(data), size),
+                         std::string{"failed writing "} + name);
+        position = offset + size;
+    };
+    write_section(host_mtx->get_const_row_ptrs(), row_ptrs_offset,
+                  (num_rows + 1) * sizeof(IndexType), "row pointers");
+    write_section(host_mtx->get_const_col_idxs(), col_idxs_offset,
+                  num_entries * sizeof(IndexType), "column indices");
+    write_section(host_mtx->get_const_values(), values_offset,
+                  num_entries * sizeof(ValueType), "values");
+    os.flush();
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    const std::string& filename, std::shared_ptr<const Executor> exec)
+{
+    auto file = std::make_shared<mapped_file>(filename);
+    if (file->get_size() < binary_csr_header_size) {
+        throw GKO_STREAM_ERROR("failed reading header");
+    }
+    std::array<uint64, binary_csr_header_size / sizeof(uint64)> header{};
+    std::memcpy(header.data(), file->get_data(), binary_csr_header_size);
+    const auto magic = header[0];
+    const auto num_rows = header[1];
+    const auto num_cols = header[2];
+    const auto num_entries = header[3];
+    const auto row_ptrs_offset = header[4];
+    const auto col_idxs_offset = header[5];
+    const auto values_offset = header[6];
+    const auto file_size = header[7];
+    if (magic != binary_csr_format_magic<ValueType, IndexType>()) {
+        if (std::string(file->get_data(), 6) == "GKOCSR") {
+            throw GKO_STREAM_ERROR(
+                "cannot read into this format, the file stores different "
+                "value or index types");
+        }
+        throw GKO_STREAM_ERROR("invalid header magic number '" +
+                               std::string(file->get_data(), 8) + "'");
+    }
+    if (num_rows >= std::numeric_limits<IndexType>::max() ||
+        num_entries > std::numeric_limits<IndexType>::max()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, its index type would overflow");
+    }
+    const auto section_fits = [&](uint64 offset, uint64 size) {
+        return offset % binary_csr_alignment == 0 &&
+               offset >= binary_csr_header_size && offset <= file_size &&
+               size <= file_size - offset;
+    };
+    if (file_size != file->get_size() ||
+        !section_fits(row_ptrs_offset, (num_rows + 1) * sizeof(IndexType)) ||
+        !section_fits(col_idxs_offset, num_entries * sizeof(IndexType)) ||
+        !section_fits(values_offset, num_entries * sizeof(ValueType))) {
+        throw GKO_STREAM_ERROR("invalid section layout or truncated file " +
+                               filename);
+    }
+    auto host_exec = exec->get_master();
+    return matrix::Csr<ValueType, IndexType>::create(
+        exec, dim<2>{num_rows, num_cols},
+        make_mapped_array<ValueType>(host_exec, file, values_offset,
+                                     num_entries),
+        make_mapped_array<IndexType>(host_exec, file, col_idxs_offset,
+                                     num_entries),
+        make_mapped_array<IndexType>(host_exec, file, row_ptrs_offset,
+                                     num_rows + 1));
+}
+
+
 #define GKO_DECLARE_READ_RAW(ValueType, IndexType) \
     matrix_data<ValueType, IndexType> read_raw(std::istream& is)
+#define GKO_DECLARE_READ_RAW_PARALLEL(ValueType, IndexType) \
+    device_matrix_data<ValueType, IndexType> read_raw(      \
+        std::istream& is, std::shared_ptr<const Executor> exec)
 #define GKO_DECLARE_WRITE_RAW(ValueType, IndexType)               \
     void write_raw(std::ostream& os,                              \
                    const matrix_data<ValueType, IndexType>& data, \
@@ -984,11 +1783,25 @@ void write_raw(std::ostream& os, const matrix_data<ValueType, IndexType>& data,
                           const matrix_data<ValueType, IndexType>& data)
 #define GKO_DECLARE_READ_GENERIC_RAW(ValueType, IndexType) \
     matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is)
+#define GKO_DECLARE_READ_GENERIC_RAW_PARALLEL(ValueType, IndexType) \
+    device_matrix_data<ValueType, IndexType> read_generic_raw(      \
+        std::istream& is, std::shared_ptr<const Executor> exec)
+#define GKO_DECLARE_WRITE_BINARY_CSR(ValueType, IndexType) \
+    void write_binary_csr(std::ostream& os,                \
+                          const matrix::Csr<ValueType, IndexType>* mtx)
+#define GKO_DECLARE_READ_BINARY_CSR(ValueType, IndexType)          \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr( \
+        const std::string& filename, std::shared_ptr<const Executor> exec)
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW_PARALLEL);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_GENERIC_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_READ_GENERIC_RAW_PARALLEL);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_CSR);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_CSR);
 
 
 }  // namespace gko
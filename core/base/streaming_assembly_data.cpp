@@ -0,0 +1,359 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/base/streaming_assembly_data.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <utility>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace {
+
+
+/**
+ * Number of entries read from a spilled run at once during the merge.
+ */
+constexpr size_type run_read_chunk_size = 4096;
+
+
+template <typename Entry>
+bool less_position(const Entry& a, const Entry& b)
+{
+    return std::tie(a.row, a.column) < std::tie(b.row, b.column);
+}
+
+
+template <typename Entry>
+bool same_position(const Entry& a, const Entry& b)
+{
+    return a.row == b.row && a.column == b.column;
+}
+
+
+/**
+ * Sequential reader for a single sorted run, either from memory or from a
+ * spill file, holding at most run_read_chunk_size entries of the latter.
+ */
+template <typename Entry>
+class run_cursor {
+public:
+    run_cursor(const std::vector<Entry>& run)
+        : memory_{run.data()}, remaining_{run.size()}, pos_{}
+    {}
+
+    run_cursor(const std::string& filename, size_type size)
+        : memory_{}, file_{filename, std::ios::binary}, remaining_{size}, pos_{}
+    {
+        if (!file_) {
+            throw GKO_STREAM_ERROR("failed opening run file " + filename);
+        }
+        this->refill();
+    }
+
+    bool valid() const { return remaining_ > 0; }
+
+    const Entry& get() const
+    {
+        return memory_ ? memory_[pos_] : chunk_[pos_];
+    }
+
+    void advance()
+    {
+        pos_++;
+        remaining_--;
+        if (!memory_ && pos_ == chunk_.size()) {
+            this->refill();
+        }
+    }
+
+private:
+    void refill()
+    {
+        chunk_.resize(std::min(remaining_, run_read_chunk_size));
+        file_.read(reinterpret_cast<char*>(chunk_.data()),
+                   chunk_.size() * sizeof(Entry));
+        if (!file_) {
+            throw GKO_STREAM_ERROR("failed reading run file");
+        }
+        pos_ = 0;
+    }
+
+    const Entry* memory_;
+    std::ifstream file_;
+    std::vector<Entry> chunk_;
+    size_type remaining_;
+    size_type pos_;
+};
+
+
+/**
+ * Merges all runs in row-major order and calls fn once for every distinct
+ * position with the sum of all values at this position.
+ */
+template <typename Entry, typename Fn>
+void merge_runs(std::vector<std::unique_ptr<run_cursor<Entry>>>& cursors,
+                Fn fn)
+{
+    using heap_entry = std::pair<Entry, size_type>;
+    auto greater = [](const heap_entry& a, const heap_entry& b) {
+        return less_position(b.first, a.first);
+    };
+    std::priority_queue<heap_entry, std::vector<heap_entry>, decltype(greater)>
+        heap{greater};
+    for (size_type run = 0; run < cursors.size(); run++) {
+        if (cursors[run]->valid()) {
+            heap.emplace(cursors[run]->get(), run);
+        }
+    }
+    while (!heap.empty()) {
+        auto entry = heap.top().first;
+        entry.value = zero(entry.value);
+        // runs don't contain duplicates, so at most one entry per run matches
+        while (!heap.empty() && same_position(heap.top().first, entry)) {
+            const auto run = heap.top().second;
+            entry.value += heap.top().first.value;
+            heap.pop();
+            auto& cursor = *cursors[run];
+            cursor.advance();
+            if (cursor.valid()) {
+                heap.emplace(cursor.get(), run);
+            }
+        }
+        fn(entry);
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+streaming_assembly_data<ValueType, IndexType>::streaming_assembly_data(
+    dim<2> size, size_type run_size, std::string spill_directory)
+    : size_{size}, run_size_{std::max(run_size, size_type{1})}
+{
+    if (!spill_directory.empty()) {
+        static std::atomic<size_type> instance_counter{};
+        spill_prefix_ = spill_directory + "/ginkgo_assembly_" +
+                        std::to_string(std::random_device{}()) + "_" +
+                        std::to_string(instance_counter++) + "_";
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+streaming_assembly_data<ValueType, IndexType>::~streaming_assembly_data()
+{
+    this->remove_runs();
+}
+
+
+template <typename ValueType, typename IndexType>
+void streaming_assembly_data<ValueType, IndexType>::add_value(index_type row,
+                                                              index_type col,
+                                                              value_type val)
+{
+    GKO_ENSURE_IN_BOUNDS(static_cast<size_type>(row), size_[0]);
+    GKO_ENSURE_IN_BOUNDS(static_cast<size_type>(col), size_[1]);
+    buffer_.emplace_back(row, col, val);
+    if (buffer_.size() >= run_size_) {
+        this->flush_buffer();
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void streaming_assembly_data<ValueType, IndexType>::add_values(
+    size_type num_values, const index_type* rows, const index_type* cols,
+    const value_type* vals)
+{
+    for (size_type i = 0; i < num_values; i++) {
+        this->add_value(rows[i], cols[i], vals[i]);
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+size_type
+streaming_assembly_data<ValueType, IndexType>::get_num_stored_elements()
+    const noexcept
+{
+    size_type result = buffer_.size();
+    for (auto run_size : run_sizes_) {
+        result += run_size;
+    }
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+void streaming_assembly_data<ValueType, IndexType>::flush_buffer()
+{
+    std::sort(buffer_.begin(), buffer_.end(), less_position<nonzero_type>);
+    // sum up duplicates in-place
+    size_type out = 0;
+    for (size_type in = 0; in < buffer_.size(); in++) {
+        if (out > 0 && same_position(buffer_[out - 1], buffer_[in])) {
+            buffer_[out - 1].value += buffer_[in].value;
+        } else {
+            buffer_[out++] = buffer_[in];
+        }
+    }
+    buffer_.resize(out);
+    if (spill_prefix_.empty()) {
+        memory_runs_.emplace_back(buffer_);
+    } else {
+        const auto filename = this->get_run_filename(run_sizes_.size());
+        std::ofstream file{filename, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(buffer_.data()),
+                   buffer_.size() * sizeof(nonzero_type));
+        if (!file) {
+            std::remove(filename.c_str());
+            throw GKO_STREAM_ERROR("failed writing run file " + filename);
+        }
+    }
+    run_sizes_.push_back(buffer_.size());
+    buffer_.clear();
+    // merge the in-memory runs once the later runs outgrow the first one, so
+    // they store little more than twice the number of distinct entries
+    if (spill_prefix_.empty() &&
+        std::accumulate(run_sizes_.begin() + 1, run_sizes_.end(),
+                        size_type{}) > run_sizes_.front()) {
+        this->merge_memory_runs();
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void streaming_assembly_data<ValueType, IndexType>::merge_memory_runs()
+{
+    using cursor_type = run_cursor<nonzero_type>;
+    auto open_runs = [&] {
+        std::vector<std::unique_ptr<cursor_type>> cursors;
+        for (const auto& run : memory_runs_) {
+            cursors.emplace_back(std::make_unique<cursor_type>(run));
+        }
+        return cursors;
+    };
+    // count first, so the merged run is allocated only once
+    size_type merged_size{};
+    {
+        auto cursors = open_runs();
+        merge_runs(cursors, [&](const nonzero_type&) { merged_size++; });
+    }
+    std::vector<nonzero_type> merged;
+    merged.reserve(merged_size);
+    {
+        auto cursors = open_runs();
+        merge_runs(cursors,
+                   [&](const nonzero_type& entry) { merged.push_back(entry); });
+    }
+    memory_runs_.clear();
+    memory_runs_.push_back(std::move(merged));
+    run_sizes_.assign(1, merged_size);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::string streaming_assembly_data<ValueType, IndexType>::get_run_filename(
+    size_type run) const
+{
+    return spill_prefix_ + std::to_string(run) + ".bin";
+}
+
+
+template <typename ValueType, typename IndexType>
+void streaming_assembly_data<ValueType, IndexType>::remove_runs()
+{
+    if (!spill_prefix_.empty()) {
+        for (size_type run = 0; run < run_sizes_.size(); run++) {
+            std::remove(this->get_run_filename(run).c_str());
+        }
+    }
+    memory_runs_.clear();
+    run_sizes_.clear();
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>>
+streaming_assembly_data<ValueType, IndexType>::assemble(
+    std::shared_ptr<const Executor> exec)
+{
+    using cursor_type = run_cursor<nonzero_type>;
+    if (!buffer_.empty()) {
+        this->flush_buffer();
+    }
+    auto open_runs = [&] {
+        std::vector<std::unique_ptr<cursor_type>> cursors;
+        for (size_type run = 0; run < run_sizes_.size(); run++) {
+            if (spill_prefix_.empty()) {
+                cursors.emplace_back(
+                    std::make_unique<cursor_type>(memory_runs_[run]));
+            } else {
+                cursors.emplace_back(std::make_unique<cursor_type>(
+                    this->get_run_filename(run), run_sizes_[run]));
+            }
+        }
+        return cursors;
+    };
+    auto host = exec->get_master();
+    // first pass: count the distinct entries per row
+    array<index_type> row_ptrs{host, size_[0] + 1};
+    row_ptrs.fill(zero<index_type>());
+    auto row_ptr_data = row_ptrs.get_data();
+    {
+        auto cursors = open_runs();
+        merge_runs(cursors,
+                   [&](const nonzero_type& entry) { row_ptr_data[entry.row]++; });
+    }
+    std::exclusive_scan(row_ptr_data, row_ptr_data + size_[0] + 1,
+                        row_ptr_data, index_type{});
+    const auto nnz = static_cast<size_type>(row_ptr_data[size_[0]]);
+    // second pass: write the merged entries into the final arrays
+    array<index_type> col_idxs{host, nnz};
+    array<value_type> values{host, nnz};
+    {
+        auto col_idx_data = col_idxs.get_data();
+        auto value_data = values.get_data();
+        size_type out = 0;
+        auto cursors = open_runs();
+        merge_runs(cursors, [&](const nonzero_type& entry) {
+            col_idx_data[out] = entry.column;
+            value_data[out] = entry.value;
+            out++;
+        });
+    }
+    this->remove_runs();
+    auto result = matrix::Csr<value_type, index_type>::create(
+        host, size_, std::move(values), std::move(col_idxs),
+        std::move(row_ptrs));
+    if (host == exec) {
+        return result;
+    }
+    return gko::clone(exec, result);
+}
+
+
+#define GKO_DECLARE_STREAMING_ASSEMBLY_DATA(ValueType, IndexType) \
+    class streaming_assembly_data<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STREAMING_ASSEMBLY_DATA);
+
+
+}  // namespace gko
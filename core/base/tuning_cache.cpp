@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/base/tuning_cache.hpp"
+
+#include <fstream>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+
+
+TuningCache::TuningCache(std::string filename) : filename_{std::move(filename)}
+{
+    if (filename_.empty()) {
+        return;
+    }
+    // a missing file is an empty cache
+    std::ifstream stream{filename_};
+    std::string line;
+    while (std::getline(stream, line)) {
+        const auto separator = line.find('\t');
+        // skip malformed lines, e.g. from an interrupted write
+        if (separator == std::string::npos || separator == 0) {
+            continue;
+        }
+        entries_[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+}
+
+
+std::shared_ptr<TuningCache> TuningCache::create(std::string filename)
+{
+    return std::shared_ptr<TuningCache>{new TuningCache{std::move(filename)}};
+}
+
+
+std::optional<std::string> TuningCache::lookup(const std::string& key) const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+
+void TuningCache::store(const std::string& key, const std::string& value)
+{
+    if (key.empty() || key.find_first_of("\t\n") != std::string::npos ||
+        value.find('\n') != std::string::npos) {
+        GKO_INVALID_STATE("Tuning cache entries must be single-line strings");
+    }
+    std::lock_guard<std::mutex> guard{mutex_};
+    entries_[key] = value;
+    if (filename_.empty()) {
+        return;
+    }
+    std::ofstream stream{filename_, std::ios::app};
+    stream << key << '\t' << value << '\n';
+    stream.flush();
+    if (!stream) {
+        throw GKO_STREAM_ERROR("Failed to write tuning cache file " +
+                               filename_);
+    }
+}
+
+
+size_type TuningCache::get_num_entries() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return entries_.size();
+}
+
+
+}  // namespace gko
@@ -36,6 +36,7 @@
 #include "core/matrix/batch_ell_kernels.hpp"
 #include "core/matrix/coo_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
+#include "core/matrix/delta_csr_kernels.hpp"
 #include "core/matrix/dense_kernels.hpp"
 #include "core/matrix/diagonal_kernels.hpp"
 #include "core/matrix/ell_kernels.hpp"
@@ -43,10 +44,16 @@
 #include "core/matrix/fft_kernels.hpp"
 #include "core/matrix/hybrid_kernels.hpp"
 #include "core/matrix/permutation_kernels.hpp"
+#include "core/matrix/reduced_csr_kernels.hpp"
 #include "core/matrix/scaled_permutation_kernels.hpp"
 #include "core/matrix/sellp_kernels.hpp"
 #include "core/matrix/sparsity_csr_kernels.hpp"
+#include "core/matrix/stencil_kernels.hpp"
+#include "core/matrix/symmetric_csr_kernels.hpp"
+#include "core/matrix/vbcsr_kernels.hpp"
 #include "core/multigrid/pgm_kernels.hpp"
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+#include "core/preconditioner/batch_isai_kernels.hpp"
 #include "core/preconditioner/batch_jacobi_kernels.hpp"
 #include "core/preconditioner/isai_kernels.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
@@ -54,6 +61,8 @@
 #include "core/reorder/rcm_kernels.hpp"
 #include "core/solver/batch_bicgstab_kernels.hpp"
 #include "core/solver/batch_cg_kernels.hpp"
+#include "core/solver/batch_direct_kernels.hpp"
+#include "core/solver/batch_gmres_kernels.hpp"
 #include "core/solver/bicg_kernels.hpp"
 #include "core/solver/bicgstab_kernels.hpp"
 #include "core/solver/cb_gmres_kernels.hpp"
@@ -517,6 +526,31 @@ GKO_STUB_BATCH_VALUE_MATRIX_PRECONDITIONER_BASE(
 }  // namespace batch_cg
 
 
+namespace batch_direct {
+
+
+GKO_STUB_VALUE_AND_INT32_TYPE(GKO_DECLARE_BATCH_DIRECT_DENSE_FACTORIZE_KERNEL);
+GKO_STUB_VALUE_AND_INT32_TYPE(GKO_DECLARE_BATCH_DIRECT_DENSE_SOLVE_KERNEL);
+GKO_STUB_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SYMBOLIC_FACTORIZE_KERNEL);
+GKO_STUB_VALUE_AND_INT32_TYPE(GKO_DECLARE_BATCH_DIRECT_SPARSE_FACTORIZE_KERNEL);
+GKO_STUB_VALUE_AND_INT32_TYPE(GKO_DECLARE_BATCH_DIRECT_SPARSE_SOLVE_KERNEL);
+
+
+}  // namespace batch_direct
+
+
+namespace batch_gmres {
+
+
+GKO_STUB_BATCH_VALUE_MATRIX_PRECONDITIONER_BASE(
+    GKO_DECLARE_BATCH_GMRES_APPLY_KERNEL,
+    GKO_DECLARE_BATCH_GMRES_APPLY_KERNEL_WRAPPER);
+
+
+}  // namespace batch_gmres
+
+
 namespace cg {
 
 
@@ -747,6 +781,19 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_INV_SCALE_KERNEL);
 }  // namespace csr
 
 
+namespace delta_csr {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_COUNT_DELTA_BYTES_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_FILL_IN_DELTAS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace delta_csr
+
+
 namespace fbcsr {
 
 
@@ -840,6 +887,62 @@ GKO_STUB_INDEX_TYPE(GKO_DECLARE_PERMUTATION_COMPOSE_KERNEL);
 }  // namespace permutation
 
 
+namespace reduced_csr {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_REDUCED_CSR_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_REDUCED_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_REDUCED_CSR_COMPRESS_VALUES_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_REDUCED_CSR_DECOMPRESS_VALUES_KERNEL);
+
+
+}  // namespace reduced_csr
+
+
+namespace vbcsr {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_VBCSR_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_VBCSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_VBCSR_COUNT_BLOCKS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_VBCSR_FILL_IN_BLOCKS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_VBCSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace vbcsr
+
+
+namespace symmetric_csr {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NONZEROS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_UPPER_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_FULL_NONZEROS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace symmetric_csr
+
+
+namespace stencil {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_COUNT_ROW_NONZEROS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_FILL_IN_CSR_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace stencil
+
+
 namespace scaled_permutation {
 
 
@@ -866,6 +969,28 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_EXTRACT_DIAGONAL_KERNEL);
 }  // namespace sellp
 
 
+namespace batch_ilu {
+
+
+GKO_STUB_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_GENERATE_COMMON_PATTERN_KERNEL);
+GKO_STUB_VALUE_AND_INT32_TYPE(GKO_DECLARE_BATCH_ILU_COMPUTE_FACTORS_KERNEL);
+
+
+}  // namespace batch_ilu
+
+
+namespace batch_isai {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_BATCH_ISAI_COMPUTE_CUMULATIVE_SYSTEM_STORAGE);
+GKO_STUB_VALUE_AND_INT32_TYPE(GKO_DECLARE_BATCH_ISAI_EXTRACT_PATTERN_KERNEL);
+GKO_STUB_VALUE_AND_INT32_TYPE(GKO_DECLARE_BATCH_ISAI_COMPUTE_KERNEL);
+
+
+}  // namespace batch_isai
+
+
 namespace batch_jacobi {
 
 
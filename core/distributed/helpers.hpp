@@ -216,6 +216,124 @@ create_submatrix_helper(experimental::distributed::Vector<ValueType>* mtx,
 #endif
 
 
+/**
+ * Computes the column-wise dot products `conj(a1)^T b1` and `conj(a2)^T b2`.
+ *
+ * The distributed overload computes both using a single global reduction. It
+ * stores the packed values in `buffer` and `host_buffer`, which are unused
+ * otherwise, so they can be reused across iterations of a solver.
+ */
+template <typename ValueType>
+void compute_conj_dot_pair(const matrix::Dense<ValueType>* a1,
+                           const matrix::Dense<ValueType>* b1, LinOp* result1,
+                           const matrix::Dense<ValueType>* a2,
+                           const matrix::Dense<ValueType>* b2, LinOp* result2,
+                           array<char>& tmp,
+                           array<remove_complex<ValueType>>& buffer,
+                           array<remove_complex<ValueType>>& host_buffer)
+{
+    a1->compute_conj_dot(b1, result1, tmp);
+    a2->compute_conj_dot(b2, result2, tmp);
+}
+
+
+/**
+ * Computes the column-wise dot product `conj(a)^T b` and the squared
+ * column-wise Euclidean norm of `c`.
+ *
+ * The distributed overload computes both using a single global reduction, see
+ * compute_conj_dot_pair.
+ */
+template <typename ValueType>
+void compute_conj_dot_and_squared_norm2(
+    const matrix::Dense<ValueType>* a, const matrix::Dense<ValueType>* b,
+    LinOp* dot_result, const matrix::Dense<ValueType>* c, LinOp* norm_result,
+    array<char>& tmp, array<remove_complex<ValueType>>& buffer,
+    array<remove_complex<ValueType>>& host_buffer)
+{
+    a->compute_conj_dot(b, dot_result, tmp);
+    c->compute_squared_norm2(norm_result, tmp);
+}
+
+
+/**
+ * Computes the column-wise dot products `conj(a1)^T b1` and `conj(a2)^T b2`
+ * and the column-wise Euclidean norm of `c`.
+ *
+ * The distributed overload computes all three using a single global reduction,
+ * see compute_conj_dot_pair.
+ */
+template <typename ValueType>
+void compute_conj_dot_pair_and_norm2(
+    const matrix::Dense<ValueType>* a1, const matrix::Dense<ValueType>* b1,
+    LinOp* result1, const matrix::Dense<ValueType>* a2,
+    const matrix::Dense<ValueType>* b2, LinOp* result2,
+    const matrix::Dense<ValueType>* c, LinOp* norm_result, array<char>& tmp,
+    array<remove_complex<ValueType>>& buffer,
+    array<remove_complex<ValueType>>& host_buffer)
+{
+    a1->compute_conj_dot(b1, result1, tmp);
+    a2->compute_conj_dot(b2, result2, tmp);
+    c->compute_norm2(norm_result, tmp);
+}
+
+
+#if GINKGO_BUILD_MPI
+
+
+template <typename ValueType>
+void compute_conj_dot_pair(
+    const experimental::distributed::Vector<ValueType>* a1,
+    const experimental::distributed::Vector<ValueType>* b1, LinOp* result1,
+    const experimental::distributed::Vector<ValueType>* a2,
+    const experimental::distributed::Vector<ValueType>* b2, LinOp* result2,
+    array<char>& tmp, array<remove_complex<ValueType>>& buffer,
+    array<remove_complex<ValueType>>& host_buffer)
+{
+    experimental::distributed::FusedReduction<ValueType> reduction{
+        a1, buffer, host_buffer};
+    reduction.add_conj_dot(a1, b1, result1).add_conj_dot(a2, b2, result2);
+    reduction.compute(tmp);
+}
+
+
+template <typename ValueType>
+void compute_conj_dot_and_squared_norm2(
+    const experimental::distributed::Vector<ValueType>* a,
+    const experimental::distributed::Vector<ValueType>* b, LinOp* dot_result,
+    const experimental::distributed::Vector<ValueType>* c, LinOp* norm_result,
+    array<char>& tmp, array<remove_complex<ValueType>>& buffer,
+    array<remove_complex<ValueType>>& host_buffer)
+{
+    experimental::distributed::FusedReduction<ValueType> reduction{
+        a, buffer, host_buffer};
+    reduction.add_conj_dot(a, b, dot_result).add_squared_norm2(c, norm_result);
+    reduction.compute(tmp);
+}
+
+
+template <typename ValueType>
+void compute_conj_dot_pair_and_norm2(
+    const experimental::distributed::Vector<ValueType>* a1,
+    const experimental::distributed::Vector<ValueType>* b1, LinOp* result1,
+    const experimental::distributed::Vector<ValueType>* a2,
+    const experimental::distributed::Vector<ValueType>* b2, LinOp* result2,
+    const experimental::distributed::Vector<ValueType>* c, LinOp* norm_result,
+    array<char>& tmp, array<remove_complex<ValueType>>& buffer,
+    array<remove_complex<ValueType>>& host_buffer)
+{
+    experimental::distributed::FusedReduction<ValueType> reduction{
+        a1, buffer, host_buffer};
+    reduction.add_conj_dot(a1, b1, result1)
+        .add_conj_dot(a2, b2, result2)
+        .add_norm2(c, norm_result);
+    reduction.compute(tmp);
+}
+
+
+#endif
+
+
 }  // namespace detail
 }  // namespace gko
 
@@ -4,6 +4,8 @@
 
 #include "ginkgo/core/distributed/matrix.hpp"
 
+#include <utility>
+
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/distributed/assembly.hpp>
@@ -462,27 +464,8 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
 {
     distributed::precision_dispatch_real_complex<ValueType>(
         [this](const auto dense_b, auto dense_x) {
-            auto x_exec = dense_x->get_executor();
-            auto local_x = gko::matrix::Dense<ValueType>::create(
-                x_exec, dense_x->get_local_vector()->get_size(),
-                gko::make_array_view(
-                    x_exec,
-                    dense_x->get_local_vector()->get_num_stored_elements(),
-                    dense_x->get_local_values()),
-                dense_x->get_local_vector()->get_stride());
-
-            auto comm = this->get_communicator();
-            auto req = this->communicate(dense_b->get_local_vector());
-            local_mtx_->apply(dense_b->get_local_vector(), local_x);
-            req.wait();
-
-            auto exec = this->get_executor();
-            auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
-            if (use_host_buffer) {
-                recv_buffer_->copy_from(host_recv_buffer_.get());
-            }
-            non_local_mtx_->apply(one_scalar_.get(), recv_buffer_.get(),
-                                  one_scalar_.get(), local_x);
+            this->apply_begin_impl(nullptr, dense_b, nullptr, dense_x);
+            this->apply_end_impl();
         },
         b, x);
 }
@@ -495,33 +478,114 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
     distributed::precision_dispatch_real_complex<ValueType>(
         [this](const auto local_alpha, const auto dense_b,
                const auto local_beta, auto dense_x) {
-            const auto x_exec = dense_x->get_executor();
-            auto local_x = gko::matrix::Dense<ValueType>::create(
-                x_exec, dense_x->get_local_vector()->get_size(),
-                gko::make_array_view(
-                    x_exec,
-                    dense_x->get_local_vector()->get_num_stored_elements(),
-                    dense_x->get_local_values()),
-                dense_x->get_local_vector()->get_stride());
-
-            auto comm = this->get_communicator();
-            auto req = this->communicate(dense_b->get_local_vector());
-            local_mtx_->apply(local_alpha, dense_b->get_local_vector(),
-                              local_beta, local_x);
-            req.wait();
-
-            auto exec = this->get_executor();
-            auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
-            if (use_host_buffer) {
-                recv_buffer_->copy_from(host_recv_buffer_.get());
-            }
-            non_local_mtx_->apply(local_alpha, recv_buffer_.get(),
-                                  one_scalar_.get(), local_x);
+            this->apply_begin_impl(local_alpha, dense_b, local_beta, dense_x);
+            this->apply_end_impl();
         },
         alpha, b, beta, x);
 }
 
 
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+mpi::request& Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_begin(
+    ptr_param<const LinOp> b, ptr_param<LinOp> x) const
+{
+    this->validate_application_parameters(b.get(), x.get());
+    this->template log<log::Logger::linop_apply_started>(this, b.get(),
+                                                         x.get());
+    this->apply_begin_impl(nullptr, as<global_vector_type>(b.get()), nullptr,
+                           as<global_vector_type>(x.get()));
+    return split_apply_.request;
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+mpi::request& Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_begin(
+    ptr_param<const LinOp> alpha, ptr_param<const LinOp> b,
+    ptr_param<const LinOp> beta, ptr_param<LinOp> x) const
+{
+    this->validate_application_parameters(alpha.get(), b.get(), beta.get(),
+                                          x.get());
+    this->template log<log::Logger::linop_advanced_apply_started>(
+        this, alpha.get(), b.get(), beta.get(), x.get());
+    this->apply_begin_impl(alpha.get(), as<global_vector_type>(b.get()),
+                           beta.get(), as<global_vector_type>(x.get()));
+    return split_apply_.request;
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_end() const
+{
+    if (!split_apply_.b) {
+        GKO_INVALID_STATE("apply_end requires a preceding call to apply_begin");
+    }
+    const auto alpha = split_apply_.alpha;
+    const auto b = split_apply_.b;
+    const auto beta = split_apply_.beta;
+    const auto x = split_apply_.x;
+    this->apply_end_impl();
+    if (alpha) {
+        this->template log<log::Logger::linop_advanced_apply_completed>(
+            this, alpha, b, beta, x);
+    } else {
+        this->template log<log::Logger::linop_apply_completed>(this, b, x);
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_begin_impl(
+    const LinOp* alpha, const global_vector_type* b, const LinOp* beta,
+    global_vector_type* x) const
+{
+    if (split_apply_.b) {
+        GKO_INVALID_STATE(
+            "apply_begin can't be called while another application of this "
+            "matrix is pending");
+    }
+    split_apply_.request = this->communicate(b->get_local_vector());
+    split_apply_.alpha = alpha;
+    split_apply_.b = b;
+    split_apply_.beta = beta;
+    split_apply_.x = x;
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_end_impl() const
+{
+    const auto alpha = std::exchange(split_apply_.alpha, nullptr);
+    const auto b = std::exchange(split_apply_.b, nullptr);
+    const auto beta = std::exchange(split_apply_.beta, nullptr);
+    const auto x = std::exchange(split_apply_.x, nullptr);
+    auto req = std::move(split_apply_.request);
+
+    const auto x_exec = x->get_executor();
+    auto local_x = gko::matrix::Dense<ValueType>::create(
+        x_exec, x->get_local_vector()->get_size(),
+        gko::make_array_view(x_exec,
+                             x->get_local_vector()->get_num_stored_elements(),
+                             x->get_local_values()),
+        x->get_local_vector()->get_stride());
+
+    if (alpha) {
+        local_mtx_->apply(alpha, b->get_local_vector(), beta, local_x);
+    } else {
+        local_mtx_->apply(b->get_local_vector(), local_x);
+    }
+    req.wait();
+
+    auto exec = this->get_executor();
+    auto comm = this->get_communicator();
+    auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
+    if (use_host_buffer) {
+        recv_buffer_->copy_from(host_recv_buffer_.get());
+    }
+    non_local_mtx_->apply(alpha ? alpha : one_scalar_.get(),
+                          recv_buffer_.get(), one_scalar_.get(), local_x);
+}
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Matrix<ValueType, LocalIndexType, GlobalIndexType>::col_scale(
     ptr_param<const global_vector_type> scaling_factors)
@@ -17,6 +17,24 @@ namespace vector {
 namespace {
 
 
+// the global reductions run as host operations, so loggers can separate
+// communication from the local kernels
+template <typename ValueType>
+void mpi_all_reduce(std::shared_ptr<const Executor> exec,
+                    const mpi::communicator& comm, ValueType* values, int count,
+                    MPI_Op operation)
+{
+    comm.all_reduce(std::move(exec), values, count, operation);
+}
+
+
+void mpi_wait(mpi::request& request) { request.wait(); }
+
+
+GKO_REGISTER_HOST_OPERATION(all_reduce, mpi_all_reduce);
+GKO_REGISTER_HOST_OPERATION(wait, mpi_wait);
+
+
 GKO_REGISTER_OPERATION(compute_squared_norm2, dense::compute_squared_norm2);
 GKO_REGISTER_OPERATION(compute_sqrt, dense::compute_sqrt);
 GKO_REGISTER_OPERATION(outplace_absolute_dense, dense::outplace_absolute_dense);
@@ -449,13 +467,14 @@ void Vector<ValueType>::compute_dot(ptr_param<const LinOp> b,
     if (mpi::requires_host_buffer(exec, comm)) {
         host_reduction_buffer_.init(exec->get_master(), dense_res->get_size());
         host_reduction_buffer_->copy_from(dense_res.get());
-        comm.all_reduce(exec->get_master(),
-                        host_reduction_buffer_->get_values(),
-                        static_cast<int>(this->get_size()[1]), MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec->get_master(), comm, host_reduction_buffer_->get_values(),
+            static_cast<int>(this->get_size()[1]), MPI_SUM));
         dense_res->copy_from(host_reduction_buffer_.get());
     } else {
-        comm.all_reduce(exec, dense_res->get_values(),
-                        static_cast<int>(this->get_size()[1]), MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec, comm, dense_res->get_values(),
+            static_cast<int>(this->get_size()[1]), MPI_SUM));
     }
 }
 
@@ -485,13 +504,14 @@ void Vector<ValueType>::compute_conj_dot(ptr_param<const LinOp> b,
     if (mpi::requires_host_buffer(exec, comm)) {
         host_reduction_buffer_.init(exec->get_master(), dense_res->get_size());
         host_reduction_buffer_->copy_from(dense_res.get());
-        comm.all_reduce(exec->get_master(),
-                        host_reduction_buffer_->get_values(),
-                        static_cast<int>(this->get_size()[1]), MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec->get_master(), comm, host_reduction_buffer_->get_values(),
+            static_cast<int>(this->get_size()[1]), MPI_SUM));
         dense_res->copy_from(host_reduction_buffer_.get());
     } else {
-        comm.all_reduce(exec, dense_res->get_values(),
-                        static_cast<int>(this->get_size()[1]), MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec, comm, dense_res->get_values(),
+            static_cast<int>(this->get_size()[1]), MPI_SUM));
     }
 }
 
@@ -539,12 +559,14 @@ void Vector<ValueType>::compute_norm1(ptr_param<LinOp> result,
     if (mpi::requires_host_buffer(exec, comm)) {
         host_norm_buffer_.init(exec->get_master(), dense_res->get_size());
         host_norm_buffer_->copy_from(dense_res.get());
-        comm.all_reduce(exec->get_master(), host_norm_buffer_->get_values(),
-                        static_cast<int>(this->get_size()[1]), MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec->get_master(), comm, host_norm_buffer_->get_values(),
+            static_cast<int>(this->get_size()[1]), MPI_SUM));
         dense_res->copy_from(host_norm_buffer_.get());
     } else {
-        comm.all_reduce(exec, dense_res->get_values(),
-                        static_cast<int>(this->get_size()[1]), MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec, comm, dense_res->get_values(),
+            static_cast<int>(this->get_size()[1]), MPI_SUM));
     }
 }
 
@@ -572,12 +594,14 @@ void Vector<ValueType>::compute_squared_norm2(ptr_param<LinOp> result,
     if (mpi::requires_host_buffer(exec, comm)) {
         host_norm_buffer_.init(exec->get_master(), dense_res->get_size());
         host_norm_buffer_->copy_from(dense_res.get());
-        comm.all_reduce(exec->get_master(), host_norm_buffer_->get_values(),
-                        static_cast<int>(this->get_size()[1]), MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec->get_master(), comm, host_norm_buffer_->get_values(),
+            static_cast<int>(this->get_size()[1]), MPI_SUM));
         dense_res->copy_from(host_norm_buffer_.get());
     } else {
-        comm.all_reduce(exec, dense_res->get_values(),
-                        static_cast<int>(this->get_size()[1]), MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec, comm, dense_res->get_values(),
+            static_cast<int>(this->get_size()[1]), MPI_SUM));
     }
 }
 
@@ -614,12 +638,13 @@ void Vector<ValueType>::compute_mean(ptr_param<LinOp> result,
     if (mpi::requires_host_buffer(exec, comm)) {
         host_reduction_buffer_.init(exec->get_master(), dense_res->get_size());
         host_reduction_buffer_->copy_from(dense_res.get());
-        comm.all_reduce(exec->get_master(),
-                        host_reduction_buffer_->get_values(), num_vecs,
-                        MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec->get_master(), comm, host_reduction_buffer_->get_values(),
+            num_vecs, MPI_SUM));
         dense_res->copy_from(host_reduction_buffer_.get());
     } else {
-        comm.all_reduce(exec, dense_res->get_values(), num_vecs, MPI_SUM);
+        exec->run(vector::make_all_reduce(
+            exec, comm, dense_res->get_values(), num_vecs, MPI_SUM));
     }
 }
 
@@ -727,6 +752,227 @@ std::unique_ptr<Vector<ValueType>> Vector<ValueType>::create_with_type_of_impl(
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE_BASE(GKO_DECLARE_DISTRIBUTED_VECTOR);
 
 
+template <typename ValueType>
+FusedReduction<ValueType>::FusedReduction(ptr_param<const vector_type> vector)
+    : exec_{vector->get_executor()},
+      comm_{vector->get_communicator()},
+      buffer_{exec_},
+      host_buffer_{exec_->get_master()},
+      external_buffer_{},
+      external_host_buffer_{},
+      buffer_size_{},
+      uses_host_buffer_{}
+{}
+
+
+template <typename ValueType>
+FusedReduction<ValueType>::FusedReduction(ptr_param<const vector_type> vector,
+                                          array<absolute_type>& buffer,
+                                          array<absolute_type>& host_buffer)
+    : FusedReduction(vector)
+{
+    external_buffer_ = &buffer;
+    external_host_buffer_ = &host_buffer;
+}
+
+
+template <typename ValueType>
+array<remove_complex<ValueType>>& FusedReduction<ValueType>::get_buffer()
+{
+    return external_buffer_ ? *external_buffer_ : buffer_;
+}
+
+
+template <typename ValueType>
+array<remove_complex<ValueType>>& FusedReduction<ValueType>::get_host_buffer()
+{
+    return external_host_buffer_ ? *external_host_buffer_ : host_buffer_;
+}
+
+
+template <typename ValueType>
+FusedReduction<ValueType>& FusedReduction<ValueType>::add_dot(
+    ptr_param<const vector_type> a, ptr_param<const vector_type> b,
+    ptr_param<LinOp> result)
+{
+    return this->add(reduction_kind::dot, a.get(), b.get(), result.get());
+}
+
+
+template <typename ValueType>
+FusedReduction<ValueType>& FusedReduction<ValueType>::add_conj_dot(
+    ptr_param<const vector_type> a, ptr_param<const vector_type> b,
+    ptr_param<LinOp> result)
+{
+    return this->add(reduction_kind::conj_dot, a.get(), b.get(), result.get());
+}
+
+
+template <typename ValueType>
+FusedReduction<ValueType>& FusedReduction<ValueType>::add_squared_norm2(
+    ptr_param<const vector_type> a, ptr_param<LinOp> result)
+{
+    return this->add(reduction_kind::squared_norm2, a.get(), nullptr,
+                     result.get());
+}
+
+
+template <typename ValueType>
+FusedReduction<ValueType>& FusedReduction<ValueType>::add_norm2(
+    ptr_param<const vector_type> a, ptr_param<LinOp> result)
+{
+    return this->add(reduction_kind::norm2, a.get(), nullptr, result.get());
+}
+
+
+template <typename ValueType>
+FusedReduction<ValueType>& FusedReduction<ValueType>::add(
+    reduction_kind kind, const vector_type* a, const vector_type* b,
+    LinOp* result)
+{
+    const auto num_cols = a->get_size()[1];
+    GKO_ASSERT_EQUAL_DIMENSIONS(result, dim<2>(1, num_cols));
+    if (b) {
+        GKO_ASSERT_EQUAL_DIMENSIONS(a, b);
+    }
+    entries_.push_back({kind, a, b, result, buffer_size_});
+    // dot products are stored as (possibly complex) ValueType, norms as
+    // their real counterpart, both packed into a buffer of real values
+    const auto is_dot =
+        kind == reduction_kind::dot || kind == reduction_kind::conj_dot;
+    buffer_size_ += is_dot && is_complex<ValueType>() ? 2 * num_cols : num_cols;
+    return *this;
+}
+
+
+template <typename ValueType>
+mpi::request& FusedReduction<ValueType>::start(array<char>& tmp)
+{
+    if (entries_.empty()) {
+        return request_;
+    }
+    auto& buffer = this->get_buffer();
+    if (buffer.get_executor() != exec_) {
+        buffer.set_executor(exec_);
+    }
+    // only reallocates if the size changed
+    buffer.resize_and_reset(buffer_size_);
+    for (const auto& entry : entries_) {
+        const auto num_cols = entry.a->get_size()[1];
+        auto values = buffer.get_data() + entry.offset;
+        const auto local_a = entry.a->get_local_vector();
+        switch (entry.kind) {
+        case reduction_kind::dot:
+        case reduction_kind::conj_dot: {
+            auto local_res = matrix::Dense<ValueType>::create(
+                exec_, dim<2>{1, num_cols},
+                make_array_view(exec_, num_cols,
+                                reinterpret_cast<ValueType*>(values)),
+                num_cols);
+            if (entry.kind == reduction_kind::dot) {
+                local_a->compute_dot(entry.b->get_local_vector(), local_res,
+                                     tmp);
+            } else {
+                local_a->compute_conj_dot(entry.b->get_local_vector(),
+                                          local_res, tmp);
+            }
+            break;
+        }
+        case reduction_kind::squared_norm2:
+        case reduction_kind::norm2: {
+            auto local_res = matrix::Dense<absolute_type>::create(
+                exec_, dim<2>{1, num_cols},
+                make_array_view(exec_, num_cols, values), num_cols);
+            exec_->run(vector::make_compute_squared_norm2(
+                local_a, local_res.get(), tmp));
+            break;
+        }
+        }
+    }
+    exec_->synchronize();
+    uses_host_buffer_ = mpi::requires_host_buffer(exec_, comm_);
+    if (uses_host_buffer_) {
+        auto& host_buffer = this->get_host_buffer();
+        if (host_buffer.get_executor() != exec_->get_master()) {
+            host_buffer.set_executor(exec_->get_master());
+        }
+        host_buffer = buffer;
+        request_ = comm_.i_all_reduce(exec_->get_master(),
+                                      host_buffer.get_data(),
+                                      static_cast<int>(buffer_size_), MPI_SUM);
+    } else {
+        request_ = comm_.i_all_reduce(exec_, buffer.get_data(),
+                                      static_cast<int>(buffer_size_), MPI_SUM);
+    }
+    return request_;
+}
+
+
+template <typename ValueType>
+void FusedReduction<ValueType>::finish()
+{
+    if (entries_.empty()) {
+        return;
+    }
+    exec_->run(vector::make_wait(request_));
+    auto& buffer = this->get_buffer();
+    if (uses_host_buffer_) {
+        buffer = this->get_host_buffer();
+    }
+    for (const auto& entry : entries_) {
+        const auto num_cols = entry.a->get_size()[1];
+        auto values = buffer.get_data() + entry.offset;
+        switch (entry.kind) {
+        case reduction_kind::dot:
+        case reduction_kind::conj_dot: {
+            auto global_res = matrix::Dense<ValueType>::create(
+                exec_, dim<2>{1, num_cols},
+                make_array_view(exec_, num_cols,
+                                reinterpret_cast<ValueType*>(values)),
+                num_cols);
+            as<matrix::Dense<ValueType>>(entry.result)
+                ->copy_from(global_res.get());
+            break;
+        }
+        case reduction_kind::squared_norm2:
+        case reduction_kind::norm2: {
+            auto global_res = matrix::Dense<absolute_type>::create(
+                exec_, dim<2>{1, num_cols},
+                make_array_view(exec_, num_cols, values), num_cols);
+            if (entry.kind == reduction_kind::norm2) {
+                exec_->run(vector::make_compute_sqrt(global_res.get()));
+            }
+            as<matrix::Dense<absolute_type>>(entry.result)
+                ->copy_from(global_res.get());
+            break;
+        }
+        }
+    }
+}
+
+
+template <typename ValueType>
+void FusedReduction<ValueType>::compute(array<char>& tmp)
+{
+    this->start(tmp);
+    this->finish();
+}
+
+
+template <typename ValueType>
+void FusedReduction<ValueType>::clear()
+{
+    entries_.clear();
+    buffer_size_ = 0;
+}
+
+
+#define GKO_DECLARE_DISTRIBUTED_FUSED_REDUCTION(ValueType) \
+    class FusedReduction<ValueType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE_BASE(
+    GKO_DECLARE_DISTRIBUTED_FUSED_REDUCTION);
+
+
 }  // namespace distributed
 }  // namespace experimental
 }  // namespace gko
@@ -0,0 +1,379 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/log/metrics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/stop/stopping_status.hpp>
+
+#include "core/log/profiler_hook.hpp"
+#include "core/log/thread_state.hpp"
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * The counters of a single thread. Only the owning thread updates them, so the
+ * increments need no atomic read-modify-write, but the values are atomic so
+ * other threads can read them at any time. The nesting state is only accessed
+ * by the owning thread.
+ */
+struct Metrics::thread_counters {
+    using clock = std::chrono::steady_clock;
+
+    /** An apply or generate call that has started, but not completed yet. */
+    struct open_call {
+        const void* object;
+        clock::time_point begin;
+        // the time of the completed calls nested in this one
+        int64 nested_time;
+    };
+
+    thread_counters() : values{}, thread{std::this_thread::get_id()} {}
+
+    void add(metric m, int64 value)
+    {
+        auto& counter = values[static_cast<int>(m)];
+        counter.store(counter.load(std::memory_order_relaxed) + value,
+                      std::memory_order_relaxed);
+    }
+
+    /**
+     * Pushes a call of object onto the stack of open calls. A call of the same
+     * object that is still open is assumed to be left over from a call that
+     * threw an exception, so it is dropped together with the calls nested in
+     * it.
+     */
+    static void start_call(std::vector<open_call>& open_calls,
+                           const void* object)
+    {
+        auto it = std::find_if(
+            open_calls.begin(), open_calls.end(),
+            [&](const open_call& call) { return call.object == object; });
+        open_calls.erase(it, open_calls.end());
+        open_calls.push_back({object, clock::now(), 0});
+    }
+
+    /**
+     * Pops the innermost open call of object off the stack, together with the
+     * calls nested in it that threw an exception, and adds its time without
+     * the time of its completed nested calls to the time metric m. Thus the
+     * time of properly nested calls is only counted once, and a call that
+     * threw an exception does not stop the time of the calls that follow.
+     */
+    void complete_call(std::vector<open_call>& open_calls, const void* object,
+                       metric m)
+    {
+        auto it = std::find_if(
+            open_calls.rbegin(), open_calls.rend(),
+            [&](const open_call& call) { return call.object == object; });
+        // ignore the completion of calls started before the logger was added
+        if (it == open_calls.rend()) {
+            return;
+        }
+        const auto pos = std::prev(it.base());
+        const int64 elapsed =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                                 pos->begin)
+                .count();
+        this->add(m, elapsed - pos->nested_time);
+        if (pos != open_calls.begin()) {
+            std::prev(pos)->nested_time += elapsed;
+        }
+        open_calls.erase(pos, open_calls.end());
+    }
+
+    std::array<std::atomic<int64>, num_metrics> values;
+    std::thread::id thread;
+    // set while the logger itself causes events, which are not counted
+    bool ignore_events{};
+    std::vector<open_call> open_applies;
+    std::vector<open_call> open_generates;
+};
+
+
+namespace {
+
+
+/**
+ * Sets a flag while in scope, and resets it also if the scope is left by an
+ * exception.
+ */
+class flag_guard {
+public:
+    explicit flag_guard(bool& flag) : flag_{flag} { flag_ = true; }
+
+    flag_guard(const flag_guard&) = delete;
+
+    flag_guard& operator=(const flag_guard&) = delete;
+
+    ~flag_guard() { flag_ = false; }
+
+private:
+    bool& flag_;
+};
+
+
+}  // namespace
+
+
+Metrics::Metrics() : Logger(mask_), id_{get_next_thread_state_owner_id()} {}
+
+
+Metrics::~Metrics() = default;
+
+
+Metrics::thread_counters* Metrics::get_thread_counters() const
+{
+    return get_thread_state(id_, mutex_, counters_, [](size_type) {
+        return std::make_unique<thread_counters>();
+    });
+}
+
+
+const char* Metrics::get_metric_name(metric m)
+{
+    switch (m) {
+    case metric::spmvs:
+        return "spmvs";
+    case metric::spmv_bytes:
+        return "spmv_bytes";
+    case metric::allocations:
+        return "allocations";
+    case metric::allocated_bytes:
+        return "allocated_bytes";
+    case metric::copies:
+        return "copies";
+    case metric::copied_bytes:
+        return "copied_bytes";
+    case metric::operations:
+        return "operations";
+    case metric::solves:
+        return "solves";
+    case metric::iterations:
+        return "iterations";
+    case metric::convergence_failures:
+        return "convergence_failures";
+    case metric::generates:
+        return "generates";
+    case metric::generate_time:
+        return "generate_time_ns";
+    case metric::apply_time:
+        return "apply_time_ns";
+    }
+    GKO_INVALID_STATE("unknown metric");
+}
+
+
+int64 Metrics::get_value(metric m) const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    int64 sum{};
+    for (const auto& counters : counters_) {
+        sum += counters->values[static_cast<int>(m)].load(
+            std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+
+std::map<std::string, int64> Metrics::get_snapshot() const
+{
+    std::array<int64, num_metrics> sums{};
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        for (const auto& counters : counters_) {
+            for (int i = 0; i < num_metrics; i++) {
+                sums[i] +=
+                    counters->values[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    std::map<std::string, int64> result;
+    for (int i = 0; i < num_metrics; i++) {
+        result[get_metric_name(static_cast<metric>(i))] = sums[i];
+    }
+    return result;
+}
+
+
+void Metrics::write_json(std::ostream& os) const
+{
+    const auto snapshot = this->get_snapshot();
+    os << '{';
+    bool first = true;
+    for (const auto& entry : snapshot) {
+        os << (first ? "" : ",") << '"' << entry.first
+           << "\":" << entry.second;
+        first = false;
+    }
+    os << "}\n";
+}
+
+
+void Metrics::on_allocation_completed(const Executor* exec,
+                                      const size_type& num_bytes,
+                                      const uintptr& location) const
+{
+    auto counters = this->get_thread_counters();
+    if (counters->ignore_events) {
+        return;
+    }
+    counters->add(metric::allocations, 1);
+    counters->add(metric::allocated_bytes, static_cast<int64>(num_bytes));
+}
+
+
+void Metrics::on_copy_completed(const Executor* from, const Executor* to,
+                                const uintptr& location_from,
+                                const uintptr& location_to,
+                                const size_type& num_bytes) const
+{
+    auto counters = this->get_thread_counters();
+    if (counters->ignore_events) {
+        return;
+    }
+    counters->add(metric::copies, 1);
+    counters->add(metric::copied_bytes, static_cast<int64>(num_bytes));
+}
+
+
+void Metrics::on_operation_launched(const Executor* exec,
+                                    const Operation* op) const
+{
+    auto counters = this->get_thread_counters();
+    if (!counters->ignore_events) {
+        counters->add(metric::operations, 1);
+    }
+}
+
+
+void Metrics::apply_started(const LinOp* A) const
+{
+    thread_counters::start_call(this->get_thread_counters()->open_applies, A);
+}
+
+
+void Metrics::apply_completed(const LinOp* A, const LinOp* b,
+                              bool advanced) const
+{
+    auto counters = this->get_thread_counters();
+    if (auto work = estimate_apply_work(A, b, advanced)) {
+        counters->add(metric::spmvs, 1);
+        counters->add(metric::spmv_bytes, work->bytes);
+    }
+    counters->complete_call(counters->open_applies, A, metric::apply_time);
+}
+
+
+void Metrics::on_linop_apply_started(const LinOp* A, const LinOp* b,
+                                     const LinOp* x) const
+{
+    this->apply_started(A);
+}
+
+
+void Metrics::on_linop_apply_completed(const LinOp* A, const LinOp* b,
+                                       const LinOp* x) const
+{
+    this->apply_completed(A, b, false);
+}
+
+
+void Metrics::on_linop_advanced_apply_started(const LinOp* A,
+                                              const LinOp* alpha,
+                                              const LinOp* b,
+                                              const LinOp* beta,
+                                              const LinOp* x) const
+{
+    this->apply_started(A);
+}
+
+
+void Metrics::on_linop_advanced_apply_completed(const LinOp* A,
+                                                const LinOp* alpha,
+                                                const LinOp* b,
+                                                const LinOp* beta,
+                                                const LinOp* x) const
+{
+    this->apply_completed(A, b, true);
+}
+
+
+void Metrics::on_linop_factory_generate_started(const LinOpFactory* factory,
+                                                const LinOp* input) const
+{
+    thread_counters::start_call(this->get_thread_counters()->open_generates,
+                                factory);
+}
+
+
+void Metrics::on_linop_factory_generate_completed(const LinOpFactory* factory,
+                                                  const LinOp* input,
+                                                  const LinOp* output) const
+{
+    auto counters = this->get_thread_counters();
+    counters->add(metric::generates, 1);
+    counters->complete_call(counters->open_generates, factory,
+                            metric::generate_time);
+}
+
+
+void Metrics::on_iteration_complete(const LinOp* solver, const LinOp* b,
+                                    const LinOp* x, const size_type& it,
+                                    const LinOp* r, const LinOp* tau,
+                                    const LinOp* implicit_tau_sq,
+                                    const array<stopping_status>* status,
+                                    bool stopped) const
+{
+    auto counters = this->get_thread_counters();
+    // iteration 0 is the initial state before the first iteration
+    if (it > 0) {
+        counters->add(metric::iterations, 1);
+    }
+    if (!stopped) {
+        return;
+    }
+    counters->add(metric::solves, 1);
+    if (status && status->get_size() > 0) {
+        const auto has_failed = [](const array<stopping_status>& host_status) {
+            const auto begin = host_status.get_const_data();
+            const auto end = begin + host_status.get_size();
+            return std::any_of(begin, end, [](const stopping_status& s) {
+                return !s.has_converged();
+            });
+        };
+        const auto exec = status->get_executor();
+        bool failed{};
+        if (exec == exec->get_master()) {
+            failed = has_failed(*status);
+        } else {
+            // the status is only copied once per solve, and the allocation and
+            // copy are not part of the measured program
+            flag_guard guard{counters->ignore_events};
+            failed = has_failed(
+                array<stopping_status>(exec->get_master(), *status));
+        }
+        if (failed) {
+            counters->add(metric::convergence_failures, 1);
+        }
+    }
+}
+
+
+}  // namespace log
+}  // namespace gko
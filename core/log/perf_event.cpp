@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/config.hpp>
+#include <ginkgo/core/log/profiler_hook.hpp>
+
+#include "core/log/profiler_hook.hpp"
+
+#ifdef __linux__
+#include <cstdlib>
+
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace gko {
+namespace log {
+
+
+#ifdef __linux__
+
+
+namespace {
+
+
+int open_counter(pid_t tid, uint64 config)
+{
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // also count threads that are created by this thread later on
+    attr.inherit = 1;
+    // measure the given thread on any CPU
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1,
+                                    PERF_FLAG_FD_CLOEXEC));
+}
+
+
+/**
+ * Returns the ids of all threads of this process. Thread pools like the one of
+ * OpenMP may already exist, so inheriting the counters of the calling thread
+ * is not sufficient.
+ */
+std::vector<pid_t> get_thread_ids()
+{
+    std::vector<pid_t> result;
+    if (auto dir = opendir("/proc/self/task")) {
+        while (auto entry = readdir(dir)) {
+            if (entry->d_name[0] != '.') {
+                result.push_back(static_cast<pid_t>(std::atol(entry->d_name)));
+            }
+        }
+        closedir(dir);
+    }
+    if (result.empty()) {
+        // fall back to the calling thread only
+        result.push_back(0);
+    }
+    return result;
+}
+
+
+int64 read_counter(int fd)
+{
+    uint64 value{};
+    if (fd < 0 || ::read(fd, &value, sizeof(value)) != sizeof(value)) {
+        return 0;
+    }
+    return static_cast<int64>(value);
+}
+
+
+}  // namespace
+
+
+perf_event_counters::perf_event_counters()
+{
+    for (auto tid : get_thread_ids()) {
+        fds_.push_back({{open_counter(tid, PERF_COUNT_HW_CPU_CYCLES),
+                         open_counter(tid, PERF_COUNT_HW_INSTRUCTIONS),
+                         open_counter(tid, PERF_COUNT_HW_CACHE_MISSES)}});
+    }
+}
+
+
+perf_event_counters::~perf_event_counters()
+{
+    for (const auto& thread_fds : fds_) {
+        for (auto fd : thread_fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+}
+
+
+ProfilerHook::hardware_counters perf_event_counters::read() const
+{
+    ProfilerHook::hardware_counters result{};
+    for (const auto& thread_fds : fds_) {
+        result.cycles += read_counter(thread_fds[0]);
+        result.instructions += read_counter(thread_fds[1]);
+        result.llc_misses += read_counter(thread_fds[2]);
+    }
+    return result;
+}
+
+
+#else
+
+
+perf_event_counters::perf_event_counters() = default;
+
+
+perf_event_counters::~perf_event_counters() = default;
+
+
+ProfilerHook::hardware_counters perf_event_counters::read() const
+{
+    return {};
+}
+
+
+#endif
+
+
+bool perf_event_counters::is_available() const
+{
+    for (const auto& thread_fds : fds_) {
+        for (auto fd : thread_fds) {
+            if (fd >= 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+
+}  // namespace log
+}  // namespace gko
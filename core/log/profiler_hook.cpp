@@ -29,9 +29,12 @@ void ProfilerHook::on_allocation_started(const gko::Executor* exec,
 
 
 void ProfilerHook::on_allocation_completed(const gko::Executor* exec,
-                                           const gko::size_type&,
-                                           const gko::uintptr&) const
+                                           const gko::size_type& num_bytes,
+                                           const gko::uintptr& location) const
 {
+    if (allocation_hook_) {
+        allocation_hook_(exec, location, num_bytes);
+    }
     this->maybe_synchronize(exec);
     this->end_hook_("allocate", profile_event_category::memory);
 }
@@ -46,8 +49,11 @@ void ProfilerHook::on_free_started(const gko::Executor* exec,
 
 
 void ProfilerHook::on_free_completed(const gko::Executor* exec,
-                                     const gko::uintptr&) const
+                                     const gko::uintptr& location) const
 {
+    if (free_hook_) {
+        free_hook_(exec, location);
+    }
     this->maybe_synchronize(exec);
     this->end_hook_("free", profile_event_category::memory);
 }
@@ -141,6 +147,7 @@ void ProfilerHook::on_linop_apply_started(const LinOp* A, const LinOp* b,
     std::stringstream ss;
     ss << "apply(" << stringify_object(A) << ")";
     this->begin_hook_(ss.str().c_str(), profile_event_category::linop);
+    this->annotate_apply_work(A, b, false);
     if (dynamic_cast<const solver::IterativeBase*>(A)) {
         this->begin_hook_("iteration", profile_event_category::solver);
     }
@@ -168,6 +175,7 @@ void ProfilerHook::on_linop_advanced_apply_started(const LinOp* A,
     std::stringstream ss;
     ss << "advanced_apply(" << stringify_object(A) << ")";
     this->begin_hook_(ss.str().c_str(), profile_event_category::linop);
+    this->annotate_apply_work(A, b, true);
     if (dynamic_cast<const solver::IterativeBase*>(A)) {
         this->begin_hook_("iteration", profile_event_category::solver);
     }
@@ -327,8 +335,26 @@ std::string ProfilerHook::stringify_object(const PolymorphicObject* obj) const
 }
 
 
-ProfilerHook::ProfilerHook(hook_function begin, hook_function end)
-    : synchronize_{false}, begin_hook_{begin}, end_hook_{end}
+void ProfilerHook::annotate_apply_work(const LinOp* A, const LinOp* b,
+                                       bool advanced) const
+{
+    if (work_hook_) {
+        if (auto work = estimate_apply_work(A, b, advanced)) {
+            work_hook_(*work);
+        }
+    }
+}
+
+
+ProfilerHook::ProfilerHook(hook_function begin, hook_function end,
+                           work_function work, allocation_function allocate,
+                           free_function free)
+    : synchronize_{false},
+      begin_hook_{begin},
+      end_hook_{end},
+      work_hook_{std::move(work)},
+      allocation_hook_{std::move(allocate)},
+      free_hook_{std::move(free)}
 {}
 
 
@@ -6,7 +6,9 @@
 #define GKO_CORE_LOG_PROFILER_HOOK_HPP_
 
 
+#include <array>
 #include <optional>
+#include <vector>
 
 #include <ginkgo/core/log/profiler_hook.hpp>
 
@@ -61,6 +63,47 @@ void end_roctx(const char*, profile_event_category);
 void finalize_tau();
 
 
+/**
+ * Reads the hardware counters of all threads of the process through the Linux
+ * `perf_event_open` interface. It opens one set of counters for each thread
+ * that exists on creation, which also count the threads created by them later
+ * on. If a counter can't be opened, its value is always zero.
+ */
+class perf_event_counters {
+public:
+    perf_event_counters();
+
+    ~perf_event_counters();
+
+    perf_event_counters(const perf_event_counters&) = delete;
+
+    perf_event_counters& operator=(const perf_event_counters&) = delete;
+
+    /** Returns true if at least one of the counters could be opened. */
+    bool is_available() const;
+
+    /** Returns the current counter values. */
+    ProfilerHook::hardware_counters read() const;
+
+private:
+    // one file descriptor per counter for each thread
+    std::vector<std::array<int, 3>> fds_;
+};
+
+
+/**
+ * Returns the modeled work of applying A to b, if A is a Dense, Csr, Coo or
+ * Ell matrix.
+ *
+ * @param A  the applied LinOp
+ * @param b  the right-hand side
+ * @param advanced  whether this is an advanced apply x = alpha A b + beta x
+ */
+std::optional<ProfilerHook::work_estimate> estimate_apply_work(const LinOp* A,
+                                                               const LinOp* b,
+                                                               bool advanced);
+
+
 class default_profiling_scope_guard : log::profiling_scope_guard {
 public:
     default_profiling_scope_guard(const char* name)
@@ -2,12 +2,16 @@
 //
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
 #include <numeric>
 #include <unordered_map>
 #include <vector>
 
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+
 #include "core/log/profiler_hook.hpp"
 
 
@@ -141,9 +145,19 @@ struct summary : summary_base {
     std::vector<std::pair<int64, time_point>> stack;
     std::unordered_map<std::string, int64> name_map;
     std::vector<ProfilerHook::summary_entry> entries;
-
-    summary(std::shared_ptr<Timer> timer) : summary_base{std::move(timer)}
+    // only used for performance summaries: the hardware counters at the start
+    // of each range on the stack, and the work annotated inside of it so far
+    std::unique_ptr<perf_event_counters> counters;
+    std::vector<std::pair<ProfilerHook::hardware_counters,
+                          ProfilerHook::work_estimate>>
+        perf_stack;
+
+    summary(std::shared_ptr<Timer> timer, bool collect_counters = false)
+        : summary_base{std::move(timer)}
     {
+        if (collect_counters) {
+            counters = std::make_unique<perf_event_counters>();
+        }
         push("total");
     }
 
@@ -162,6 +176,10 @@ struct summary : summary_base {
             entries.back().name = name;
         }
         const auto id = it->second;
+        if (counters) {
+            perf_stack.emplace_back(counters->read(),
+                                    ProfilerHook::work_estimate{});
+        }
         auto now = get_current_time_point();
         stack.emplace_back(id, std::move(now));
         overhead += cpu_clock::now() - cpu_now;
@@ -172,6 +190,8 @@ struct summary : summary_base {
         const auto cpu_now = cpu_clock::now();
         std::lock_guard<std::mutex> guard{mutex};
         auto now = get_current_time_point();
+        const auto end_counters =
+            counters ? counters->read() : ProfilerHook::hardware_counters{};
         if (!check_pop_status(*this, name, allow_pop_root)) {
             return;
         }
@@ -179,6 +199,22 @@ struct summary : summary_base {
         auto partial_entry = std::move(stack.back());
         stack.pop_back();
         auto& entry = entries[id];
+        if (counters) {
+            const auto start = perf_stack.back();
+            perf_stack.pop_back();
+            entry.counters.cycles += end_counters.cycles - start.first.cycles;
+            entry.counters.instructions +=
+                end_counters.instructions - start.first.instructions;
+            entry.counters.llc_misses +=
+                end_counters.llc_misses - start.first.llc_misses;
+            entry.work.bytes += start.second.bytes;
+            entry.work.flops += start.second.flops;
+            if (!perf_stack.empty()) {
+                // the work of nested ranges is included in the parent range
+                perf_stack.back().second.bytes += start.second.bytes;
+                perf_stack.back().second.flops += start.second.flops;
+            }
+        }
         const auto cpu_now2 = cpu_clock::now();
         // we need to exclude the wait for the timer from the overhead
         // measurement
@@ -197,6 +233,15 @@ struct summary : summary_base {
         overhead += (cpu_now4 - cpu_now3) + (cpu_now2 - cpu_now);
     }
 
+    void add_work(const ProfilerHook::work_estimate& work)
+    {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (!broken && !perf_stack.empty()) {
+            perf_stack.back().second.bytes += work.bytes;
+            perf_stack.back().second.flops += work.flops;
+        }
+    }
+
     const std::string& get_top_name() const
     {
         return entries[stack.back().first].name;
@@ -324,6 +369,232 @@ struct nested_summary : summary_base {
 };
 
 
+struct memory_summary {
+    struct node {
+        int64 name_id;
+        int64 parent_id;
+        int64 count{};
+        // the statistics for each executor
+        std::vector<int64> peak_bytes;
+        std::vector<int64> allocated_bytes;
+        std::vector<int64> num_allocations;
+
+        node(int64 name_id, int64 parent_id)
+            : name_id{name_id}, parent_id{parent_id}
+        {}
+    };
+
+    struct partial_entry {
+        int64 node_id;
+        // the live bytes of each executor when the range began, and their
+        // maximum since then
+        std::vector<int64> start_bytes;
+        std::vector<int64> max_bytes;
+
+        partial_entry(int64 node_id, std::vector<int64> live_bytes)
+            : node_id{node_id},
+              start_bytes{live_bytes},
+              max_bytes{std::move(live_bytes)}
+        {}
+    };
+
+    struct pair_hash {
+        int64 operator()(std::pair<int64, int64> pair) const
+        {
+            return pair.first ^ (pair.second << 32);
+        }
+    };
+
+    bool broken{};
+    bool check_nesting{};
+    std::mutex mutex{};
+    std::vector<partial_entry> stack;
+    std::unordered_map<std::pair<int64, int64>, int64, pair_hash> node_map;
+    std::unordered_map<std::string, int64> name_map;
+    std::vector<node> nodes;
+    std::vector<std::string> names;
+    std::unordered_map<const Executor*, int64> executor_map;
+    std::vector<std::string> executor_names;
+    std::vector<int64> live_bytes;
+    // the size of each live allocation on each executor
+    std::vector<std::unordered_map<uintptr, int64>> allocations;
+
+    memory_summary() { push("total"); }
+
+    int64 get_or_add_name_id(const char* name)
+    {
+        const auto it = name_map.find(name);
+        if (it != name_map.end()) {
+            return it->second;
+        }
+        const auto name_id = static_cast<int64>(names.size());
+        name_map.emplace_hint(it, name, name_id);
+        names.push_back(name);
+        return name_id;
+    }
+
+    int64 get_or_add_node_id(int64 name_id)
+    {
+        const auto parent_id = get_parent_id();
+        const auto pair = std::make_pair(name_id, parent_id);
+        const auto it = node_map.find(pair);
+        if (it != node_map.end()) {
+            return it->second;
+        }
+        const auto node_id = static_cast<int64>(nodes.size());
+        node_map.emplace_hint(it, pair, node_id);
+        nodes.emplace_back(name_id, parent_id);
+        return node_id;
+    }
+
+    int64 get_or_add_executor_id(const Executor* exec)
+    {
+        const auto it = executor_map.find(exec);
+        if (it != executor_map.end()) {
+            return it->second;
+        }
+        const auto exec_id = static_cast<int64>(executor_names.size());
+        executor_map.emplace_hint(it, exec, exec_id);
+        auto name = name_demangling::get_type_name(typeid(*exec));
+        // distinguish multiple executors of the same type
+        const auto same_type =
+            std::count_if(executor_names.begin(), executor_names.end(),
+                          [&](const std::string& other) {
+                              return other.compare(0, name.size(), name) == 0;
+                          });
+        if (same_type > 0) {
+            name += " #" + std::to_string(same_type + 1);
+        }
+        executor_names.push_back(std::move(name));
+        live_bytes.push_back(0);
+        allocations.emplace_back();
+        for (auto& entry : stack) {
+            entry.start_bytes.push_back(0);
+            entry.max_bytes.push_back(0);
+        }
+        return exec_id;
+    }
+
+    int64 get_parent_id() const
+    {
+        return stack.empty() ? int64{-1} : stack.back().node_id;
+    }
+
+    void push(const char* name, profile_event_category category =
+                                    profile_event_category::internal)
+    {
+        // allocations and frees are attributed to the surrounding range
+        if (broken || category == profile_event_category::memory) {
+            return;
+        }
+        std::lock_guard<std::mutex> guard{mutex};
+        const auto name_id = get_or_add_name_id(name);
+        const auto node_id = get_or_add_node_id(name_id);
+        stack.emplace_back(node_id, live_bytes);
+    }
+
+    void pop(const char* name, bool allow_pop_root = false,
+             profile_event_category category =
+                 profile_event_category::internal)
+    {
+        if (category == profile_event_category::memory) {
+            return;
+        }
+        std::lock_guard<std::mutex> guard{mutex};
+        if (!check_pop_status(*this, name, allow_pop_root)) {
+            return;
+        }
+        const auto entry = std::move(stack.back());
+        stack.pop_back();
+        auto& node = nodes[entry.node_id];
+        const auto num_executors = executor_names.size();
+        node.peak_bytes.resize(num_executors);
+        node.allocated_bytes.resize(num_executors);
+        node.num_allocations.resize(num_executors);
+        for (std::size_t exec_id = 0; exec_id < num_executors; exec_id++) {
+            node.peak_bytes[exec_id] =
+                std::max(node.peak_bytes[exec_id],
+                         entry.max_bytes[exec_id] - entry.start_bytes[exec_id]);
+        }
+        node.count++;
+    }
+
+    void allocate(const Executor* exec, uintptr location, size_type num_bytes)
+    {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (broken) {
+            return;
+        }
+        const auto exec_id = get_or_add_executor_id(exec);
+        const auto bytes = static_cast<int64>(num_bytes);
+        allocations[exec_id][location] = bytes;
+        live_bytes[exec_id] += bytes;
+        for (auto& entry : stack) {
+            entry.max_bytes[exec_id] =
+                std::max(entry.max_bytes[exec_id], live_bytes[exec_id]);
+            auto& node = nodes[entry.node_id];
+            node.allocated_bytes.resize(executor_names.size());
+            node.num_allocations.resize(executor_names.size());
+            node.allocated_bytes[exec_id] += bytes;
+            node.num_allocations[exec_id]++;
+        }
+    }
+
+    void free(const Executor* exec, uintptr location)
+    {
+        std::lock_guard<std::mutex> guard{mutex};
+        // ignore memory that was allocated before the logger was created
+        const auto exec_it = executor_map.find(exec);
+        if (exec_it == executor_map.end()) {
+            return;
+        }
+        const auto exec_id = exec_it->second;
+        const auto it = allocations[exec_id].find(location);
+        if (it == allocations[exec_id].end()) {
+            return;
+        }
+        live_bytes[exec_id] -= it->second;
+        allocations[exec_id].erase(it);
+    }
+
+    const std::string& get_top_name() const
+    {
+        return names[nodes[stack.back().node_id].name_id];
+    }
+
+    /** Returns the tree of ranges with the statistics of an executor. */
+    ProfilerHook::memory_summary_entry build_tree(std::size_t exec_id) const
+    {
+        std::vector<std::vector<int64>> children(nodes.size());
+        for (std::size_t node_id = 0; node_id < nodes.size(); node_id++) {
+            if (nodes[node_id].parent_id >= 0) {
+                children[nodes[node_id].parent_id].push_back(node_id);
+            }
+        }
+        const auto get_stat = [&](const std::vector<int64>& stats) {
+            return exec_id < stats.size() ? stats[exec_id] : int64{};
+        };
+        using entry_type = ProfilerHook::memory_summary_entry;
+        auto visit_node = [&](auto visit_node, int64 node_id,
+                              entry_type& entry) -> void {
+            const auto& node = nodes[node_id];
+            entry.name = names[node.name_id];
+            entry.peak_bytes = get_stat(node.peak_bytes);
+            entry.allocated_bytes = get_stat(node.allocated_bytes);
+            entry.num_allocations = get_stat(node.num_allocations);
+            entry.count = node.count;
+            for (const auto child_id : children[node_id]) {
+                entry.children.emplace_back();
+                visit_node(visit_node, child_id, entry.children.back());
+            }
+        };
+        entry_type root;
+        visit_node(visit_node, 0, root);
+        return root;
+    }
+};
+
+
 ProfilerHook::nested_summary_entry build_tree(const nested_summary& summary)
 {
     ProfilerHook::nested_summary_entry root;
@@ -391,6 +662,65 @@ std::shared_ptr<ProfilerHook> ProfilerHook::create_summary(
 }
 
 
+std::shared_ptr<ProfilerHook> ProfilerHook::create_perf_summary(
+    std::shared_ptr<Timer> timer, std::unique_ptr<SummaryWriter> writer,
+    bool debug_check_nesting)
+{
+    // we need to wrap the deleter in a shared_ptr to deal with a GCC 5.5 bug
+    // related to move-only functors
+    std::shared_ptr<summary> data{
+        new summary{std::move(timer), true},
+        [writer = std::shared_ptr<SummaryWriter>{std::move(writer)}](
+            summary* ptr) {
+            // clean up open ranges
+            pop_all(*ptr);
+            writer->write(ptr->entries, ptr->overhead);
+            delete ptr;
+        }};
+    data->check_nesting = debug_check_nesting;
+    return std::shared_ptr<ProfilerHook>{new ProfilerHook{
+        [data](const char* name, profile_event_category) { data->push(name); },
+        [data](const char* name, profile_event_category) { data->pop(name); },
+        [data](const work_estimate& work) { data->add_work(work); }}};
+}
+
+
+std::shared_ptr<ProfilerHook> ProfilerHook::create_memory_summary(
+    std::unique_ptr<MemorySummaryWriter> writer, bool debug_check_nesting)
+{
+    // we need to wrap the deleter in a shared_ptr to deal with a GCC 5.5 bug
+    // related to move-only functors
+    std::shared_ptr<memory_summary> data{
+        new memory_summary{},
+        [writer = std::shared_ptr<MemorySummaryWriter>{std::move(writer)}](
+            memory_summary* ptr) {
+            // clean up open ranges
+            pop_all(*ptr);
+            for (std::size_t exec_id = 0;
+                 exec_id < ptr->executor_names.size(); exec_id++) {
+                writer->write_memory(ptr->executor_names[exec_id],
+                                     ptr->build_tree(exec_id));
+            }
+            delete ptr;
+        }};
+    data->check_nesting = debug_check_nesting;
+    return std::shared_ptr<ProfilerHook>{new ProfilerHook{
+        [data](const char* name, profile_event_category category) {
+            data->push(name, category);
+        },
+        [data](const char* name, profile_event_category category) {
+            data->pop(name, false, category);
+        },
+        {},
+        [data](const Executor* exec, uintptr location, size_type num_bytes) {
+            data->allocate(exec, location, num_bytes);
+        },
+        [data](const Executor* exec, uintptr location) {
+            data->free(exec, location);
+        }}};
+}
+
+
 std::shared_ptr<ProfilerHook> ProfilerHook::create_nested_summary(
     std::shared_ptr<Timer> timer, std::unique_ptr<NestedSummaryWriter> writer,
     bool debug_check_nesting)
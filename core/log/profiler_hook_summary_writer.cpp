@@ -52,21 +52,62 @@ std::string format_fraction(std::chrono::nanoseconds part,
 }
 
 
+std::string format_bytes(int64 bytes)
+{
+    std::stringstream ss;
+    ss << std::setprecision(1) << std::fixed;
+    std::array<const char*, 5> units{{"B  ", "KiB", "MiB", "GiB", "TiB"}};
+    auto value = static_cast<double>(bytes);
+    std::size_t unit = 0;
+    while (value >= 1024.0 && unit + 1 < units.size()) {
+        value /= 1024.0;
+        unit++;
+    }
+    ss << value << ' ' << units[unit];
+    return ss.str();
+}
+
+
+std::string format_number(double value)
+{
+    std::stringstream ss;
+    ss << std::setprecision(1) << std::fixed << value;
+    return ss.str();
+}
+
+
+/** Formats `part / whole`, or "-" if either of them is zero. */
+std::string format_ratio(double part, double whole, double scale = 1.0)
+{
+    if (part <= 0.0 || whole <= 0.0) {
+        return "-";
+    }
+    return format_number(part / whole * scale);
+}
+
+
+/**
+ * The number of bytes transferred from memory for each last-level cache miss,
+ * assuming 64 byte cache lines.
+ */
+constexpr double cache_line_bytes = 64.0;
+
+
 template <std::size_t size>
 void print_table(const std::array<std::string, size>& headers,
                  const std::vector<std::array<std::string, size>>& table,
                  std::ostream& stream)
 {
     std::array<std::size_t, size> widths;
-    for (int i = 0; i < widths.size(); i++) {
+    for (std::size_t i = 0; i < widths.size(); i++) {
         widths[i] = headers[i].size();
     }
     for (const auto& row : table) {
-        for (int i = 0; i < widths.size(); i++) {
+        for (std::size_t i = 0; i < widths.size(); i++) {
             widths[i] = std::max(widths[i], row[i].size());
         }
     }
-    for (int i = 0; i < widths.size(); i++) {
+    for (std::size_t i = 0; i < widths.size(); i++) {
         stream << '|';
         const auto align1 = (widths[i] - headers[i].size()) / 2;
         const auto align2 = (widths[i] - headers[i].size()) - align1;
@@ -74,14 +115,14 @@ void print_table(const std::array<std::string, size>& headers,
                << std::string(align2, ' ');
     }
     stream << "|\n";
-    for (int i = 0; i < widths.size(); i++) {
+    for (std::size_t i = 0; i < widths.size(); i++) {
         stream << '|';
         // right-align for Markdown, assuming widths[i] > 0
         stream << std::string(widths[i] - 1, '-') << (i == 0 ? '-' : ':');
     }
     stream << "|\n";
     for (const auto& row : table) {
-        for (int i = 0; i < widths.size(); i++) {
+        for (std::size_t i = 0; i < widths.size(); i++) {
             stream << '|';
             stream << std::setw(widths[i]) << (i > 0 ? std::right : std::left)
                    << row[i];
@@ -95,8 +136,9 @@ void print_table(const std::array<std::string, size>& headers,
 
 
 ProfilerHook::TableSummaryWriter::TableSummaryWriter(std::ostream& output,
-                                                     std::string header)
-    : output_{&output}, header_{std::move(header)}
+                                                     std::string header,
+                                                     roofline_peak peak)
+    : output_{&output}, header_{std::move(header)}, peak_{peak}
 {}
 
 
@@ -125,6 +167,47 @@ void ProfilerHook::TableSummaryWriter::write(
             " " + format_avg_duration(entry.exclusive, entry.count) + " "});
     }
     print_table(headers, table, *output_);
+    std::vector<std::array<std::string, 9>> perf_table;
+    std::array<std::string, 9> perf_headers(
+        {" name ", " total ", " IPC ", " LLC GB/s ", " GB/s ", " GFLOP/s ",
+         " FLOP/byte ", " % peak GB/s ", " % roofline "});
+    for (const auto& entry : sorted_entries) {
+        if (entry.counters.cycles == 0 && entry.work.bytes == 0) {
+            continue;
+        }
+        // bytes per nanosecond are GB/s
+        const auto time = static_cast<double>(entry.inclusive.count());
+        const auto bytes = static_cast<double>(entry.work.bytes);
+        const auto flops = static_cast<double>(entry.work.flops);
+        const auto llc_bytes =
+            static_cast<double>(entry.counters.llc_misses) * cache_line_bytes;
+        // prefer the modeled traffic, but fall back to the measured traffic
+        const auto bandwidth = bytes > 0.0 ? bytes / time : llc_bytes / time;
+        std::string roofline = "-";
+        if (flops > 0.0 && bytes > 0.0 && peak_.flops > 0.0 &&
+            peak_.bandwidth > 0.0) {
+            const auto bound =
+                std::min(peak_.flops, flops / bytes * peak_.bandwidth);
+            roofline = format_ratio(flops / time, bound, 100.0);
+        }
+        perf_table.emplace_back(std::array<std::string, 9>{
+            " " + entry.name + " ",
+            " " + format_duration(entry.inclusive) + " ",
+            " " +
+                format_ratio(static_cast<double>(entry.counters.instructions),
+                             static_cast<double>(entry.counters.cycles)) +
+                " ",
+            " " + format_ratio(llc_bytes, time) + " ",
+            " " + format_ratio(bytes, time) + " ",
+            " " + format_ratio(flops, time) + " ",
+            " " + format_ratio(flops, bytes) + " ",
+            " " + format_ratio(bandwidth, peak_.bandwidth, 100.0) + " ",
+            " " + roofline + " "});
+    }
+    if (!perf_table.empty()) {
+        (*output_) << "Performance summary\n";
+        print_table(perf_headers, perf_table, *output_);
+    }
 }
 
 
@@ -183,5 +266,37 @@ void ProfilerHook::TableSummaryWriter::write_nested(
 }
 
 
+void ProfilerHook::TableSummaryWriter::write_memory(
+    const std::string& executor, const memory_summary_entry& root)
+{
+    (*output_) << header_ << " (" << executor << ")\n";
+    std::vector<std::array<std::string, 5>> table;
+    std::array<std::string, 5> headers(
+        {" name ", " peak ", " allocated ", " allocations ", " count "});
+    auto visitor = [&table](auto visitor, const memory_summary_entry& node,
+                            std::size_t depth) -> void {
+        std::vector<int64> child_permutation(node.children.size());
+        std::iota(child_permutation.begin(), child_permutation.end(), 0);
+        std::stable_sort(child_permutation.begin(), child_permutation.end(),
+                         [&node](int64 lhs, int64 rhs) {
+                             // sort by peak memory in descending order
+                             return node.children[lhs].peak_bytes >
+                                    node.children[rhs].peak_bytes;
+                         });
+        table.emplace_back(std::array<std::string, 5>{
+            std::string(2 * depth + 1, ' ') + node.name + " ",
+            " " + format_bytes(node.peak_bytes) + " ",
+            " " + format_bytes(node.allocated_bytes) + " ",
+            " " + std::to_string(node.num_allocations) + " ",
+            " " + std::to_string(node.count) + " "});
+        for (const auto child_id : child_permutation) {
+            visitor(visitor, node.children[child_id], depth + 1);
+        }
+    };
+    visitor(visitor, root, 0);
+    print_table(headers, table, *output_);
+}
+
+
 }  // namespace log
 }  // namespace gko
@@ -0,0 +1,364 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/log/solver_timeline.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <limits>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+// the names of the registered kernels, e.g. dense::compute_dot_dispatch
+constexpr std::array<const char*, 2> communication_operations{
+    {"mpi_all_reduce", "mpi_wait"}};
+constexpr std::array<const char*, 10> reduction_operations{
+    {"dense::compute_dot_dispatch", "dense::compute_conj_dot_dispatch",
+     "dense::compute_norm2_dispatch", "dense::compute_norm1",
+     "dense::compute_squared_norm2", "dense::compute_mean", "gmres::multi_dot",
+     "components::reduce_add_array", "residual_norm::residual_norm",
+     "implicit_residual_norm::implicit_residual_norm"}};
+
+
+template <std::size_t size>
+bool is_one_of(const char* name, const std::array<const char*, size>& names)
+{
+    return std::any_of(names.begin(), names.end(), [&](const char* entry) {
+        return std::strcmp(name, entry) == 0;
+    });
+}
+
+
+timeline_category classify_operation(const char* name)
+{
+    if (is_one_of(name, communication_operations)) {
+        return timeline_category::communication;
+    }
+    if (is_one_of(name, reduction_operations)) {
+        return timeline_category::reduction;
+    }
+    return timeline_category::vector_update;
+}
+
+
+template <typename ValueType>
+bool compute_first_column_norm(const LinOp* op, double& value)
+{
+    auto dense = dynamic_cast<const matrix::Dense<ValueType>*>(op);
+    if (!dense || dense->get_size()[1] == 0) {
+        return false;
+    }
+    // computed on the host to avoid logging additional operations
+    auto host =
+        make_temporary_clone(dense->get_executor()->get_master(), dense);
+    double sum{};
+    for (size_type row = 0; row < host->get_size()[0]; row++) {
+        sum += static_cast<double>(squared_norm(host->at(row, 0)));
+    }
+    value = std::sqrt(sum);
+    return true;
+}
+
+
+bool compute_first_column_norm(const LinOp* op, double& value)
+{
+    return op && (compute_first_column_norm<double>(op, value) ||
+                  compute_first_column_norm<float>(op, value) ||
+                  compute_first_column_norm<std::complex<double>>(op, value) ||
+                  compute_first_column_norm<std::complex<float>>(op, value));
+}
+
+
+template <typename ValueType>
+bool read_first_value(const LinOp* op, double& value)
+{
+    auto dense = dynamic_cast<const matrix::Dense<ValueType>*>(op);
+    if (!dense || dense->get_size()[0] == 0 || dense->get_size()[1] == 0) {
+        return false;
+    }
+    auto host =
+        make_temporary_clone(dense->get_executor()->get_master(), dense);
+    value = static_cast<double>(abs(host->at(0, 0)));
+    return true;
+}
+
+
+bool read_first_value(const LinOp* op, double& value)
+{
+    return op && (read_first_value<double>(op, value) ||
+                  read_first_value<float>(op, value) ||
+                  read_first_value<std::complex<double>>(op, value) ||
+                  read_first_value<std::complex<float>>(op, value));
+}
+
+
+}  // namespace
+
+
+SolverTimeline::SolverTimeline()
+    : Logger(mask_),
+      solver_{},
+      system_matrix_{},
+      preconditioner_{},
+      num_solves_{},
+      depth_{},
+      range_category_{timeline_category::other},
+      row_times_{}
+{}
+
+
+const char* SolverTimeline::get_category_name(timeline_category category)
+{
+    switch (category) {
+    case timeline_category::spmv:
+        return "spmv";
+    case timeline_category::preconditioner:
+        return "preconditioner";
+    case timeline_category::reduction:
+        return "reduction";
+    case timeline_category::communication:
+        return "communication";
+    case timeline_category::vector_update:
+        return "vector_update";
+    default:
+        return "other";
+    }
+}
+
+
+void SolverTimeline::begin_range(timeline_category category) const
+{
+    if (depth_++ == 0) {
+        range_category_ = category;
+        range_begin_ = clock::now();
+    }
+}
+
+
+void SolverTimeline::end_range(const Executor* exec) const
+{
+    if (--depth_ == 0) {
+        exec->synchronize();
+        row_times_[static_cast<int>(range_category_)] +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                                 range_begin_)
+                .count();
+    }
+}
+
+
+void SolverTimeline::on_operation_launched(const Executor* exec,
+                                           const Operation* op) const
+{
+    if (solver_) {
+        this->begin_range(classify_operation(op->get_name()));
+    }
+}
+
+
+void SolverTimeline::on_operation_completed(const Executor* exec,
+                                            const Operation* op) const
+{
+    if (solver_) {
+        this->end_range(exec);
+    }
+}
+
+
+void SolverTimeline::on_linop_apply_started(const LinOp* A, const LinOp* b,
+                                            const LinOp* x) const
+{
+    if (solver_) {
+        if (depth_ > 0) {
+            depth_++;
+        } else if (A == system_matrix_) {
+            this->begin_range(timeline_category::spmv);
+        } else if (A == preconditioner_) {
+            this->begin_range(timeline_category::preconditioner);
+        } else {
+            this->begin_range(timeline_category::other);
+        }
+        return;
+    }
+    auto solver = dynamic_cast<const solver::detail::SolverBaseLinOp*>(A);
+    if (!solver) {
+        return;
+    }
+    auto precond = dynamic_cast<const Preconditionable*>(A);
+    solver_ = A;
+    system_matrix_ = solver->get_system_matrix().get();
+    preconditioner_ = precond ? precond->get_preconditioner().get() : nullptr;
+    depth_ = 0;
+    row_times_.fill(0);
+    row_begin_ = clock::now();
+}
+
+
+void SolverTimeline::on_linop_apply_completed(const LinOp* A, const LinOp* b,
+                                              const LinOp* x) const
+{
+    if (!solver_) {
+        return;
+    }
+    if (A == solver_ && depth_ == 0) {
+        solver_ = nullptr;
+        num_solves_++;
+        return;
+    }
+    this->end_range(A->get_executor().get());
+}
+
+
+void SolverTimeline::on_linop_advanced_apply_started(
+    const LinOp* A, const LinOp* alpha, const LinOp* b, const LinOp* beta,
+    const LinOp* x) const
+{
+    this->on_linop_apply_started(A, b, x);
+}
+
+
+void SolverTimeline::on_linop_advanced_apply_completed(
+    const LinOp* A, const LinOp* alpha, const LinOp* b, const LinOp* beta,
+    const LinOp* x) const
+{
+    this->on_linop_apply_completed(A, b, x);
+}
+
+
+void SolverTimeline::on_iteration_complete(
+    const LinOp* solver, const LinOp* b, const LinOp* x, const size_type& it,
+    const LinOp* r, const LinOp* tau, const LinOp* implicit_tau_sq,
+    const array<stopping_status>* status, bool stopped) const
+{
+    if (!solver_ || solver != solver_ || depth_ > 0) {
+        return;
+    }
+    const auto now = clock::now();
+    const auto total =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - row_begin_)
+            .count();
+    auto covered = int64{};
+    for (int i = 0; i < num_categories; i++) {
+        covered += row_times_[i];
+    }
+    row_times_[static_cast<int>(timeline_category::other)] +=
+        std::max(total - covered, int64{});
+    solves_.push_back(num_solves_);
+    iterations_.push_back(it);
+    totals_.push_back(total);
+    for (int i = 0; i < num_categories; i++) {
+        times_[i].push_back(row_times_[i]);
+    }
+    constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+    double norm{};
+    if (read_first_value(tau, norm) || compute_first_column_norm(r, norm)) {
+        residual_norms_.push_back(norm);
+    } else {
+        residual_norms_.push_back(nan);
+    }
+    // the implicit residual norm may differ from the residual norm, e.g. for
+    // preconditioned solvers
+    if (read_first_value(implicit_tau_sq, norm)) {
+        implicit_residual_norms_.push_back(std::sqrt(norm));
+    } else {
+        implicit_residual_norms_.push_back(nan);
+    }
+    row_times_.fill(0);
+    // reading the residual norm is not part of the next iteration
+    row_begin_ = clock::now();
+}
+
+
+void SolverTimeline::clear()
+{
+    solves_.clear();
+    iterations_.clear();
+    totals_.clear();
+    for (auto& column : times_) {
+        column.clear();
+    }
+    residual_norms_.clear();
+    implicit_residual_norms_.clear();
+    num_solves_ = 0;
+}
+
+
+void SolverTimeline::write_csv(std::ostream& os) const
+{
+    os << "solve,iteration,total";
+    for (int i = 0; i < num_categories; i++) {
+        os << ',' << get_category_name(static_cast<timeline_category>(i));
+    }
+    os << ",residual_norm,implicit_residual_norm\n";
+    for (size_type row = 0; row < this->get_num_rows(); row++) {
+        os << solves_[row] << ',' << iterations_[row] << ',' << totals_[row];
+        for (int i = 0; i < num_categories; i++) {
+            os << ',' << times_[i][row];
+        }
+        for (auto norms : {&residual_norms_, &implicit_residual_norms_}) {
+            os << ',';
+            if (!std::isnan((*norms)[row])) {
+                os << (*norms)[row];
+            }
+        }
+        os << '\n';
+    }
+}
+
+
+void SolverTimeline::write_json(std::ostream& os) const
+{
+    const auto write_column = [&](const char* name, const auto& column) {
+        os << '"' << name << "\":[";
+        for (size_type row = 0; row < column.size(); row++) {
+            os << (row > 0 ? "," : "") << column[row];
+        }
+        os << ']';
+    };
+    os << '{';
+    write_column("solve", solves_);
+    os << ',';
+    write_column("iteration", iterations_);
+    os << ',';
+    write_column("total", totals_);
+    for (int i = 0; i < num_categories; i++) {
+        os << ',';
+        write_column(get_category_name(static_cast<timeline_category>(i)),
+                     times_[i]);
+    }
+    // JSON has no NaN, so missing residual norms become null
+    const auto write_norm_column = [&](const char* name, const auto& column) {
+        os << ",\"" << name << "\":[";
+        for (size_type row = 0; row < column.size(); row++) {
+            os << (row > 0 ? "," : "");
+            if (std::isnan(column[row])) {
+                os << "null";
+            } else {
+                os << column[row];
+            }
+        }
+        os << ']';
+    };
+    write_norm_column("residual_norm", residual_norms_);
+    write_norm_column("implicit_residual_norm", implicit_residual_norms_);
+    os << "}\n";
+}
+
+
+}  // namespace log
+}  // namespace gko
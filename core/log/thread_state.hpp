@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_LOG_THREAD_STATE_HPP_
+#define GKO_CORE_LOG_THREAD_STATE_HPP_
+
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * Returns a new id for a logger that keeps per-thread state. Ids are never
+ * reused, so a stale entry of the cache in get_thread_state can never match
+ * a new logger.
+ */
+inline uint64 get_next_thread_state_owner_id()
+{
+    static std::atomic<uint64> next_id{1};
+    return next_id++;
+}
+
+
+/**
+ * Returns the state of the calling thread out of the per-thread states of a
+ * logger, creating it if this is the first event of the thread.
+ *
+ * The state of the logger that recorded the last event on this thread is
+ * cached, so the common case of a single logger of a type needs no lock.
+ *
+ * @tparam State  the per-thread state type, with a member `thread` storing the
+ *                id of its owning thread
+ *
+ * @param owner_id  the id of the logger, see get_next_thread_state_owner_id
+ * @param mutex  the mutex protecting the states
+ * @param states  the states of all threads
+ * @param create  creates a new state, given the number of existing states
+ *
+ * @return the state of the calling thread
+ */
+template <typename State, typename CreateFn>
+State* get_thread_state(uint64 owner_id, std::mutex& mutex,
+                        std::vector<std::unique_ptr<State>>& states,
+                        CreateFn create)
+{
+    struct cache_entry {
+        uint64 owner_id;
+        State* state;
+    };
+    thread_local cache_entry cache{0, nullptr};
+    if (cache.owner_id == owner_id) {
+        return cache.state;
+    }
+    // slow path: first event of this thread, or multiple loggers in use
+    std::lock_guard<std::mutex> guard{mutex};
+    const auto thread = std::this_thread::get_id();
+    auto it = std::find_if(
+        states.begin(), states.end(),
+        [&](const auto& state) { return state->thread == thread; });
+    State* state{};
+    if (it != states.end()) {
+        state = it->get();
+    } else {
+        states.push_back(create(states.size()));
+        state = states.back().get();
+    }
+    cache = {owner_id, state};
+    return state;
+}
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_CORE_LOG_THREAD_STATE_HPP_
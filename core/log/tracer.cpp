@@ -0,0 +1,383 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/log/tracer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <thread>
+#include <unordered_map>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+
+#include "core/log/thread_state.hpp"
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * The ring buffer of a single thread. Only the owning thread writes events,
+ * publishing them by incrementing `head` with release semantics. It has one
+ * more slot than the capacity, which is the slot the owning thread may be
+ * writing to while the other events are read.
+ */
+struct Tracer::thread_buffer {
+    thread_buffer(size_type capacity, int32 index)
+        : events(new trace_event[capacity + 1]),
+          head{0},
+          thread{std::this_thread::get_id()},
+          index{index}
+    {}
+
+    std::unique_ptr<trace_event[]> events;
+    // total number of events ever written to this buffer
+    std::atomic<uint64> head;
+    std::thread::id thread;
+    int32 index;
+};
+
+
+namespace {
+
+
+bool is_begin(trace_event_kind kind)
+{
+    return kind == trace_event_kind::operation_begin ||
+           kind == trace_event_kind::apply_begin ||
+           kind == trace_event_kind::generate_begin;
+}
+
+
+bool is_end(trace_event_kind kind)
+{
+    return kind == trace_event_kind::operation_end ||
+           kind == trace_event_kind::apply_end ||
+           kind == trace_event_kind::generate_end;
+}
+
+
+const char* get_category(trace_event_kind kind)
+{
+    switch (kind) {
+    case trace_event_kind::allocation:
+        return "allocation";
+    case trace_event_kind::free:
+        return "free";
+    case trace_event_kind::copy:
+        return "copy";
+    case trace_event_kind::operation_begin:
+    case trace_event_kind::operation_end:
+        return "operation";
+    case trace_event_kind::apply_begin:
+    case trace_event_kind::apply_end:
+        return "apply";
+    case trace_event_kind::generate_begin:
+    case trace_event_kind::generate_end:
+        return "generate";
+    default:
+        return "iteration";
+    }
+}
+
+
+void write_json_string(std::ostream& os, const std::string& str)
+{
+    os << '"';
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) >= 0x20) {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+
+}  // namespace
+
+
+Tracer::Tracer(size_type capacity, const mask_type& enabled_events)
+    : Logger(enabled_events),
+      id_{get_next_thread_state_owner_id()},
+      capacity_{capacity},
+      start_{std::chrono::steady_clock::now()}
+{
+    if (capacity == 0) {
+        GKO_INVALID_STATE("The Tracer needs to store at least one event");
+    }
+}
+
+
+Tracer::~Tracer() = default;
+
+
+Tracer::thread_buffer* Tracer::get_thread_buffer() const
+{
+    return get_thread_state(id_, mutex_, buffers_, [&](size_type index) {
+        return std::make_unique<thread_buffer>(capacity_,
+                                               static_cast<int32>(index));
+    });
+}
+
+
+int64 Tracer::get_timestamp() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - start_)
+        .count();
+}
+
+
+void Tracer::record(trace_event_kind kind, const void* object,
+                    const std::type_info* type, size_type size0,
+                    size_type size1, const char* name) const
+{
+    auto buffer = this->get_thread_buffer();
+    const auto head = buffer->head.load(std::memory_order_relaxed);
+    auto& event = buffer->events[head % (capacity_ + 1)];
+    event.timestamp = this->get_timestamp();
+    event.thread = buffer->index;
+    event.kind = kind;
+    event.object = object;
+    event.type = type;
+    event.size[0] = size0;
+    event.size[1] = size1;
+    if (name) {
+        std::strncpy(event.name, name, trace_event::max_name_length - 1);
+        event.name[trace_event::max_name_length - 1] = '\0';
+    } else {
+        event.name[0] = '\0';
+    }
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+
+void Tracer::on_allocation_completed(const Executor* exec,
+                                     const size_type& num_bytes,
+                                     const uintptr& location) const
+{
+    this->record(trace_event_kind::allocation, exec, nullptr, num_bytes,
+                 location);
+}
+
+
+void Tracer::on_free_completed(const Executor* exec,
+                               const uintptr& location) const
+{
+    this->record(trace_event_kind::free, exec, nullptr, 0, location);
+}
+
+
+void Tracer::on_copy_completed(const Executor* from, const Executor* to,
+                               const uintptr& location_from,
+                               const uintptr& location_to,
+                               const size_type& num_bytes) const
+{
+    this->record(trace_event_kind::copy, to, nullptr, num_bytes, location_to);
+}
+
+
+void Tracer::on_operation_launched(const Executor* exec,
+                                   const Operation* op) const
+{
+    // the name is copied, since not all operations have static names
+    this->record(trace_event_kind::operation_begin, exec, nullptr, 0, 0,
+                 op->get_name());
+}
+
+
+void Tracer::on_operation_completed(const Executor* exec,
+                                    const Operation* op) const
+{
+    this->record(trace_event_kind::operation_end, exec, nullptr, 0, 0,
+                 op->get_name());
+}
+
+
+void Tracer::on_linop_apply_started(const LinOp* A, const LinOp* b,
+                                    const LinOp* x) const
+{
+    this->record(trace_event_kind::apply_begin, A, &typeid(*A),
+                 A->get_size()[0], A->get_size()[1]);
+}
+
+
+void Tracer::on_linop_apply_completed(const LinOp* A, const LinOp* b,
+                                      const LinOp* x) const
+{
+    this->record(trace_event_kind::apply_end, A, &typeid(*A),
+                 A->get_size()[0], A->get_size()[1]);
+}
+
+
+void Tracer::on_linop_advanced_apply_started(const LinOp* A,
+                                             const LinOp* alpha,
+                                             const LinOp* b, const LinOp* beta,
+                                             const LinOp* x) const
+{
+    this->on_linop_apply_started(A, b, x);
+}
+
+
+void Tracer::on_linop_advanced_apply_completed(const LinOp* A,
+                                               const LinOp* alpha,
+                                               const LinOp* b,
+                                               const LinOp* beta,
+                                               const LinOp* x) const
+{
+    this->on_linop_apply_completed(A, b, x);
+}
+
+
+void Tracer::on_linop_factory_generate_started(const LinOpFactory* factory,
+                                               const LinOp* input) const
+{
+    this->record(trace_event_kind::generate_begin, factory, &typeid(*factory),
+                 input->get_size()[0], input->get_size()[1]);
+}
+
+
+void Tracer::on_linop_factory_generate_completed(const LinOpFactory* factory,
+                                                 const LinOp* input,
+                                                 const LinOp* output) const
+{
+    this->record(trace_event_kind::generate_end, factory, &typeid(*factory),
+                 input->get_size()[0], input->get_size()[1]);
+}
+
+
+void Tracer::on_iteration_complete(const LinOp* solver, const LinOp* b,
+                                   const LinOp* x, const size_type& it,
+                                   const LinOp* r, const LinOp* tau,
+                                   const LinOp* implicit_tau_sq,
+                                   const array<stopping_status>* status,
+                                   bool stopped) const
+{
+    this->record(trace_event_kind::iteration, solver, &typeid(*solver), it,
+                 stopped ? 1 : 0);
+}
+
+
+std::vector<trace_event> Tracer::get_events(
+    std::chrono::nanoseconds window) const
+{
+    const auto now = this->get_timestamp();
+    const auto min_timestamp =
+        window.count() < now ? now - window.count() : int64{};
+    std::vector<trace_event> result;
+    std::lock_guard<std::mutex> guard{mutex_};
+    for (const auto& buffer : buffers_) {
+        const auto head = buffer->head.load(std::memory_order_acquire);
+        const auto begin = head > capacity_ ? head - capacity_ : uint64{};
+        std::vector<trace_event> events;
+        events.reserve(head - begin);
+        for (auto i = begin; i < head; i++) {
+            events.push_back(buffer->events[i % (capacity_ + 1)]);
+        }
+        // the owning thread may have overwritten some of the events while we
+        // were copying them, including the slot it is currently writing to.
+        const auto new_head = buffer->head.load(std::memory_order_acquire);
+        const auto valid_begin =
+            new_head > capacity_ ? new_head - capacity_ : uint64{};
+        for (auto i = std::max(begin, valid_begin); i < head; i++) {
+            const auto& event = events[i - begin];
+            if (event.timestamp >= min_timestamp) {
+                result.push_back(event);
+            }
+        }
+    }
+    std::stable_sort(result.begin(), result.end(),
+                     [](const trace_event& a, const trace_event& b) {
+                         return a.timestamp < b.timestamp;
+                     });
+    return result;
+}
+
+
+void Tracer::write_chrome_trace(std::ostream& os,
+                                std::chrono::nanoseconds window) const
+{
+    const auto events = this->get_events(window);
+    // the begin events of the oldest open ranges may have been overwritten,
+    // so we skip end events without a matching begin event per thread
+    std::unordered_map<int32, int64> depths;
+    std::unordered_map<const std::type_info*, std::string> type_names;
+    const auto get_name = [&](const trace_event& event) -> std::string {
+        if (!event.type) {
+            return event.kind == trace_event_kind::allocation ||
+                           event.kind == trace_event_kind::free ||
+                           event.kind == trace_event_kind::copy
+                       ? get_category(event.kind)
+                       : event.name;
+        }
+        auto it = type_names.find(event.type);
+        if (it == type_names.end()) {
+            it = type_names
+                     .emplace(event.type,
+                              name_demangling::get_type_name(*event.type))
+                     .first;
+        }
+        return it->second;
+    };
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& event : events) {
+        auto& depth = depths[event.thread];
+        if (is_end(event.kind)) {
+            if (depth == 0) {
+                continue;
+            }
+            depth--;
+        } else if (is_begin(event.kind)) {
+            depth++;
+        }
+        os << (first ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(os, get_name(event));
+        os << ",\"cat\":\"" << get_category(event.kind) << "\",\"ph\":\""
+           << (is_begin(event.kind) ? "B" : (is_end(event.kind) ? "E" : "i"))
+           << "\",\"ts\":" << event.timestamp / 1000 << '.'
+           << std::setfill('0') << std::setw(3) << event.timestamp % 1000
+           << std::setfill(' ') << ",\"pid\":0,\"tid\":" << event.thread;
+        if (!is_begin(event.kind) && !is_end(event.kind)) {
+            os << ",\"s\":\"t\"";
+        }
+        os << ",\"args\":{\"object\":\"" << event.object << '"';
+        switch (event.kind) {
+        case trace_event_kind::allocation:
+        case trace_event_kind::free:
+        case trace_event_kind::copy:
+            os << ",\"bytes\":" << event.size[0] << ",\"location\":\""
+               << reinterpret_cast<const void*>(
+                      static_cast<uintptr>(event.size[1]))
+               << '"';
+            break;
+        case trace_event_kind::iteration:
+            os << ",\"iteration\":" << event.size[0]
+               << ",\"stopped\":" << (event.size[1] ? "true" : "false");
+            break;
+        case trace_event_kind::apply_begin:
+        case trace_event_kind::generate_begin:
+            os << ",\"rows\":" << event.size[0]
+               << ",\"cols\":" << event.size[1];
+            break;
+        default:
+            break;
+        }
+        os << "}}";
+        first = false;
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+
+}  // namespace log
+}  // namespace gko
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+
+#include "core/log/profiler_hook.hpp"
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+/** Number of floating point operations of a multiply-add. */
+template <typename ValueType>
+constexpr int64 fma_flops()
+{
+    return is_complex<ValueType>() ? 8 : 2;
+}
+
+
+/**
+ * Returns the work of an SpMV-like apply, given the number of multiply-adds
+ * and the number of bytes of A. The vectors are read (b, and x for the
+ * advanced apply) and written (x) once.
+ */
+template <typename ValueType>
+ProfilerHook::work_estimate apply_work(const LinOp* A, const LinOp* b,
+                                       bool advanced, int64 num_fmas,
+                                       int64 matrix_bytes)
+{
+    const auto num_rows = static_cast<int64>(A->get_size()[0]);
+    const auto num_cols = static_cast<int64>(A->get_size()[1]);
+    const auto num_rhs = static_cast<int64>(b->get_size()[1]);
+    const auto value_bytes = static_cast<int64>(sizeof(ValueType));
+    ProfilerHook::work_estimate work;
+    work.flops = num_fmas * num_rhs * fma_flops<ValueType>();
+    work.bytes = matrix_bytes + (num_cols + num_rows) * num_rhs * value_bytes;
+    if (advanced) {
+        // x = alpha * A b + beta * x reads x and needs a multiply-add per entry
+        work.flops += num_rows * num_rhs * fma_flops<ValueType>();
+        work.bytes += num_rows * num_rhs * value_bytes;
+    }
+    return work;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::optional<ProfilerHook::work_estimate> estimate_sparse_work(
+    const LinOp* A, const LinOp* b, bool advanced)
+{
+    const auto value_bytes = static_cast<int64>(sizeof(ValueType));
+    const auto index_bytes = static_cast<int64>(sizeof(IndexType));
+    if (auto csr = dynamic_cast<const matrix::Csr<ValueType, IndexType>*>(A)) {
+        const auto nnz = static_cast<int64>(csr->get_num_stored_elements());
+        const auto num_rows = static_cast<int64>(csr->get_size()[0]);
+        return apply_work<ValueType>(
+            A, b, advanced, nnz,
+            nnz * (value_bytes + index_bytes) + (num_rows + 1) * index_bytes);
+    }
+    if (auto coo = dynamic_cast<const matrix::Coo<ValueType, IndexType>*>(A)) {
+        const auto nnz = static_cast<int64>(coo->get_num_stored_elements());
+        return apply_work<ValueType>(
+            A, b, advanced, nnz, nnz * (value_bytes + 2 * index_bytes));
+    }
+    if (auto ell = dynamic_cast<const matrix::Ell<ValueType, IndexType>*>(A)) {
+        // the kernels also process the padding entries
+        const auto stored =
+            static_cast<int64>(ell->get_num_stored_elements());
+        return apply_work<ValueType>(A, b, advanced, stored,
+                                     stored * (value_bytes + index_bytes));
+    }
+    return {};
+}
+
+
+template <typename ValueType>
+std::optional<ProfilerHook::work_estimate> estimate_value_work(
+    const LinOp* A, const LinOp* b, bool advanced)
+{
+    if (dynamic_cast<const matrix::Dense<ValueType>*>(A)) {
+        const auto size = static_cast<int64>(A->get_size()[0] *
+                                             A->get_size()[1]);
+        return apply_work<ValueType>(
+            A, b, advanced, size,
+            size * static_cast<int64>(sizeof(ValueType)));
+    }
+    if (auto work = estimate_sparse_work<ValueType, int32>(A, b, advanced)) {
+        return work;
+    }
+    return estimate_sparse_work<ValueType, int64>(A, b, advanced);
+}
+
+
+}  // namespace
+
+
+std::optional<ProfilerHook::work_estimate> estimate_apply_work(const LinOp* A,
+                                                               const LinOp* b,
+                                                               bool advanced)
+{
+    if (!A || !b) {
+        return {};
+    }
+    if (auto work = estimate_value_work<double>(A, b, advanced)) {
+        return work;
+    }
+    if (auto work = estimate_value_work<float>(A, b, advanced)) {
+        return work;
+    }
+    if (auto work = estimate_value_work<std::complex<double>>(A, b, advanced)) {
+        return work;
+    }
+    return estimate_value_work<std::complex<float>>(A, b, advanced);
+}
+
+
+}  // namespace log
+}  // namespace gko
@@ -0,0 +1,441 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/matrix/auto_format.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/timer.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+#include <ginkgo/core/matrix/hybrid.hpp>
+#include <ginkgo/core/matrix/sellp.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace {
+
+
+/**
+ * Ell is only considered if its padded storage is at most this many times the
+ * number of stored elements of the Csr matrix.
+ */
+constexpr size_type max_ell_fill_ratio = 3;
+
+
+/**
+ * The slice sizes of the Sellp candidates in addition to the default slice
+ * size. Smaller slices need less padding for irregular row lengths.
+ */
+constexpr size_type sellp_slice_sizes[] = {32, 8};
+
+
+struct row_statistics {
+    // number of empty rows, then rows with length in [2^(k-1), 2^k)
+    std::vector<size_type> histogram;
+    size_type max_row_length;
+};
+
+
+template <typename IndexType>
+row_statistics compute_row_statistics(const Executor* exec,
+                                      const IndexType* row_ptrs,
+                                      size_type num_rows)
+{
+    row_statistics result{{}, 0};
+    if (num_rows == 0) {
+        return result;
+    }
+    auto host = exec->get_master();
+    array<IndexType> host_row_ptrs{host, num_rows + 1};
+    host->copy_from(exec, num_rows + 1, row_ptrs, host_row_ptrs.get_data());
+    const auto ptrs = host_row_ptrs.get_const_data();
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto length = static_cast<size_type>(ptrs[row + 1] - ptrs[row]);
+        size_type bucket = 0;
+        while ((size_type{1} << bucket) <= length) {
+            bucket++;
+        }
+        if (result.histogram.size() <= bucket) {
+            result.histogram.resize(bucket + 1);
+        }
+        result.histogram[bucket]++;
+        result.max_row_length = std::max(result.max_row_length, length);
+    }
+    return result;
+}
+
+
+bool is_gpu_executor(const Executor* exec)
+{
+    return dynamic_cast<const CudaExecutor*>(exec) ||
+           dynamic_cast<const HipExecutor*>(exec) ||
+           dynamic_cast<const DpcppExecutor*>(exec);
+}
+
+
+int get_device_id(const Executor* exec)
+{
+    if (auto cuda = dynamic_cast<const CudaExecutor*>(exec)) {
+        return cuda->get_device_id();
+    }
+    if (auto hip = dynamic_cast<const HipExecutor*>(exec)) {
+        return hip->get_device_id();
+    }
+    if (auto dpcpp = dynamic_cast<const DpcppExecutor*>(exec)) {
+        return dpcpp->get_device_id();
+    }
+    return -1;
+}
+
+
+template <typename CsrType>
+std::shared_ptr<typename CsrType::strategy_type> make_csr_strategy(
+    const std::string& format, std::shared_ptr<const Executor> exec)
+{
+    if (format == "csr_classical") {
+        return std::make_shared<typename CsrType::classical>();
+    }
+    if (format == "csr_merge_path") {
+        return std::make_shared<typename CsrType::merge_path>();
+    }
+    if (format == "csr_sparselib") {
+        return std::make_shared<typename CsrType::sparselib>();
+    }
+    using load_balance = typename CsrType::load_balance;
+    if (auto cuda = std::dynamic_pointer_cast<const CudaExecutor>(exec)) {
+        return std::make_shared<load_balance>(cuda);
+    }
+    if (auto hip = std::dynamic_pointer_cast<const HipExecutor>(exec)) {
+        return std::make_shared<load_balance>(hip);
+    }
+    return std::make_shared<load_balance>(
+        std::dynamic_pointer_cast<const DpcppExecutor>(exec));
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+std::vector<std::string> AutoFormat<ValueType, IndexType>::get_candidates()
+    const
+{
+    const auto exec = this->get_executor();
+    std::vector<std::string> result;
+    if (is_gpu_executor(exec.get())) {
+        result = {"csr_classical", "csr_merge_path", "csr_load_balance",
+                  "csr_sparselib"};
+    } else {
+        // the CPU kernels don't depend on the Csr strategy
+        result = {"csr"};
+    }
+    result.emplace_back("coo");
+    const auto stats = compute_row_statistics(
+        exec.get(), source_->get_const_row_ptrs(), source_->get_size()[0]);
+    if (stats.max_row_length * source_->get_size()[0] <=
+        max_ell_fill_ratio * source_->get_num_stored_elements()) {
+        result.emplace_back("ell");
+    }
+    result.emplace_back("hybrid");
+    result.emplace_back("hybrid_imbalance_limit");
+    result.emplace_back("hybrid_minimal_storage");
+    result.emplace_back("sellp");
+    for (auto slice_size : sellp_slice_sizes) {
+        result.emplace_back("sellp_" + std::to_string(slice_size));
+    }
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::string AutoFormat<ValueType, IndexType>::get_fingerprint() const
+{
+    const auto exec = this->get_executor();
+    const auto stats = compute_row_statistics(
+        exec.get(), source_->get_const_row_ptrs(), source_->get_size()[0]);
+    std::ostringstream key;
+    key << name_demangling::get_type_name(typeid(*exec)) << '('
+        << get_device_id(exec.get()) << ")|"
+        << name_demangling::get_type_name(typeid(ValueType)) << '|'
+        << name_demangling::get_type_name(typeid(IndexType)) << '|'
+        << source_->get_size()[0] << 'x' << source_->get_size()[1] << '|'
+        << source_->get_num_stored_elements() << '|';
+    for (size_type i = 0; i < stats.histogram.size(); i++) {
+        key << (i > 0 ? "," : "") << stats.histogram[i];
+    }
+    return key.str();
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> AutoFormat<ValueType, IndexType>::convert_to_format(
+    const std::string& format) const
+{
+    const auto exec = this->get_executor();
+    if (format == "csr") {
+        return source_->clone();
+    }
+    if (format.rfind("csr_", 0) == 0) {
+        auto result = source_->clone();
+        result->set_strategy(make_csr_strategy<csr_type>(format, exec));
+        return result;
+    }
+    if (format == "coo") {
+        auto result = Coo<ValueType, IndexType>::create(exec);
+        source_->convert_to(result.get());
+        return result;
+    }
+    if (format == "ell") {
+        auto result = Ell<ValueType, IndexType>::create(exec);
+        source_->convert_to(result.get());
+        return result;
+    }
+    if (format.rfind("hybrid", 0) == 0) {
+        using hybrid_type = Hybrid<ValueType, IndexType>;
+        std::shared_ptr<typename hybrid_type::strategy_type> strategy;
+        if (format == "hybrid") {
+            strategy = std::make_shared<typename hybrid_type::automatic>();
+        } else if (format == "hybrid_imbalance_limit") {
+            strategy =
+                std::make_shared<typename hybrid_type::imbalance_limit>();
+        } else if (format == "hybrid_minimal_storage") {
+            strategy =
+                std::make_shared<typename hybrid_type::minimal_storage_limit>();
+        } else {
+            GKO_INVALID_STATE("Unknown matrix format " + format);
+        }
+        auto result = hybrid_type::create(exec, std::move(strategy));
+        source_->convert_to(result.get());
+        return result;
+    }
+    if (format == "sellp") {
+        auto result = Sellp<ValueType, IndexType>::create(exec);
+        source_->convert_to(result.get());
+        return result;
+    }
+    for (auto slice_size : sellp_slice_sizes) {
+        if (format == "sellp_" + std::to_string(slice_size)) {
+            auto result = Sellp<ValueType, IndexType>::create(
+                exec, dim<2>{}, slice_size, default_stride_factor, 0);
+            source_->convert_to(result.get());
+            return result;
+        }
+    }
+    GKO_INVALID_STATE("Unknown matrix format " + format);
+}
+
+
+template <typename ValueType, typename IndexType>
+void AutoFormat<ValueType, IndexType>::tune() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    if (op_) {
+        return;
+    }
+    const auto exec = this->get_executor();
+    if (source_->get_size()[0] == 0 || source_->get_size()[1] == 0) {
+        format_ = "csr";
+        op_ = source_;
+        return;
+    }
+    const auto candidates = this->get_candidates();
+    const auto key = this->get_fingerprint();
+    if (cache_) {
+        const auto cached = cache_->lookup(key);
+        // entries from other versions may name formats we don't know about
+        if (cached && std::find(candidates.begin(), candidates.end(),
+                                *cached) != candidates.end()) {
+            format_ = *cached;
+            op_ = this->convert_to_format(format_);
+            return;
+        }
+    }
+    using Vec = Dense<ValueType>;
+    auto b = Vec::create(exec, dim<2>{source_->get_size()[1], 1});
+    auto x = Vec::create(exec, dim<2>{source_->get_size()[0], 1});
+    b->fill(one<ValueType>());
+    x->fill(zero<ValueType>());
+    auto timer = Timer::create_for_executor(exec);
+    auto start = timer->create_time_point();
+    auto stop = timer->create_time_point();
+    auto best_time = std::chrono::nanoseconds::max();
+    for (const auto& candidate : candidates) {
+        std::unique_ptr<LinOp> op;
+        try {
+            op = this->convert_to_format(candidate);
+            // warm-up run, which may also allocate workspace
+            op->apply(b, x);
+        } catch (const Error&) {
+            // the candidate is not supported on this executor
+            continue;
+        }
+        timer->record(start);
+        for (int i = 0; i < num_repetitions_; i++) {
+            op->apply(b, x);
+        }
+        timer->record(stop);
+        timer->wait(stop);
+        const auto time = timer->difference_async(start, stop);
+        if (time < best_time) {
+            best_time = time;
+            format_ = candidate;
+            op_ = std::move(op);
+        }
+    }
+    if (!op_) {
+        format_ = "csr";
+        op_ = source_;
+        return;
+    }
+    if (cache_) {
+        cache_->store(key, format_);
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+std::string AutoFormat<ValueType, IndexType>::get_selected_format() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return format_;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::shared_ptr<const LinOp>
+AutoFormat<ValueType, IndexType>::get_selected_operator() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return op_;
+}
+
+
+template <typename ValueType, typename IndexType>
+void AutoFormat<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                  LinOp* x) const
+{
+    this->tune();
+    this->get_selected_operator()->apply(b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void AutoFormat<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                  const LinOp* b,
+                                                  const LinOp* beta,
+                                                  LinOp* x) const
+{
+    this->tune();
+    this->get_selected_operator()->apply(alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+AutoFormat<ValueType, IndexType>::AutoFormat(
+    std::shared_ptr<const Executor> exec)
+    : AutoFormat(exec, csr_type::create(exec), nullptr, 10)
+{}
+
+
+template <typename ValueType, typename IndexType>
+AutoFormat<ValueType, IndexType>::AutoFormat(
+    std::shared_ptr<const Executor> exec,
+    std::shared_ptr<const csr_type> source, std::shared_ptr<TuningCache> cache,
+    int num_repetitions)
+    : EnableLinOp<AutoFormat>(exec, source->get_size()),
+      source_{source->get_executor() == exec
+                  ? std::move(source)
+                  : std::shared_ptr<const csr_type>{gko::clone(exec, source)}},
+      cache_{std::move(cache)},
+      num_repetitions_{num_repetitions}
+{
+    if (num_repetitions < 1) {
+        GKO_INVALID_STATE("AutoFormat needs to time at least one SpMV");
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+AutoFormat<ValueType, IndexType>::AutoFormat(const AutoFormat& other)
+    : AutoFormat(other.get_executor())
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+AutoFormat<ValueType, IndexType>& AutoFormat<ValueType, IndexType>::operator=(
+    const AutoFormat& other)
+{
+    if (this == &other) {
+        return *this;
+    }
+    EnableLinOp<AutoFormat>::operator=(other);
+    const auto exec = this->get_executor();
+    std::string format;
+    std::shared_ptr<const LinOp> op;
+    {
+        std::lock_guard<std::mutex> guard{other.mutex_};
+        format = other.format_;
+        op = other.op_;
+    }
+    const auto same_exec = other.get_executor() == exec;
+    std::lock_guard<std::mutex> guard{mutex_};
+    source_ = same_exec ? other.source_
+                        : std::shared_ptr<const csr_type>{
+                              gko::clone(exec, other.source_)};
+    cache_ = other.cache_;
+    num_repetitions_ = other.num_repetitions_;
+    format_ = format;
+    if (!op) {
+        op_ = nullptr;
+    } else if (op == other.source_) {
+        op_ = source_;
+    } else {
+        op_ = same_exec
+                  ? op
+                  : std::shared_ptr<const LinOp>{gko::clone(exec, op)};
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<AutoFormat<ValueType, IndexType>>
+AutoFormat<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec)
+{
+    return std::unique_ptr<AutoFormat>{new AutoFormat{exec}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<AutoFormat<ValueType, IndexType>>
+AutoFormat<ValueType, IndexType>::create(
+    std::shared_ptr<const Executor> exec,
+    std::shared_ptr<const csr_type> source, std::shared_ptr<TuningCache> cache,
+    int num_repetitions)
+{
+    return std::unique_ptr<AutoFormat>{new AutoFormat{
+        exec, std::move(source), std::move(cache), num_repetitions}};
+}
+
+
+#define GKO_DECLARE_AUTO_FORMAT_MATRIX(ValueType, IndexType) \
+    class AutoFormat<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_AUTO_FORMAT_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
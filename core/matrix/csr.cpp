@@ -12,14 +12,18 @@
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/delta_csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/ell.hpp>
 #include <ginkgo/core/matrix/fbcsr.hpp>
 #include <ginkgo/core/matrix/identity.hpp>
 #include <ginkgo/core/matrix/permutation.hpp>
+#include <ginkgo/core/matrix/reduced_csr.hpp>
 #include <ginkgo/core/matrix/scaled_permutation.hpp>
 #include <ginkgo/core/matrix/sellp.hpp>
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+#include <ginkgo/core/matrix/vbcsr.hpp>
 
 #include "core/base/array_access.hpp"
 #include "core/base/device_matrix_data_kernels.hpp"
@@ -422,6 +426,10 @@ template <typename ValueType, typename IndexType>
 void Csr<ValueType, IndexType>::convert_to(
     Sellp<ValueType, IndexType>* result) const
 {
+    if (result->get_sorting_window() > 1) {
+        result->fill_sorted(this);
+        return;
+    }
     auto exec = this->get_executor();
     const auto stride_factor = result->get_stride_factor();
     const auto slice_size = result->get_slice_size();
@@ -473,6 +481,68 @@ void Csr<ValueType, IndexType>::move_to(
 }
 
 
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::convert_to(
+    DeltaCsr<ValueType, IndexType>* result) const
+{
+    result->fill_from(this);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::move_to(DeltaCsr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::convert_to(
+    ReducedCsr<ValueType, IndexType>* result) const
+{
+    result->fill_from(this);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::move_to(
+    ReducedCsr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::convert_to(
+    Vbcsr<ValueType, IndexType>* result) const
+{
+    result->fill_from(this);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::move_to(Vbcsr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::convert_to(
+    SymmetricCsr<ValueType, IndexType>* result) const
+{
+    result->fill_from(this);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::move_to(
+    SymmetricCsr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
 template <typename ValueType, typename IndexType>
 void Csr<ValueType, IndexType>::convert_to(
     Ell<ValueType, IndexType>* result) const
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_DELTA_CSR_ENCODING_HPP_
+#define GKO_CORE_MATRIX_DELTA_CSR_ENCODING_HPP_
+
+
+#include <cstring>
+
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace delta_csr {
+
+
+/** Largest delta that is stored in a single byte. */
+constexpr int64 max_short_delta = 255;
+
+/** Largest delta that is stored as an escaped 16 bit value. */
+constexpr int64 max_medium_delta = 65535;
+
+
+/**
+ * Returns the number of bytes needed to encode the column delta `delta`.
+ */
+template <typename IndexType>
+inline int64 encoded_size(IndexType delta)
+{
+    if (delta > 0 && delta <= max_short_delta) {
+        return 1;
+    }
+    if (delta > 0 && delta <= max_medium_delta) {
+        return 1 + sizeof(uint16);
+    }
+    return 1 + sizeof(uint16) + sizeof(IndexType);
+}
+
+
+/**
+ * Encodes the column delta `delta` into `out`.
+ *
+ * @return  the position behind the encoded delta.
+ */
+template <typename IndexType>
+inline uint8* encode(IndexType delta, uint8* out)
+{
+    if (delta > 0 && delta <= max_short_delta) {
+        *out = static_cast<uint8>(delta);
+        return out + 1;
+    }
+    *out = 0;
+    uint16 medium = delta > 0 && delta <= max_medium_delta
+                        ? static_cast<uint16>(delta)
+                        : uint16{};
+    std::memcpy(out + 1, &medium, sizeof(uint16));
+    if (medium != 0) {
+        return out + 1 + sizeof(uint16);
+    }
+    std::memcpy(out + 1 + sizeof(uint16), &delta, sizeof(IndexType));
+    return out + 1 + sizeof(uint16) + sizeof(IndexType);
+}
+
+
+/**
+ * Decodes the column delta stored at `in` into `delta`.
+ *
+ * @return  the position behind the encoded delta.
+ */
+template <typename IndexType>
+inline const uint8* decode(const uint8* in, IndexType& delta)
+{
+    if (*in != 0) {
+        delta = *in;
+        return in + 1;
+    }
+    uint16 medium{};
+    std::memcpy(&medium, in + 1, sizeof(uint16));
+    if (medium != 0) {
+        delta = medium;
+        return in + 1 + sizeof(uint16);
+    }
+    std::memcpy(&delta, in + 1 + sizeof(uint16), sizeof(IndexType));
+    return in + 1 + sizeof(uint16) + sizeof(IndexType);
+}
+
+
+}  // namespace delta_csr
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_DELTA_CSR_ENCODING_HPP_
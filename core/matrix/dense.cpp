@@ -882,6 +882,12 @@ template <typename IndexType>
 void Dense<ValueType>::convert_impl(Sellp<ValueType, IndexType>* result) const
 {
     auto exec = this->get_executor();
+    if (result->get_sorting_window() > 1) {
+        auto tmp = Csr<ValueType, IndexType>::create(exec);
+        this->convert_impl(tmp.get());
+        result->fill_sorted(tmp.get());
+        return;
+    }
     const auto num_rows = this->get_size()[0];
     const auto stride_factor = result->get_stride_factor();
     const auto slice_size = result->get_slice_size();
@@ -0,0 +1,230 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/matrix/reduced_csr.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/matrix/reduced_csr_kernels.hpp"
+#include "core/matrix/reduced_csr_storage.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace reduced_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, reduced_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, reduced_csr::advanced_spmv);
+GKO_REGISTER_OPERATION(compress_values, reduced_csr::compress_values);
+GKO_REGISTER_OPERATION(decompress_values, reduced_csr::decompress_values);
+
+
+}  // anonymous namespace
+}  // namespace reduced_csr
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>& ReducedCsr<ValueType, IndexType>::operator=(
+    const ReducedCsr& other)
+{
+    if (&other != this) {
+        EnableLinOp<ReducedCsr>::operator=(other);
+        mode_ = other.mode_;
+        storage_ = other.storage_;
+        scales_ = other.scales_;
+        col_idxs_ = other.col_idxs_;
+        row_ptrs_ = other.row_ptrs_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>& ReducedCsr<ValueType, IndexType>::operator=(
+    ReducedCsr&& other)
+{
+    if (&other != this) {
+        EnableLinOp<ReducedCsr>::operator=(std::move(other));
+        mode_ = other.mode_;
+        storage_ = std::move(other.storage_);
+        scales_ = std::move(other.scales_);
+        col_idxs_ = std::move(other.col_idxs_);
+        row_ptrs_ = std::move(other.row_ptrs_);
+        // restore other invariant
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>::ReducedCsr(const ReducedCsr& other)
+    : ReducedCsr(other.get_executor())
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>::ReducedCsr(ReducedCsr&& other)
+    : ReducedCsr(other.get_executor())
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>::ReducedCsr(
+    std::shared_ptr<const Executor> exec, const dim<2>& size,
+    reduced_storage mode)
+    : EnableLinOp<ReducedCsr>(exec, size),
+      mode_{mode},
+      storage_(exec),
+      scales_(exec),
+      col_idxs_(exec),
+      row_ptrs_(exec, size[0] + 1)
+{
+    // rejects storage modes that are unavailable for this value type
+    reduced_csr::storage_bytes_per_value<ValueType>(mode_);
+    row_ptrs_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<ReducedCsr<ValueType, IndexType>>
+ReducedCsr<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                         const dim<2>& size,
+                                         reduced_storage mode)
+{
+    return std::unique_ptr<ReducedCsr>{new ReducedCsr{exec, size, mode}};
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                  LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                reduced_csr::make_spmv(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                  const LinOp* b,
+                                                  const LinOp* beta,
+                                                  LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(reduced_csr::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x));
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::fill_from(
+    const Csr<ValueType, IndexType>* source)
+{
+    auto exec = this->get_executor();
+    auto local_source = make_temporary_clone(exec, source);
+    const auto num_rows = source->get_size()[0];
+    const auto nnz = source->get_num_stored_elements();
+    col_idxs_ = make_const_array_view(exec, nnz,
+                                      local_source->get_const_col_idxs())
+                    .copy_to_array();
+    row_ptrs_ = make_const_array_view(exec, num_rows + 1,
+                                      local_source->get_const_row_ptrs())
+                    .copy_to_array();
+    storage_.resize_and_reset(
+        nnz * reduced_csr::storage_bytes_per_value<ValueType>(mode_));
+    scales_.resize_and_reset(
+        mode_ == reduced_storage::scaled_int16 ? num_rows : 0);
+    exec->run(reduced_csr::make_compress_values(
+        local_source.get(), mode_, storage_.get_data(), scales_.get_data()));
+    this->set_size(source->get_size());
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    {
+        auto tmp = make_temporary_clone(exec, result);
+        tmp->row_ptrs_ = row_ptrs_;
+        tmp->col_idxs_ = col_idxs_;
+        tmp->values_.resize_and_reset(this->get_num_stored_elements());
+        tmp->set_size(this->get_size());
+        exec->run(
+            reduced_csr::make_decompress_values(this, tmp->get_values()));
+    }
+    result->make_srow();
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::move_to(
+    Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    auto csr = Csr<ValueType, IndexType>::create(this->get_executor());
+    csr->read(data);
+    this->fill_from(csr.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    this->read(data);
+    data.empty_out();
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    this->read(device_mat_data::create_from_host(this->get_executor(), data));
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto csr = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(csr.get());
+    csr->write(data);
+}
+
+
+#define GKO_DECLARE_REDUCED_CSR_MATRIX(ValueType, IndexType) \
+    class ReducedCsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_REDUCED_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_REDUCED_CSR_KERNELS_HPP_
+#define GKO_CORE_MATRIX_REDUCED_CSR_KERNELS_HPP_
+
+
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/reduced_csr.hpp>
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_REDUCED_CSR_SPMV_KERNEL(ValueType, IndexType) \
+    void spmv(std::shared_ptr<const DefaultExecutor> exec,        \
+              const matrix::ReducedCsr<ValueType, IndexType>* a,  \
+              const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+
+#define GKO_DECLARE_REDUCED_CSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType) \
+    void advanced_spmv(std::shared_ptr<const DefaultExecutor> exec,        \
+                       const matrix::Dense<ValueType>* alpha,              \
+                       const matrix::ReducedCsr<ValueType, IndexType>* a,  \
+                       const matrix::Dense<ValueType>* b,                  \
+                       const matrix::Dense<ValueType>* beta,               \
+                       matrix::Dense<ValueType>* c)
+
+#define GKO_DECLARE_REDUCED_CSR_COMPRESS_VALUES_KERNEL(ValueType, IndexType) \
+    void compress_values(std::shared_ptr<const DefaultExecutor> exec,        \
+                         const matrix::Csr<ValueType, IndexType>* source,    \
+                         matrix::reduced_storage mode, uint8* storage,       \
+                         remove_complex<ValueType>* scales)
+
+#define GKO_DECLARE_REDUCED_CSR_DECOMPRESS_VALUES_KERNEL(ValueType, IndexType) \
+    void decompress_values(                                                    \
+        std::shared_ptr<const DefaultExecutor> exec,                           \
+        const matrix::ReducedCsr<ValueType, IndexType>* source,                \
+        ValueType* values)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                        \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_REDUCED_CSR_SPMV_KERNEL(ValueType, IndexType);              \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_REDUCED_CSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType);     \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_REDUCED_CSR_COMPRESS_VALUES_KERNEL(ValueType, IndexType);   \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_REDUCED_CSR_DECOMPRESS_VALUES_KERNEL(ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(reduced_csr,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_REDUCED_CSR_KERNELS_HPP_
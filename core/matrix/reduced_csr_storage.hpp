@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_REDUCED_CSR_STORAGE_HPP_
+#define GKO_CORE_MATRIX_REDUCED_CSR_STORAGE_HPP_
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/reduced_csr.hpp>
+
+#include "accessor/reduced_row_major.hpp"
+#include "accessor/utils.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace reduced_csr {
+
+
+/** Largest magnitude of a stored value in reduced_storage::scaled_int16. */
+constexpr int16 max_scaled_value = 32767;
+
+
+/**
+ * Describes how the values of a ReducedCsr matrix are stored: as
+ * `StorageType`, and multiplied by a per-row scale on access if `Scaled` is
+ * true.
+ */
+template <typename StorageType, bool Scaled>
+struct storage_traits {
+    using storage_type = StorageType;
+    static constexpr bool is_scaled = Scaled;
+};
+
+
+/**
+ * Calls `fn` with the storage_traits matching the storage mode `mode` for
+ * matrices with value type ValueType.
+ *
+ * @throws NotSupported  if `mode` is reduced_storage::scaled_int16 and
+ *                       ValueType is complex.
+ */
+template <typename ValueType, typename Callable>
+void run_with_storage(reduced_storage mode, Callable&& fn)
+{
+    switch (mode) {
+    case reduced_storage::single_reduction:
+        fn(storage_traits<reduce_precision<ValueType>, false>{});
+        break;
+    case reduced_storage::double_reduction:
+        fn(storage_traits<reduce_precision<reduce_precision<ValueType>>,
+                          false>{});
+        break;
+    case reduced_storage::scaled_int16:
+        if constexpr (is_complex<ValueType>()) {
+            GKO_NOT_SUPPORTED(mode);
+        } else {
+            fn(storage_traits<int16, true>{});
+        }
+        break;
+    default:
+        GKO_NOT_SUPPORTED(mode);
+    }
+}
+
+
+/**
+ * Returns the number of bytes used to store a single value in storage mode
+ * `mode`.
+ */
+template <typename ValueType>
+size_type storage_bytes_per_value(reduced_storage mode)
+{
+    size_type result{};
+    run_with_storage<ValueType>(mode, [&](auto traits) {
+        result = sizeof(typename decltype(traits)::storage_type);
+    });
+    return result;
+}
+
+
+/**
+ * Returns the scaling factor for reduced_storage::scaled_int16 of a row whose
+ * largest entry has the magnitude `max_abs`.
+ */
+template <typename ScaleType>
+inline ScaleType compute_scale(ScaleType max_abs)
+{
+    return static_cast<ScaleType>(static_cast<double>(max_abs) /
+                                  max_scaled_value);
+}
+
+
+/**
+ * Returns the 16 bit integer representing `value` in a row with scaling
+ * factor `scale`. The result is clamped to the representable range, since
+ * `scale` may have been rounded down when it was stored.
+ */
+template <typename ValueType>
+inline int16 to_scaled_int16(ValueType value, ValueType scale)
+{
+    const auto s = static_cast<double>(scale);
+    if (s == 0.0) {
+        return 0;
+    }
+    const auto scaled = std::round(static_cast<double>(value) / s);
+    return static_cast<int16>(
+        std::min<double>(std::max<double>(scaled, -max_scaled_value),
+                         max_scaled_value));
+}
+
+
+/**
+ * Builds an accessor that reads `num_values` values stored as StorageType in
+ * `storage` and converts them to ArithmeticType.
+ */
+template <typename ArithmeticType, typename StorageType>
+auto build_const_storage_accessor(const uint8* storage, size_type num_values)
+{
+    using accessor =
+        acc::reduced_row_major<1, ArithmeticType, const StorageType>;
+    return acc::range<accessor>(
+        std::array<acc::size_type, 1>{
+            {static_cast<acc::size_type>(num_values)}},
+        reinterpret_cast<const StorageType*>(storage));
+}
+
+
+/**
+ * Builds an accessor that converts ArithmeticType values to StorageType when
+ * writing them to the first `num_values` entries of `storage`.
+ */
+template <typename ArithmeticType, typename StorageType>
+auto build_storage_accessor(uint8* storage, size_type num_values)
+{
+    using accessor = acc::reduced_row_major<1, ArithmeticType, StorageType>;
+    return acc::range<accessor>(
+        std::array<acc::size_type, 1>{
+            {static_cast<acc::size_type>(num_values)}},
+        reinterpret_cast<StorageType*>(storage));
+}
+
+
+}  // namespace reduced_csr
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_REDUCED_CSR_STORAGE_HPP_
@@ -4,6 +4,9 @@
 
 #include "ginkgo/core/matrix/sellp.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/math.hpp>
@@ -11,6 +14,7 @@
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
 
 #include "core/base/allocator.hpp"
 #include "core/base/array_access.hpp"
@@ -62,6 +66,8 @@ Sellp<ValueType, IndexType>& Sellp<ValueType, IndexType>::operator=(
         slice_sets_ = other.slice_sets_;
         slice_size_ = other.slice_size_;
         stride_factor_ = other.stride_factor_;
+        sorting_window_ = other.sorting_window_;
+        permutation_ = other.permutation_;
     }
     return *this;
 }
@@ -77,9 +83,11 @@ Sellp<ValueType, IndexType>& Sellp<ValueType, IndexType>::operator=(
         col_idxs_ = std::move(other.col_idxs_);
         slice_lengths_ = std::move(other.slice_lengths_);
         slice_sets_ = std::move(other.slice_sets_);
-        // slice_size and stride_factor are immutable
+        permutation_ = std::move(other.permutation_);
+        // slice_size, stride_factor and sorting_window are immutable
         slice_size_ = other.slice_size_;
         stride_factor_ = other.stride_factor_;
+        sorting_window_ = other.sorting_window_;
         // restore other invariant
         other.slice_sets_.resize_and_reset(1);
         other.slice_sets_.fill(0);
@@ -116,13 +124,26 @@ Sellp<ValueType, IndexType>::Sellp(std::shared_ptr<const Executor> exec,
                                    const dim<2>& size, size_type slice_size,
                                    size_type stride_factor,
                                    size_type total_cols)
+    : Sellp(std::move(exec), size, slice_size, stride_factor,
+            default_sorting_window, total_cols)
+{}
+
+
+template <typename ValueType, typename IndexType>
+Sellp<ValueType, IndexType>::Sellp(std::shared_ptr<const Executor> exec,
+                                   const dim<2>& size, size_type slice_size,
+                                   size_type stride_factor,
+                                   size_type sorting_window,
+                                   size_type total_cols)
     : EnableLinOp<Sellp>(exec, size),
       values_(exec, slice_size * total_cols),
       col_idxs_(exec, slice_size * total_cols),
       slice_lengths_(exec, ceildiv(size[0], slice_size)),
       slice_sets_(exec, ceildiv(size[0], slice_size) + 1),
       slice_size_(slice_size),
-      stride_factor_(stride_factor)
+      stride_factor_(stride_factor),
+      sorting_window_(std::max<size_type>(sorting_window, 1)),
+      permutation_(exec)
 {
     slice_sets_.fill(0);
     slice_lengths_.fill(0);
@@ -150,6 +171,36 @@ Sellp<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
 }
 
 
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Sellp<ValueType, IndexType>>
+Sellp<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                    const dim<2>& size, size_type slice_size,
+                                    size_type stride_factor,
+                                    size_type sorting_window,
+                                    size_type total_cols)
+{
+    return std::unique_ptr<Sellp>{new Sellp{exec, size, slice_size,
+                                            stride_factor, sorting_window,
+                                            total_cols}};
+}
+
+
+template <typename ValueType, typename IndexType>
+size_type Sellp<ValueType, IndexType>::simd_slice_size() noexcept
+{
+#if defined(__AVX512F__)
+    constexpr size_type simd_bytes = 64;
+#elif defined(__AVX__)
+    constexpr size_type simd_bytes = 32;
+#else
+    // SSE2, NEON and VSX all provide 128 bit registers
+    constexpr size_type simd_bytes = 16;
+#endif
+    return std::min<size_type>(
+        std::max<size_type>(simd_bytes / sizeof(ValueType), 4), 16);
+}
+
+
 template <typename ValueType, typename IndexType>
 void Sellp<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
 {
@@ -184,6 +235,8 @@ void Sellp<ValueType, IndexType>::convert_to(
     result->slice_sets_ = this->slice_sets_;
     result->slice_size_ = this->slice_size_;
     result->stride_factor_ = this->stride_factor_;
+    result->sorting_window_ = this->sorting_window_;
+    result->permutation_ = this->permutation_;
     result->set_size(this->get_size());
 }
 
@@ -207,6 +260,8 @@ void Sellp<ValueType, IndexType>::convert_to(
     result->slice_sets_ = this->slice_sets_;
     result->slice_size_ = this->slice_size_;
     result->stride_factor_ = this->stride_factor_;
+    result->sorting_window_ = this->sorting_window_;
+    result->permutation_ = this->permutation_;
     result->set_size(this->get_size());
 }
 
@@ -269,11 +324,55 @@ void Sellp<ValueType, IndexType>::move_to(Csr<ValueType, IndexType>* result)
 }
 
 
+template <typename ValueType, typename IndexType>
+void Sellp<ValueType, IndexType>::fill_sorted(
+    const Csr<ValueType, IndexType>* source)
+{
+    auto exec = this->get_executor();
+    auto host_exec = exec->get_master();
+    const auto num_rows = source->get_size()[0];
+    // the permutation only depends on the row lengths, which are cheap to
+    // sort on the host compared to the remaining conversion
+    array<IndexType> row_ptrs{host_exec, num_rows + 1};
+    host_exec->copy_from(source->get_executor(), num_rows + 1,
+                         source->get_const_row_ptrs(), row_ptrs.get_data());
+    array<IndexType> perm{host_exec, num_rows};
+    const auto host_row_ptrs = row_ptrs.get_const_data();
+    const auto host_perm = perm.get_data();
+    std::iota(host_perm, host_perm + num_rows, IndexType{});
+    for (size_type begin = 0; begin < num_rows; begin += sorting_window_) {
+        const auto end = std::min(begin + sorting_window_, num_rows);
+        std::stable_sort(host_perm + begin, host_perm + end,
+                         [&](IndexType a, IndexType b) {
+                             return host_row_ptrs[a + 1] - host_row_ptrs[a] >
+                                    host_row_ptrs[b + 1] - host_row_ptrs[b];
+                         });
+    }
+    auto sorted = make_temporary_clone(exec, source)->permute(
+        Permutation<IndexType>::create(exec, perm), permute_mode::rows);
+    auto unsorted_result =
+        Sellp::create(exec, {}, slice_size_, stride_factor_, 0);
+    sorted->convert_to(unsorted_result.get());
+    values_ = std::move(unsorted_result->values_);
+    col_idxs_ = std::move(unsorted_result->col_idxs_);
+    slice_lengths_ = std::move(unsorted_result->slice_lengths_);
+    slice_sets_ = std::move(unsorted_result->slice_sets_);
+    permutation_ = perm;
+    this->set_size(source->get_size());
+}
+
+
 template <typename ValueType, typename IndexType>
 void Sellp<ValueType, IndexType>::read(const device_mat_data& data)
 {
     auto exec = this->get_executor();
     const auto size = data.get_size();
+    if (sorting_window_ > 1) {
+        auto csr = Csr<ValueType, IndexType>::create(exec);
+        csr->read(data);
+        this->fill_sorted(csr.get());
+        return;
+    }
     slice_lengths_.resize_and_reset(ceildiv(size[0], slice_size_));
     slice_sets_.resize_and_reset(ceildiv(size[0], slice_size_) + 1);
     this->set_size(size);
@@ -316,14 +415,17 @@ void Sellp<ValueType, IndexType>::write(mat_data& data) const
 
     data = {tmp->get_size(), {}};
 
+    const auto perm = tmp->get_const_permutation();
     auto slice_size = tmp->get_slice_size();
     size_type slice_num = static_cast<index_type>(
         (tmp->get_size()[0] + slice_size - 1) / slice_size);
     for (size_type slice = 0; slice < slice_num; slice++) {
         for (size_type row_in_slice = 0; row_in_slice < slice_size;
              row_in_slice++) {
-            auto row = slice * slice_size + row_in_slice;
-            if (row < tmp->get_size()[0]) {
+            const auto stored_row = slice * slice_size + row_in_slice;
+            if (stored_row < tmp->get_size()[0]) {
+                const auto row = perm ? static_cast<size_type>(perm[stored_row])
+                                      : stored_row;
                 const auto slice_len = tmp->get_const_slice_lengths()[slice];
                 const auto slice_offset = tmp->get_const_slice_sets()[slice];
                 for (size_type i = 0; i < slice_len; i++) {
@@ -336,6 +438,9 @@ void Sellp<ValueType, IndexType>::write(mat_data& data) const
             }
         }
     }
+    if (perm) {
+        data.sort_row_major();
+    }
 }
 
 
@@ -372,11 +477,13 @@ Sellp<ValueType, IndexType>::compute_absolute() const
 
     auto abs_sellp = absolute_type::create(
         exec, this->get_size(), this->get_slice_size(),
-        this->get_stride_factor(), this->get_total_cols());
+        this->get_stride_factor(), this->get_sorting_window(),
+        this->get_total_cols());
 
     abs_sellp->col_idxs_ = col_idxs_;
     abs_sellp->slice_lengths_ = slice_lengths_;
     abs_sellp->slice_sets_ = slice_sets_;
+    abs_sellp->permutation_ = permutation_;
     exec->run(sellp::make_outplace_absolute_array(
         this->get_const_values(), this->get_num_stored_elements(),
         abs_sellp->get_values()));
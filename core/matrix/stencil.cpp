@@ -0,0 +1,254 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/matrix/stencil.hpp"
+
+#include <utility>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+#include "core/base/array_access.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/stencil_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace stencil {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, stencil::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, stencil::advanced_spmv);
+GKO_REGISTER_OPERATION(count_row_nonzeros, stencil::count_row_nonzeros);
+GKO_REGISTER_OPERATION(fill_in_csr, stencil::fill_in_csr);
+GKO_REGISTER_OPERATION(extract_diagonal, stencil::extract_diagonal);
+GKO_REGISTER_OPERATION(prefix_sum_nonnegative,
+                       components::prefix_sum_nonnegative);
+
+
+}  // anonymous namespace
+}  // namespace stencil
+
+
+namespace {
+
+
+dim<2> get_stencil_size(const dim<3>& grid_size)
+{
+    return dim<2>{grid_size[0] * grid_size[1] * grid_size[2]};
+}
+
+
+/**
+ * Returns the constant coefficients of the negative Laplacian, i.e. the number
+ * of neighbors for the center and -1 for the neighbors.
+ */
+template <typename ValueType>
+array<ValueType> make_laplacian_coefficients(
+    std::shared_ptr<const Executor> exec, stencil_type type)
+{
+    const auto num_points = get_num_stencil_points(type);
+    array<ValueType> coefficients(exec->get_master(), num_points);
+    coefficients.fill(-one<ValueType>());
+    coefficients.get_data()[(num_points - 1) / 2] =
+        static_cast<ValueType>(num_points - 1);
+    return coefficients;
+}
+
+
+}  // anonymous namespace
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>& Stencil<ValueType, IndexType>::operator=(
+    const Stencil& other)
+{
+    if (&other != this) {
+        EnableLinOp<Stencil>::operator=(other);
+        grid_size_ = other.grid_size_;
+        type_ = other.type_;
+        coefficients_ = other.coefficients_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>& Stencil<ValueType, IndexType>::operator=(
+    Stencil&& other)
+{
+    if (&other != this) {
+        EnableLinOp<Stencil>::operator=(std::move(other));
+        grid_size_ = std::exchange(other.grid_size_, dim<3>{});
+        type_ = std::exchange(other.type_, stencil_type::five_point);
+        coefficients_ = std::move(other.coefficients_);
+        // restore other invariant
+        other.coefficients_.clear();
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>::Stencil(const Stencil& other)
+    : Stencil(other.get_executor())
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>::Stencil(Stencil&& other)
+    : Stencil(other.get_executor())
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>::Stencil(std::shared_ptr<const Executor> exec,
+                                       const dim<3>& grid_size,
+                                       stencil_type type)
+    : Stencil(exec, grid_size, type,
+              make_laplacian_coefficients<ValueType>(exec, type))
+{}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>::Stencil(std::shared_ptr<const Executor> exec,
+                                       const dim<3>& grid_size,
+                                       stencil_type type,
+                                       array<value_type> coefficients)
+    : EnableLinOp<Stencil>(exec, get_stencil_size(grid_size)),
+      grid_size_{grid_size},
+      type_{type},
+      coefficients_{exec, std::move(coefficients)}
+{
+    if (type == stencil_type::five_point || type == stencil_type::nine_point) {
+        GKO_ASSERT_EQ(grid_size[2], 1);
+    }
+    const auto num_points = this->get_num_points();
+    if (coefficients_.get_size() != num_points) {
+        GKO_ASSERT_EQ(coefficients_.get_size(),
+                      num_points * this->get_size()[0]);
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Stencil<ValueType, IndexType>>
+Stencil<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                      const dim<3>& grid_size,
+                                      stencil_type type)
+{
+    return std::unique_ptr<Stencil>{new Stencil{exec, grid_size, type}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Stencil<ValueType, IndexType>>
+Stencil<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                      const dim<3>& grid_size,
+                                      stencil_type type,
+                                      array<value_type> coefficients)
+{
+    return std::unique_ptr<Stencil>{
+        new Stencil{exec, grid_size, type, std::move(coefficients)}};
+}
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                stencil::make_spmv(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                               const LinOp* b,
+                                               const LinOp* beta,
+                                               LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(stencil::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x));
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    {
+        auto tmp = make_temporary_clone(exec, result);
+        tmp->row_ptrs_.resize_and_reset(num_rows + 1);
+        exec->run(
+            stencil::make_count_row_nonzeros(this, tmp->row_ptrs_.get_data()));
+        exec->run(stencil::make_prefix_sum_nonnegative(
+            tmp->row_ptrs_.get_data(), num_rows + 1));
+        const auto nnz =
+            static_cast<size_type>(get_element(tmp->row_ptrs_, num_rows));
+        tmp->col_idxs_.resize_and_reset(nnz);
+        tmp->values_.resize_and_reset(nnz);
+        tmp->set_size(this->get_size());
+        exec->run(stencil::make_fill_in_csr(this, tmp.get()));
+    }
+    result->make_srow();
+}
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::move_to(Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto csr = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(csr.get());
+    csr->write(data);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Diagonal<ValueType>>
+Stencil<ValueType, IndexType>::extract_diagonal() const
+{
+    auto exec = this->get_executor();
+
+    auto diag = Diagonal<ValueType>::create(exec, this->get_size()[0]);
+    exec->run(stencil::make_extract_diagonal(this, diag.get()));
+    return diag;
+}
+
+
+#define GKO_DECLARE_STENCIL_MATRIX(ValueType, IndexType) \
+    class Stencil<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
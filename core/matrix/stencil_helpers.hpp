@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_STENCIL_HELPERS_HPP_
+#define GKO_CORE_MATRIX_STENCIL_HELPERS_HPP_
+
+
+#include <cstdlib>
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace stencil {
+
+
+/**
+ * Returns true if the offset `(dx, dy, dz)` is a point of the stencil `type`.
+ */
+inline bool is_point(stencil_type type, int dx, int dy, int dz)
+{
+    const auto distance = std::abs(dx) + std::abs(dy) + std::abs(dz);
+    switch (type) {
+    case stencil_type::five_point:
+        return dz == 0 && distance <= 1;
+    case stencil_type::nine_point:
+        return dz == 0;
+    case stencil_type::seven_point:
+        return distance <= 1;
+    default:
+        return true;
+    }
+}
+
+
+/**
+ * Calls `callback(point, dx, dy, dz)` for all points of the stencil `type` in
+ * the order of the stencil coefficients, i.e. by increasing column offset.
+ */
+template <typename Callback>
+void for_each_point(stencil_type type, Callback callback)
+{
+    int point = 0;
+    for (int dz = -1; dz <= 1; dz++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                if (is_point(type, dx, dy, dz)) {
+                    callback(point, dx, dy, dz);
+                    point++;
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * Returns true if `idx + offset` lies in `[0, size)`.
+ */
+inline bool is_in_grid(int64 idx, int offset, int64 size)
+{
+    return idx + offset >= 0 && idx + offset < size;
+}
+
+
+}  // namespace stencil
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_STENCIL_HELPERS_HPP_
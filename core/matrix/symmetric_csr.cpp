@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/matrix/symmetric_csr.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+#include "core/base/array_access.hpp"
+#include "core/components/fill_array_kernels.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace symmetric_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, symmetric_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, symmetric_csr::advanced_spmv);
+GKO_REGISTER_OPERATION(count_upper_nonzeros,
+                       symmetric_csr::count_upper_nonzeros);
+GKO_REGISTER_OPERATION(fill_in_upper, symmetric_csr::fill_in_upper);
+GKO_REGISTER_OPERATION(count_full_nonzeros,
+                       symmetric_csr::count_full_nonzeros);
+GKO_REGISTER_OPERATION(fill_in_csr, symmetric_csr::fill_in_csr);
+GKO_REGISTER_OPERATION(extract_diagonal, symmetric_csr::extract_diagonal);
+GKO_REGISTER_OPERATION(fill_array, components::fill_array);
+GKO_REGISTER_OPERATION(prefix_sum_nonnegative,
+                       components::prefix_sum_nonnegative);
+
+
+}  // anonymous namespace
+}  // namespace symmetric_csr
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>& SymmetricCsr<ValueType, IndexType>::
+operator=(const SymmetricCsr& other)
+{
+    if (&other != this) {
+        EnableLinOp<SymmetricCsr>::operator=(other);
+        row_ptrs_ = other.row_ptrs_;
+        col_idxs_ = other.col_idxs_;
+        values_ = other.values_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>& SymmetricCsr<ValueType, IndexType>::
+operator=(SymmetricCsr&& other)
+{
+    if (&other != this) {
+        EnableLinOp<SymmetricCsr>::operator=(std::move(other));
+        row_ptrs_ = std::move(other.row_ptrs_);
+        col_idxs_ = std::move(other.col_idxs_);
+        values_ = std::move(other.values_);
+        // restore other invariant
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(const SymmetricCsr& other)
+    : SymmetricCsr(other.get_executor())
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(SymmetricCsr&& other)
+    : SymmetricCsr(other.get_executor())
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(
+    std::shared_ptr<const Executor> exec, const dim<2>& size)
+    : EnableLinOp<SymmetricCsr>(exec, size),
+      row_ptrs_(exec, size[0] + 1),
+      col_idxs_(exec),
+      values_(exec),
+      workspace_(exec)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(size);
+    row_ptrs_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<SymmetricCsr<ValueType, IndexType>>
+SymmetricCsr<ValueType, IndexType>::create(
+    std::shared_ptr<const Executor> exec, const dim<2>& size)
+{
+    return std::unique_ptr<SymmetricCsr>{new SymmetricCsr{exec, size}};
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                    LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                symmetric_csr::make_spmv(this, dense_b, dense_x, workspace_));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                    const LinOp* b,
+                                                    const LinOp* beta,
+                                                    LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(symmetric_csr::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x, workspace_));
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::fill_from(
+    const Csr<ValueType, IndexType>* source)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(source);
+    auto exec = this->get_executor();
+    auto local_source = make_temporary_clone(exec, source);
+    const auto num_rows = source->get_size()[0];
+    row_ptrs_.resize_and_reset(num_rows + 1);
+    exec->run(symmetric_csr::make_count_upper_nonzeros(local_source.get(),
+                                                       row_ptrs_.get_data()));
+    exec->run(symmetric_csr::make_prefix_sum_nonnegative(row_ptrs_.get_data(),
+                                                         num_rows + 1));
+    const auto nnz = static_cast<size_type>(get_element(row_ptrs_, num_rows));
+    col_idxs_.resize_and_reset(nnz);
+    values_.resize_and_reset(nnz);
+    exec->run(symmetric_csr::make_fill_in_upper(
+        local_source.get(), row_ptrs_.get_const_data(), col_idxs_.get_data(),
+        values_.get_data()));
+    this->set_size(source->get_size());
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    {
+        auto tmp = make_temporary_clone(exec, result);
+        tmp->row_ptrs_.resize_and_reset(num_rows + 1);
+        exec->run(symmetric_csr::make_count_full_nonzeros(
+            this, tmp->row_ptrs_.get_data()));
+        exec->run(symmetric_csr::make_prefix_sum_nonnegative(
+            tmp->row_ptrs_.get_data(), num_rows + 1));
+        const auto nnz =
+            static_cast<size_type>(get_element(tmp->row_ptrs_, num_rows));
+        tmp->col_idxs_.resize_and_reset(nnz);
+        tmp->values_.resize_and_reset(nnz);
+        tmp->set_size(this->get_size());
+        exec->run(symmetric_csr::make_fill_in_csr(this, tmp.get()));
+    }
+    result->make_srow();
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::move_to(
+    Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    auto csr = Csr<ValueType, IndexType>::create(this->get_executor());
+    csr->read(data);
+    this->fill_from(csr.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    this->read(data);
+    data.empty_out();
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    this->read(device_mat_data::create_from_host(this->get_executor(), data));
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto csr = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(csr.get());
+    csr->write(data);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Diagonal<ValueType>>
+SymmetricCsr<ValueType, IndexType>::extract_diagonal() const
+{
+    auto exec = this->get_executor();
+
+    auto diag = Diagonal<ValueType>::create(exec, this->get_size()[0]);
+    exec->run(symmetric_csr::make_fill_array(
+        diag->get_values(), diag->get_size()[0], zero<ValueType>()));
+    exec->run(symmetric_csr::make_extract_diagonal(this, diag.get()));
+    return diag;
+}
+
+
+#define GKO_DECLARE_SYMMETRIC_CSR_MATRIX(ValueType, IndexType) \
+    class SymmetricCsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,321 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/matrix/vbcsr.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/base/array_access.hpp"
+#include "core/components/fill_array_kernels.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/vbcsr_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace vbcsr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, vbcsr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, vbcsr::advanced_spmv);
+GKO_REGISTER_OPERATION(count_blocks, vbcsr::count_blocks);
+GKO_REGISTER_OPERATION(fill_in_blocks, vbcsr::fill_in_blocks);
+GKO_REGISTER_OPERATION(convert_to_csr, vbcsr::convert_to_csr);
+GKO_REGISTER_OPERATION(fill_seq_array, components::fill_seq_array);
+GKO_REGISTER_OPERATION(prefix_sum_nonnegative,
+                       components::prefix_sum_nonnegative);
+
+
+/**
+ * Returns the offsets of the block partition of `source` obtained by merging
+ * consecutive rows with identical sparsity patterns. This only takes a single
+ * sweep over the pattern, which is run on the host.
+ */
+template <typename ValueType, typename IndexType>
+array<IndexType> detect_block_offsets(std::shared_ptr<const Executor> exec,
+                                      const Csr<ValueType, IndexType>* source)
+{
+    auto host_source = make_temporary_clone(exec->get_master(), source);
+    const auto row_ptrs = host_source->get_const_row_ptrs();
+    const auto col_idxs = host_source->get_const_col_idxs();
+    const auto num_rows = static_cast<IndexType>(source->get_size()[0]);
+    std::vector<IndexType> offsets{0};
+    for (IndexType row = 1; row < num_rows; row++) {
+        const auto same_pattern = std::equal(
+            col_idxs + row_ptrs[row - 1], col_idxs + row_ptrs[row],
+            col_idxs + row_ptrs[row], col_idxs + row_ptrs[row + 1]);
+        if (!same_pattern) {
+            offsets.push_back(row);
+        }
+    }
+    if (num_rows > 0) {
+        offsets.push_back(num_rows);
+    }
+    return array<IndexType>{
+        exec, array<IndexType>{exec->get_master(), offsets.begin(),
+                               offsets.end()}};
+}
+
+
+}  // anonymous namespace
+}  // namespace vbcsr
+
+
+template <typename ValueType, typename IndexType>
+Vbcsr<ValueType, IndexType>& Vbcsr<ValueType, IndexType>::operator=(
+    const Vbcsr& other)
+{
+    if (&other != this) {
+        EnableLinOp<Vbcsr>::operator=(other);
+        detect_blocks_ = other.detect_blocks_;
+        block_offsets_ = other.block_offsets_;
+        row_ptrs_ = other.row_ptrs_;
+        col_idxs_ = other.col_idxs_;
+        value_ptrs_ = other.value_ptrs_;
+        values_ = other.values_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+Vbcsr<ValueType, IndexType>& Vbcsr<ValueType, IndexType>::operator=(
+    Vbcsr&& other)
+{
+    if (&other != this) {
+        EnableLinOp<Vbcsr>::operator=(std::move(other));
+        detect_blocks_ = other.detect_blocks_;
+        block_offsets_ = std::move(other.block_offsets_);
+        row_ptrs_ = std::move(other.row_ptrs_);
+        col_idxs_ = std::move(other.col_idxs_);
+        value_ptrs_ = std::move(other.value_ptrs_);
+        values_ = std::move(other.values_);
+        // restore other invariant
+        other.block_offsets_.resize_and_reset(1);
+        other.block_offsets_.fill(0);
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+Vbcsr<ValueType, IndexType>::Vbcsr(const Vbcsr& other)
+    : Vbcsr(other.get_executor())
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+Vbcsr<ValueType, IndexType>::Vbcsr(Vbcsr&& other)
+    : Vbcsr(other.get_executor())
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+Vbcsr<ValueType, IndexType>::Vbcsr(std::shared_ptr<const Executor> exec,
+                                   const dim<2>& size)
+    : EnableLinOp<Vbcsr>(exec, size),
+      detect_blocks_{true},
+      block_offsets_(exec, size[0] + 1),
+      row_ptrs_(exec, size[0] + 1),
+      col_idxs_(exec),
+      value_ptrs_(exec),
+      values_(exec)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(size);
+    // until the matrix is filled, every row forms its own block
+    exec->run(vbcsr::make_fill_seq_array(block_offsets_.get_data(),
+                                         block_offsets_.get_size()));
+    row_ptrs_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+Vbcsr<ValueType, IndexType>::Vbcsr(std::shared_ptr<const Executor> exec,
+                                   const dim<2>& size,
+                                   array<index_type> block_sizes)
+    : EnableLinOp<Vbcsr>(exec, size),
+      detect_blocks_{false},
+      block_offsets_(exec, block_sizes.get_size() + 1),
+      row_ptrs_(exec, block_sizes.get_size() + 1),
+      col_idxs_(exec),
+      value_ptrs_(exec),
+      values_(exec)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(size);
+    const auto num_blocks = block_sizes.get_size();
+    exec->copy_from(block_sizes.get_executor(), num_blocks,
+                    block_sizes.get_const_data(), block_offsets_.get_data());
+    set_element(block_offsets_, num_blocks, zero<index_type>());
+    exec->run(vbcsr::make_prefix_sum_nonnegative(block_offsets_.get_data(),
+                                                 num_blocks + 1));
+    GKO_ASSERT_EQ(
+        static_cast<size_type>(get_element(block_offsets_, num_blocks)),
+        size[0]);
+    row_ptrs_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Vbcsr<ValueType, IndexType>>
+Vbcsr<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                    const dim<2>& size)
+{
+    return std::unique_ptr<Vbcsr>{new Vbcsr{exec, size}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Vbcsr<ValueType, IndexType>>
+Vbcsr<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                    const dim<2>& size,
+                                    array<index_type> block_sizes)
+{
+    return std::unique_ptr<Vbcsr>{
+        new Vbcsr{exec, size, std::move(block_sizes)}};
+}
+
+
+template <typename ValueType, typename IndexType>
+void Vbcsr<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                vbcsr::make_spmv(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Vbcsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                             const LinOp* b, const LinOp* beta,
+                                             LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(vbcsr::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x));
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Vbcsr<ValueType, IndexType>::fill_from(
+    const Csr<ValueType, IndexType>* source)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(source);
+    auto exec = this->get_executor();
+    auto local_source = make_temporary_clone(exec, source);
+    if (detect_blocks_) {
+        block_offsets_ = vbcsr::detect_block_offsets(exec, source);
+    }
+    const auto num_block_rows = this->get_num_block_rows();
+    GKO_ASSERT_EQ(
+        static_cast<size_type>(get_element(block_offsets_, num_block_rows)),
+        source->get_size()[0]);
+    row_ptrs_.resize_and_reset(num_block_rows + 1);
+    array<index_type> row_value_ptrs{exec, num_block_rows + 1};
+    exec->run(vbcsr::make_count_blocks(
+        local_source.get(), block_offsets_.get_const_data(), num_block_rows,
+        row_ptrs_.get_data(), row_value_ptrs.get_data()));
+    exec->run(vbcsr::make_prefix_sum_nonnegative(row_ptrs_.get_data(),
+                                                 num_block_rows + 1));
+    exec->run(vbcsr::make_prefix_sum_nonnegative(row_value_ptrs.get_data(),
+                                                 num_block_rows + 1));
+    const auto num_blocks =
+        static_cast<size_type>(get_element(row_ptrs_, num_block_rows));
+    col_idxs_.resize_and_reset(num_blocks);
+    value_ptrs_.resize_and_reset(num_blocks + 1);
+    values_.resize_and_reset(
+        static_cast<size_type>(get_element(row_value_ptrs, num_block_rows)));
+    exec->run(vbcsr::make_fill_in_blocks(
+        local_source.get(), block_offsets_.get_const_data(), num_block_rows,
+        row_ptrs_.get_const_data(), row_value_ptrs.get_const_data(),
+        col_idxs_.get_data(), value_ptrs_.get_data(), values_.get_data()));
+    this->set_size(source->get_size());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Vbcsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    {
+        auto tmp = make_temporary_clone(exec, result);
+        tmp->row_ptrs_.resize_and_reset(this->get_size()[0] + 1);
+        tmp->col_idxs_.resize_and_reset(this->get_num_stored_elements());
+        tmp->values_.resize_and_reset(this->get_num_stored_elements());
+        tmp->set_size(this->get_size());
+        exec->run(vbcsr::make_convert_to_csr(this, tmp.get()));
+    }
+    result->make_srow();
+}
+
+
+template <typename ValueType, typename IndexType>
+void Vbcsr<ValueType, IndexType>::move_to(Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Vbcsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    auto csr = Csr<ValueType, IndexType>::create(this->get_executor());
+    csr->read(data);
+    this->fill_from(csr.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Vbcsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    this->read(data);
+    data.empty_out();
+}
+
+
+template <typename ValueType, typename IndexType>
+void Vbcsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    this->read(device_mat_data::create_from_host(this->get_executor(), data));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Vbcsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto csr = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(csr.get());
+    csr->write(data);
+}
+
+
+#define GKO_DECLARE_VBCSR_MATRIX(ValueType, IndexType) \
+    class Vbcsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_VBCSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
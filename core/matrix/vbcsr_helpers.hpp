@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_VBCSR_HELPERS_HPP_
+#define GKO_CORE_MATRIX_VBCSR_HELPERS_HPP_
+
+
+#include <algorithm>
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace vbcsr {
+
+
+/**
+ * Returns the index of the block containing the row or column `idx`.
+ */
+template <typename IndexType>
+inline IndexType find_block(const IndexType* block_offsets,
+                            size_type num_blocks, IndexType idx)
+{
+    return static_cast<IndexType>(
+        std::upper_bound(block_offsets, block_offsets + num_blocks + 1, idx) -
+        block_offsets - 1);
+}
+
+
+/**
+ * Stores the sorted and unique block column indexes of all entries of
+ * `source` in the block row `block_row` in `block_cols`.
+ */
+template <typename ValueType, typename IndexType, typename Vector>
+void collect_block_cols(const Csr<ValueType, IndexType>* source,
+                        const IndexType* block_offsets, size_type num_blocks,
+                        size_type block_row, Vector& block_cols)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    block_cols.clear();
+    for (auto nz = row_ptrs[block_offsets[block_row]];
+         nz < row_ptrs[block_offsets[block_row + 1]]; nz++) {
+        block_cols.push_back(
+            find_block(block_offsets, num_blocks, col_idxs[nz]));
+    }
+    std::sort(block_cols.begin(), block_cols.end());
+    block_cols.erase(std::unique(block_cols.begin(), block_cols.end()),
+                     block_cols.end());
+}
+
+
+}  // namespace vbcsr
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_VBCSR_HELPERS_HPP_
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_VBCSR_KERNELS_HPP_
+#define GKO_CORE_MATRIX_VBCSR_KERNELS_HPP_
+
+
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/vbcsr.hpp>
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_VBCSR_SPMV_KERNEL(ValueType, IndexType) \
+    void spmv(std::shared_ptr<const DefaultExecutor> exec,  \
+              const matrix::Vbcsr<ValueType, IndexType>* a, \
+              const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+
+#define GKO_DECLARE_VBCSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType) \
+    void advanced_spmv(std::shared_ptr<const DefaultExecutor> exec,  \
+                       const matrix::Dense<ValueType>* alpha,        \
+                       const matrix::Vbcsr<ValueType, IndexType>* a, \
+                       const matrix::Dense<ValueType>* b,            \
+                       const matrix::Dense<ValueType>* beta,         \
+                       matrix::Dense<ValueType>* c)
+
+#define GKO_DECLARE_VBCSR_COUNT_BLOCKS_KERNEL(ValueType, IndexType)     \
+    void count_blocks(std::shared_ptr<const DefaultExecutor> exec,      \
+                      const matrix::Csr<ValueType, IndexType>* source,  \
+                      const IndexType* block_offsets,                   \
+                      size_type num_block_rows, IndexType* block_count, \
+                      IndexType* value_count)
+
+#define GKO_DECLARE_VBCSR_FILL_IN_BLOCKS_KERNEL(ValueType, IndexType) \
+    void fill_in_blocks(                                              \
+        std::shared_ptr<const DefaultExecutor> exec,                  \
+        const matrix::Csr<ValueType, IndexType>* source,              \
+        const IndexType* block_offsets, size_type num_block_rows,     \
+        const IndexType* row_ptrs, const IndexType* row_value_ptrs,   \
+        IndexType* col_idxs, IndexType* value_ptrs, ValueType* values)
+
+#define GKO_DECLARE_VBCSR_CONVERT_TO_CSR_KERNEL(ValueType, IndexType)     \
+    void convert_to_csr(std::shared_ptr<const DefaultExecutor> exec,      \
+                        const matrix::Vbcsr<ValueType, IndexType>* source, \
+                        matrix::Csr<ValueType, IndexType>* result)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                 \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_VBCSR_SPMV_KERNEL(ValueType, IndexType);             \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_VBCSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType);    \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_VBCSR_COUNT_BLOCKS_KERNEL(ValueType, IndexType);     \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_VBCSR_FILL_IN_BLOCKS_KERNEL(ValueType, IndexType);   \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_VBCSR_CONVERT_TO_CSR_KERNEL(ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(vbcsr, GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_VBCSR_KERNELS_HPP_
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/preconditioner/batch_ilu.hpp"
+
+#include <ginkgo/core/base/temporary_clone.hpp>
+
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+
+
+namespace gko {
+namespace batch {
+namespace preconditioner {
+namespace ilu {
+
+
+GKO_REGISTER_OPERATION(generate_common_pattern,
+                       batch_ilu::generate_common_pattern);
+GKO_REGISTER_OPERATION(compute_factors, batch_ilu::compute_factors);
+
+
+}  // namespace ilu
+
+
+template <typename ValueType, typename IndexType>
+Ilu<ValueType, IndexType>::Ilu(std::shared_ptr<const Executor> exec)
+    : EnableBatchLinOp<Ilu>(exec),
+      row_ptrs_(exec),
+      col_idxs_(exec),
+      diag_locs_(exec),
+      factors_(exec)
+{}
+
+
+template <typename ValueType, typename IndexType>
+Ilu<ValueType, IndexType>::Ilu(const Factory* factory,
+                               std::shared_ptr<const BatchLinOp> system_matrix)
+    : EnableBatchLinOp<Ilu>(factory->get_executor(),
+                            gko::transpose(system_matrix->get_size())),
+      parameters_{factory->get_parameters()},
+      row_ptrs_(factory->get_executor()),
+      col_idxs_(factory->get_executor()),
+      diag_locs_(factory->get_executor()),
+      factors_(factory->get_executor())
+{
+    GKO_ASSERT_BATCH_HAS_SQUARE_DIMENSIONS(system_matrix);
+    this->generate_precond(system_matrix.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Ilu<ValueType, IndexType>::generate_precond(
+    const BatchLinOp* const system_matrix)
+{
+    using unbatch_type = gko::matrix::Csr<ValueType, IndexType>;
+    auto exec = this->get_executor();
+
+    auto* sys_csr = dynamic_cast<const matrix_type*>(system_matrix);
+    std::shared_ptr<const matrix_type> sys_csr_shared_ptr{};
+
+    if (!sys_csr) {
+        sys_csr_shared_ptr = gko::share(matrix_type::create(exec));
+        as<ConvertibleTo<const matrix_type>>(system_matrix)
+            ->convert_to(sys_csr_shared_ptr.get());
+        sys_csr = sys_csr_shared_ptr.get();
+    }
+
+    const auto num_batch = sys_csr->get_num_batch_items();
+    const auto num_rows = sys_csr->get_common_size()[0];
+    const auto num_nz = sys_csr->get_num_elements_per_item();
+
+    row_ptrs_ = make_const_array_view(exec, num_rows + 1,
+                                      sys_csr->get_const_row_ptrs())
+                    .copy_to_array();
+    col_idxs_ =
+        make_const_array_view(exec, num_nz, sys_csr->get_const_col_idxs())
+            .copy_to_array();
+    diag_locs_.resize_and_reset(num_rows);
+
+    // extract the first matrix, as a view, into a regular Csr matrix.
+    const auto unbatch_size =
+        gko::dim<2>{num_rows, sys_csr->get_common_size()[1]};
+    auto first_sys_csr = gko::share(unbatch_type::create_const(
+        exec, unbatch_size,
+        array<ValueType>::const_view(exec, num_nz,
+                                     sys_csr->get_const_values()),
+        col_idxs_.as_const_view(), row_ptrs_.as_const_view()));
+    // the symbolic elimination looks up entries by binary search
+    if (!first_sys_csr->is_sorted_by_column_index()) {
+        GKO_INVALID_STATE(
+            "The column indices of the system matrix need to be sorted");
+    }
+
+    // Since all the matrices in the batch have the same sparsity pattern, the
+    // symbolic elimination (which entries update which) is computed only once
+    // and replayed on the values of every batch item.
+    array<IndexType> update_ptrs(exec);
+    array<IndexType> update_src(exec);
+    array<IndexType> update_dst(exec);
+    exec->run(ilu::make_generate_common_pattern(
+        first_sys_csr.get(), diag_locs_.get_data(), update_ptrs, update_src,
+        update_dst));
+
+    const auto host_diag_locs =
+        make_temporary_clone(exec->get_master(), &diag_locs_);
+    for (size_type row = 0; row < num_rows; row++) {
+        if (host_diag_locs->get_const_data()[row] < 0) {
+            GKO_INVALID_STATE(
+                "Every row of the system matrix needs to store its diagonal "
+                "entry");
+        }
+    }
+
+    factors_.resize_and_reset(num_batch * num_nz);
+    exec->run(ilu::make_compute_factors(
+        sys_csr, diag_locs_.get_const_data(), update_ptrs.get_const_data(),
+        update_src.get_const_data(), update_dst.get_const_data(),
+        factors_.get_data()));
+}
+
+
+#define GKO_DECLARE_BATCH_ILU(_type) class Ilu<_type, int32>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_ILU);
+
+
+}  // namespace preconditioner
+}  // namespace batch
+}  // namespace gko
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_PRECONDITIONER_BATCH_ILU_KERNELS_HPP_
+#define GKO_CORE_PRECONDITIONER_BATCH_ILU_KERNELS_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_BATCH_ILU_GENERATE_COMMON_PATTERN_KERNEL(ValueType, \
+                                                             IndexType) \
+    void generate_common_pattern(                                       \
+        std::shared_ptr<const DefaultExecutor> exec,                    \
+        const matrix::Csr<ValueType, IndexType>* first_sys_csr,         \
+        IndexType* diag_locs, array<IndexType>& update_ptrs,            \
+        array<IndexType>& update_src, array<IndexType>& update_dst)
+
+#define GKO_DECLARE_BATCH_ILU_COMPUTE_FACTORS_KERNEL(ValueType, IndexType) \
+    void compute_factors(                                                  \
+        std::shared_ptr<const DefaultExecutor> exec,                       \
+        const batch::matrix::Csr<ValueType, IndexType>* sys_csr,           \
+        const IndexType* diag_locs, const IndexType* update_ptrs,          \
+        const IndexType* update_src, const IndexType* update_dst,          \
+        ValueType* factors)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                 \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_BATCH_ILU_GENERATE_COMMON_PATTERN_KERNEL(ValueType,  \
+                                                         IndexType); \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_BATCH_ILU_COMPUTE_FACTORS_KERNEL(ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(batch_ilu,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_BATCH_ILU_KERNELS_HPP_
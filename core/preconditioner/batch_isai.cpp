@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/preconditioner/batch_isai.hpp"
+
+#include "core/preconditioner/batch_isai_kernels.hpp"
+
+
+namespace gko {
+namespace batch {
+namespace preconditioner {
+namespace isai {
+
+
+GKO_REGISTER_OPERATION(compute_cumulative_system_storage,
+                       batch_isai::compute_cumulative_system_storage);
+GKO_REGISTER_OPERATION(extract_common_systems_pattern,
+                       batch_isai::extract_common_systems_pattern);
+GKO_REGISTER_OPERATION(compute_isai, batch_isai::compute_isai);
+
+
+}  // namespace isai
+
+
+template <typename ValueType, typename IndexType>
+Isai<ValueType, IndexType>::Isai(std::shared_ptr<const Executor> exec)
+    : EnableBatchLinOp<Isai>(exec),
+      row_ptrs_(exec),
+      col_idxs_(exec),
+      inverse_values_(exec)
+{}
+
+
+template <typename ValueType, typename IndexType>
+Isai<ValueType, IndexType>::Isai(
+    const Factory* factory, std::shared_ptr<const BatchLinOp> system_matrix)
+    : EnableBatchLinOp<Isai>(factory->get_executor(),
+                             gko::transpose(system_matrix->get_size())),
+      parameters_{factory->get_parameters()},
+      row_ptrs_(factory->get_executor()),
+      col_idxs_(factory->get_executor()),
+      inverse_values_(factory->get_executor())
+{
+    GKO_ASSERT_BATCH_HAS_SQUARE_DIMENSIONS(system_matrix);
+    this->generate_precond(system_matrix.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Isai<ValueType, IndexType>::generate_precond(
+    const BatchLinOp* const system_matrix)
+{
+    using unbatch_type = gko::matrix::Csr<ValueType, IndexType>;
+    auto exec = this->get_executor();
+
+    auto* sys_csr = dynamic_cast<const matrix_type*>(system_matrix);
+    std::shared_ptr<const matrix_type> sys_csr_shared_ptr{};
+
+    if (!sys_csr) {
+        sys_csr_shared_ptr = gko::share(matrix_type::create(exec));
+        as<ConvertibleTo<const matrix_type>>(system_matrix)
+            ->convert_to(sys_csr_shared_ptr.get());
+        sys_csr = sys_csr_shared_ptr.get();
+    }
+
+    const auto num_batch = sys_csr->get_num_batch_items();
+    const auto num_rows = sys_csr->get_common_size()[0];
+    const auto num_nz = sys_csr->get_num_elements_per_item();
+
+    row_ptrs_ = make_const_array_view(exec, num_rows + 1,
+                                      sys_csr->get_const_row_ptrs())
+                    .copy_to_array();
+    col_idxs_ =
+        make_const_array_view(exec, num_nz, sys_csr->get_const_col_idxs())
+            .copy_to_array();
+
+    // extract the first matrix, as a view, into a regular Csr matrix.
+    const auto unbatch_size =
+        gko::dim<2>{num_rows, sys_csr->get_common_size()[1]};
+    auto first_sys_csr = gko::share(unbatch_type::create_const(
+        exec, unbatch_size,
+        array<ValueType>::const_view(exec, num_nz,
+                                     sys_csr->get_const_values()),
+        col_idxs_.as_const_view(), row_ptrs_.as_const_view()));
+
+    // storage offsets of the dense local systems A(J_i, J_i)
+    array<IndexType> system_offsets(exec, num_rows + 1);
+    exec->run(isai::make_compute_cumulative_system_storage(
+        num_rows, row_ptrs_.get_const_data(), system_offsets.get_data()));
+
+    // Since all the matrices in the batch have the same sparsity pattern, the
+    // positions from which the local systems are gathered are computed only
+    // once and shared by all batch items.
+    array<IndexType> systems_pattern(
+        exec, exec->copy_val_to_host(system_offsets.get_const_data() +
+                                     num_rows));
+    exec->run(isai::make_extract_common_systems_pattern(
+        first_sys_csr.get(), system_offsets.get_const_data(),
+        systems_pattern.get_data()));
+
+    inverse_values_.resize_and_reset(num_batch * num_nz);
+    exec->run(isai::make_compute_isai(
+        sys_csr, system_offsets.get_const_data(),
+        systems_pattern.get_const_data(), inverse_values_.get_data()));
+}
+
+
+#define GKO_DECLARE_BATCH_ISAI(_type) class Isai<_type, int32>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_ISAI);
+
+
+}  // namespace preconditioner
+}  // namespace batch
+}  // namespace gko
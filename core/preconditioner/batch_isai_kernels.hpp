@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_PRECONDITIONER_BATCH_ISAI_KERNELS_HPP_
+#define GKO_CORE_PRECONDITIONER_BATCH_ISAI_KERNELS_HPP_
+
+
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_BATCH_ISAI_COMPUTE_CUMULATIVE_SYSTEM_STORAGE(IndexType) \
+    void compute_cumulative_system_storage(                                 \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        const size_type num_rows, const IndexType* row_ptrs,                \
+        IndexType* system_offsets)
+
+#define GKO_DECLARE_BATCH_ISAI_EXTRACT_PATTERN_KERNEL(ValueType, IndexType) \
+    void extract_common_systems_pattern(                                    \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        const matrix::Csr<ValueType, IndexType>* first_sys_csr,             \
+        const IndexType* system_offsets, IndexType* systems_pattern)
+
+#define GKO_DECLARE_BATCH_ISAI_COMPUTE_KERNEL(ValueType, IndexType)        \
+    void compute_isai(                                                     \
+        std::shared_ptr<const DefaultExecutor> exec,                       \
+        const batch::matrix::Csr<ValueType, IndexType>* sys_csr,           \
+        const IndexType* system_offsets, const IndexType* systems_pattern, \
+        ValueType* inverse_values)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                     \
+    template <typename IndexType>                                        \
+    GKO_DECLARE_BATCH_ISAI_COMPUTE_CUMULATIVE_SYSTEM_STORAGE(IndexType); \
+    template <typename ValueType, typename IndexType>                    \
+    GKO_DECLARE_BATCH_ISAI_EXTRACT_PATTERN_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                    \
+    GKO_DECLARE_BATCH_ISAI_COMPUTE_KERNEL(ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(batch_isai,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_BATCH_ISAI_KERNELS_HPP_
@@ -11,6 +11,8 @@
 #include <ginkgo/core/matrix/batch_dense.hpp>
 #include <ginkgo/core/matrix/batch_ell.hpp>
 #include <ginkgo/core/matrix/batch_identity.hpp>
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
 #include <ginkgo/core/preconditioner/batch_jacobi.hpp>
 
 #include "core/base/batch_multi_vector_kernels.hpp"
@@ -58,7 +60,8 @@ void Bicgstab<ValueType>::solver_apply(
 
     run<matrix::Dense<ValueType>, matrix::Csr<ValueType>,
         matrix::Ell<ValueType>>(this->system_matrix_.get(), [&](auto matrix) {
-        run<matrix::Identity<ValueType>, preconditioner::Jacobi<ValueType>>(
+        run<matrix::Identity<ValueType>, preconditioner::Jacobi<ValueType>,
+            preconditioner::Ilu<ValueType>, preconditioner::Isai<ValueType>>(
             this->preconditioner_.get(), [&](auto preconditioner) {
                 exec->run(bicgstab::make_apply(settings, matrix, preconditioner,
                                                b, x, *log_data));
@@ -11,6 +11,8 @@
 #include <ginkgo/core/matrix/batch_dense.hpp>
 #include <ginkgo/core/matrix/batch_ell.hpp>
 #include <ginkgo/core/matrix/batch_identity.hpp>
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
 #include <ginkgo/core/preconditioner/batch_jacobi.hpp>
 
 #include "core/base/batch_multi_vector_kernels.hpp"
@@ -59,7 +61,9 @@ void Cg<ValueType>::solver_apply(
         batch::matrix::Ell<ValueType>>(
         this->system_matrix_.get(), [&](auto matrix) {
             run<batch::matrix::Identity<ValueType>,
-                batch::preconditioner::Jacobi<ValueType>>(
+                batch::preconditioner::Jacobi<ValueType>,
+                batch::preconditioner::Ilu<ValueType>,
+                batch::preconditioner::Isai<ValueType>>(
                 this->preconditioner_.get(), [&](auto preconditioner) {
                     exec->run(cg::make_apply(settings, matrix, preconditioner,
                                              b, x, *log_data));
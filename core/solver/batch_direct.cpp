@@ -0,0 +1,265 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/solver/batch_direct.hpp"
+
+#include <string>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+#include "core/solver/batch_direct_kernels.hpp"
+
+
+namespace gko {
+namespace batch {
+namespace solver {
+namespace direct {
+namespace {
+
+
+GKO_REGISTER_OPERATION(dense_factorize, batch_direct::dense_factorize);
+GKO_REGISTER_OPERATION(dense_solve, batch_direct::dense_solve);
+GKO_REGISTER_OPERATION(symbolic_factorize, batch_direct::symbolic_factorize);
+GKO_REGISTER_OPERATION(generate_common_pattern,
+                       batch_ilu::generate_common_pattern);
+GKO_REGISTER_OPERATION(sparse_factorize, batch_direct::sparse_factorize);
+GKO_REGISTER_OPERATION(sparse_solve, batch_direct::sparse_solve);
+
+
+/**
+ * Throws an InvalidStateError naming the first batch item whose factorization
+ * encountered a zero or tiny pivot.
+ */
+void assert_nonsingular(const array<bool>& singular)
+{
+    const auto host_singular =
+        make_temporary_clone(singular.get_executor()->get_master(), &singular);
+    for (size_type item = 0; item < host_singular->get_size(); item++) {
+        if (host_singular->get_const_data()[item]) {
+            GKO_INVALID_STATE("Batch item " + std::to_string(item) +
+                              " of the system matrix is singular");
+        }
+    }
+}
+
+
+}  // anonymous namespace
+}  // namespace direct
+
+
+template <typename ValueType, typename IndexType>
+Direct<ValueType, IndexType>::Direct(std::shared_ptr<const Executor> exec)
+    : EnableBatchLinOp<Direct>(exec),
+      sparse_{false},
+      row_ptrs_(exec),
+      col_idxs_(exec),
+      diag_locs_(exec),
+      pivots_(exec),
+      factors_(exec)
+{}
+
+
+template <typename ValueType, typename IndexType>
+Direct<ValueType, IndexType>::Direct(
+    const Factory* factory, std::shared_ptr<const BatchLinOp> system_matrix)
+    : EnableBatchLinOp<Direct>(factory->get_executor(),
+                               gko::transpose(system_matrix->get_size())),
+      parameters_{factory->get_parameters()},
+      sparse_{false},
+      row_ptrs_(factory->get_executor()),
+      col_idxs_(factory->get_executor()),
+      diag_locs_(factory->get_executor()),
+      pivots_(factory->get_executor()),
+      factors_(factory->get_executor())
+{
+    GKO_ASSERT_BATCH_HAS_SQUARE_DIMENSIONS(system_matrix);
+    if (auto sys_dense = dynamic_cast<const matrix::Dense<ValueType>*>(
+            system_matrix.get())) {
+        this->generate_dense(
+            make_temporary_clone(this->get_executor(), sys_dense).get());
+    } else {
+        this->generate_sparse(system_matrix.get());
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void Direct<ValueType, IndexType>::generate_dense(
+    const matrix::Dense<ValueType>* sys_dense)
+{
+    auto exec = this->get_executor();
+    const auto num_batch = sys_dense->get_num_batch_items();
+    const auto num_rows = sys_dense->get_common_size()[0];
+    sparse_ = false;
+    pivots_.resize_and_reset(num_batch * num_rows);
+    factors_.resize_and_reset(num_batch * num_rows * num_rows);
+    array<bool> singular(exec, num_batch);
+    exec->run(direct::make_dense_factorize(sys_dense, factors_.get_data(),
+                                           pivots_.get_data(),
+                                           singular.get_data()));
+    direct::assert_nonsingular(singular);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Direct<ValueType, IndexType>::generate_sparse(
+    const BatchLinOp* system_matrix)
+{
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+    using unbatch_type = gko::matrix::Csr<ValueType, IndexType>;
+    auto exec = this->get_executor();
+
+    auto* sys_csr = dynamic_cast<const matrix_type*>(system_matrix);
+    std::shared_ptr<const matrix_type> sys_csr_shared_ptr{};
+
+    if (!sys_csr) {
+        sys_csr_shared_ptr = gko::share(matrix_type::create(exec));
+        as<ConvertibleTo<const matrix_type>>(system_matrix)
+            ->convert_to(sys_csr_shared_ptr.get());
+        sys_csr = sys_csr_shared_ptr.get();
+    }
+    auto sys_csr_clone = make_temporary_clone(exec, sys_csr);
+    sys_csr = sys_csr_clone.get();
+
+    const auto num_batch = sys_csr->get_num_batch_items();
+    const auto num_rows = sys_csr->get_common_size()[0];
+    const auto num_nz = sys_csr->get_num_elements_per_item();
+    const auto unbatch_size = sys_csr->get_common_size();
+    sparse_ = true;
+
+    // extract the first matrix, as a view, into a regular Csr matrix.
+    auto first_sys_csr = unbatch_type::create_const(
+        exec, unbatch_size,
+        array<ValueType>::const_view(exec, num_nz,
+                                     sys_csr->get_const_values()),
+        make_const_array_view(exec, num_nz, sys_csr->get_const_col_idxs()),
+        make_const_array_view(exec, num_rows + 1,
+                              sys_csr->get_const_row_ptrs()));
+
+    // Since all the matrices in the batch have the same sparsity pattern, the
+    // fill-in and the list of updates performed by the elimination are
+    // computed only once and replayed on the values of every batch item.
+    exec->run(direct::make_symbolic_factorize(first_sys_csr.get(), row_ptrs_,
+                                              col_idxs_));
+    const auto factor_nnz = col_idxs_.get_size();
+    factors_.resize_and_reset(num_batch * factor_nnz);
+    diag_locs_.resize_and_reset(num_rows);
+    array<bool> singular(exec, num_batch);
+    {
+        // only the pattern of the factors is used, so their not yet computed
+        // values can serve as the values of the matrix
+        auto factor_pattern = unbatch_type::create_const(
+            exec, unbatch_size,
+            array<ValueType>::const_view(exec, factor_nnz,
+                                         factors_.get_const_data()),
+            col_idxs_.as_const_view(), row_ptrs_.as_const_view());
+        array<IndexType> update_ptrs(exec);
+        array<IndexType> update_src(exec);
+        array<IndexType> update_dst(exec);
+        exec->run(direct::make_generate_common_pattern(
+            factor_pattern.get(), diag_locs_.get_data(), update_ptrs,
+            update_src, update_dst));
+        exec->run(direct::make_sparse_factorize(
+            sys_csr, row_ptrs_.get_const_data(), col_idxs_.get_const_data(),
+            diag_locs_.get_const_data(), update_ptrs.get_const_data(),
+            update_src.get_const_data(), update_dst.get_const_data(),
+            factors_.get_data(), singular.get_data()));
+    }
+    direct::assert_nonsingular(singular);
+}
+
+
+template <typename ValueType, typename IndexType>
+Direct<ValueType, IndexType>* Direct<ValueType, IndexType>::apply(
+    ptr_param<const MultiVector<ValueType>> b,
+    ptr_param<MultiVector<ValueType>> x)
+{
+    static_cast<const Direct*>(this)->apply(b, x);
+    return this;
+}
+
+
+template <typename ValueType, typename IndexType>
+const Direct<ValueType, IndexType>* Direct<ValueType, IndexType>::apply(
+    ptr_param<const MultiVector<ValueType>> b,
+    ptr_param<MultiVector<ValueType>> x) const
+{
+    this->validate_application_parameters(b.get(), x.get());
+    auto exec = this->get_executor();
+    this->apply_impl(make_temporary_clone(exec, b).get(),
+                     make_temporary_clone(exec, x).get());
+    return this;
+}
+
+
+template <typename ValueType, typename IndexType>
+Direct<ValueType, IndexType>* Direct<ValueType, IndexType>::apply(
+    ptr_param<const MultiVector<ValueType>> alpha,
+    ptr_param<const MultiVector<ValueType>> b,
+    ptr_param<const MultiVector<ValueType>> beta,
+    ptr_param<MultiVector<ValueType>> x)
+{
+    static_cast<const Direct*>(this)->apply(alpha, b, beta, x);
+    return this;
+}
+
+
+template <typename ValueType, typename IndexType>
+const Direct<ValueType, IndexType>* Direct<ValueType, IndexType>::apply(
+    ptr_param<const MultiVector<ValueType>> alpha,
+    ptr_param<const MultiVector<ValueType>> b,
+    ptr_param<const MultiVector<ValueType>> beta,
+    ptr_param<MultiVector<ValueType>> x) const
+{
+    this->validate_application_parameters(alpha.get(), b.get(), beta.get(),
+                                          x.get());
+    auto exec = this->get_executor();
+    this->apply_impl(make_temporary_clone(exec, alpha).get(),
+                     make_temporary_clone(exec, b).get(),
+                     make_temporary_clone(exec, beta).get(),
+                     make_temporary_clone(exec, x).get());
+    return this;
+}
+
+
+template <typename ValueType, typename IndexType>
+void Direct<ValueType, IndexType>::apply_impl(const MultiVector<ValueType>* b,
+                                              MultiVector<ValueType>* x) const
+{
+    auto exec = this->get_executor();
+    // the triangular solves work in-place on the right-hand side
+    x->copy_from(b);
+    if (sparse_) {
+        exec->run(direct::make_sparse_solve(
+            row_ptrs_.get_const_data(), col_idxs_.get_const_data(),
+            diag_locs_.get_const_data(), factors_.get_const_data(), x));
+    } else {
+        exec->run(direct::make_dense_solve(factors_.get_const_data(),
+                                           pivots_.get_const_data(), x));
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void Direct<ValueType, IndexType>::apply_impl(
+    const MultiVector<ValueType>* alpha, const MultiVector<ValueType>* b,
+    const MultiVector<ValueType>* beta, MultiVector<ValueType>* x) const
+{
+    auto solution = MultiVector<ValueType>::create_with_config_of(x);
+    this->apply_impl(b, solution.get());
+    x->scale(beta);
+    x->add_scaled(alpha, solution);
+}
+
+
+#define GKO_DECLARE_BATCH_DIRECT(_type) class Direct<_type, int32>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_DIRECT);
+
+
+}  // namespace solver
+}  // namespace batch
+}  // namespace gko
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_SOLVER_BATCH_DIRECT_KERNELS_HPP_
+#define GKO_CORE_SOLVER_BATCH_DIRECT_KERNELS_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/solver/batch_direct.hpp>
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_BATCH_DIRECT_DENSE_FACTORIZE_KERNEL(ValueType, IndexType) \
+    void dense_factorize(std::shared_ptr<const DefaultExecutor> exec,         \
+                         const batch::matrix::Dense<ValueType>* sys_dense,    \
+                         ValueType* factors, IndexType* pivots,               \
+                         bool* singular)
+
+#define GKO_DECLARE_BATCH_DIRECT_DENSE_SOLVE_KERNEL(ValueType, IndexType) \
+    void dense_solve(std::shared_ptr<const DefaultExecutor> exec,         \
+                     const ValueType* factors, const IndexType* pivots,   \
+                     batch::MultiVector<ValueType>* x)
+
+#define GKO_DECLARE_BATCH_DIRECT_SYMBOLIC_FACTORIZE_KERNEL(ValueType, \
+                                                           IndexType) \
+    void symbolic_factorize(                                          \
+        std::shared_ptr<const DefaultExecutor> exec,                  \
+        const matrix::Csr<ValueType, IndexType>* first_sys_csr,       \
+        array<IndexType>& factor_row_ptrs,                            \
+        array<IndexType>& factor_col_idxs)
+
+#define GKO_DECLARE_BATCH_DIRECT_SPARSE_FACTORIZE_KERNEL(ValueType,         \
+                                                         IndexType)         \
+    void sparse_factorize(                                                  \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        const batch::matrix::Csr<ValueType, IndexType>* sys_csr,            \
+        const IndexType* factor_row_ptrs, const IndexType* factor_col_idxs, \
+        const IndexType* diag_locs, const IndexType* update_ptrs,           \
+        const IndexType* update_src, const IndexType* update_dst,           \
+        ValueType* factors, bool* singular)
+
+#define GKO_DECLARE_BATCH_DIRECT_SPARSE_SOLVE_KERNEL(ValueType, IndexType)  \
+    void sparse_solve(std::shared_ptr<const DefaultExecutor> exec,          \
+                      const IndexType* factor_row_ptrs,                     \
+                      const IndexType* factor_col_idxs,                     \
+                      const IndexType* diag_locs, const ValueType* factors, \
+                      batch::MultiVector<ValueType>* x)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                        \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_BATCH_DIRECT_DENSE_FACTORIZE_KERNEL(ValueType, IndexType);  \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_BATCH_DIRECT_DENSE_SOLVE_KERNEL(ValueType, IndexType);      \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_BATCH_DIRECT_SYMBOLIC_FACTORIZE_KERNEL(ValueType,           \
+                                                       IndexType);          \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_BATCH_DIRECT_SPARSE_FACTORIZE_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_BATCH_DIRECT_SPARSE_SOLVE_KERNEL(ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(batch_direct,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_BATCH_DIRECT_KERNELS_HPP_
@@ -13,6 +13,8 @@
 #include <ginkgo/core/matrix/batch_dense.hpp>
 #include <ginkgo/core/matrix/batch_ell.hpp>
 #include <ginkgo/core/matrix/batch_identity.hpp>
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
 #include <ginkgo/core/preconditioner/batch_jacobi.hpp>
 #include <ginkgo/core/solver/batch_bicgstab.hpp>
 #include <ginkgo/core/stop/batch_stop_enum.hpp>
@@ -111,6 +113,8 @@ using DeviceValueType = gko::kernels::dpcpp::sycl_type<ValueType>;
 #include "reference/matrix/batch_struct.hpp"
 #include "reference/preconditioner/batch_block_jacobi.hpp"
 #include "reference/preconditioner/batch_identity.hpp"
+#include "reference/preconditioner/batch_ilu.hpp"
+#include "reference/preconditioner/batch_isai.hpp"
 #include "reference/preconditioner/batch_scalar_jacobi.hpp"
 #include "reference/stop/batch_criteria.hpp"
 
@@ -320,6 +324,33 @@ public:
                                            block_ptrs_arr, row_block_map_arr),
                     b_item, x_item);
             }
+// ILU and ISAI are only available on the host executors so far
+#if !(defined GKO_COMPILING_CUDA || defined GKO_COMPILING_HIP || \
+      defined GKO_COMPILING_DPCPP)
+        } else if constexpr (std::is_same_v<
+                                 PrecType,
+                                 batch::preconditioner::Ilu<value_type>>) {
+            dispatch_on_stop(
+                logger, mat_item,
+                device::batch_preconditioner::Ilu<device_value_type>(
+                    static_cast<int>(precond_->get_num_elements_per_item()),
+                    precond_->get_const_row_ptrs(),
+                    precond_->get_const_col_idxs(),
+                    precond_->get_const_diag_locations(),
+                    precond_->get_const_factors()),
+                b_item, x_item);
+        } else if constexpr (std::is_same_v<
+                                 PrecType,
+                                 batch::preconditioner::Isai<value_type>>) {
+            dispatch_on_stop(
+                logger, mat_item,
+                device::batch_preconditioner::Isai<device_value_type>(
+                    static_cast<int>(precond_->get_num_elements_per_item()),
+                    precond_->get_const_row_ptrs(),
+                    precond_->get_const_col_idxs(),
+                    precond_->get_const_inverse_values()),
+                b_item, x_item);
+#endif
         } else {
             GKO_NOT_IMPLEMENTED;
         }
@@ -118,6 +118,7 @@ void Bicgstab<ValueType>::apply_dense_impl(const VectorType* dense_b,
 
     bool one_changed{};
     GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+    GKO_SOLVER_FUSED_REDUCTION_ARRAYS();
 
     // r = dense_b
     // prev_rho = rho = omega = alpha = beta = gamma = 1.0
@@ -213,9 +214,10 @@ void Bicgstab<ValueType>::apply_dense_impl(const VectorType* dense_b,
         // t = A * z
         this->get_system_matrix()->apply(z, t);
         // gamma = dot(s, t)
-        s->compute_conj_dot(t, gamma, reduction_tmp);
         // beta = dot(t, t)
-        t->compute_conj_dot(t, beta, reduction_tmp);
+        gko::detail::compute_conj_dot_pair(s, t, gamma, t, t, beta,
+                                           reduction_tmp, fused_buffer,
+                                           fused_host_buffer);
         // omega = gamma / beta
         // x = x + alpha * y + omega * z
         // r = s - omega * t
@@ -250,7 +252,7 @@ void Bicgstab<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
 template <typename ValueType>
 int workspace_traits<Bicgstab<ValueType>>::num_arrays(const Solver&)
 {
-    return 2;
+    return 4;
 }
 
 
@@ -277,7 +279,7 @@ template <typename ValueType>
 std::vector<std::string> workspace_traits<Bicgstab<ValueType>>::array_names(
     const Solver&)
 {
-    return {"stop", "tmp"};
+    return {"stop", "tmp", "fused_buffer", "fused_host_buffer"};
 }
 
 
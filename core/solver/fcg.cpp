@@ -111,6 +111,7 @@ void Fcg<ValueType>::apply_dense_impl(const VectorType* dense_b,
 
     bool one_changed{};
     GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+    GKO_SOLVER_FUSED_REDUCTION_ARRAYS();
 
     // r = dense_b
     // t = r
@@ -141,8 +142,9 @@ void Fcg<ValueType>::apply_dense_impl(const VectorType* dense_b,
      */
     while (true) {
         this->get_preconditioner()->apply(r, z);
-        r->compute_conj_dot(z, rho, reduction_tmp);
-        t->compute_conj_dot(z, rho_t, reduction_tmp);
+        gko::detail::compute_conj_dot_pair(r, z, rho, t, z, rho_t,
+                                           reduction_tmp, fused_buffer,
+                                           fused_host_buffer);
 
         ++iter;
         bool all_stopped =
@@ -201,7 +203,7 @@ void Fcg<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
 template <typename ValueType>
 int workspace_traits<Fcg<ValueType>>::num_arrays(const Solver&)
 {
-    return 2;
+    return 4;
 }
 
 
@@ -227,7 +229,7 @@ template <typename ValueType>
 std::vector<std::string> workspace_traits<Fcg<ValueType>>::array_names(
     const Solver&)
 {
-    return {"stop", "tmp"};
+    return {"stop", "tmp", "fused_buffer", "fused_host_buffer"};
 }
 
 
@@ -137,6 +137,7 @@ void Gcr<ValueType>::apply_dense_impl(const VectorType* dense_b,
     bool one_changed{};
     GKO_SOLVER_ONE_MINUS_ONE();
     GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+    GKO_SOLVER_FUSED_REDUCTION_ARRAYS();
 
     // Initialization
     // residual = dense_b
@@ -235,12 +236,12 @@ void Gcr<ValueType>::apply_dense_impl(const VectorType* dense_b,
             span{local_num_rows * restart_iter,
                  local_num_rows * (restart_iter + 1)},
             span{0, num_rhs});
-        // compute r*Ap
-        residual->compute_conj_dot(Ap.get(), tmp_rAp, reduction_tmp);
-        // normalise
         auto Ap_norm = Ap_norms->create_submatrix(
             span{restart_iter, restart_iter + 1}, span{0, num_rhs});
-        Ap->compute_squared_norm2(Ap_norm.get(), reduction_tmp);
+        // compute r*Ap and the squared norm of Ap
+        gko::detail::compute_conj_dot_and_squared_norm2(
+            residual, Ap.get(), tmp_rAp, Ap.get(), Ap_norm.get(),
+            reduction_tmp, fused_buffer, fused_host_buffer);
 
         // alpha = r*Ap / Ap_norm
         // x = x + alpha * p
@@ -317,7 +318,7 @@ void Gcr<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
 template <typename ValueType>
 int workspace_traits<Gcr<ValueType>>::num_arrays(const Solver&)
 {
-    return 3;
+    return 5;
 }
 
 
@@ -350,7 +351,8 @@ template <typename ValueType>
 std::vector<std::string> workspace_traits<Gcr<ValueType>>::array_names(
     const Solver&)
 {
-    return {"stop", "tmp", "final_iter_nums"};
+    return {"stop", "tmp", "final_iter_nums", "fused_buffer",
+            "fused_host_buffer"};
 }
 
 
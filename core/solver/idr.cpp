@@ -156,6 +156,7 @@ void Idr<ValueType>::iterate(const VectorType* dense_b,
 
     bool one_changed{};
     GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+    GKO_SOLVER_FUSED_REDUCTION_ARRAYS();
 
     // Initialization
     // m = identity
@@ -274,9 +275,9 @@ void Idr<ValueType>::iterate(const VectorType* dense_b,
         this->get_preconditioner()->apply(residual, helper);
         this->get_system_matrix()->apply(helper, t);
 
-        t->compute_conj_dot(residual, omega, reduction_tmp);
-        t->compute_conj_dot(t, tht, reduction_tmp);
-        residual->compute_norm2(residual_norm, reduction_tmp);
+        gko::detail::compute_conj_dot_pair_and_norm2(
+            t, residual, omega, t, t, tht, residual, residual_norm,
+            reduction_tmp, fused_buffer, fused_host_buffer);
 
         // omega = (t^H * residual) / (t^H * t)
         // rho = (t^H * residual) / (norm(t) * norm(residual))
@@ -345,7 +346,7 @@ void Idr<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
 template <typename ValueType>
 int workspace_traits<Idr<ValueType>>::num_arrays(const Solver&)
 {
-    return 2;
+    return 4;
 }
 
 
@@ -386,7 +387,7 @@ template <typename ValueType>
 std::vector<std::string> workspace_traits<Idr<ValueType>>::array_names(
     const Solver&)
 {
-    return {"stop", "tmp"};
+    return {"stop", "tmp", "fused_buffer", "fused_host_buffer"};
 }
 
 
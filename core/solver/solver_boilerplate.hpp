@@ -33,3 +33,10 @@
             GKO_SOLVER_TRAITS::stop, dense_b->get_size()[1]);   \
     auto& reduction_tmp =                                       \
         this->template create_workspace_array<char>(GKO_SOLVER_TRAITS::tmp)
+
+// the packed buffers of fused distributed reductions, reused across iterations
+#define GKO_SOLVER_FUSED_REDUCTION_ARRAYS()                                \
+    auto& fused_buffer = this->template create_workspace_array<            \
+        remove_complex<ValueType>>(GKO_SOLVER_TRAITS::fused_buffer);       \
+    auto& fused_host_buffer = this->template create_workspace_array<       \
+        remove_complex<ValueType>>(GKO_SOLVER_TRAITS::fused_host_buffer)
@@ -2,16 +2,21 @@
 //
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <cstdio>
+#include <cstdint>
 #include <cstring>
+#include <fstream>
 #include <sstream>
 
 #include <gtest/gtest.h>
 
 #include <ginkgo/config.hpp>
 #include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/mtx_io.hpp>
 #include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 
 #include "core/test/utils.hpp"
@@ -704,6 +709,255 @@ TEST(MtxReader, FailsWhenReadingSparseComplexMtxToRealMtx)
 }
 
 
+TEST(MtxReader, ReadsSparseRealMtxInParallel)
+{
+    using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 4\n"
+        "1 1 1.0\n"
+        "2 2 5.0\n"
+        "1 2 3.0\n"
+        "1 3 2.0\n");
+
+    auto data = gko::read_raw<double, gko::int32>(iss, exec);
+
+    ASSERT_EQ(data.get_executor(), exec);
+    ASSERT_EQ(data.get_size(), gko::dim<2>(2, 3));
+    auto host_data = data.copy_to_host();
+    auto& v = host_data.nonzeros;
+    ASSERT_EQ(v.size(), 4);
+    ASSERT_EQ(v[0], tpl(0, 0, 1.0));
+    ASSERT_EQ(v[1], tpl(0, 1, 3.0));
+    ASSERT_EQ(v[2], tpl(0, 2, 2.0));
+    ASSERT_EQ(v[3], tpl(1, 1, 5.0));
+}
+
+
+TEST(MtxReader, ReadsSparseRealSymmetricMtxInParallel)
+{
+    using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real symmetric\n"
+        "3 3 4\n"
+        "1 1 1.0\n"
+        "2 1 2.0\n"
+        "3 3 6.0\n"
+        "3 1 3.0\n");
+
+    auto data = gko::read_raw<double, gko::int32>(iss, exec).copy_to_host();
+
+    ASSERT_EQ(data.size, gko::dim<2>(3, 3));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v.size(), 6);
+    ASSERT_EQ(v[0], tpl(0, 0, 1.0));
+    ASSERT_EQ(v[1], tpl(0, 1, 2.0));
+    ASSERT_EQ(v[2], tpl(0, 2, 3.0));
+    ASSERT_EQ(v[3], tpl(1, 0, 2.0));
+    ASSERT_EQ(v[4], tpl(2, 0, 3.0));
+    ASSERT_EQ(v[5], tpl(2, 2, 6.0));
+}
+
+
+TEST(MtxReader, ReadsSparseRealSkewSymmetricMtxInParallel)
+{
+    using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+        "3 3 2\n"
+        "2 1 2.0\n"
+        "3 1 3.0\n");
+
+    auto data = gko::read_raw<double, gko::int32>(iss, exec).copy_to_host();
+
+    ASSERT_EQ(data.size, gko::dim<2>(3, 3));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v.size(), 4);
+    ASSERT_EQ(v[0], tpl(0, 1, -2.0));
+    ASSERT_EQ(v[1], tpl(0, 2, -3.0));
+    ASSERT_EQ(v[2], tpl(1, 0, 2.0));
+    ASSERT_EQ(v[3], tpl(2, 0, 3.0));
+}
+
+
+TEST(MtxReader, ReadsSparsePatternMtxInParallel)
+{
+    using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate pattern general\n"
+        "2 3 2\n"
+        "2 2\n"
+        "1 3\n");
+
+    auto data = gko::read_raw<double, gko::int32>(iss, exec).copy_to_host();
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 3));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v.size(), 2);
+    ASSERT_EQ(v[0], tpl(0, 2, 1.0));
+    ASSERT_EQ(v[1], tpl(1, 1, 1.0));
+}
+
+
+TEST(MtxReader, ReadsSparseComplexHermitianMtxInParallel)
+{
+    using cpx = std::complex<double>;
+    using tpl = gko::matrix_data<cpx, gko::int64>::nonzero_type;
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate complex hermitian\n"
+        "2 2 2\n"
+        "1 1 1.0 2.0\n"
+        "2 1 3.0 1.0\n");
+
+    auto data = gko::read_raw<cpx, gko::int64>(iss, exec).copy_to_host();
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 2));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v.size(), 3);
+    ASSERT_EQ(v[0], tpl(0, 0, cpx(1.0, 2.0)));
+    ASSERT_EQ(v[1], tpl(0, 1, cpx(3.0, -1.0)));
+    ASSERT_EQ(v[2], tpl(1, 0, cpx(3.0, 1.0)));
+}
+
+
+TEST(MtxReader, ReadsDenseMtxInParallel)
+{
+    using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix array real general\n"
+        "2 2\n"
+        "1.0\n"
+        "0.0\n"
+        "3.0\n"
+        "5.0\n");
+
+    auto data = gko::read_raw<double, gko::int32>(iss, exec).copy_to_host();
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 2));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v.size(), 4);
+    ASSERT_EQ(v[0], tpl(0, 0, 1.0));
+    ASSERT_EQ(v[1], tpl(0, 1, 3.0));
+    ASSERT_EQ(v[2], tpl(1, 0, 0.0));
+    ASSERT_EQ(v[3], tpl(1, 1, 5.0));
+}
+
+
+TEST(MtxReader, ReadsLargeSymmetricMtxInParallelLikeSequentially)
+{
+    // large enough to be split into multiple chunks
+    const int num_rows = 20000;
+    std::ostringstream oss;
+    oss << "%%MatrixMarket matrix coordinate real symmetric\n"
+        << "% a comment\n"
+        << num_rows << ' ' << num_rows << ' ' << 2 * num_rows - 1 << '\n';
+    for (int row = num_rows; row > 0; row--) {
+        oss << row << ' ' << row << ' ' << 0.5 * row << '\n';
+        if (row > 1) {
+            // extra whitespace, trailing characters and empty lines
+            oss << "  " << row << '\t' << row - 1 << " -1.25e+0 x\r\n\n";
+        }
+    }
+    std::istringstream sequential_iss(oss.str());
+    std::istringstream parallel_iss(oss.str());
+    auto exec = gko::ReferenceExecutor::create();
+
+    auto sequential = gko::read_raw<double, gko::int32>(sequential_iss);
+    auto parallel =
+        gko::read_raw<double, gko::int32>(parallel_iss, exec).copy_to_host();
+
+    ASSERT_EQ(parallel.size, sequential.size);
+    ASSERT_EQ(parallel.nonzeros.size(), 3 * num_rows - 2);
+    ASSERT_EQ(parallel.nonzeros, sequential.nonzeros);
+}
+
+
+TEST(MtxReader, ReadsGenericMtxInParallel)
+{
+    using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 2\n"
+        "2 2 5.0\n"
+        "1 3 2.0\n");
+
+    auto data =
+        gko::read_generic_raw<double, gko::int32>(iss, exec).copy_to_host();
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 3));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v.size(), 2);
+    ASSERT_EQ(v[0], tpl(0, 2, 2.0));
+    ASSERT_EQ(v[1], tpl(1, 1, 5.0));
+}
+
+
+TEST(MtxReader, ReadsGenericBinaryInParallel)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto raw_data = build_binary_real_data();
+    std::stringstream ss{std::string{reinterpret_cast<char*>(raw_data.data()),
+                                     raw_data.size() * sizeof(gko::uint64)}};
+
+    auto data = gko::read_generic_raw<double, int>(ss, exec).copy_to_host();
+
+    ASSERT_EQ(data.size, gko::dim<2>(64, 32));
+    ASSERT_EQ(data.nonzeros.size(), 4);
+    ASSERT_EQ(data.nonzeros[1].row, 1);
+    ASSERT_EQ(data.nonzeros[1].column, 1);
+    ASSERT_EQ(data.nonzeros[1].value, 2.5);
+}
+
+
+TEST(MtxReader, FailsWhenReadingSparseComplexMtxToRealMtxInParallel)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate complex general\n"
+        "2 3 2\n"
+        "1 1 1.0 2.0\n"
+        "2 2 5.0 3.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(iss, exec)),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingTooFewEntriesInParallel)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 3\n"
+        "1 1 1.0\n"
+        "2 2 5.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(iss, exec)),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingInvalidEntryInParallel)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 2\n"
+        "1 1 1.0\n"
+        "2 2\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(iss, exec)),
+                 gko::StreamError);
+}
+
+
 TEST(MatrixData, WritesDoubleRealMatrixToMatrixMarketArray)
 {
     // clang-format off
@@ -930,6 +1184,154 @@ TEST(MtxReader, WritesComplexBinary)
 }
 
 
+class BinaryCsr : public ::testing::Test {
+protected:
+    using Mtx = gko::matrix::Csr<double, gko::int32>;
+
+    BinaryCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          filename("mtx_io_binary_csr_test.bin"),
+          mtx(Mtx::create(exec, gko::dim<2>{3, 4},
+                          {1.0, 2.0, -1.5, 4.0, 0.25},
+                          {0, 3, 1, 2, 3}, {0, 2, 2, 5}))
+    {}
+
+    ~BinaryCsr() { std::remove(filename.c_str()); }
+
+    void write_file()
+    {
+        std::ofstream os(filename, std::ios::binary);
+        gko::write_binary_csr(os, mtx.get());
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::string filename;
+    std::unique_ptr<Mtx> mtx;
+};
+
+
+TEST_F(BinaryCsr, WritesAlignedSections)
+{
+    std::stringstream ss;
+
+    gko::write_binary_csr(ss, mtx.get());
+
+    const auto str = ss.str();
+    std::array<gko::uint64, 8> header{};
+    std::memcpy(header.data(), str.data(), sizeof(header));
+    ASSERT_EQ(std::string(str.data(), 6), "GKOCSR");
+    ASSERT_EQ(header[1], 3);
+    ASSERT_EQ(header[2], 4);
+    ASSERT_EQ(header[3], 5);
+    ASSERT_EQ(header[4], 64);
+    ASSERT_EQ(header[5], 128);
+    ASSERT_EQ(header[6], 192);
+    ASSERT_EQ(header[7], 232);
+    ASSERT_EQ(str.size(), 232);
+    gko::int32 col_idxs[5];
+    double values[5];
+    std::memcpy(col_idxs, str.data() + 128, sizeof(col_idxs));
+    std::memcpy(values, str.data() + 192, sizeof(values));
+    ASSERT_EQ(col_idxs[1], 3);
+    ASSERT_EQ(values[2], -1.5);
+}
+
+
+TEST_F(BinaryCsr, ReadsMappedMatrix)
+{
+    write_file();
+
+    auto result = gko::read_binary_csr<double, gko::int32>(filename, exec);
+
+    ASSERT_EQ(result->get_executor(), exec);
+    GKO_ASSERT_MTX_NEAR(result, mtx, 0.0);
+    // the arrays point into the page-aligned mapping
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(result->get_const_values()) %
+                  64,
+              0);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(result->get_const_col_idxs()) %
+                  64,
+              0);
+}
+
+
+TEST_F(BinaryCsr, ModifyingMappedMatrixKeepsFile)
+{
+    write_file();
+    auto result = gko::read_binary_csr<double, gko::int32>(filename, exec);
+
+    result->get_values()[0] = 10.0;
+    auto reread = gko::read_binary_csr<double, gko::int32>(filename, exec);
+
+    ASSERT_EQ(result->get_const_values()[0], 10.0);
+    GKO_ASSERT_MTX_NEAR(reread, mtx, 0.0);
+}
+
+
+TEST_F(BinaryCsr, MappedMatrixOutlivesOtherMatrices)
+{
+    write_file();
+    auto result = gko::read_binary_csr<double, gko::int32>(filename, exec);
+    auto clone = result->clone();
+
+    result.reset();
+
+    GKO_ASSERT_MTX_NEAR(clone, mtx, 0.0);
+}
+
+
+TEST_F(BinaryCsr, ReadsComplexMappedMatrix)
+{
+    using CplxMtx = gko::matrix::Csr<std::complex<float>, gko::int64>;
+    auto cplx_mtx = CplxMtx::create(exec, gko::dim<2>{2, 2},
+                                    {std::complex<float>{1.0, -1.0}},
+                                    {gko::int64{1}}, {0, 1, 1});
+    {
+        std::ofstream os(filename, std::ios::binary);
+        gko::write_binary_csr(os, cplx_mtx.get());
+    }
+
+    auto result =
+        gko::read_binary_csr<std::complex<float>, gko::int64>(filename, exec);
+
+    GKO_ASSERT_MTX_NEAR(result, cplx_mtx, 0.0);
+}
+
+
+TEST_F(BinaryCsr, FailsReadingDifferentTypes)
+{
+    write_file();
+
+    ASSERT_THROW((gko::read_binary_csr<float, gko::int32>(filename, exec)),
+                 gko::StreamError);
+    ASSERT_THROW((gko::read_binary_csr<double, gko::int64>(filename, exec)),
+                 gko::StreamError);
+}
+
+
+TEST_F(BinaryCsr, FailsReadingTruncatedFile)
+{
+    std::stringstream ss;
+    gko::write_binary_csr(ss, mtx.get());
+    {
+        std::ofstream os(filename, std::ios::binary);
+        const auto str = ss.str();
+        os.write(str.data(), str.size() - 8);
+    }
+
+    ASSERT_THROW((gko::read_binary_csr<double, gko::int32>(filename, exec)),
+                 gko::StreamError);
+}
+
+
+TEST_F(BinaryCsr, FailsReadingMissingFile)
+{
+    ASSERT_THROW((gko::read_binary_csr<double, gko::int32>(
+                     "mtx_io_binary_csr_missing.bin", exec)),
+                 gko::StreamError);
+}
+
+
 template <typename ValueType, typename IndexType>
 class DummyLinOp
     : public gko::EnableLinOp<DummyLinOp<ValueType, IndexType>>,
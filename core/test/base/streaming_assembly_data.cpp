@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/streaming_assembly_data.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class StreamingAssemblyData : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = gko::int32;
+    using Mtx = gko::matrix::Csr<value_type, index_type>;
+
+    StreamingAssemblyData()
+        : exec(gko::ReferenceExecutor::create()),
+          // contains duplicates within and across runs of size 3
+          rows{2, 0, 2, 1, 2, 0, 1, 2},
+          cols{3, 1, 0, 4, 3, 1, 4, 0},
+          vals{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0},
+          expected(Mtx::create(exec, gko::dim<2>{3, 5},
+                               {8.0, 11.0, 11.0, 6.0}, {1, 4, 0, 3},
+                               {0, 1, 2, 4}))
+    {}
+
+    void add_all(gko::streaming_assembly_data<value_type, index_type>& data)
+    {
+        data.add_values(rows.size(), rows.data(), cols.data(), vals.data());
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::vector<index_type> rows;
+    std::vector<index_type> cols;
+    std::vector<value_type> vals;
+    std::unique_ptr<Mtx> expected;
+};
+
+
+TEST_F(StreamingAssemblyData, InitializesEmpty)
+{
+    gko::streaming_assembly_data<value_type, index_type> data(
+        gko::dim<2>{3, 5});
+
+    ASSERT_EQ(data.get_size(), gko::dim<2>(3, 5));
+    ASSERT_EQ(data.get_num_stored_elements(), 0);
+    ASSERT_EQ(data.get_num_runs(), 0);
+}
+
+
+TEST_F(StreamingAssemblyData, AssemblesEmptyMatrix)
+{
+    gko::streaming_assembly_data<value_type, index_type> data(
+        gko::dim<2>{3, 5});
+
+    auto result = data.assemble(exec);
+
+    ASSERT_EQ(result->get_size(), gko::dim<2>(3, 5));
+    ASSERT_EQ(result->get_num_stored_elements(), 0);
+    ASSERT_EQ(result->get_const_row_ptrs()[3], 0);
+}
+
+
+TEST_F(StreamingAssemblyData, AssemblesSingleRun)
+{
+    gko::streaming_assembly_data<value_type, index_type> data(
+        gko::dim<2>{3, 5});
+
+    add_all(data);
+    auto result = data.assemble(exec);
+
+    ASSERT_EQ(data.get_num_runs(), 0);
+    ASSERT_EQ(data.get_num_stored_elements(), 0);
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+}
+
+
+TEST_F(StreamingAssemblyData, SumsDuplicatesWithinRun)
+{
+    gko::streaming_assembly_data<value_type, index_type> data(
+        gko::dim<2>{3, 5}, 3);
+
+    data.add_value(2, 3, 1.0);
+    data.add_value(0, 1, 2.0);
+    data.add_value(2, 3, 5.0);
+
+    ASSERT_EQ(data.get_num_runs(), 1);
+    ASSERT_EQ(data.get_num_stored_elements(), 2);
+}
+
+
+TEST_F(StreamingAssemblyData, AssemblesMultipleRunsInMemory)
+{
+    gko::streaming_assembly_data<value_type, index_type> data(
+        gko::dim<2>{3, 5}, 3);
+
+    add_all(data);
+    ASSERT_EQ(data.get_num_runs(), 2);
+    ASSERT_EQ(data.get_num_stored_elements(), 8);
+    auto result = data.assemble(exec);
+
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+}
+
+
+TEST_F(StreamingAssemblyData, MergesRunsInMemory)
+{
+    gko::streaming_assembly_data<value_type, index_type> data(
+        gko::dim<2>{3, 5}, 1);
+
+    add_all(data);
+    // the runs were merged after the 3rd and 7th entry
+    ASSERT_EQ(data.get_num_runs(), 2);
+    ASSERT_EQ(data.get_num_stored_elements(), 5);
+    auto result = data.assemble(exec);
+
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+}
+
+
+TEST_F(StreamingAssemblyData, AssemblesMultipleRunsFromDisk)
+{
+    gko::streaming_assembly_data<value_type, index_type> data(
+        gko::dim<2>{3, 5}, 3, ".");
+
+    add_all(data);
+    ASSERT_EQ(data.get_num_runs(), 2);
+    auto result = data.assemble(exec);
+
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+}
+
+
+TEST_F(StreamingAssemblyData, CanBeReusedAfterAssembly)
+{
+    gko::streaming_assembly_data<value_type, index_type> data(
+        gko::dim<2>{3, 5}, 3, ".");
+    add_all(data);
+    data.assemble(exec);
+
+    add_all(data);
+    auto result = data.assemble(exec);
+
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+}
+
+
+TEST_F(StreamingAssemblyData, ThrowsOnOutOfBoundsEntry)
+{
+    gko::streaming_assembly_data<value_type, index_type> data(
+        gko::dim<2>{3, 5});
+
+    ASSERT_THROW(data.add_value(3, 0, 1.0), gko::OutOfBoundsError);
+    ASSERT_THROW(data.add_value(0, 5, 1.0), gko::OutOfBoundsError);
+}
+
+
+}  // namespace
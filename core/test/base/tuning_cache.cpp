@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/base/tuning_cache.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+
+
+namespace {
+
+
+class TuningCache : public ::testing::Test {
+protected:
+    TuningCache() : filename("tuning_cache_test.txt")
+    {
+        std::remove(filename.c_str());
+    }
+
+    ~TuningCache() { std::remove(filename.c_str()); }
+
+    std::string filename;
+};
+
+
+TEST_F(TuningCache, StoresInMemory)
+{
+    auto cache = gko::TuningCache::create();
+
+    cache->store("key", "value");
+    cache->store("other", "value2");
+    cache->store("key", "value3");
+
+    ASSERT_EQ(cache->get_filename(), "");
+    ASSERT_EQ(cache->get_num_entries(), 2);
+    ASSERT_EQ(cache->lookup("key"), "value3");
+    ASSERT_EQ(cache->lookup("other"), "value2");
+    ASSERT_FALSE(cache->lookup("missing").has_value());
+}
+
+
+TEST_F(TuningCache, StartsEmptyWithoutFile)
+{
+    auto cache = gko::TuningCache::create(filename);
+
+    ASSERT_EQ(cache->get_filename(), filename);
+    ASSERT_EQ(cache->get_num_entries(), 0);
+}
+
+
+TEST_F(TuningCache, PersistsEntries)
+{
+    {
+        auto cache = gko::TuningCache::create(filename);
+        cache->store("key", "value");
+        cache->store("other key", "value2");
+        cache->store("key", "value3");
+    }
+
+    auto cache = gko::TuningCache::create(filename);
+
+    ASSERT_EQ(cache->get_num_entries(), 2);
+    ASSERT_EQ(cache->lookup("key"), "value3");
+    ASSERT_EQ(cache->lookup("other key"), "value2");
+}
+
+
+TEST_F(TuningCache, SkipsMalformedLines)
+{
+    {
+        std::ofstream stream{filename};
+        stream << "no separator\n\tno key\nkey\tvalue\npartial";
+    }
+
+    auto cache = gko::TuningCache::create(filename);
+
+    ASSERT_EQ(cache->get_num_entries(), 1);
+    ASSERT_EQ(cache->lookup("key"), "value");
+}
+
+
+TEST_F(TuningCache, ThrowsOnMultiLineEntries)
+{
+    auto cache = gko::TuningCache::create();
+
+    ASSERT_THROW(cache->store("a\tb", "value"), gko::InvalidStateError);
+    ASSERT_THROW(cache->store("key", "a\nb"), gko::InvalidStateError);
+    ASSERT_THROW(cache->store("", "value"), gko::InvalidStateError);
+}
+
+
+}  // namespace
@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/log/metrics.hpp>
+
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Metrics : public ::testing::Test {
+protected:
+    using Dense = gko::matrix::Dense<double>;
+    using Cg = gko::solver::Cg<double>;
+    using metric = gko::log::metric;
+
+    Metrics()
+        : ref{gko::ReferenceExecutor::create()},
+          mtx{gko::initialize<Dense>(
+              {{4.0, 1.0, 0.0}, {1.0, 4.0, 1.0}, {0.0, 1.0, 4.0}}, ref)},
+          b{gko::initialize<Dense>({1.0, 2.0, 3.0}, ref)},
+          x{Dense::create(ref, gko::dim<2>{3, 1})},
+          logger{gko::share(gko::log::Metrics::create())}
+    {
+        x->fill(0.0);
+    }
+
+    std::unique_ptr<Cg> generate_cg(gko::size_type max_iters)
+    {
+        return Cg::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(max_iters),
+                gko::stop::ResidualNorm<double>::build().with_reduction_factor(
+                    1e-14))
+            .on(ref)
+            ->generate(mtx);
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<Dense> mtx;
+    std::unique_ptr<Dense> b;
+    std::unique_ptr<Dense> x;
+    std::shared_ptr<gko::log::Metrics> logger;
+};
+
+
+TEST_F(Metrics, StartsAtZero)
+{
+    for (const auto& entry : logger->get_snapshot()) {
+        EXPECT_EQ(entry.second, 0) << entry.first;
+    }
+    ASSERT_EQ(logger->get_snapshot().size(),
+              gko::log::Metrics::num_metrics);
+}
+
+
+TEST_F(Metrics, CountsSpmv)
+{
+    ref->add_logger(logger);
+
+    mtx->apply(b, x);
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_value(metric::spmvs), 1);
+    // 9 matrix entries, 3 entries each of b and x
+    ASSERT_EQ(logger->get_value(metric::spmv_bytes), 15 * sizeof(double));
+    ASSERT_GT(logger->get_value(metric::operations), 0);
+    ASSERT_GE(logger->get_value(metric::apply_time), 0);
+    ASSERT_EQ(logger->get_value(metric::solves), 0);
+}
+
+
+TEST_F(Metrics, CountsAllocationsAndCopies)
+{
+    ref->add_logger(logger);
+
+    gko::array<double> a{ref, 3};
+    gko::array<double> copy{ref, a};
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_value(metric::allocations), 2);
+    ASSERT_EQ(logger->get_value(metric::allocated_bytes), 6 * sizeof(double));
+    ASSERT_EQ(logger->get_value(metric::copies), 1);
+    ASSERT_EQ(logger->get_value(metric::copied_bytes), 3 * sizeof(double));
+}
+
+
+TEST_F(Metrics, CountsGenerate)
+{
+    ref->add_logger(logger);
+
+    auto solver = generate_cg(10u);
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_value(metric::generates), 1);
+    ASSERT_GE(logger->get_value(metric::generate_time), 0);
+}
+
+
+TEST_F(Metrics, CountsConvergedSolve)
+{
+    auto solver = generate_cg(10u);
+    ref->add_logger(logger);
+
+    solver->apply(b, x);
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_value(metric::solves), 1);
+    ASSERT_EQ(logger->get_value(metric::convergence_failures), 0);
+    ASSERT_GT(logger->get_value(metric::iterations), 0);
+    ASSERT_LE(logger->get_value(metric::iterations), 3);
+    // the initial residual and one SpMV per iteration
+    ASSERT_EQ(logger->get_value(metric::spmvs),
+              logger->get_value(metric::iterations) + 1);
+    ASSERT_GT(logger->get_value(metric::apply_time), 0);
+}
+
+
+TEST_F(Metrics, KeepsTimingAppliesAfterException)
+{
+    auto solver = generate_cg(10u);
+    auto wrong_x = Dense::create(ref, gko::dim<2>{2, 1});
+    ref->add_logger(logger);
+
+    ASSERT_THROW(mtx->apply(b, wrong_x), gko::DimensionMismatch);
+    ASSERT_THROW(solver->apply(b, wrong_x), gko::DimensionMismatch);
+    const auto time_before = logger->get_value(metric::apply_time);
+    solver->apply(b, x);
+
+    ref->remove_logger(logger);
+    ASSERT_GT(logger->get_value(metric::apply_time), time_before);
+}
+
+TEST_F(Metrics, CountsConvergenceFailure)
+{
+    auto solver = generate_cg(2u);
+    ref->add_logger(logger);
+
+    solver->apply(b, x);
+    solver->apply(b, x);
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_value(metric::solves), 2);
+    ASSERT_EQ(logger->get_value(metric::convergence_failures), 2);
+    ASSERT_EQ(logger->get_value(metric::iterations), 4);
+}
+
+
+TEST_F(Metrics, AggregatesThreads)
+{
+    ref->add_logger(logger);
+
+    std::thread first{[&] { mtx->apply(b, x); }};
+    first.join();
+    std::thread second{[&] { mtx->apply(b, x); }};
+    second.join();
+    mtx->apply(b, x);
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_value(metric::spmvs), 3);
+    ASSERT_EQ(logger->get_snapshot().at("spmvs"), 3);
+}
+
+
+TEST_F(Metrics, WritesJson)
+{
+    ref->add_logger(logger);
+    mtx->apply(b, x);
+    ref->remove_logger(logger);
+    std::stringstream ss;
+
+    logger->write_json(ss);
+
+    const auto str = ss.str();
+    ASSERT_EQ(str.front(), '{');
+    ASSERT_EQ(str.substr(str.size() - 2), "}\n");
+    ASSERT_NE(str.find("\"spmvs\":1"), std::string::npos);
+    ASSERT_NE(str.find("\"spmv_bytes\":120"), std::string::npos);
+    ASSERT_NE(str.find("\"convergence_failures\":0"), std::string::npos);
+    ASSERT_NE(str.find("\"apply_time_ns\":"), std::string::npos);
+}
+
+
+}  // namespace
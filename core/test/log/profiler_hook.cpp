@@ -11,6 +11,7 @@
 
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/log/profiler_hook.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/solver/ir.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 
@@ -374,6 +375,167 @@ TEST(ProfilerHook, NestedSummaryWorks)
 }
 
 
+struct WorkSummaryWriter : gko::log::ProfilerHook::SummaryWriter {
+    WorkSummaryWriter(std::vector<gko::log::ProfilerHook::summary_entry>& out)
+        : out{&out}
+    {}
+
+    void write(const std::vector<gko::log::ProfilerHook::summary_entry>& e,
+               std::chrono::nanoseconds overhead) override
+    {
+        *out = e;
+    }
+
+    std::vector<gko::log::ProfilerHook::summary_entry>* out;
+};
+
+
+TEST(ProfilerHook, PerfSummaryModelsApplyWork)
+{
+    using Mtx = gko::matrix::Csr<double, gko::int32>;
+    using Vec = gko::matrix::Dense<double>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = gko::initialize<Mtx>({{1.0, 2.0}, {0.0, 3.0}}, exec);
+    auto b = gko::initialize<Vec>({1.0, 1.0}, exec);
+    auto x = gko::initialize<Vec>({0.0, 0.0}, exec);
+    auto alpha = gko::initialize<Vec>({1.0}, exec);
+    std::vector<gko::log::ProfilerHook::summary_entry> entries;
+    {
+        auto logger = gko::log::ProfilerHook::create_perf_summary(
+            std::make_unique<gko::CpuTimer>(),
+            std::make_unique<WorkSummaryWriter>(entries));
+        logger->set_object_name(mtx, "mtx");
+        mtx->add_logger(logger);
+
+        mtx->apply(b, x);
+        mtx->apply(alpha, b, alpha, x);
+
+        mtx->remove_logger(logger);
+    }
+
+    ASSERT_EQ(entries.size(), 3);
+    ASSERT_EQ(entries[0].name, "total");
+    ASSERT_EQ(entries[1].name, "apply(mtx)");
+    ASSERT_EQ(entries[2].name, "advanced_apply(mtx)");
+    // 3 multiply-adds, 3 values and column indices, 3 row pointers, b and x
+    ASSERT_EQ(entries[1].work.flops, 6);
+    ASSERT_EQ(entries[1].work.bytes, 3 * 12 + 3 * 4 + 4 * 8);
+    // the update of x needs another multiply-add and read per row
+    ASSERT_EQ(entries[2].work.flops, 6 + 2 * 2);
+    ASSERT_EQ(entries[2].work.bytes, 3 * 12 + 3 * 4 + 6 * 8);
+    ASSERT_EQ(entries[0].work.flops, 16);
+    ASSERT_EQ(entries[0].work.bytes, 80 + 96);
+    ASSERT_GE(entries[0].counters.cycles, entries[1].counters.cycles);
+    ASSERT_GE(entries[1].counters.instructions, 0);
+}
+
+
+TEST(ProfilerHook, PerfSummaryDoesNotModelUnknownLinOps)
+{
+    std::vector<gko::log::ProfilerHook::summary_entry> entries;
+    auto exec = gko::ReferenceExecutor::create();
+    auto linop = gko::share(DummyLinOp::create(exec, gko::dim<2>{1, 1}));
+    {
+        auto logger = gko::log::ProfilerHook::create_perf_summary(
+            std::make_unique<gko::CpuTimer>(),
+            std::make_unique<WorkSummaryWriter>(entries));
+        logger->set_object_name(linop, "obj");
+        linop->add_logger(logger);
+
+        linop->apply(linop, linop);
+
+        linop->remove_logger(logger);
+    }
+
+    ASSERT_EQ(entries.size(), 2);
+    ASSERT_EQ(entries[1].name, "apply(obj)");
+    ASSERT_EQ(entries[1].work.flops, 0);
+    ASSERT_EQ(entries[1].work.bytes, 0);
+}
+
+
+struct TestMemorySummaryWriter
+    : gko::log::ProfilerHook::MemorySummaryWriter {
+    TestMemorySummaryWriter(
+        std::vector<std::pair<std::string,
+                              gko::log::ProfilerHook::memory_summary_entry>>&
+            out)
+        : out{&out}
+    {}
+
+    void write_memory(
+        const std::string& executor,
+        const gko::log::ProfilerHook::memory_summary_entry& root) override
+    {
+        out->emplace_back(executor, root);
+    }
+
+    std::vector<
+        std::pair<std::string, gko::log::ProfilerHook::memory_summary_entry>>*
+        out;
+};
+
+
+TEST(ProfilerHook, MemorySummaryWorks)
+{
+    std::vector<
+        std::pair<std::string, gko::log::ProfilerHook::memory_summary_entry>>
+        output;
+    auto exec = gko::ReferenceExecutor::create();
+    auto previous = exec->alloc<char>(10);
+    {
+        auto logger = gko::log::ProfilerHook::create_memory_summary(
+            std::make_unique<TestMemorySummaryWriter>(output));
+        exec->add_logger(logger);
+        {
+            auto range1 = logger->user_range("foo");
+            auto a = exec->alloc<char>(100);
+            {
+                auto range2 = logger->user_range("bar");
+                auto b = exec->alloc<char>(50);
+                exec->free(b);
+                auto c = exec->alloc<char>(30);
+                exec->free(c);
+            }
+            {
+                auto range2 = logger->user_range("bar");
+                auto b = exec->alloc<char>(60);
+                exec->free(b);
+            }
+            exec->free(a);
+            // memory allocated before the logger was created is ignored
+            exec->free(previous);
+        }
+        exec->remove_logger(logger);
+    }
+
+    ASSERT_EQ(output.size(), 1);
+    ASSERT_EQ(output[0].first, "gko::ReferenceExecutor");
+    const auto& total = output[0].second;
+    ASSERT_EQ(total.name, "total");
+    ASSERT_EQ(total.peak_bytes, 160);
+    ASSERT_EQ(total.allocated_bytes, 240);
+    ASSERT_EQ(total.num_allocations, 4);
+    ASSERT_EQ(total.count, 1);
+    ASSERT_EQ(total.children.size(), 1);
+    const auto& foo = total.children[0];
+    ASSERT_EQ(foo.name, "foo");
+    ASSERT_EQ(foo.peak_bytes, 160);
+    ASSERT_EQ(foo.allocated_bytes, 240);
+    ASSERT_EQ(foo.num_allocations, 4);
+    ASSERT_EQ(foo.count, 1);
+    ASSERT_EQ(foo.children.size(), 1);
+    const auto& bar = foo.children[0];
+    ASSERT_EQ(bar.name, "bar");
+    // the peak is the largest peak of all invocations
+    ASSERT_EQ(bar.peak_bytes, 60);
+    ASSERT_EQ(bar.allocated_bytes, 140);
+    ASSERT_EQ(bar.num_allocations, 3);
+    ASSERT_EQ(bar.count, 2);
+    ASSERT_EQ(bar.children.size(), 0);
+}
+
+
 TEST(ProfilerHookTableSummaryWriter, SummaryWorks)
 {
     using gko::log::ProfilerHook;
@@ -443,3 +605,72 @@ Overhead estimate 1.0 ns
 
     ASSERT_EQ(ss.str(), expected);
 }
+
+
+TEST(ProfilerHookTableSummaryWriter, PerformanceSummaryWorks)
+{
+    using gko::log::ProfilerHook;
+    using namespace std::chrono_literals;
+    std::stringstream ss;
+    ProfilerHook::TableSummaryWriter writer(ss, "Test header", {100.0, 10.0});
+    std::vector<ProfilerHook::summary_entry> entries;
+    entries.push_back({"plain", 500ns, 500ns, 1});
+    entries.push_back({"spmv", 1us, 1us, 1, {2000, 3000, 10}, {8000, 2400}});
+    entries.push_back({"other", 2us, 2us, 1, {4000, 2000, 100}, {}});
+    // clang-format off
+    const auto expected = R"(Test header
+Overhead estimate 1.0 ns
+| name  |  total   | total (self) | count |   avg    | avg (self) |
+|-------|---------:|-------------:|------:|---------:|-----------:|
+| other |   2.0 us |       2.0 us |     1 |   2.0 us |     2.0 us |
+| spmv  |   1.0 us |       1.0 us |     1 |   1.0 us |     1.0 us |
+| plain | 500.0 ns |     500.0 ns |     1 | 500.0 ns |   500.0 ns |
+Performance summary
+| name  | total  | IPC | LLC GB/s | GB/s | GFLOP/s | FLOP/byte | % peak GB/s | % roofline |
+|-------|-------:|----:|---------:|-----:|--------:|----------:|------------:|-----------:|
+| other | 2.0 us | 0.5 |      3.2 |    - |       - |         - |         3.2 |          - |
+| spmv  | 1.0 us | 1.5 |      0.6 |  8.0 |     2.4 |       0.3 |         8.0 |       24.0 |
+)";
+    // clang-format on
+
+    writer.write(entries, 1ns);
+
+    ASSERT_EQ(ss.str(), expected);
+}
+
+
+TEST(ProfilerHookTableSummaryWriter, MemorySummaryWorks)
+{
+    using gko::log::ProfilerHook;
+    std::stringstream ss;
+    ProfilerHook::TableSummaryWriter writer(ss, "Test header");
+    ProfilerHook::memory_summary_entry entry{
+        "root",
+        3 << 20,
+        5 << 20,
+        4,
+        1,
+        {ProfilerHook::memory_summary_entry{"foo", 1000, 1500, 2, 2, {}},
+         ProfilerHook::memory_summary_entry{
+             "bar",
+             3 << 20,
+             5 << 20,
+             2,
+             1,
+             {ProfilerHook::memory_summary_entry{"child", 2048, 2048, 1, 1,
+                                                 {}}}}}};
+    // clang-format off
+    const auto expected = R"(Test header (gko::ReferenceExecutor)
+|   name    |    peak    | allocated | allocations | count |
+|-----------|-----------:|----------:|------------:|------:|
+| root      |    3.0 MiB |   5.0 MiB |           4 |     1 |
+|   bar     |    3.0 MiB |   5.0 MiB |           2 |     1 |
+|     child |    2.0 KiB |   2.0 KiB |           1 |     1 |
+|   foo     | 1000.0 B   |   1.5 KiB |           2 |     2 |
+)";
+    // clang-format on
+
+    writer.write_memory("gko::ReferenceExecutor", entry);
+
+    ASSERT_EQ(ss.str(), expected);
+}
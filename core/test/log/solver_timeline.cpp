@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/log/solver_timeline.hpp>
+
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class SolverTimeline : public ::testing::Test {
+protected:
+    using Dense = gko::matrix::Dense<double>;
+    using Cg = gko::solver::Cg<double>;
+    using category = gko::log::timeline_category;
+
+    SolverTimeline()
+        : ref{gko::ReferenceExecutor::create()},
+          mtx{gko::initialize<Dense>(
+              {{4.0, 1.0, 0.0}, {1.0, 4.0, 1.0}, {0.0, 1.0, 4.0}}, ref)},
+          precond{gko::initialize<Dense>(
+              {{0.25, 0.0, 0.0}, {0.0, 0.25, 0.0}, {0.0, 0.0, 0.25}}, ref)},
+          b{gko::initialize<Dense>({1.0, 2.0, 3.0}, ref)},
+          x{Dense::create(ref, gko::dim<2>{3, 1})},
+          logger{gko::share(gko::log::SolverTimeline::create())}
+    {
+        solver =
+            Cg::build()
+                .with_criteria(gko::stop::Iteration::build().with_max_iters(2u))
+                .with_generated_preconditioner(precond)
+                .on(ref)
+                ->generate(mtx);
+        x->fill(0.0);
+    }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<Dense> mtx;
+    std::shared_ptr<Dense> precond;
+    std::unique_ptr<Dense> b;
+    std::unique_ptr<Dense> x;
+    std::unique_ptr<Cg> solver;
+    std::shared_ptr<gko::log::SolverTimeline> logger;
+};
+
+
+TEST_F(SolverTimeline, RecordsOneRowPerIteration)
+{
+    ref->add_logger(logger);
+
+    solver->apply(b, x);
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_num_rows(), 3);
+    for (int row = 0; row < 3; row++) {
+        EXPECT_EQ(logger->get_solves()[row], 0);
+        EXPECT_EQ(logger->get_iterations()[row], row);
+        gko::int64 sum{};
+        for (int i = 0; i < gko::log::SolverTimeline::num_categories; i++) {
+            const auto time =
+                logger->get_times(static_cast<category>(i))[row];
+            EXPECT_GE(time, 0);
+            sum += time;
+        }
+        EXPECT_GE(sum, logger->get_total_times()[row]);
+    }
+    // the setup computes the initial residual and applies the preconditioner
+    EXPECT_GT(logger->get_times(category::spmv)[0], 0);
+    EXPECT_GT(logger->get_times(category::preconditioner)[0], 0);
+    EXPECT_GT(logger->get_times(category::spmv)[1], 0);
+    EXPECT_GT(logger->get_times(category::preconditioner)[1], 0);
+    EXPECT_GT(logger->get_times(category::reduction)[1], 0);
+    EXPECT_GT(logger->get_times(category::vector_update)[1], 0);
+    EXPECT_EQ(logger->get_times(category::communication)[1], 0);
+}
+
+
+TEST_F(SolverTimeline, RecordsResidualNorms)
+{
+    ref->add_logger(logger);
+
+    solver->apply(b, x);
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_num_rows(), 3);
+    for (int row = 0; row < 3; row++) {
+        EXPECT_FALSE(std::isnan(logger->get_residual_norms()[row]));
+        EXPECT_FALSE(std::isnan(logger->get_implicit_residual_norms()[row]));
+    }
+    // the initial residual is b, CG computes the implicit norm from
+    // r^T M r with M = 0.25 I
+    EXPECT_DOUBLE_EQ(logger->get_residual_norms()[0], std::sqrt(14.0));
+    EXPECT_DOUBLE_EQ(logger->get_implicit_residual_norms()[0], std::sqrt(3.5));
+}
+
+
+TEST_F(SolverTimeline, CountsSolves)
+{
+    ref->add_logger(logger);
+
+    solver->apply(b, x);
+    solver->apply(b, x);
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_num_rows(), 6);
+    EXPECT_EQ(logger->get_solves()[2], 0);
+    EXPECT_EQ(logger->get_solves()[3], 1);
+    EXPECT_EQ(logger->get_iterations()[3], 0);
+}
+
+
+TEST_F(SolverTimeline, IgnoresEventsOutsideOfSolver)
+{
+    ref->add_logger(logger);
+
+    mtx->apply(b, x);
+    b->compute_norm2(x->create_submatrix(gko::span{0, 1}, gko::span{0, 1}));
+
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_num_rows(), 0);
+}
+
+
+TEST_F(SolverTimeline, ClearsRows)
+{
+    ref->add_logger(logger);
+    solver->apply(b, x);
+
+    logger->clear();
+
+    solver->apply(b, x);
+    ref->remove_logger(logger);
+    ASSERT_EQ(logger->get_num_rows(), 3);
+    EXPECT_EQ(logger->get_solves()[0], 0);
+}
+
+
+TEST_F(SolverTimeline, WritesCsv)
+{
+    ref->add_logger(logger);
+    solver->apply(b, x);
+    ref->remove_logger(logger);
+    std::stringstream ss;
+
+    logger->write_csv(ss);
+
+    std::string line;
+    std::getline(ss, line);
+    ASSERT_EQ(line,
+              "solve,iteration,total,spmv,preconditioner,reduction,"
+              "communication,vector_update,other,residual_norm,"
+              "implicit_residual_norm");
+    int num_lines = 0;
+    while (std::getline(ss, line)) {
+        EXPECT_EQ(line.substr(0, 4), "0," + std::to_string(num_lines) + ",");
+        num_lines++;
+    }
+    ASSERT_EQ(num_lines, 3);
+}
+
+
+TEST_F(SolverTimeline, WritesJson)
+{
+    ref->add_logger(logger);
+    solver->apply(b, x);
+    ref->remove_logger(logger);
+    std::stringstream ss;
+
+    logger->write_json(ss);
+
+    const auto str = ss.str();
+    ASSERT_EQ(str.substr(0, 33), "{\"solve\":[0,0,0],\"iteration\":[0,1");
+    for (auto column : {"\"total\":[", "\"spmv\":[", "\"preconditioner\":[",
+                        "\"reduction\":[", "\"communication\":[0,0,0]",
+                        "\"vector_update\":[", "\"other\":[",
+                        "\"residual_norm\":[",
+                        "\"implicit_residual_norm\":["}) {
+        EXPECT_NE(str.find(column), std::string::npos) << column;
+    }
+}
+
+
+}  // namespace
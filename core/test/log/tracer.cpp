@@ -0,0 +1,228 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/log/tracer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class DummyOperation : public gko::Operation {
+public:
+    void run(std::shared_ptr<const gko::OmpExecutor>) const override {}
+
+    void run(std::shared_ptr<const gko::ReferenceExecutor>) const override {}
+
+    void run(std::shared_ptr<const gko::HipExecutor>) const override {}
+
+    void run(std::shared_ptr<const gko::DpcppExecutor>) const override {}
+
+    void run(std::shared_ptr<const gko::CudaExecutor>) const override {}
+
+    const char* get_name() const noexcept override { return "op"; }
+};
+
+
+TEST(Tracer, RecordsAllocateCopyOperation)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::share(gko::log::Tracer::create());
+    exec->add_logger(logger);
+
+    {
+        int i = 0;
+        gko::array<int> data{exec, 1};
+        exec->copy(1, &i, data.get_data());
+        exec->run(DummyOperation{});
+    }
+
+    exec->remove_logger(logger);
+    auto events = logger->get_events();
+    ASSERT_EQ(events.size(), 5);
+    EXPECT_EQ(events[0].kind, gko::log::trace_event_kind::allocation);
+    EXPECT_EQ(events[0].object, exec.get());
+    EXPECT_EQ(events[0].size[0], sizeof(int));
+    EXPECT_EQ(events[1].kind, gko::log::trace_event_kind::copy);
+    EXPECT_EQ(events[1].size[0], sizeof(int));
+    EXPECT_EQ(events[2].kind, gko::log::trace_event_kind::operation_begin);
+    EXPECT_STREQ(events[2].name, "op");
+    EXPECT_EQ(events[3].kind, gko::log::trace_event_kind::operation_end);
+    EXPECT_EQ(events[4].kind, gko::log::trace_event_kind::free);
+    EXPECT_EQ(events[4].size[1], events[0].size[1]);
+    for (int i = 1; i < 5; i++) {
+        EXPECT_LE(events[i - 1].timestamp, events[i].timestamp);
+    }
+}
+
+
+TEST(Tracer, RecordsApplyWithoutCloning)
+{
+    using Vec = gko::matrix::Dense<>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::share(gko::log::Tracer::create(
+        16, gko::log::Logger::linop_events_mask));
+    auto mtx = gko::initialize<Vec>({{1.0, 2.0}, {3.0, 4.0}}, exec);
+    auto b = gko::initialize<Vec>({1.0, 1.0}, exec);
+    auto x = Vec::create(exec, gko::dim<2>{2, 1});
+    mtx->add_logger(logger);
+
+    mtx->apply(b, x);
+
+    mtx->remove_logger(logger);
+    auto events = logger->get_events();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].kind, gko::log::trace_event_kind::apply_begin);
+    EXPECT_EQ(events[0].object, mtx.get());
+    EXPECT_EQ(*events[0].type, typeid(Vec));
+    EXPECT_EQ(events[0].size[0], 2);
+    EXPECT_EQ(events[0].size[1], 2);
+    EXPECT_EQ(events[1].kind, gko::log::trace_event_kind::apply_end);
+    EXPECT_EQ(events[1].object, mtx.get());
+}
+
+
+TEST(Tracer, KeepsOnlyMostRecentEvents)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::share(gko::log::Tracer::create(4));
+    exec->add_logger(logger);
+
+    for (int i = 1; i <= 10; i++) {
+        exec->free(exec->alloc<char>(i));
+    }
+
+    exec->remove_logger(logger);
+    auto events = logger->get_events();
+    ASSERT_EQ(logger->get_capacity(), 4);
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(events[0].kind, gko::log::trace_event_kind::allocation);
+    EXPECT_EQ(events[0].size[0], 9);
+    EXPECT_EQ(events[2].kind, gko::log::trace_event_kind::allocation);
+    EXPECT_EQ(events[2].size[0], 10);
+    EXPECT_EQ(events[3].kind, gko::log::trace_event_kind::free);
+}
+
+
+TEST(Tracer, UsesSeparateBufferPerThread)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::share(gko::log::Tracer::create(8));
+    exec->add_logger(logger);
+    std::vector<std::thread> threads;
+    std::atomic<int> num_started{0};
+
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&] {
+            // keep all threads alive at the same time, so they can't share
+            // the same thread id
+            num_started++;
+            while (num_started.load() < 4) {
+            }
+            for (int i = 0; i < 8; i++) {
+                exec->run(DummyOperation{});
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    exec->remove_logger(logger);
+    auto events = logger->get_events();
+    ASSERT_EQ(events.size(), 4 * 8);
+    std::vector<int> counts(4);
+    for (const auto& event : events) {
+        ASSERT_GE(event.thread, 0);
+        ASSERT_LT(event.thread, 4);
+        counts[event.thread]++;
+    }
+    ASSERT_EQ(counts, std::vector<int>(4, 8));
+}
+
+
+TEST(Tracer, FiltersByTimeWindow)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::share(gko::log::Tracer::create());
+    exec->add_logger(logger);
+
+    exec->run(DummyOperation{});
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    exec->free(exec->alloc<char>(1));
+
+    exec->remove_logger(logger);
+    auto events = logger->get_events(std::chrono::milliseconds{25});
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].kind, gko::log::trace_event_kind::allocation);
+    EXPECT_EQ(events[1].kind, gko::log::trace_event_kind::free);
+}
+
+
+TEST(Tracer, WritesChromeTrace)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::share(gko::log::Tracer::create(3));
+    exec->add_logger(logger);
+    std::ostringstream ss;
+
+    exec->run(DummyOperation{});
+    exec->free(exec->alloc<char>(1));
+    logger->write_chrome_trace(ss);
+
+    exec->remove_logger(logger);
+    const auto trace = ss.str();
+    // the begin event of the operation was overwritten, so its end is dropped
+    EXPECT_EQ(trace.find("\"ph\":\"B\""), std::string::npos);
+    EXPECT_EQ(trace.find("\"ph\":\"E\""), std::string::npos);
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[\n", 0), 0);
+    EXPECT_NE(trace.find("{\"name\":\"allocation\",\"cat\":\"allocation\","
+                         "\"ph\":\"i\""),
+              std::string::npos);
+    EXPECT_NE(trace.find("\"bytes\":1"), std::string::npos);
+    EXPECT_NE(trace.find("\n],\"displayTimeUnit\":\"ns\"}\n"),
+              std::string::npos);
+}
+
+
+TEST(Tracer, WritesMatchingBeginAndEndEvents)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::share(gko::log::Tracer::create());
+    exec->add_logger(logger);
+    std::ostringstream ss;
+
+    exec->run(DummyOperation{});
+    logger->write_chrome_trace(ss);
+
+    exec->remove_logger(logger);
+    const auto trace = ss.str();
+    const auto begin = trace.find(
+        "{\"name\":\"op\",\"cat\":\"operation\",\"ph\":\"B\",\"ts\":");
+    const auto end = trace.find(
+        "{\"name\":\"op\",\"cat\":\"operation\",\"ph\":\"E\",\"ts\":");
+    ASSERT_NE(begin, std::string::npos);
+    ASSERT_NE(end, std::string::npos);
+    ASSERT_LT(begin, end);
+}
+
+
+TEST(Tracer, ThrowsOnZeroCapacity)
+{
+    ASSERT_THROW(gko::log::Tracer::create(0), gko::InvalidStateError);
+}
+
+
+}  // namespace
@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/delta_csr.hpp>
+
+#include "core/test/utils.hpp"
+
+
+template <typename ValueIndexType>
+class DeltaCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::DeltaCsr<value_type, index_type>;
+
+    DeltaCsr() : exec(gko::ReferenceExecutor::create()), mtx(Mtx::create(exec))
+    {
+        mtx->read({{3, 400},
+                   {{0, 1, 1.0}, {0, 3, 2.0}, {0, 300, 3.0}, {2, 5, 4.0}}});
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+
+    void assert_equal_to_original_mtx(gko::ptr_param<const Mtx> m)
+    {
+        auto v = m->get_const_values();
+        auto r = m->get_const_row_ptrs();
+        auto b = m->get_const_base_cols();
+        auto p = m->get_const_delta_ptrs();
+        auto d = m->get_const_deltas();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(3, 400));
+        ASSERT_EQ(m->get_num_stored_elements(), 4);
+        ASSERT_EQ(m->get_num_delta_bytes(), 4);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 3);
+        EXPECT_EQ(r[2], 3);
+        EXPECT_EQ(r[3], 4);
+        EXPECT_EQ(b[0], 1);
+        EXPECT_EQ(b[1], 0);
+        EXPECT_EQ(b[2], 5);
+        EXPECT_EQ(p[0], 0);
+        EXPECT_EQ(p[1], 4);
+        EXPECT_EQ(p[2], 4);
+        EXPECT_EQ(p[3], 4);
+        // a single byte delta, followed by an escaped 16 bit delta
+        EXPECT_EQ(d[0], 2);
+        EXPECT_EQ(d[1], 0);
+        EXPECT_EQ(v[0], value_type{1.0});
+        EXPECT_EQ(v[1], value_type{2.0});
+        EXPECT_EQ(v[2], value_type{3.0});
+        EXPECT_EQ(v[3], value_type{4.0});
+    }
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_num_delta_bytes(), 0);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        ASSERT_NE(m->get_const_delta_ptrs(), nullptr);
+        EXPECT_EQ(m->get_const_row_ptrs()[0], 0);
+        EXPECT_EQ(m->get_const_delta_ptrs()[0], 0);
+    }
+};
+
+TYPED_TEST_SUITE(DeltaCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(DeltaCsr, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(3, 400));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 4);
+}
+
+
+TYPED_TEST(DeltaCsr, ContainsCorrectData)
+{
+    this->assert_equal_to_original_mtx(this->mtx);
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->mtx->get_values()[1] = 5.0;
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->move_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->mtx->get_values()[1] = 5.0;
+    this->assert_equal_to_original_mtx(dynamic_cast<Mtx*>(clone.get()));
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeCleared)
+{
+    this->mtx->clear();
+
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(DeltaCsr, GeneratesCorrectMatrixData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(3, 400));
+    ASSERT_EQ(data.nonzeros.size(), 4);
+    EXPECT_EQ(data.nonzeros[0], tpl(0, 1, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[1], tpl(0, 3, value_type{2.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(0, 300, value_type{3.0}));
+    EXPECT_EQ(data.nonzeros[3], tpl(2, 5, value_type{4.0}));
+}
@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/reduced_csr.hpp>
+
+#include "core/test/utils.hpp"
+
+
+template <typename ValueIndexType>
+class ReducedCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::ReducedCsr<value_type, index_type>;
+    using storage_type = gko::reduce_precision<value_type>;
+
+    ReducedCsr()
+        : exec(gko::ReferenceExecutor::create()), mtx(Mtx::create(exec))
+    {
+        mtx->read(
+            {{2, 3}, {{0, 0, 1.0}, {0, 1, 3.0}, {0, 2, 2.0}, {1, 1, 5.0}}});
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+
+    void assert_equal_to_original_mtx(gko::ptr_param<const Mtx> m)
+    {
+        auto s = reinterpret_cast<const storage_type*>(m->get_const_storage());
+        auto c = m->get_const_col_idxs();
+        auto r = m->get_const_row_ptrs();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(2, 3));
+        ASSERT_EQ(m->get_num_stored_elements(), 4);
+        ASSERT_EQ(m->get_storage_mode(),
+                  gko::matrix::reduced_storage::single_reduction);
+        ASSERT_EQ(m->get_num_storage_bytes(), 4 * sizeof(storage_type));
+        ASSERT_EQ(m->get_const_scales(), nullptr);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 3);
+        EXPECT_EQ(r[2], 4);
+        EXPECT_EQ(c[0], 0);
+        EXPECT_EQ(c[1], 1);
+        EXPECT_EQ(c[2], 2);
+        EXPECT_EQ(c[3], 1);
+        EXPECT_EQ(s[0], storage_type{1.0});
+        EXPECT_EQ(s[1], storage_type{3.0});
+        EXPECT_EQ(s[2], storage_type{2.0});
+        EXPECT_EQ(s[3], storage_type{5.0});
+    }
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_num_storage_bytes(), 0);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        EXPECT_EQ(m->get_const_row_ptrs()[0], 0);
+    }
+};
+
+TYPED_TEST_SUITE(ReducedCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(ReducedCsr, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 4);
+}
+
+
+TYPED_TEST(ReducedCsr, ContainsCorrectData)
+{
+    this->assert_equal_to_original_mtx(this->mtx);
+}
+
+
+TYPED_TEST(ReducedCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(ReducedCsr, KnowsItsStorageMode)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using storage_type =
+        gko::reduce_precision<gko::reduce_precision<typename Mtx::value_type>>;
+    auto mtx = Mtx::create(this->exec, gko::dim<2>{},
+                           gko::matrix::reduced_storage::double_reduction);
+
+    mtx->read({{2, 2}, {{0, 0, 1.0}, {1, 1, 2.0}}});
+
+    ASSERT_EQ(mtx->get_storage_mode(),
+              gko::matrix::reduced_storage::double_reduction);
+    ASSERT_EQ(mtx->get_num_storage_bytes(), 2 * sizeof(storage_type));
+}
+
+
+TYPED_TEST(ReducedCsr, StoresScaledInt16ValuesForRealTypes)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    const auto mode = gko::matrix::reduced_storage::scaled_int16;
+    if (gko::is_complex<value_type>()) {
+        ASSERT_THROW(Mtx::create(this->exec, gko::dim<2>{}, mode),
+                     gko::NotSupported);
+        return;
+    }
+    auto mtx = Mtx::create(this->exec, gko::dim<2>{}, mode);
+
+    mtx->read({{2, 2}, {{0, 0, 1.0}, {0, 1, -4.0}, {1, 1, 2.0}}});
+
+    auto s = reinterpret_cast<const gko::int16*>(mtx->get_const_storage());
+    ASSERT_EQ(mtx->get_num_storage_bytes(), 3 * sizeof(gko::int16));
+    ASSERT_NE(mtx->get_const_scales(), nullptr);
+    EXPECT_EQ(s[1], -32767);
+    EXPECT_EQ(s[2], 32767);
+}
+
+
+TYPED_TEST(ReducedCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec, gko::dim<2>{},
+                            gko::matrix::reduced_storage::double_reduction);
+
+    copy->copy_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(ReducedCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->move_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(ReducedCsr, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->assert_equal_to_original_mtx(dynamic_cast<Mtx*>(clone.get()));
+}
+
+
+TYPED_TEST(ReducedCsr, CanBeCleared)
+{
+    this->mtx->clear();
+
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(ReducedCsr, GeneratesCorrectMatrixData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 3));
+    ASSERT_EQ(data.nonzeros.size(), 4);
+    EXPECT_EQ(data.nonzeros[0], tpl(0, 0, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[1], tpl(0, 1, value_type{3.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(0, 2, value_type{2.0}));
+    EXPECT_EQ(data.nonzeros[3], tpl(1, 1, value_type{5.0}));
+}
@@ -149,6 +149,38 @@ TYPED_TEST(Sellp, CanBeConstructedWithSliceSizeAndStrideFactor)
 }
 
 
+TYPED_TEST(Sellp, DoesNotSortRowsByDefault)
+{
+    ASSERT_EQ(this->mtx->get_sorting_window(), 1);
+    ASSERT_EQ(this->mtx->get_const_permutation(), nullptr);
+}
+
+
+TYPED_TEST(Sellp, CanBeConstructedWithSortingWindow)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, gko::dim<2>{2, 3}, 2, 2, 8, 3);
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(mtx->get_num_stored_elements(), 6);
+    ASSERT_EQ(mtx->get_slice_size(), 2);
+    ASSERT_EQ(mtx->get_stride_factor(), 2);
+    ASSERT_EQ(mtx->get_sorting_window(), 8);
+    ASSERT_EQ(mtx->get_total_cols(), 3);
+}
+
+
+TYPED_TEST(Sellp, SimdSliceSizeMatchesVectorWidth)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    const auto slice_size = Mtx::simd_slice_size();
+
+    ASSERT_GE(slice_size, 4);
+    ASSERT_LE(slice_size, 16);
+}
+
+
 TYPED_TEST(Sellp, CanBeCopied)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -266,3 +298,79 @@ TYPED_TEST(Sellp, CanBeReadFromMatrixAssemblyDataWithSliceSizeAndStrideFactor)
     this->assert_equal_to_original_mtx_with_slice_size_and_stride_factor(
         m.get());
 }
+
+
+TYPED_TEST(Sellp, CanBeReadFromMatrixDataWithSortingWindow)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto m = Mtx::create(this->exec, gko::dim<2>{}, 2, 1, 2, 0);
+
+    m->read({{3, 3}, {{0, 0, 1.0}, {1, 0, 2.0}, {1, 2, 3.0}, {2, 1, 4.0}}});
+
+    auto v = m->get_const_values();
+    auto c = m->get_const_col_idxs();
+    auto l = m->get_const_slice_lengths();
+    auto s = m->get_const_slice_sets();
+    auto p = m->get_const_permutation();
+    ASSERT_EQ(m->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(m->get_sorting_window(), 2);
+    ASSERT_EQ(m->get_total_cols(), 3);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(p[0], 1);
+    EXPECT_EQ(p[1], 0);
+    EXPECT_EQ(p[2], 2);
+    EXPECT_EQ(l[0], 2);
+    EXPECT_EQ(l[1], 1);
+    EXPECT_EQ(s[0], 0);
+    EXPECT_EQ(s[1], 2);
+    EXPECT_EQ(s[2], 3);
+    EXPECT_EQ(c[0], 0);
+    EXPECT_EQ(c[1], 0);
+    EXPECT_EQ(c[2], 2);
+    EXPECT_EQ(c[3], this->invalid_index);
+    EXPECT_EQ(c[4], 1);
+    EXPECT_EQ(v[0], value_type{2.0});
+    EXPECT_EQ(v[1], value_type{1.0});
+    EXPECT_EQ(v[2], value_type{3.0});
+    EXPECT_EQ(v[3], value_type{0.0});
+    EXPECT_EQ(v[4], value_type{4.0});
+}
+
+
+TYPED_TEST(Sellp, GeneratesCorrectMatrixDataWithSortingWindow)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    auto m = Mtx::create(this->exec, gko::dim<2>{}, 2, 1, 2, 0);
+    m->read({{3, 3}, {{0, 0, 1.0}, {1, 0, 2.0}, {1, 2, 3.0}, {2, 1, 4.0}}});
+    gko::matrix_data<value_type, index_type> data;
+
+    m->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(3, 3));
+    ASSERT_EQ(data.nonzeros.size(), 4);
+    EXPECT_EQ(data.nonzeros[0], tpl(0, 0, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[1], tpl(1, 0, value_type{2.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(1, 2, value_type{3.0}));
+    EXPECT_EQ(data.nonzeros[3], tpl(2, 1, value_type{4.0}));
+}
+
+
+TYPED_TEST(Sellp, CopyPreservesRowPermutation)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto m = Mtx::create(this->exec, gko::dim<2>{}, 2, 1, 2, 0);
+    m->read({{3, 3}, {{0, 0, 1.0}, {1, 0, 2.0}, {1, 2, 3.0}, {2, 1, 4.0}}});
+
+    auto copy = m->clone();
+
+    ASSERT_EQ(copy->get_sorting_window(), 2);
+    ASSERT_NE(copy->get_const_permutation(), nullptr);
+    EXPECT_NE(copy->get_const_permutation(), m->get_const_permutation());
+    EXPECT_EQ(copy->get_const_permutation()[0], 1);
+    EXPECT_EQ(copy->get_const_permutation()[1], 0);
+    EXPECT_EQ(copy->get_const_permutation()[2], 2);
+}
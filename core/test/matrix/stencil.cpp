@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/stencil.hpp>
+
+#include "core/test/utils.hpp"
+
+
+template <typename ValueIndexType>
+class Stencil : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Stencil<value_type, index_type>;
+
+    Stencil()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec, gko::dim<3>{3, 2, 1}))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+
+    void assert_equal_to_original_mtx(gko::ptr_param<const Mtx> m)
+    {
+        auto c = m->get_const_coefficients();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(6, 6));
+        ASSERT_EQ(m->get_grid_size(), (gko::dim<3>{3, 2, 1}));
+        ASSERT_EQ(m->get_stencil_type(), gko::matrix::stencil_type::five_point);
+        ASSERT_EQ(m->get_num_points(), 5);
+        ASSERT_FALSE(m->has_variable_coefficients());
+        EXPECT_EQ(c[0], value_type{-1.0});
+        EXPECT_EQ(c[1], value_type{-1.0});
+        EXPECT_EQ(c[2], value_type{4.0});
+        EXPECT_EQ(c[3], value_type{-1.0});
+        EXPECT_EQ(c[4], value_type{-1.0});
+    }
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_grid_size(), gko::dim<3>{});
+    }
+};
+
+TYPED_TEST_SUITE(Stencil, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(Stencil, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(6, 6));
+    ASSERT_EQ(this->mtx->get_grid_size(), (gko::dim<3>{3, 2, 1}));
+}
+
+
+TYPED_TEST(Stencil, UsesLaplacianCoefficientsByDefault)
+{
+    this->assert_equal_to_original_mtx(this->mtx);
+}
+
+
+TYPED_TEST(Stencil, KnowsNumberOfPoints)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using gko::matrix::stencil_type;
+
+    auto nine = Mtx::create(this->exec, gko::dim<3>{2, 2, 1},
+                            stencil_type::nine_point);
+    auto seven = Mtx::create(this->exec, gko::dim<3>{2, 2, 2},
+                             stencil_type::seven_point);
+    auto full = Mtx::create(this->exec, gko::dim<3>{2, 2, 2},
+                            stencil_type::twenty_seven_point);
+
+    ASSERT_EQ(nine->get_num_points(), 9);
+    ASSERT_EQ(seven->get_num_points(), 7);
+    ASSERT_EQ(full->get_num_points(), 27);
+    EXPECT_EQ(nine->get_const_coefficients()[4], value_type{8.0});
+    EXPECT_EQ(seven->get_const_coefficients()[3], value_type{6.0});
+    EXPECT_EQ(full->get_const_coefficients()[13], value_type{26.0});
+    EXPECT_EQ(full->get_const_coefficients()[0], value_type{-1.0});
+}
+
+
+TYPED_TEST(Stencil, CanUseVariableCoefficients)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    gko::array<value_type> coefficients(this->exec, 5 * 6);
+    coefficients.fill(value_type{2.0});
+
+    auto mtx = Mtx::create(this->exec, gko::dim<3>{3, 2, 1},
+                           gko::matrix::stencil_type::five_point,
+                           std::move(coefficients));
+
+    ASSERT_TRUE(mtx->has_variable_coefficients());
+    EXPECT_EQ(mtx->get_const_coefficients()[29], value_type{2.0});
+}
+
+
+TYPED_TEST(Stencil, ThrowsOnWrongNumberOfCoefficients)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+
+    ASSERT_THROW(Mtx::create(this->exec, gko::dim<3>{3, 2, 1},
+                             gko::matrix::stencil_type::five_point,
+                             gko::array<value_type>(this->exec, 7)),
+                 gko::ValueMismatch);
+}
+
+
+TYPED_TEST(Stencil, Throws2DStencilOn3DGrid)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    ASSERT_THROW(Mtx::create(this->exec, gko::dim<3>{3, 2, 2},
+                             gko::matrix::stencil_type::nine_point),
+                 gko::ValueMismatch);
+}
+
+
+TYPED_TEST(Stencil, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(Stencil, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->mtx->get_coefficients()[1] = 5.0;
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(Stencil, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->move_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(copy);
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(Stencil, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->mtx->get_coefficients()[1] = 5.0;
+    this->assert_equal_to_original_mtx(dynamic_cast<Mtx*>(clone.get()));
+}
+
+
+TYPED_TEST(Stencil, CanBeCleared)
+{
+    this->mtx->clear();
+
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(Stencil, GeneratesCorrectMatrixData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(6, 6));
+    ASSERT_EQ(data.nonzeros.size(), 20);
+    EXPECT_EQ(data.nonzeros[0], tpl(0, 0, value_type{4.0}));
+    EXPECT_EQ(data.nonzeros[1], tpl(0, 1, value_type{-1.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(0, 3, value_type{-1.0}));
+    EXPECT_EQ(data.nonzeros[3], tpl(1, 0, value_type{-1.0}));
+    EXPECT_EQ(data.nonzeros[4], tpl(1, 1, value_type{4.0}));
+    EXPECT_EQ(data.nonzeros[19], tpl(5, 5, value_type{4.0}));
+}
@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+#include "core/test/utils.hpp"
+
+
+template <typename ValueIndexType>
+class SymmetricCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using mat_data = gko::matrix_data<value_type, index_type>;
+
+    SymmetricCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec)),
+          // unsorted on purpose, the lower triangle is ignored
+          data{{3, 3},
+               {{0, 1, 1.0},
+                {0, 0, 4.0},
+                {1, 0, 1.0},
+                {1, 2, 2.0},
+                {1, 1, 5.0},
+                {2, 1, 2.0},
+                {2, 2, 6.0}}}
+    {
+        mtx->read(data);
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+    mat_data data;
+
+    void assert_equal_to_original_mtx(gko::ptr_param<const Mtx> m)
+    {
+        auto r = m->get_const_row_ptrs();
+        auto c = m->get_const_col_idxs();
+        auto v = m->get_const_values();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(3, 3));
+        ASSERT_EQ(m->get_num_stored_elements(), 5);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 2);
+        EXPECT_EQ(r[2], 4);
+        EXPECT_EQ(r[3], 5);
+        EXPECT_EQ(c[0], 0);
+        EXPECT_EQ(c[1], 1);
+        EXPECT_EQ(c[2], 1);
+        EXPECT_EQ(c[3], 2);
+        EXPECT_EQ(c[4], 2);
+        EXPECT_EQ(v[0], value_type{4.0});
+        EXPECT_EQ(v[1], value_type{1.0});
+        EXPECT_EQ(v[2], value_type{5.0});
+        EXPECT_EQ(v[3], value_type{2.0});
+        EXPECT_EQ(v[4], value_type{6.0});
+    }
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        EXPECT_EQ(m->get_const_row_ptrs()[0], 0);
+    }
+};
+
+TYPED_TEST_SUITE(SymmetricCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsr, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 5);
+}
+
+
+TYPED_TEST(SymmetricCsr, StoresSortedUpperTriangle)
+{
+    this->assert_equal_to_original_mtx(this->mtx);
+}
+
+
+TYPED_TEST(SymmetricCsr, IgnoresLowerTriangle)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    mtx->read({{3, 3}, {{0, 0, 4.0}, {1, 0, 7.0}, {2, 0, 8.0}}});
+
+    ASSERT_EQ(mtx->get_num_stored_elements(), 1);
+    EXPECT_EQ(mtx->get_const_row_ptrs()[3], 1);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, ThrowsOnNonSquareMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    ASSERT_THROW(mtx->read({{2, 3}, {{0, 0, 1.0}}}), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->mtx->get_values()[1] = 5.0;
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->move_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->mtx->get_values()[1] = 5.0;
+    this->assert_equal_to_original_mtx(dynamic_cast<Mtx*>(clone.get()));
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCleared)
+{
+    this->mtx->clear();
+
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, GeneratesFullMatrixData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(3, 3));
+    ASSERT_EQ(data.nonzeros.size(), 7);
+    EXPECT_EQ(data.nonzeros[0], tpl(0, 0, value_type{4.0}));
+    EXPECT_EQ(data.nonzeros[1], tpl(0, 1, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(1, 0, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[3], tpl(1, 1, value_type{5.0}));
+    EXPECT_EQ(data.nonzeros[4], tpl(1, 2, value_type{2.0}));
+    EXPECT_EQ(data.nonzeros[5], tpl(2, 1, value_type{2.0}));
+    EXPECT_EQ(data.nonzeros[6], tpl(2, 2, value_type{6.0}));
+}
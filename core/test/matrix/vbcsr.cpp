@@ -0,0 +1,258 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/vbcsr.hpp>
+
+#include "core/test/utils.hpp"
+
+
+template <typename ValueIndexType>
+class Vbcsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Vbcsr<value_type, index_type>;
+    using mat_data = gko::matrix_data<value_type, index_type>;
+
+    Vbcsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec)),
+          // rows 0-1 and rows 2-4 share their sparsity pattern
+          data{{5, 5},
+               {{0, 0, 1.0},
+                {0, 1, 2.0},
+                {0, 3, 3.0},
+                {1, 0, 4.0},
+                {1, 1, 5.0},
+                {1, 3, 6.0},
+                {2, 2, 7.0},
+                {2, 3, 8.0},
+                {2, 4, 9.0},
+                {3, 2, 10.0},
+                {3, 3, 11.0},
+                {3, 4, 12.0},
+                {4, 2, 13.0},
+                {4, 3, 14.0},
+                {4, 4, 15.0}}}
+    {
+        mtx->read(data);
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+    mat_data data;
+
+    void assert_equal_to_original_mtx(gko::ptr_param<const Mtx> m)
+    {
+        auto o = m->get_const_block_offsets();
+        auto r = m->get_const_row_ptrs();
+        auto c = m->get_const_col_idxs();
+        auto p = m->get_const_value_ptrs();
+        auto v = m->get_const_values();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(5, 5));
+        ASSERT_EQ(m->get_num_block_rows(), 2);
+        ASSERT_EQ(m->get_num_stored_blocks(), 3);
+        ASSERT_EQ(m->get_num_stored_elements(), 19);
+        EXPECT_EQ(o[0], 0);
+        EXPECT_EQ(o[1], 2);
+        EXPECT_EQ(o[2], 5);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 2);
+        EXPECT_EQ(r[2], 3);
+        EXPECT_EQ(c[0], 0);
+        EXPECT_EQ(c[1], 1);
+        EXPECT_EQ(c[2], 1);
+        EXPECT_EQ(p[0], 0);
+        EXPECT_EQ(p[1], 4);
+        EXPECT_EQ(p[2], 10);
+        EXPECT_EQ(p[3], 19);
+        EXPECT_EQ(v[0], value_type{1.0});
+        EXPECT_EQ(v[3], value_type{5.0});
+        // the 2x3 block contains explicit zeros
+        EXPECT_EQ(v[4], value_type{0.0});
+        EXPECT_EQ(v[5], value_type{3.0});
+        EXPECT_EQ(v[6], value_type{0.0});
+        EXPECT_EQ(v[8], value_type{6.0});
+        EXPECT_EQ(v[10], value_type{7.0});
+        EXPECT_EQ(v[18], value_type{15.0});
+    }
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_block_rows(), 0);
+        ASSERT_EQ(m->get_num_stored_blocks(), 0);
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_NE(m->get_const_block_offsets(), nullptr);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        EXPECT_EQ(m->get_const_block_offsets()[0], 0);
+        EXPECT_EQ(m->get_const_row_ptrs()[0], 0);
+    }
+};
+
+TYPED_TEST_SUITE(Vbcsr, gko::test::ValueIndexTypes, PairTypenameNameGenerator);
+
+
+TYPED_TEST(Vbcsr, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(5, 5));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 19);
+}
+
+
+TYPED_TEST(Vbcsr, DetectsBlocks)
+{
+    ASSERT_TRUE(this->mtx->detects_blocks());
+    this->assert_equal_to_original_mtx(this->mtx);
+}
+
+
+TYPED_TEST(Vbcsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(Vbcsr, UsesOneBlockPerRowBeforeFilling)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, gko::dim<2>{3, 3});
+
+    ASSERT_EQ(mtx->get_num_block_rows(), 3);
+    ASSERT_EQ(mtx->get_num_stored_blocks(), 0);
+    EXPECT_EQ(mtx->get_const_block_offsets()[3], 3);
+    EXPECT_EQ(mtx->get_const_row_ptrs()[3], 0);
+}
+
+
+TYPED_TEST(Vbcsr, UsesGivenBlockSizes)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    auto mtx =
+        Mtx::create(this->exec, gko::dim<2>{5, 5},
+                    gko::array<index_type>{this->exec, {2, 1, 2}});
+
+    mtx->read(this->data);
+
+    auto o = mtx->get_const_block_offsets();
+    auto r = mtx->get_const_row_ptrs();
+    auto c = mtx->get_const_col_idxs();
+    auto p = mtx->get_const_value_ptrs();
+    ASSERT_FALSE(mtx->detects_blocks());
+    ASSERT_EQ(mtx->get_num_block_rows(), 3);
+    ASSERT_EQ(mtx->get_num_stored_blocks(), 6);
+    ASSERT_EQ(mtx->get_num_stored_elements(), 17);
+    EXPECT_EQ(o[1], 2);
+    EXPECT_EQ(o[2], 3);
+    EXPECT_EQ(o[3], 5);
+    EXPECT_EQ(r[1], 2);
+    EXPECT_EQ(r[2], 4);
+    EXPECT_EQ(r[3], 6);
+    EXPECT_EQ(c[0], 0);
+    EXPECT_EQ(c[1], 2);
+    EXPECT_EQ(c[2], 1);
+    EXPECT_EQ(c[3], 2);
+    EXPECT_EQ(p[1], 4);
+    EXPECT_EQ(p[2], 8);
+    EXPECT_EQ(p[3], 9);
+    EXPECT_EQ(p[4], 11);
+    EXPECT_EQ(p[6], 17);
+    EXPECT_EQ(mtx->get_const_values()[4], value_type{3.0});
+    EXPECT_EQ(mtx->get_const_values()[5], value_type{0.0});
+}
+
+
+TYPED_TEST(Vbcsr, ThrowsOnMismatchingBlockSizes)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+
+    ASSERT_THROW(Mtx::create(this->exec, gko::dim<2>{5, 5},
+                             gko::array<index_type>{this->exec, {2, 2}}),
+                 gko::ValueMismatch);
+}
+
+
+TYPED_TEST(Vbcsr, ThrowsOnNonSquareMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    ASSERT_THROW(mtx->read({{2, 3}, {{0, 0, 1.0}}}), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(Vbcsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->mtx->get_values()[1] = 5.0;
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(Vbcsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->move_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(Vbcsr, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->mtx->get_values()[1] = 5.0;
+    this->assert_equal_to_original_mtx(dynamic_cast<Mtx*>(clone.get()));
+}
+
+
+TYPED_TEST(Vbcsr, CanBeCleared)
+{
+    this->mtx->clear();
+
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(Vbcsr, GeneratesCorrectMatrixData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(5, 5));
+    ASSERT_EQ(data.nonzeros.size(), 19);
+    EXPECT_EQ(data.nonzeros[0], tpl(0, 0, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[1], tpl(0, 1, value_type{2.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(0, 2, value_type{0.0}));
+    EXPECT_EQ(data.nonzeros[3], tpl(0, 3, value_type{3.0}));
+    EXPECT_EQ(data.nonzeros[4], tpl(0, 4, value_type{0.0}));
+    EXPECT_EQ(data.nonzeros[10], tpl(2, 2, value_type{7.0}));
+    EXPECT_EQ(data.nonzeros[18], tpl(4, 4, value_type{15.0}));
+}
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/solver/batch_direct.hpp>
+
+#include "core/base/batch_utilities.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/batch_helpers.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class BatchDirect : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::batch::matrix::Dense<value_type>;
+    using CsrMtx = gko::batch::matrix::Csr<value_type>;
+    using MVec = gko::batch::MultiVector<value_type>;
+    using Solver = gko::batch::solver::Direct<value_type>;
+
+    BatchDirect()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::share(gko::test::generate_3pt_stencil_batch_matrix<Mtx>(
+              this->exec, num_batch_items, num_rows))),
+          csr_mtx(gko::share(
+              gko::test::generate_3pt_stencil_batch_matrix<CsrMtx>(
+                  this->exec, num_batch_items, num_rows, 3 * num_rows - 2))),
+          solver_factory(Solver::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    const gko::size_type num_batch_items = 3;
+    const int num_rows = 5;
+    std::shared_ptr<const Mtx> mtx;
+    std::shared_ptr<const CsrMtx> csr_mtx;
+    std::unique_ptr<typename Solver::Factory> solver_factory;
+};
+
+TYPED_TEST_SUITE(BatchDirect, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchDirect, FactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->solver_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(BatchDirect, FactoryCreatesCorrectSolver)
+{
+    auto solver = this->solver_factory->generate(this->mtx);
+
+    ASSERT_EQ(solver->get_num_batch_items(), this->num_batch_items);
+    ASSERT_EQ(solver->get_common_size(),
+              gko::dim<2>(this->num_rows, this->num_rows));
+}
+
+
+TYPED_TEST(BatchDirect, StoresDenseFactorsForDenseMatrix)
+{
+    auto solver = this->solver_factory->generate(this->mtx);
+
+    ASSERT_FALSE(solver->has_sparse_factors());
+    ASSERT_EQ(solver->get_num_elements_per_item(),
+              this->num_rows * this->num_rows);
+    ASSERT_EQ(solver->get_num_stored_elements(),
+              this->num_batch_items * this->num_rows * this->num_rows);
+}
+
+
+TYPED_TEST(BatchDirect, StoresSparseFactorsForCsrMatrix)
+{
+    auto solver = this->solver_factory->generate(this->csr_mtx);
+
+    // a tridiagonal matrix has no fill-in
+    ASSERT_TRUE(solver->has_sparse_factors());
+    ASSERT_EQ(solver->get_num_elements_per_item(), 3 * this->num_rows - 2);
+    ASSERT_EQ(solver->get_num_stored_elements(),
+              this->num_batch_items * (3 * this->num_rows - 2));
+}
+
+
+TYPED_TEST(BatchDirect, ThrowsOnRectangularMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = gko::share(
+        Mtx::create(this->exec, gko::batch_dim<2>(this->num_batch_items,
+                                                  gko::dim<2>(3, 4))));
+
+    ASSERT_THROW(this->solver_factory->generate(mtx), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(BatchDirect, ThrowsOnApplyWithWrongSize)
+{
+    using MVec = typename TestFixture::MVec;
+    auto solver = this->solver_factory->generate(this->mtx);
+    auto b = MVec::create(
+        this->exec, gko::batch_dim<2>(this->num_batch_items,
+                                      gko::dim<2>(this->num_rows + 1, 1)));
+    auto x = MVec::create(this->exec,
+                          gko::batch_dim<2>(this->num_batch_items,
+                                            gko::dim<2>(this->num_rows, 1)));
+
+    ASSERT_THROW(solver->apply(b, x), gko::DimensionMismatch);
+}
+
+
+}  // namespace
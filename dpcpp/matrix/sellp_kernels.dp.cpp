@@ -42,6 +42,7 @@ template <typename ValueType, typename IndexType>
 void spmv_kernel(size_type num_rows, size_type num_right_hand_sides,
                  size_type b_stride, size_type c_stride, size_type slice_size,
                  const size_type* __restrict__ slice_sets,
+                 const IndexType* __restrict__ perm,
                  const ValueType* __restrict__ a,
                  const IndexType* __restrict__ cols,
                  const ValueType* __restrict__ b, ValueType* __restrict__ c,
@@ -60,7 +61,8 @@ void spmv_kernel(size_type num_rows, size_type num_right_hand_sides,
                 val += a[ind] * b[col * b_stride + column_id];
             }
         }
-        c[row * c_stride + column_id] = val;
+        const auto out_row = perm ? perm[row] : row;
+        c[out_row * c_stride + column_id] = val;
     }
 }
 
@@ -72,6 +74,7 @@ void advanced_spmv_kernel(size_type num_rows, size_type num_right_hand_sides,
                           size_type b_stride, size_type c_stride,
                           size_type slice_size,
                           const size_type* __restrict__ slice_sets,
+                          const IndexType* __restrict__ perm,
                           const ValueType* __restrict__ alpha,
                           const ValueType* __restrict__ a,
                           const IndexType* __restrict__ cols,
@@ -92,8 +95,9 @@ void advanced_spmv_kernel(size_type num_rows, size_type num_right_hand_sides,
                 val += a[ind] * b[col * b_stride + column_id];
             }
         }
-        c[row * c_stride + column_id] =
-            beta[0] * c[row * c_stride + column_id] + alpha[0] * val;
+        const auto out_row = perm ? perm[row] : row;
+        c[out_row * c_stride + column_id] =
+            beta[0] * c[out_row * c_stride + column_id] + alpha[0] * val;
     }
 }
 
@@ -115,8 +119,9 @@ void spmv(std::shared_ptr<const DpcppExecutor> exec,
     spmv_kernel(gridSize, blockSize, 0, exec->get_queue(), a->get_size()[0],
                 b->get_size()[1], b->get_stride(), c->get_stride(),
                 a->get_slice_size(), a->get_const_slice_sets(),
-                a->get_const_values(), a->get_const_col_idxs(),
-                b->get_const_values(), c->get_values());
+                a->get_const_permutation(), a->get_const_values(),
+                a->get_const_col_idxs(), b->get_const_values(),
+                c->get_values());
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_SPMV_KERNEL);
@@ -137,8 +142,9 @@ void advanced_spmv(std::shared_ptr<const DpcppExecutor> exec,
     advanced_spmv_kernel(
         gridSize, blockSize, 0, exec->get_queue(), a->get_size()[0],
         b->get_size()[1], b->get_stride(), c->get_stride(), a->get_slice_size(),
-        a->get_const_slice_sets(), alpha->get_const_values(),
-        a->get_const_values(), a->get_const_col_idxs(), b->get_const_values(),
+        a->get_const_slice_sets(), a->get_const_permutation(),
+        alpha->get_const_values(), a->get_const_values(),
+        a->get_const_col_idxs(), b->get_const_values(),
         beta->get_const_values(), c->get_values());
 }
 
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_isai_kernels.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace dpcpp {
+namespace batch_isai {
+
+
+template <typename IndexType>
+void compute_cumulative_system_storage(
+    std::shared_ptr<const DefaultExecutor> exec, const size_type num_rows,
+    const IndexType* row_ptrs, IndexType* system_offsets) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_COMPUTE_CUMULATIVE_SYSTEM_STORAGE);
+
+
+template <typename ValueType, typename IndexType>
+void extract_common_systems_pattern(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const gko::matrix::Csr<ValueType, IndexType>* first_sys_csr,
+    const IndexType* system_offsets,
+    IndexType* systems_pattern) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_EXTRACT_PATTERN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_isai(std::shared_ptr<const DefaultExecutor> exec,
+                  const batch::matrix::Csr<ValueType, IndexType>* sys_csr,
+                  const IndexType* system_offsets,
+                  const IndexType* systems_pattern,
+                  ValueType* inverse_values) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_COMPUTE_KERNEL);
+
+
+}  // namespace batch_isai
+}  // namespace dpcpp
+}  // namespace kernels
+}  // namespace gko
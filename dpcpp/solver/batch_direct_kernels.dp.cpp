@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/batch_direct_kernels.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace dpcpp {
+namespace batch_direct {
+
+
+template <typename ValueType, typename IndexType>
+void dense_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                     const batch::matrix::Dense<ValueType>* sys_dense,
+                     ValueType* factors, IndexType* pivots,
+                     bool* singular) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_DENSE_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void dense_solve(std::shared_ptr<const DefaultExecutor> exec,
+                 const ValueType* factors, const IndexType* pivots,
+                 batch::MultiVector<ValueType>* x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_DENSE_SOLVE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void symbolic_factorize(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const gko::matrix::Csr<ValueType, IndexType>* first_sys_csr,
+    array<IndexType>& factor_row_ptrs,
+    array<IndexType>& factor_col_idxs) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SYMBOLIC_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void sparse_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                      const batch::matrix::Csr<ValueType, IndexType>* sys_csr,
+                      const IndexType* factor_row_ptrs,
+                      const IndexType* factor_col_idxs,
+                      const IndexType* diag_locs, const IndexType* update_ptrs,
+                      const IndexType* update_src, const IndexType* update_dst,
+                      ValueType* factors,
+                      bool* singular) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SPARSE_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void sparse_solve(std::shared_ptr<const DefaultExecutor> exec,
+                  const IndexType* factor_row_ptrs,
+                  const IndexType* factor_col_idxs, const IndexType* diag_locs,
+                  const ValueType* factors,
+                  batch::MultiVector<ValueType>* x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SPARSE_SOLVE_KERNEL);
+
+
+}  // namespace batch_direct
+}  // namespace dpcpp
+}  // namespace kernels
+}  // namespace gko
@@ -7,7 +7,10 @@
 
 
 #include <istream>
+#include <memory>
+#include <string>
 
+#include <ginkgo/core/base/device_matrix_data.hpp>
 #include <ginkgo/core/base/matrix_data.hpp>
 
 
@@ -32,6 +35,37 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 matrix_data<ValueType, IndexType> read_raw(std::istream& is);
 
 
+/**
+ * Reads a matrix stored in matrix market format from an input stream into
+ * device_matrix_data on the given executor.
+ *
+ * Compared to read_raw(std::istream&), the remaining content of the stream is
+ * read in blocks of bounded size, which are split at line boundaries and
+ * parsed by multiple threads using std::from_chars. The entries are written
+ * directly into the arrays of the result, without intermediate matrix_data
+ * or a copy of the whole file, and sorted on the executor. This requires every entry of a coordinate matrix
+ * to be stored on a separate line, as is the case for all regular matrix
+ * market files. Matrices in array layout are read sequentially.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param is  input stream from which to read the data
+ * @param exec  the executor on which the matrix data will be stored
+ *
+ * @return A device_matrix_data structure containing the matrix. The nonzero
+ *         elements are sorted in lexicographic order of their (row, column)
+ *         indexes.
+ *
+ * @note This is an advanced routine that will return the raw matrix data
+ *       structure. It can be passed to the read function of a matrix, e.g.
+ *       `mtx->read(gko::read_raw<double, int>(is, exec))`.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+device_matrix_data<ValueType, IndexType> read_raw(
+    std::istream& is, std::shared_ptr<const Executor> exec);
+
+
 /**
  * Reads a matrix stored in Ginkgo's binary matrix format from an input stream.
  * Note that this format depends on the processor's endianness,
@@ -86,6 +120,30 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is);
 
 
+/**
+ * Reads a matrix stored in either binary or matrix market format from an input
+ * stream into device_matrix_data on the given executor. Matrix market files
+ * are parsed in parallel like in read_raw(std::istream&,
+ * std::shared_ptr<const Executor>).
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param is  input stream from which to read the data
+ * @param exec  the executor on which the matrix data will be stored
+ *
+ * @return A device_matrix_data structure containing the matrix. The nonzero
+ *         elements are sorted in lexicographic order of their (row, column)
+ *         indexes.
+ *
+ * @note This is an advanced routine that will return the raw matrix data
+ *       structure. Consider using gko::read_generic instead.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+device_matrix_data<ValueType, IndexType> read_generic_raw(
+    std::istream& is, std::shared_ptr<const Executor> exec);
+
+
 /**
  * Specifies the layout type when writing data in matrix market format.
  */
@@ -223,6 +281,10 @@ template <typename ValueType>
 class Dense;
 
 
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
 class Fft;
 
 
@@ -235,6 +297,63 @@ class Fft3;
 }  // namespace matrix
 
 
+/**
+ * Writes a matrix into Ginkgo's binary CSR format, which can be memory-mapped
+ * by read_binary_csr without any parsing or conversion. Like the binary format
+ * of write_binary_raw, it depends on the processor's endianness.
+ *
+ * The binary CSR format has the following structure (in system endianness):
+ * 1. A 64 byte header consisting of 8 uint64_t values:
+ *    magic = GKOCSR__: The highest two bytes stand for value and index type,
+ *                      encoded as in the binary format of read_binary_raw.
+ *    num_rows: Number of rows
+ *    num_cols: Number of columns
+ *    num_entries: Number of stored elements
+ *    row_ptrs_offset: Offset of the row pointers in the file
+ *    col_idxs_offset: Offset of the column indices in the file
+ *    values_offset: Offset of the values in the file
+ *    file_size: Total size of the file
+ * 2. The num_rows + 1 row pointers, num_entries column indices and num_entries
+ *    values, each stored as a contiguous array starting at its offset. All
+ *    offsets are multiples of 64 bytes, the gaps between the sections are
+ *    filled with zeros.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param os  output stream where the data is to be written
+ * @param mtx  the matrix to be written
+ */
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* mtx);
+
+
+/**
+ * Loads a matrix stored in Ginkgo's binary CSR format (see write_binary_csr)
+ * by mapping the file into memory.
+ *
+ * The arrays of the returned matrix directly use the mapped file content, so
+ * loading takes constant time and pages are only read from disk when they are
+ * first accessed. The pages are mapped copy-on-write, so modifying the matrix
+ * does not modify the file. The mapping is released when the matrix arrays
+ * are destroyed. If `exec` is not a host executor, the arrays are copied to
+ * it and the mapping is released immediately. On platforms without `mmap`,
+ * the file is read into memory instead.
+ *
+ * @tparam ValueType  type of matrix values, must match the file
+ * @tparam IndexType  type of matrix indexes, must match the file
+ *
+ * @param filename  the name of the file to load
+ * @param exec  the executor of the resulting matrix
+ *
+ * @return the loaded matrix
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    const std::string& filename, std::shared_ptr<const Executor> exec);
+
+
 namespace detail {
 
 
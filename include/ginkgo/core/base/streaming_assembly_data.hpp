@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_BASE_STREAMING_ASSEMBLY_DATA_HPP_
+#define GKO_PUBLIC_CORE_BASE_STREAMING_ASSEMBLY_DATA_HPP_
+
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+}  // namespace matrix
+
+
+/**
+ * This structure assembles a sparse matrix in CSR format from a stream of
+ * (row_index, column_index, value) triplets, without ever storing all
+ * triplets at once.
+ *
+ * Triplets are collected in a buffer of bounded size. Whenever the buffer is
+ * full, it is sorted in row-major order, entries with the same position are
+ * summed up, and the result is kept as a sorted run, either in memory or, if a
+ * spill directory is given, in a temporary file in that directory. assemble()
+ * then merges all runs, again summing up entries with the same position,
+ * directly into the arrays of the resulting matrix::Csr. With a spill
+ * directory, the peak memory usage is thus bounded by the size of the
+ * resulting matrix plus the buffer size. Without one, the runs in memory are
+ * merged into a single run whenever the later runs together outgrow the first
+ * one, so they hold little more than twice the number of distinct entries.
+ *
+ * Like matrix_assembly_data::add_value, values added multiple times at the
+ * same position are summed up.
+ *
+ * @tparam ValueType  type of matrix values stored in the structure
+ * @tparam IndexType  type of matrix indexes stored in the structure
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class streaming_assembly_data {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using nonzero_type = matrix_data_entry<value_type, index_type>;
+
+    /**
+     * The default number of triplets buffered before a sorted run is created.
+     */
+    static constexpr size_type default_run_size = size_type{1} << 22;
+
+    /**
+     * Creates an empty assembly structure.
+     *
+     * @param size  the dimensions of the assembled matrix
+     * @param run_size  the maximum number of triplets buffered before they are
+     *                  turned into a sorted run
+     * @param spill_directory  the directory to store sorted runs in. If it is
+     *                         empty, the runs are kept in memory.
+     */
+    explicit streaming_assembly_data(dim<2> size,
+                                     size_type run_size = default_run_size,
+                                     std::string spill_directory = {});
+
+    ~streaming_assembly_data();
+
+    streaming_assembly_data(const streaming_assembly_data&) = delete;
+
+    streaming_assembly_data& operator=(const streaming_assembly_data&) = delete;
+
+    /**
+     * Adds a value at (row, col). If a value at this position was added
+     * before, the values will be summed up.
+     *
+     * @param row  the row where the value should be added
+     * @param col  the column where the value should be added
+     * @param val  the value to be added to (row, col)
+     */
+    void add_value(index_type row, index_type col, value_type val);
+
+    /**
+     * Adds a chunk of triplets stored in host memory.
+     *
+     * @param num_values  the number of triplets in the chunk
+     * @param rows  the row indices of the triplets
+     * @param cols  the column indices of the triplets
+     * @param vals  the values of the triplets
+     */
+    void add_values(size_type num_values, const index_type* rows,
+                    const index_type* cols, const value_type* vals);
+
+    /**
+     * Merges all triplets added so far into a CSR matrix. The structure is
+     * empty afterwards.
+     *
+     * @param exec  the executor of the resulting matrix
+     *
+     * @return the assembled matrix with sorted column indices and without
+     *         duplicate entries
+     */
+    std::unique_ptr<matrix::Csr<value_type, index_type>> assemble(
+        std::shared_ptr<const Executor> exec);
+
+    /** @return the dimensions of the matrix being assembled */
+    dim<2> get_size() const noexcept { return size_; }
+
+    /** @return the number of sorted runs created so far */
+    size_type get_num_runs() const noexcept { return run_sizes_.size(); }
+
+    /**
+     * @return the number of triplets stored in the buffer and all sorted
+     *         runs. Entries at the same position in different runs are
+     *         counted separately.
+     */
+    size_type get_num_stored_elements() const noexcept;
+
+private:
+    /**
+     * Sorts the buffer, sums up duplicates and stores the result as a new run.
+     */
+    void flush_buffer();
+
+    /**
+     * Merges all runs stored in memory into a single run.
+     */
+    void merge_memory_runs();
+
+    std::string get_run_filename(size_type run) const;
+
+    void remove_runs();
+
+    dim<2> size_;
+    size_type run_size_;
+    std::string spill_prefix_;
+    std::vector<nonzero_type> buffer_;
+    std::vector<std::vector<nonzero_type>> memory_runs_;
+    std::vector<size_type> run_sizes_;
+};
+
+
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_BASE_STREAMING_ASSEMBLY_DATA_HPP_
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_BASE_TUNING_CACHE_HPP_
+#define GKO_PUBLIC_CORE_BASE_TUNING_CACHE_HPP_
+
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+
+
+/**
+ * TuningCache stores the results of autotuning runs, mapping a key that
+ * describes the tuning problem (e.g. a matrix fingerprint and the executor)
+ * to the name of the best candidate.
+ *
+ * If the cache is associated with a file, the entries of the file are loaded
+ * on creation, and every new entry is appended to it, so the results can be
+ * reused by later runs of the application. Each line of the file contains a
+ * key and its value, separated by a tab. If a key occurs multiple times, the
+ * last occurrence takes precedence.
+ *
+ * All member functions are thread-safe.
+ */
+class TuningCache {
+public:
+    /**
+     * Returns the value stored for the given key, or nothing if the key is
+     * not in the cache.
+     *
+     * @param key  the key to look up
+     */
+    std::optional<std::string> lookup(const std::string& key) const;
+
+    /**
+     * Stores a value for the given key, overwriting any previous value, and
+     * appends the entry to the cache file.
+     *
+     * @param key  the key, which must not contain tabs or line breaks
+     * @param value  the value, which must not contain line breaks
+     *
+     * @throws StreamError if the cache file can not be written.
+     */
+    void store(const std::string& key, const std::string& value);
+
+    /** Returns the number of entries in the cache. */
+    size_type get_num_entries() const;
+
+    /**
+     * Returns the name of the file backing this cache, or an empty string if
+     * the cache only lives in memory.
+     */
+    const std::string& get_filename() const noexcept { return filename_; }
+
+    /**
+     * Creates a new TuningCache.
+     *
+     * @param filename  the file to load the entries from and store new
+     *                  entries to. If it is empty, the cache only lives in
+     *                  memory. If the file doesn't exist yet, it is created on
+     *                  the first call to store.
+     *
+     * @return a shared_ptr to the new cache
+     */
+    static std::shared_ptr<TuningCache> create(std::string filename = {});
+
+protected:
+    explicit TuningCache(std::string filename);
+
+private:
+    std::string filename_;
+    mutable std::mutex mutex_;
+    std::map<std::string, std::string> entries_;
+};
+
+
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_BASE_TUNING_CACHE_HPP_
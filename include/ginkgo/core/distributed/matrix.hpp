@@ -611,6 +611,62 @@ public:
      */
     void row_scale(ptr_param<const global_vector_type> scaling_factors);
 
+    /**
+     * Starts the split-phase application `x = A * b`.
+     *
+     * Only the exchange of the halo values of `b` is started, the actual
+     * products are computed by apply_end(). Any work that does not modify `b`
+     * or `x` can be scheduled between both calls to overlap it with the
+     * communication, e.g.
+     * ```
+     * A->apply_begin(b, x);
+     * // vector updates, preconditioner applications, other matrices, ...
+     * A->apply_end();
+     * ```
+     * Calling apply_begin followed by apply_end is equivalent to calling
+     * apply.
+     *
+     * @note Contrary to apply, `b` and `x` have to be Vector objects of the
+     *       same value type as this matrix, no implicit conversions are
+     *       performed. At most one split-phase application can be pending
+     *       per matrix, and the operands need to stay alive until apply_end
+     *       returns.
+     *
+     * @param b  the input vector, with the same column partition as this
+     * @param x  the output vector, with the same row partition as this
+     *
+     * @return the request of the halo exchange. It may be tested by the
+     *         caller, but apply_end needs to be called to complete the
+     *         application.
+     */
+    mpi::request& apply_begin(ptr_param<const LinOp> b,
+                              ptr_param<LinOp> x) const;
+
+    /**
+     * Starts the split-phase application `x = alpha * A * b + beta * x`.
+     *
+     * @see apply_begin(ptr_param<const LinOp>, ptr_param<LinOp>)
+     *
+     * @param alpha  a Dense 1x1 scalar
+     * @param b  the input vector, with the same column partition as this
+     * @param beta  a Dense 1x1 scalar
+     * @param x  the output vector, with the same row partition as this
+     *
+     * @return the request of the halo exchange.
+     */
+    mpi::request& apply_begin(ptr_param<const LinOp> alpha,
+                              ptr_param<const LinOp> b,
+                              ptr_param<const LinOp> beta,
+                              ptr_param<LinOp> x) const;
+
+    /**
+     * Completes the split-phase application started by apply_begin.
+     *
+     * This computes the local product, waits for the halo exchange to finish
+     * and then adds the non-local product to the output vector.
+     */
+    void apply_end() const;
+
 protected:
     explicit Matrix(std::shared_ptr<const Executor> exec,
                     mpi::communicator comm);
@@ -647,7 +703,30 @@ protected:
     void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
                     LinOp* x) const override;
 
+    /**
+     * Starts the halo exchange for `x = alpha * A * b + beta * x` and stores
+     * the operands for apply_end_impl. A null alpha and beta denote the
+     * simple application `x = A * b`.
+     */
+    void apply_begin_impl(const LinOp* alpha, const global_vector_type* b,
+                          const LinOp* beta, global_vector_type* x) const;
+
+    /**
+     * Computes the local and non-local products of the application started
+     * by apply_begin_impl.
+     */
+    void apply_end_impl() const;
+
 private:
+    struct split_apply_state {
+        mpi::request request;
+        const LinOp* alpha{};
+        const global_vector_type* b{};
+        const LinOp* beta{};
+        global_vector_type* x{};
+    };
+
+
     std::vector<comm_index_type> send_offsets_;
     std::vector<comm_index_type> send_sizes_;
     std::vector<comm_index_type> recv_offsets_;
@@ -661,6 +740,7 @@ private:
     gko::detail::DenseCache<value_type> recv_buffer_;
     std::shared_ptr<LinOp> local_mtx_;
     std::shared_ptr<LinOp> non_local_mtx_;
+    mutable split_apply_state split_apply_;
 };
 
 
@@ -12,6 +12,8 @@
 #if GINKGO_BUILD_MPI
 
 
+#include <vector>
+
 #include <ginkgo/core/base/dense_cache.hpp>
 #include <ginkgo/core/base/mpi.hpp>
 #include <ginkgo/core/distributed/base.hpp>
@@ -649,6 +651,197 @@ private:
 };
 
 
+/**
+ * FusedReduction computes several independent column-wise reductions of
+ * distributed vectors using a single global reduction.
+ *
+ * Krylov solvers often need multiple dot products or norms that do not depend
+ * on each other, e.g. BiCGSTAB computes `conj(s)^T t` and `conj(t)^T t` back
+ * to back. Computing them through Vector::compute_conj_dot and
+ * Vector::compute_squared_norm2 issues one `MPI_Allreduce` per reduction. This
+ * class instead computes all local contributions into a single packed buffer
+ * and reduces that buffer with one (optionally non-blocking) `MPI_Allreduce`:
+ * ```
+ * FusedReduction<ValueType> reduction{s};
+ * reduction.add_conj_dot(s, t, gamma).add_squared_norm2(t, beta);
+ * reduction.compute(tmp);
+ * ```
+ * The split-phase interface start()/finish() allows overlapping the global
+ * reduction with other work:
+ * ```
+ * auto& req = reduction.start(tmp);
+ * // ... independent work ...
+ * reduction.finish();
+ * ```
+ *
+ * Each FusedReduction owns its packed buffer, so multiple reductions may be
+ * outstanding at the same time. Reusing the same object via clear() avoids
+ * reallocating the buffer for every reduction. Alternatively, the buffers can
+ * be provided by the caller, e.g. from the workspace of a solver that creates
+ * a new FusedReduction in every iteration.
+ *
+ * @note All vectors and results added to the reduction need to stay alive
+ *       until finish() (or compute()) returns, and the results are only valid
+ *       afterwards.
+ *
+ * @tparam ValueType  The precision of the vector elements.
+ */
+template <typename ValueType = double>
+class FusedReduction {
+public:
+    using value_type = ValueType;
+    using absolute_type = remove_complex<ValueType>;
+    using vector_type = Vector<ValueType>;
+
+    /**
+     * Creates an empty fused reduction. The executor and communicator are
+     * taken from the given vector.
+     *
+     * @param vector  a vector that is part of the reduction
+     */
+    explicit FusedReduction(ptr_param<const vector_type> vector);
+
+    /**
+     * Creates an empty fused reduction that stores its packed buffers in the
+     * given arrays instead of its own ones. The arrays are only reallocated if
+     * their size or executor doesn't fit, so they can be reused across
+     * multiple FusedReduction objects.
+     *
+     * @param vector  a vector that is part of the reduction
+     * @param buffer  the array to store the packed local and global values in
+     * @param host_buffer  the array to store the packed values in on the host,
+     *                     if the MPI implementation can't access the memory of
+     *                     the executor
+     */
+    FusedReduction(ptr_param<const vector_type> vector,
+                   array<absolute_type>& buffer,
+                   array<absolute_type>& host_buffer);
+
+    /**
+     * Adds the column-wise dot product of `a` and `b` to the reduction.
+     *
+     * @param a  the left operand
+     * @param b  a (multi-)vector of same dimension as a
+     * @param result  a Dense row matrix, used to store the dot product
+     *                (the number of columns in result must match the number
+     *                of columns of a)
+     *
+     * @return this object, to allow chaining
+     */
+    FusedReduction& add_dot(ptr_param<const vector_type> a,
+                            ptr_param<const vector_type> b,
+                            ptr_param<LinOp> result);
+
+    /**
+     * Adds the column-wise dot product of `conj(a)` and `b` to the reduction.
+     *
+     * @param a  the left operand, which will be conjugated
+     * @param b  a (multi-)vector of same dimension as a
+     * @param result  a Dense row matrix, used to store the dot product
+     *                (the number of columns in result must match the number
+     *                of columns of a)
+     *
+     * @return this object, to allow chaining
+     */
+    FusedReduction& add_conj_dot(ptr_param<const vector_type> a,
+                                 ptr_param<const vector_type> b,
+                                 ptr_param<LinOp> result);
+
+    /**
+     * Adds the square of the column-wise Euclidean norm of `a` to the
+     * reduction.
+     *
+     * @param a  the (multi-)vector to compute the norm of
+     * @param result  a real Dense row matrix, used to store the norm
+     *                (the number of columns in result must match the number
+     *                of columns of a)
+     *
+     * @return this object, to allow chaining
+     */
+    FusedReduction& add_squared_norm2(ptr_param<const vector_type> a,
+                                      ptr_param<LinOp> result);
+
+    /**
+     * Adds the column-wise Euclidean norm of `a` to the reduction.
+     *
+     * @param a  the (multi-)vector to compute the norm of
+     * @param result  a real Dense row matrix, used to store the norm
+     *                (the number of columns in result must match the number
+     *                of columns of a)
+     *
+     * @return this object, to allow chaining
+     */
+    FusedReduction& add_norm2(ptr_param<const vector_type> a,
+                              ptr_param<LinOp> result);
+
+    /**
+     * Computes the local contributions of all reductions and starts the
+     * global reduction without waiting for its completion.
+     *
+     * @param tmp  the temporary storage to use for partial sums during the
+     *             local reductions. It may be resized and/or reset to the
+     *             correct executor.
+     *
+     * @return the request of the pending global reduction. It may be tested
+     *         or waited on by the caller, but finish() needs to be called
+     *         before the results can be used.
+     */
+    mpi::request& start(array<char>& tmp);
+
+    /**
+     * Waits for the global reduction started by start() to complete and
+     * writes the reduced values into the results.
+     */
+    void finish();
+
+    /**
+     * Computes all reductions using a single blocking global reduction.
+     * This is equivalent to calling start() followed by finish().
+     *
+     * @param tmp  the temporary storage to use for partial sums during the
+     *             local reductions. It may be resized and/or reset to the
+     *             correct executor.
+     */
+    void compute(array<char>& tmp);
+
+    /**
+     * Removes all reductions, so the object can be reused for a new set of
+     * reductions.
+     */
+    void clear();
+
+private:
+    enum class reduction_kind { dot, conj_dot, squared_norm2, norm2 };
+
+    struct reduction_entry {
+        reduction_kind kind;
+        const vector_type* a;
+        const vector_type* b;
+        LinOp* result;
+        size_type offset;
+    };
+
+    FusedReduction& add(reduction_kind kind, const vector_type* a,
+                        const vector_type* b, LinOp* result);
+
+    array<absolute_type>& get_buffer();
+
+    array<absolute_type>& get_host_buffer();
+
+    std::shared_ptr<const Executor> exec_;
+    mpi::communicator comm_;
+    std::vector<reduction_entry> entries_;
+    array<absolute_type> buffer_;
+    array<absolute_type> host_buffer_;
+    // the buffers provided by the caller, or nullptr to use the own ones
+    array<absolute_type>* external_buffer_;
+    array<absolute_type>* external_host_buffer_;
+    size_type buffer_size_;
+    bool uses_host_buffer_;
+    mpi::request request_;
+};
+
+
 }  // namespace distributed
 }  // namespace experimental
 
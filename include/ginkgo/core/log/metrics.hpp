@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_LOG_METRICS_HPP_
+#define GKO_PUBLIC_CORE_LOG_METRICS_HPP_
+
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ginkgo/core/log/logger.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * The counters collected by a Metrics logger.
+ *
+ * @ingroup log
+ */
+enum class metric : uint8 {
+    /**
+     * Applications of a Dense, Csr, Coo or Ell matrix, counting the advanced
+     * apply and applies inside other LinOps.
+     */
+    spmvs,
+    /**
+     * Bytes read and written by the counted SpMVs, as estimated by the work
+     * model of ProfilerHook.
+     */
+    spmv_bytes,
+    /** Memory allocations. */
+    allocations,
+    /** Bytes allocated. */
+    allocated_bytes,
+    /** Copies between or within memory spaces. */
+    copies,
+    /** Bytes copied. */
+    copied_bytes,
+    /** Operations (kernels) run on an executor. */
+    operations,
+    /** Completed iterative solves. */
+    solves,
+    /** Iterations of all iterative solvers. */
+    iterations,
+    /**
+     * Completed iterative solves where at least one right-hand side stopped
+     * without converging.
+     */
+    convergence_failures,
+    /** Calls to LinOpFactory::generate. */
+    generates,
+    /** Time spent in outermost LinOpFactory::generate calls in nanoseconds. */
+    generate_time,
+    /** Time spent in outermost LinOp applies in nanoseconds. */
+    apply_time
+};
+
+
+/**
+ * Metrics is a Logger which maintains a set of monotonically increasing
+ * counters about the work done by Ginkgo, e.g. for exporting them to a
+ * monitoring system.
+ *
+ * In contrast to Record or Tracer, Metrics only stores the counters listed in
+ * metric, and is cheap enough to stay enabled all the time: Each thread
+ * increments its own set of atomic counters without taking a lock. Reading a
+ * counter sums up the values of all threads, so it can be done at any time,
+ * concurrently to the threads updating them.
+ *
+ * The logger needs to be attached to the executors, which forward the events
+ * of all objects on them.
+ *
+ * @note The generate and apply times are measured on the host without
+ *       synchronizing the executor, so for asynchronous executors, they only
+ *       contain the time until the last kernel was launched. If an apply or
+ *       generate call contains other calls, e.g. the applies of a solver, only
+ *       the outermost call is timed, so time spent in a LinOp apply during
+ *       generate is counted for both generate and apply. The time of a call
+ *       that threw an exception is only counted as part of its enclosing
+ *       call.
+ *
+ * @ingroup log
+ */
+class Metrics : public Logger {
+public:
+    /** The number of metric values. */
+    static constexpr int num_metrics = 13;
+
+    static_assert(num_metrics == static_cast<int>(metric::apply_time) + 1,
+                  "num_metrics needs to match the number of metric values");
+
+    void on_allocation_completed(const Executor* exec,
+                                 const size_type& num_bytes,
+                                 const uintptr& location) const override;
+
+    void on_copy_completed(const Executor* from, const Executor* to,
+                           const uintptr& location_from,
+                           const uintptr& location_to,
+                           const size_type& num_bytes) const override;
+
+    void on_operation_launched(const Executor* exec,
+                               const Operation* op) const override;
+
+    void on_linop_apply_started(const LinOp* A, const LinOp* b,
+                                const LinOp* x) const override;
+
+    void on_linop_apply_completed(const LinOp* A, const LinOp* b,
+                                  const LinOp* x) const override;
+
+    void on_linop_advanced_apply_started(const LinOp* A, const LinOp* alpha,
+                                         const LinOp* b, const LinOp* beta,
+                                         const LinOp* x) const override;
+
+    void on_linop_advanced_apply_completed(const LinOp* A, const LinOp* alpha,
+                                           const LinOp* b, const LinOp* beta,
+                                           const LinOp* x) const override;
+
+    void on_linop_factory_generate_started(const LinOpFactory* factory,
+                                           const LinOp* input) const override;
+
+    void on_linop_factory_generate_completed(
+        const LinOpFactory* factory, const LinOp* input,
+        const LinOp* output) const override;
+
+    void on_iteration_complete(const LinOp* solver, const LinOp* b,
+                               const LinOp* x, const size_type& it,
+                               const LinOp* r, const LinOp* tau,
+                               const LinOp* implicit_tau_sq,
+                               const array<stopping_status>* status,
+                               bool stopped) const override;
+
+    bool needs_propagation() const override { return true; }
+
+    /**
+     * Returns the current value of a counter, summed over all threads.
+     *
+     * @param m  the counter to read
+     */
+    int64 get_value(metric m) const;
+
+    /**
+     * Returns the current values of all counters, summed over all threads,
+     * by their name.
+     */
+    std::map<std::string, int64> get_snapshot() const;
+
+    /**
+     * Writes the current values of all counters as a JSON object, with the
+     * names of the counters as keys.
+     *
+     * @param os  the stream to write the counters to
+     */
+    void write_json(std::ostream& os) const;
+
+    /** Returns the name of a counter, as used in the snapshot and JSON. */
+    static const char* get_metric_name(metric m);
+
+    /**
+     * Creates a Metrics logger. This dynamically allocates the memory,
+     * constructs the object and returns an std::unique_ptr to this object.
+     *
+     * @return an std::unique_ptr to the the constructed object
+     */
+    static std::unique_ptr<Metrics> create()
+    {
+        return std::unique_ptr<Metrics>(new Metrics());
+    }
+
+    ~Metrics() override;
+
+protected:
+    Metrics();
+
+private:
+    struct thread_counters;
+
+    thread_counters* get_thread_counters() const;
+
+    void apply_started(const LinOp* A) const;
+
+    void apply_completed(const LinOp* A, const LinOp* b, bool advanced) const;
+
+    uint64 id_;
+    mutable std::mutex mutex_;
+    mutable std::vector<std::unique_ptr<thread_counters>> counters_;
+    static constexpr Logger::mask_type mask_ =
+        Logger::allocation_completed_mask | Logger::copy_completed_mask |
+        Logger::operation_launched_mask | Logger::linop_events_mask |
+        Logger::linop_factory_events_mask | Logger::iteration_complete_mask;
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_LOG_METRICS_HPP_
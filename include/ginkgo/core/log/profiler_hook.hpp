@@ -245,6 +245,35 @@ public:
     static std::shared_ptr<ProfilerHook> create_for_executor(
         std::shared_ptr<const Executor> exec);
 
+    /** Hardware performance counter values of a range. */
+    struct hardware_counters {
+        /** The number of CPU cycles. */
+        int64 cycles{};
+        /** The number of retired instructions. */
+        int64 instructions{};
+        /** The number of last-level cache misses. */
+        int64 llc_misses{};
+    };
+
+    /** The modeled amount of work done inside a range. */
+    struct work_estimate {
+        /** The number of bytes that need to be read or written at least. */
+        int64 bytes{};
+        /** The number of floating point operations. */
+        int64 flops{};
+    };
+
+    /**
+     * The peak performance of a machine, used for roofline summaries. Zero
+     * values stand for unknown peak performance.
+     */
+    struct roofline_peak {
+        /** The peak memory bandwidth in GB/s. */
+        double bandwidth;
+        /** The peak floating point performance in GFLOP/s. */
+        double flops;
+    };
+
     struct summary_entry {
         /** The name of the range. */
         std::string name;
@@ -257,6 +286,16 @@ public:
         std::chrono::nanoseconds exclusive{0};
         /** The total number of invocations of the range. */
         int64 count{};
+        /**
+         * The hardware counters of all invocations of the range, including
+         * nested ranges. They are only collected by create_perf_summary().
+         */
+        hardware_counters counters{};
+        /**
+         * The modeled work of all invocations of the range, including nested
+         * ranges. It is only collected by create_perf_summary().
+         */
+        work_estimate work{};
     };
 
     struct nested_summary_entry {
@@ -270,6 +309,25 @@ public:
         std::vector<nested_summary_entry> children{};
     };
 
+    struct memory_summary_entry {
+        /** The name of the range. */
+        std::string name;
+        /**
+         * The largest amount of memory in bytes that was allocated at the
+         * same time during any invocation of the range, in addition to the
+         * memory that was already allocated when the range began.
+         */
+        int64 peak_bytes{};
+        /** The total number of bytes allocated in all invocations. */
+        int64 allocated_bytes{};
+        /** The total number of allocations in all invocations. */
+        int64 num_allocations{};
+        /** The total number of invocations of the range. */
+        int64 count{};
+        /** The nested ranges inside this range. */
+        std::vector<memory_summary_entry> children{};
+    };
+
     /** Receives the results from ProfilerHook::create_summary(). */
     class SummaryWriter {
     public:
@@ -300,22 +358,48 @@ public:
                                   std::chrono::nanoseconds overhead) = 0;
     };
 
+    /** Receives the results from ProfilerHook::create_memory_summary(). */
+    class MemorySummaryWriter {
+    public:
+        virtual ~MemorySummaryWriter() = default;
+
+        /**
+         * Callback to write out the summary results. It is called once for
+         * every executor that allocated memory.
+         *
+         * @param executor  the name of the executor.
+         * @param root  the root range with the memory usage on this executor.
+         */
+        virtual void write_memory(const std::string& executor,
+                                  const memory_summary_entry& root) = 0;
+    };
+
     /**
-     * Writes the results from ProfilerHook::create_summary() and
-     * ProfilerHook::create_nested_summary() to a ASCII table in Markdown
+     * Writes the results from ProfilerHook::create_summary(),
+     * ProfilerHook::create_nested_summary() and
+     * ProfilerHook::create_memory_summary() to a ASCII table in Markdown
      * format.
+     *
+     * If the entries contain hardware counters or modeled work, a second
+     * table with the achieved instructions per cycle, memory bandwidth and
+     * floating point performance of each range follows. If the peak
+     * performance of the machine is provided, it also contains the fraction
+     * of the peak bandwidth and of the roofline bound that was achieved.
      */
     class TableSummaryWriter : public SummaryWriter,
-                               public NestedSummaryWriter {
+                               public NestedSummaryWriter,
+                               public MemorySummaryWriter {
     public:
         /**
          * Constructs a writer on an output stream.
          *
          * @param output  the output stream to write the table to.
          * @param header  the header to write above the table.
+         * @param peak  the peak performance of the machine.
          */
         TableSummaryWriter(std::ostream& output = std::cerr,
-                           std::string header = "Runtime summary");
+                           std::string header = "Runtime summary",
+                           roofline_peak peak = {});
 
         void write(const std::vector<summary_entry>& entries,
                    std::chrono::nanoseconds overhead) override;
@@ -323,9 +407,13 @@ public:
         void write_nested(const nested_summary_entry& root,
                           std::chrono::nanoseconds overhead) override;
 
+        void write_memory(const std::string& executor,
+                          const memory_summary_entry& root) override;
+
     private:
         std::ostream* output_;
         std::string header_;
+        roofline_peak peak_;
     };
 
     /**
@@ -350,6 +438,35 @@ public:
             std::make_unique<TableSummaryWriter>(),
         bool debug_check_nesting = false);
 
+    /**
+     * Creates a logger measuring the runtime, hardware counters and modeled
+     * work of Ginkgo events and printing a summary when it is destroyed.
+     *
+     * The hardware counters (cycles, instructions and last-level cache
+     * misses) are read through the Linux `perf_event_open` interface. They
+     * only count the events of the thread that created the logger, so the
+     * work of other OpenMP threads is not included. If the counters are not
+     * available, e.g. on other operating systems or due to a restrictive
+     * `perf_event_paranoid` setting, they are reported as zero.
+     *
+     * The work of LinOp applies is modeled for Dense, Csr, Coo and Ell
+     * matrices as the number of floating point operations and the number of
+     * bytes of the matrix and vectors that need to be read or written.
+     *
+     * @param timer  The timer used to record time points.
+     * @param writer  The SummaryWriter to receive the performance results.
+     * @param debug_check_nesting  Enable this flag if the output looks like it
+     *                             might contain incorrect nesting. This
+     *                             increases the overhead slightly, but
+     *                             recognizes mismatching push/pop pairs on the
+     *                             range stack.
+     */
+    static std::shared_ptr<ProfilerHook> create_perf_summary(
+        std::shared_ptr<Timer> timer = std::make_shared<CpuTimer>(),
+        std::unique_ptr<SummaryWriter> writer =
+            std::make_unique<TableSummaryWriter>(),
+        bool debug_check_nesting = false);
+
     /**
      * Creates a logger measuring the runtime of Ginkgo events in a nested
      * fashion and printing a summary when it is destroyed.
@@ -373,6 +490,30 @@ public:
             std::make_unique<TableSummaryWriter>(),
         bool debug_check_nesting = false);
 
+    /**
+     * Creates a logger tracking the memory allocated on each executor in a
+     * nested fashion and printing a summary when it is destroyed.
+     *
+     * For each range, like the generation or application of a solver or
+     * preconditioner, the summary contains the peak amount of memory that
+     * was allocated inside of it. The allocations and frees themselves do not
+     * create separate ranges.
+     *
+     * @param writer  The MemorySummaryWriter to receive the results.
+     * @param debug_check_nesting  Enable this flag if the output looks like it
+     *                             might contain incorrect nesting. This
+     *                             increases the overhead slightly, but
+     *                             recognizes mismatching push/pop pairs on the
+     *                             range stack.
+     *
+     * @note Memory that was allocated before the logger was created is not
+     *       tracked, and freeing it has no effect on the summary.
+     */
+    static std::shared_ptr<ProfilerHook> create_memory_summary(
+        std::unique_ptr<MemorySummaryWriter> writer =
+            std::make_unique<TableSummaryWriter>(std::cerr, "Memory summary"),
+        bool debug_check_nesting = false);
+
     /**
      * Creates a logger annotating Ginkgo events with a custom set of functions
      * for range begin and end.
@@ -381,7 +522,19 @@ public:
                                                        hook_function end);
 
 private:
-    ProfilerHook(hook_function begin, hook_function end);
+    using work_function = std::function<void(const work_estimate&)>;
+
+    using allocation_function =
+        std::function<void(const Executor*, uintptr, size_type)>;
+
+    using free_function = std::function<void(const Executor*, uintptr)>;
+
+    ProfilerHook(hook_function begin, hook_function end,
+                 work_function work = {}, allocation_function allocate = {},
+                 free_function free = {});
+
+    void annotate_apply_work(const LinOp* A, const LinOp* b,
+                             bool advanced) const;
 
     void maybe_synchronize(const Executor* exec) const;
 
@@ -391,6 +544,9 @@ private:
     bool synchronize_;
     hook_function begin_hook_;
     hook_function end_hook_;
+    work_function work_hook_;
+    allocation_function allocation_hook_;
+    free_function free_hook_;
 };
 
 
@@ -0,0 +1,233 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_LOG_SOLVER_TIMELINE_HPP_
+#define GKO_PUBLIC_CORE_LOG_SOLVER_TIMELINE_HPP_
+
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <ginkgo/core/log/logger.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * The categories a SolverTimeline attributes the time of a solver iteration
+ * to.
+ *
+ * @ingroup log
+ */
+enum class timeline_category : uint8 {
+    /** Applications of the solver's system matrix. */
+    spmv,
+    /** Applications of the solver's preconditioner. */
+    preconditioner,
+    /** Dot products and norms computed locally. */
+    reduction,
+    /**
+     * Global reductions of distributed vectors, including the time spent
+     * waiting for the other processes.
+     */
+    communication,
+    /** All other kernels, mostly vector updates. */
+    vector_update,
+    /** Other LinOp applications and time not covered by any kernel. */
+    other
+};
+
+
+/**
+ * SolverTimeline is a Logger which records how much time an iterative solver
+ * spends in each iteration, and how that time is split into the
+ * timeline_category values.
+ *
+ * The logger needs to be attached to the executor of the solver, which
+ * forwards the events of all objects on it. The outermost solver applied
+ * while it is attached is tracked: Applications of its system matrix and
+ * preconditioner are attributed to the spmv and preconditioner categories,
+ * including everything that happens inside of them. Other LinOp applications
+ * are attributed to the other category. All operations running directly
+ * inside the solver are classified by their registered kernel name: dot
+ * products and norms are reductions, the global reductions of
+ * experimental::distributed::Vector are communication, all others are vector
+ * updates.
+ *
+ * The timeline contains one row per call to `on_iteration_complete` of the
+ * tracked solver. It holds the time since the previous row (or the start of
+ * the apply), so the row for iteration 0 contains the setup of the solver
+ * (e.g. the initial residual), and row `i` contains iteration `i`. The data is
+ * stored column-wise, and can be written as CSV or JSON for correlating it with
+ * the convergence history.
+ *
+ * @note To get meaningful timings for asynchronous executors, the executor is
+ *       synchronized after every kernel and LinOp application.
+ *
+ * @ingroup log
+ */
+class SolverTimeline : public Logger {
+public:
+    /** The number of timeline_category values. */
+    static constexpr int num_categories = 6;
+
+    void on_operation_launched(const Executor* exec,
+                               const Operation* op) const override;
+
+    void on_operation_completed(const Executor* exec,
+                                const Operation* op) const override;
+
+    void on_linop_apply_started(const LinOp* A, const LinOp* b,
+                                const LinOp* x) const override;
+
+    void on_linop_apply_completed(const LinOp* A, const LinOp* b,
+                                  const LinOp* x) const override;
+
+    void on_linop_advanced_apply_started(const LinOp* A, const LinOp* alpha,
+                                         const LinOp* b, const LinOp* beta,
+                                         const LinOp* x) const override;
+
+    void on_linop_advanced_apply_completed(const LinOp* A, const LinOp* alpha,
+                                           const LinOp* b, const LinOp* beta,
+                                           const LinOp* x) const override;
+
+    void on_iteration_complete(const LinOp* solver, const LinOp* b,
+                               const LinOp* x, const size_type& it,
+                               const LinOp* r, const LinOp* tau,
+                               const LinOp* implicit_tau_sq,
+                               const array<stopping_status>* status,
+                               bool stopped) const override;
+
+    bool needs_propagation() const override { return true; }
+
+    /** Returns the number of recorded rows. */
+    size_type get_num_rows() const noexcept { return iterations_.size(); }
+
+    /**
+     * Returns the index of the solver apply each row belongs to, counting
+     * from 0 for the first apply the logger observed.
+     */
+    const std::vector<size_type>& get_solves() const noexcept
+    {
+        return solves_;
+    }
+
+    /** Returns the iteration count of each row. */
+    const std::vector<size_type>& get_iterations() const noexcept
+    {
+        return iterations_;
+    }
+
+    /** Returns the total time of each row in nanoseconds. */
+    const std::vector<int64>& get_total_times() const noexcept
+    {
+        return totals_;
+    }
+
+    /** Returns the time of each row spent in a category in nanoseconds. */
+    const std::vector<int64>& get_times(timeline_category category) const
+    {
+        return times_[static_cast<int>(category)];
+    }
+
+    /**
+     * Returns the residual norm of the first right-hand side for each row.
+     * It is taken from the residual norm passed to the logger, or computed
+     * from the residual if only that is available, or NaN otherwise.
+     */
+    const std::vector<double>& get_residual_norms() const noexcept
+    {
+        return residual_norms_;
+    }
+
+    /**
+     * Returns the square root of the implicit squared residual norm of the
+     * first right-hand side for each row, or NaN if it is not available. For
+     * preconditioned solvers, this is usually a norm of the preconditioned
+     * residual instead of the residual.
+     */
+    const std::vector<double>& get_implicit_residual_norms() const noexcept
+    {
+        return implicit_residual_norms_;
+    }
+
+    /** Removes all recorded rows. */
+    void clear();
+
+    /**
+     * Writes the timeline as CSV, with one line per row and times in
+     * nanoseconds.
+     *
+     * @param os  the stream to write the timeline to
+     */
+    void write_csv(std::ostream& os) const;
+
+    /**
+     * Writes the timeline as a JSON object containing one array per column,
+     * with times in nanoseconds.
+     *
+     * @param os  the stream to write the timeline to
+     */
+    void write_json(std::ostream& os) const;
+
+    /**
+     * Returns the name of a category, as used for the CSV and JSON columns.
+     */
+    static const char* get_category_name(timeline_category category);
+
+    /**
+     * Creates a SolverTimeline logger. This dynamically allocates the memory,
+     * constructs the object and returns an std::unique_ptr to this object.
+     *
+     * @return an std::unique_ptr to the the constructed object
+     */
+    static std::unique_ptr<SolverTimeline> create()
+    {
+        return std::unique_ptr<SolverTimeline>(new SolverTimeline());
+    }
+
+protected:
+    SolverTimeline();
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    void begin_range(timeline_category category) const;
+
+    void end_range(const Executor* exec) const;
+
+    mutable std::vector<size_type> solves_;
+    mutable std::vector<size_type> iterations_;
+    mutable std::vector<int64> totals_;
+    mutable std::array<std::vector<int64>, num_categories> times_;
+    mutable std::vector<double> residual_norms_;
+    mutable std::vector<double> implicit_residual_norms_;
+
+    // state of the currently tracked solver apply
+    mutable const LinOp* solver_;
+    mutable const LinOp* system_matrix_;
+    mutable const LinOp* preconditioner_;
+    mutable size_type num_solves_;
+    // number of enclosing applies or operations inside the tracked solver
+    mutable int depth_;
+    mutable timeline_category range_category_;
+    mutable clock::time_point range_begin_;
+    mutable clock::time_point row_begin_;
+    mutable std::array<int64, num_categories> row_times_;
+    static constexpr Logger::mask_type mask_ = Logger::operation_events_mask |
+                                               Logger::linop_events_mask |
+                                               Logger::iteration_complete_mask;
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_LOG_SOLVER_TIMELINE_HPP_
@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_LOG_TRACER_HPP_
+#define GKO_PUBLIC_CORE_LOG_TRACER_HPP_
+
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <typeinfo>
+#include <vector>
+
+#include <ginkgo/core/log/logger.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * The kind of an event recorded by a Tracer.
+ *
+ * @ingroup log
+ */
+enum class trace_event_kind : uint8 {
+    allocation,
+    free,
+    copy,
+    operation_begin,
+    operation_end,
+    apply_begin,
+    apply_end,
+    generate_begin,
+    generate_end,
+    iteration
+};
+
+
+/**
+ * A single event recorded by a Tracer.
+ *
+ * The event is a plain struct of fixed size, so recording it never allocates
+ * memory or copies any of the objects involved in the event.
+ *
+ * @ingroup log
+ */
+struct trace_event {
+    /** Maximum length of the stored operation name, including the `\0`. */
+    static constexpr int max_name_length = 48;
+
+    /** Time since the creation of the Tracer in nanoseconds. */
+    int64 timestamp;
+
+    /** Index of the thread that recorded the event. */
+    int32 thread;
+
+    /** The kind of the event. */
+    trace_event_kind kind;
+
+    /**
+     * The object the event refers to: the executor for allocations, frees
+     * and copies and operations, the LinOp for applies, the factory for
+     * generate events and the solver for iterations.
+     */
+    const void* object;
+
+    /**
+     * The dynamic type of the LinOp or factory for apply and generate events,
+     * `nullptr` otherwise. The type name is only demangled on export.
+     */
+    const std::type_info* type;
+
+    /**
+     * Event-specific sizes: the number of bytes and the memory location for
+     * allocations, frees and copies, the size of the LinOp for applies, the
+     * size of the input for generate events and the iteration count for
+     * iterations.
+     */
+    size_type size[2];
+
+    /** The (possibly truncated) name of the operation for operation events. */
+    char name[max_name_length];
+};
+
+
+/**
+ * Tracer is a Logger which keeps a flight recorder of the most recent
+ * events (allocations, frees, copies, operations, LinOp applies, factory
+ * generate calls and solver iterations) and exports them as a Chrome trace,
+ * which can be viewed in `chrome://tracing` or https://ui.perfetto.dev.
+ *
+ * In contrast to Record, the Tracer is cheap enough to stay enabled all the
+ * time: Each thread writes fixed-size trace_event entries into its own ring
+ * buffer of fixed capacity, without taking a lock, allocating memory or
+ * cloning the involved objects. Once a ring buffer is full, the oldest events
+ * of that thread are overwritten.
+ *
+ * The events can be read while other threads are still recording. Events
+ * that were overwritten while being read are dropped from the output.
+ *
+ * @note Since the objects are not cloned, the trace only contains their
+ *       addresses and dynamic types, not their contents.
+ *
+ * @ingroup log
+ */
+class Tracer : public Logger {
+public:
+    void on_allocation_completed(const Executor* exec,
+                                 const size_type& num_bytes,
+                                 const uintptr& location) const override;
+
+    void on_free_completed(const Executor* exec,
+                           const uintptr& location) const override;
+
+    void on_copy_completed(const Executor* from, const Executor* to,
+                           const uintptr& location_from,
+                           const uintptr& location_to,
+                           const size_type& num_bytes) const override;
+
+    void on_operation_launched(const Executor* exec,
+                               const Operation* op) const override;
+
+    void on_operation_completed(const Executor* exec,
+                                const Operation* op) const override;
+
+    void on_linop_apply_started(const LinOp* A, const LinOp* b,
+                                const LinOp* x) const override;
+
+    void on_linop_apply_completed(const LinOp* A, const LinOp* b,
+                                  const LinOp* x) const override;
+
+    void on_linop_advanced_apply_started(const LinOp* A, const LinOp* alpha,
+                                         const LinOp* b, const LinOp* beta,
+                                         const LinOp* x) const override;
+
+    void on_linop_advanced_apply_completed(const LinOp* A, const LinOp* alpha,
+                                           const LinOp* b, const LinOp* beta,
+                                           const LinOp* x) const override;
+
+    void on_linop_factory_generate_started(const LinOpFactory* factory,
+                                           const LinOp* input) const override;
+
+    void on_linop_factory_generate_completed(
+        const LinOpFactory* factory, const LinOp* input,
+        const LinOp* output) const override;
+
+    void on_iteration_complete(const LinOp* solver, const LinOp* b,
+                               const LinOp* x, const size_type& it,
+                               const LinOp* r, const LinOp* tau,
+                               const LinOp* implicit_tau_sq,
+                               const array<stopping_status>* status,
+                               bool stopped) const override;
+
+    bool needs_propagation() const override { return true; }
+
+    /**
+     * Returns the recorded events of all threads, sorted by their timestamp.
+     *
+     * @param window  only return events that are at most this old
+     */
+    std::vector<trace_event> get_events(
+        std::chrono::nanoseconds window = std::chrono::nanoseconds::max())
+        const;
+
+    /**
+     * Writes the recorded events in the Chrome trace event JSON format.
+     *
+     * Operations, applies and generate calls become duration events, all
+     * other events become instant events with their sizes as arguments. Each
+     * recording thread becomes a separate track.
+     *
+     * @param os  the stream to write the trace to
+     * @param window  only write events that are at most this old
+     */
+    void write_chrome_trace(std::ostream& os,
+                            std::chrono::nanoseconds window =
+                                std::chrono::nanoseconds::max()) const;
+
+    /**
+     * Returns the number of events each thread can store before its oldest
+     * events are overwritten.
+     */
+    size_type get_capacity() const noexcept { return capacity_; }
+
+    /**
+     * Creates a Tracer logger. This dynamically allocates the memory,
+     * constructs the object and returns an std::unique_ptr to this object.
+     *
+     * @param capacity  the number of events stored per thread
+     * @param enabled_events  the events that should be recorded
+     *
+     * @return an std::unique_ptr to the the constructed object
+     */
+    static std::unique_ptr<Tracer> create(
+        size_type capacity = 65536, const mask_type& enabled_events = mask_)
+    {
+        return std::unique_ptr<Tracer>(new Tracer(capacity, enabled_events));
+    }
+
+    ~Tracer() override;
+
+protected:
+    explicit Tracer(size_type capacity, const mask_type& enabled_events);
+
+private:
+    struct thread_buffer;
+
+    thread_buffer* get_thread_buffer() const;
+
+    void record(trace_event_kind kind, const void* object,
+                const std::type_info* type, size_type size0, size_type size1,
+                const char* name = nullptr) const;
+
+    int64 get_timestamp() const;
+
+    uint64 id_;
+    size_type capacity_;
+    std::chrono::steady_clock::time_point start_;
+    mutable std::mutex mutex_;
+    mutable std::vector<std::unique_ptr<thread_buffer>> buffers_;
+    static constexpr Logger::mask_type mask_ =
+        Logger::allocation_completed_mask | Logger::free_completed_mask |
+        Logger::copy_completed_mask | Logger::operation_events_mask |
+        Logger::linop_events_mask | Logger::linop_factory_events_mask |
+        Logger::iteration_complete_mask;
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_LOG_TRACER_HPP_
@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_AUTO_FORMAT_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_AUTO_FORMAT_HPP_
+
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/tuning_cache.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+/**
+ * AutoFormat is a sparse matrix that transparently selects the fastest
+ * storage format and kernel variant for its sparsity pattern and executor.
+ *
+ * On first use, i.e. the first apply or an explicit call to tune(), it
+ * converts the Csr matrix it was created from to each candidate format,
+ * measures the runtime of a single-vector SpMV with each of them, and from
+ * then on forwards all applications to the fastest one. The candidates are
+ *
+ * - `csr` with the default strategy on CPU executors, or `csr_classical`,
+ *   `csr_merge_path`, `csr_load_balance` and `csr_sparselib` (the vendor
+ *   library) on GPU executors,
+ * - `coo`,
+ * - `ell`, unless its padding would more than triple the storage,
+ * - `hybrid` with its automatic strategy, `hybrid_imbalance_limit` with the
+ *   imbalance_limit strategy and `hybrid_minimal_storage` with the
+ *   minimal_storage_limit strategy, and
+ * - `sellp` with the default slice size, and `sellp_32` and `sellp_8` with a
+ *   slice size of 32 and 8.
+ *
+ * The result can be stored in a TuningCache, keyed by the fingerprint of the
+ * matrix (see get_fingerprint()). If the cache already contains an entry for
+ * the fingerprint, the matrix is converted to the cached format without
+ * timing any candidates. If the cache is backed by a file, this allows
+ * reusing the tuning results between runs of the application.
+ *
+ * @note The timings are taken with a single right-hand side, so the selection
+ *       may not be optimal for applications to many right-hand sides.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class AutoFormat : public EnableLinOp<AutoFormat<ValueType, IndexType>> {
+    friend class EnablePolymorphicObject<AutoFormat, LinOp>;
+
+public:
+    using EnableLinOp<AutoFormat>::convert_to;
+    using EnableLinOp<AutoFormat>::move_to;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using csr_type = Csr<ValueType, IndexType>;
+
+    /**
+     * Selects the format, either from the tuning cache or by timing all
+     * candidates. This is called automatically by the first apply, and does
+     * nothing if the format was already selected.
+     */
+    void tune() const;
+
+    /**
+     * Returns the name of the selected format, or an empty string if the
+     * format has not been selected yet.
+     */
+    std::string get_selected_format() const;
+
+    /**
+     * Returns the operator in the selected format, or `nullptr` if the format
+     * has not been selected yet.
+     */
+    std::shared_ptr<const LinOp> get_selected_operator() const;
+
+    /** Returns the Csr matrix the format is selected for. */
+    std::shared_ptr<const csr_type> get_source() const noexcept
+    {
+        return source_;
+    }
+
+    /** Returns the cache storing the tuning results, or `nullptr`. */
+    std::shared_ptr<TuningCache> get_tuning_cache() const noexcept
+    {
+        return cache_;
+    }
+
+    /**
+     * Returns the names of the formats that are considered on this executor.
+     */
+    std::vector<std::string> get_candidates() const;
+
+    /**
+     * Returns the fingerprint of the matrix that is used as the key for the
+     * tuning cache. It consists of the executor type and device, the value
+     * and index type, the matrix size, the number of stored elements and a
+     * histogram of the row lengths, which counts the empty rows and the rows
+     * with a length in `[2^(k-1), 2^k)` for each `k >= 1`.
+     */
+    std::string get_fingerprint() const;
+
+    /**
+     * Creates an empty AutoFormat matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<AutoFormat> create(
+        std::shared_ptr<const Executor> exec);
+
+    /**
+     * Creates an AutoFormat matrix selecting the format for a Csr matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param source  the matrix to select the format for. It is copied to
+     *                `exec` if necessary.
+     * @param cache  the cache to look up and store the selected format, or
+     *               `nullptr` to always time all candidates
+     * @param num_repetitions  the number of SpMVs timed for each candidate
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<AutoFormat> create(
+        std::shared_ptr<const Executor> exec,
+        std::shared_ptr<const csr_type> source,
+        std::shared_ptr<TuningCache> cache = nullptr,
+        int num_repetitions = 10);
+
+    /**
+     * Copy-assigns an AutoFormat matrix. Preserves the executor, copies the
+     * source matrix and the selected operator to it.
+     */
+    AutoFormat& operator=(const AutoFormat&);
+
+    /**
+     * Copy-constructs an AutoFormat matrix. Inherits the executor, shares
+     * the source matrix and the selected operator.
+     */
+    AutoFormat(const AutoFormat&);
+
+protected:
+    explicit AutoFormat(std::shared_ptr<const Executor> exec);
+
+    AutoFormat(std::shared_ptr<const Executor> exec,
+               std::shared_ptr<const csr_type> source,
+               std::shared_ptr<TuningCache> cache, int num_repetitions);
+
+    /** Converts the source matrix to the given candidate format. */
+    std::unique_ptr<LinOp> convert_to_format(const std::string& format) const;
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    std::shared_ptr<const csr_type> source_;
+    std::shared_ptr<TuningCache> cache_;
+    int num_repetitions_;
+    mutable std::mutex mutex_;
+    mutable std::string format_;
+    mutable std::shared_ptr<const LinOp> op_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_AUTO_FORMAT_HPP_
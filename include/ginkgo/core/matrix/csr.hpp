@@ -45,6 +45,21 @@ class Csr;
 template <typename ValueType, typename IndexType>
 class Fbcsr;
 
+template <typename ValueType, typename IndexType>
+class DeltaCsr;
+
+template <typename ValueType, typename IndexType>
+class ReducedCsr;
+
+template <typename ValueType, typename IndexType>
+class Vbcsr;
+
+template <typename ValueType, typename IndexType>
+class SymmetricCsr;
+
+template <typename ValueType, typename IndexType>
+class Stencil;
+
 template <typename ValueType, typename IndexType>
 class CsrBuilder;
 
@@ -111,6 +126,10 @@ class Csr : public EnableLinOp<Csr<ValueType, IndexType>>,
             public ConvertibleTo<Hybrid<ValueType, IndexType>>,
             public ConvertibleTo<Sellp<ValueType, IndexType>>,
             public ConvertibleTo<SparsityCsr<ValueType, IndexType>>,
+            public ConvertibleTo<DeltaCsr<ValueType, IndexType>>,
+            public ConvertibleTo<ReducedCsr<ValueType, IndexType>>,
+            public ConvertibleTo<Vbcsr<ValueType, IndexType>>,
+            public ConvertibleTo<SymmetricCsr<ValueType, IndexType>>,
             public DiagonalExtractable<ValueType>,
             public ReadableFromMatrixData<ValueType, IndexType>,
             public WritableToMatrixData<ValueType, IndexType>,
@@ -128,6 +147,11 @@ class Csr : public EnableLinOp<Csr<ValueType, IndexType>>,
     friend class Sellp<ValueType, IndexType>;
     friend class SparsityCsr<ValueType, IndexType>;
     friend class Fbcsr<ValueType, IndexType>;
+    friend class DeltaCsr<ValueType, IndexType>;
+    friend class ReducedCsr<ValueType, IndexType>;
+    friend class Vbcsr<ValueType, IndexType>;
+    friend class SymmetricCsr<ValueType, IndexType>;
+    friend class Stencil<ValueType, IndexType>;
     friend class CsrBuilder<ValueType, IndexType>;
     friend class Csr<to_complex<ValueType>, IndexType>;
 
@@ -150,6 +174,14 @@ public:
     using ConvertibleTo<Sellp<ValueType, IndexType>>::move_to;
     using ConvertibleTo<SparsityCsr<ValueType, IndexType>>::convert_to;
     using ConvertibleTo<SparsityCsr<ValueType, IndexType>>::move_to;
+    using ConvertibleTo<DeltaCsr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<DeltaCsr<ValueType, IndexType>>::move_to;
+    using ConvertibleTo<ReducedCsr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<ReducedCsr<ValueType, IndexType>>::move_to;
+    using ConvertibleTo<Vbcsr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Vbcsr<ValueType, IndexType>>::move_to;
+    using ConvertibleTo<SymmetricCsr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<SymmetricCsr<ValueType, IndexType>>::move_to;
     using ReadableFromMatrixData<ValueType, IndexType>::read;
 
     using value_type = ValueType;
@@ -742,6 +774,22 @@ public:
 
     void move_to(SparsityCsr<ValueType, IndexType>* result) override;
 
+    void convert_to(DeltaCsr<ValueType, IndexType>* result) const override;
+
+    void move_to(DeltaCsr<ValueType, IndexType>* result) override;
+
+    void convert_to(ReducedCsr<ValueType, IndexType>* result) const override;
+
+    void move_to(ReducedCsr<ValueType, IndexType>* result) override;
+
+    void convert_to(Vbcsr<ValueType, IndexType>* result) const override;
+
+    void move_to(Vbcsr<ValueType, IndexType>* result) override;
+
+    void convert_to(SymmetricCsr<ValueType, IndexType>* result) const override;
+
+    void move_to(SymmetricCsr<ValueType, IndexType>* result) override;
+
     void read(const mat_data& data) override;
 
     void read(const device_mat_data& data) override;
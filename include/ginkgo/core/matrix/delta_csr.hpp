@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_DELTA_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_DELTA_CSR_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+/**
+ * DeltaCsr is a CSR format with compressed column indices, meant to reduce
+ * the memory traffic of bandwidth-bound SpMV.
+ *
+ * Like Csr, the values of each row are stored contiguously and the row
+ * pointers give the range of values belonging to each row. Instead of the
+ * column index of every entry, the matrix stores the column index of the first
+ * entry of each row (the base column) and a byte stream containing the
+ * differences (deltas) between consecutive column indices within each row:
+ *
+ * - a delta in [1, 255] is stored as a single byte,
+ * - otherwise, a zero byte is followed by a 16 bit delta if it is in
+ *   [1, 65535],
+ * - otherwise, a zero byte and a zero 16 bit value are followed by the full
+ *   delta as an IndexType value.
+ *
+ * The stream of row `i` starts at byte get_const_delta_ptrs()[i]. For matrices
+ * with sorted column indices and a small bandwidth (e.g. after an RCM
+ * reordering), almost all deltas fit into a single byte, so a double precision
+ * matrix with 32 bit indices needs about 9 instead of 12 bytes per nonzero.
+ * Unsorted rows and duplicate entries are supported through the long deltas.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup delta_csr
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class DeltaCsr : public EnableLinOp<DeltaCsr<ValueType, IndexType>>,
+                 public ConvertibleTo<Csr<ValueType, IndexType>>,
+                 public ReadableFromMatrixData<ValueType, IndexType>,
+                 public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<DeltaCsr, LinOp>;
+    friend class Csr<ValueType, IndexType>;
+
+public:
+    using EnableLinOp<DeltaCsr>::convert_to;
+    using EnableLinOp<DeltaCsr>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* other) const override;
+
+    void move_to(Csr<ValueType, IndexType>* other) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    /**
+     * Returns the values of the matrix.
+     *
+     * @return the values of the matrix.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc DeltaCsr::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the row pointers of the matrix, i.e. the offsets of the first
+     * value of each row.
+     *
+     * @return the row pointers of the matrix.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the column index of the first entry of each row. It is zero for
+     * empty rows.
+     *
+     * @return the base column indexes of the matrix.
+     */
+    const index_type* get_const_base_cols() const noexcept
+    {
+        return base_cols_.get_const_data();
+    }
+
+    /**
+     * Returns the offsets of the encoded column deltas of each row in the
+     * delta stream.
+     *
+     * @return the delta pointers of the matrix.
+     */
+    const int64* get_const_delta_ptrs() const noexcept
+    {
+        return delta_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the stream of encoded column deltas.
+     *
+     * @return the delta stream of the matrix.
+     */
+    const uint8* get_const_deltas() const noexcept
+    {
+        return deltas_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_size();
+    }
+
+    /**
+     * Returns the size of the delta stream in bytes.
+     *
+     * @return the size of the delta stream in bytes
+     */
+    size_type get_num_delta_bytes() const noexcept
+    {
+        return deltas_.get_size();
+    }
+
+    /**
+     * Creates an empty DeltaCsr matrix of the specified size. It can be
+     * filled by reading matrix data or converting a Csr matrix into it.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<DeltaCsr> create(
+        std::shared_ptr<const Executor> exec, const dim<2>& size = {});
+
+    /**
+     * Copy-assigns a DeltaCsr matrix. Preserves the executor, copies the data.
+     */
+    DeltaCsr& operator=(const DeltaCsr&);
+
+    /**
+     * Move-assigns a DeltaCsr matrix. Preserves the executor, moves the data.
+     * The moved-from object is empty (0x0 with valid row and delta pointers).
+     */
+    DeltaCsr& operator=(DeltaCsr&&);
+
+    /**
+     * Copy-constructs a DeltaCsr matrix. Inherits the executor, copies the
+     * data.
+     */
+    DeltaCsr(const DeltaCsr&);
+
+    /**
+     * Move-constructs a DeltaCsr matrix. Inherits the executor, moves the data.
+     * The moved-from object is empty (0x0 with valid row and delta pointers).
+     */
+    DeltaCsr(DeltaCsr&&);
+
+protected:
+    DeltaCsr(std::shared_ptr<const Executor> exec, const dim<2>& size = {});
+
+    /**
+     * Fills this matrix with the entries of `source`, compressing its column
+     * indices.
+     */
+    void fill_from(const Csr<ValueType, IndexType>* source);
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    array<value_type> values_;
+    array<index_type> row_ptrs_;
+    array<index_type> base_cols_;
+    array<int64> delta_ptrs_;
+    array<uint8> deltas_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_DELTA_CSR_HPP_
@@ -0,0 +1,242 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_REDUCED_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_REDUCED_CSR_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+/**
+ * Specifies the format in which a ReducedCsr matrix stores its values.
+ */
+enum class reduced_storage : uint8 {
+    /**
+     * The values are stored as `reduce_precision<ValueType>`, e.g. `float`
+     * for `double` matrices and `half` for `float` matrices.
+     */
+    single_reduction,
+    /**
+     * The values are stored as
+     * `reduce_precision<reduce_precision<ValueType>>`, e.g. `half` for
+     * `double` matrices.
+     */
+    double_reduction,
+    /**
+     * The values are stored as 16 bit integers, which are multiplied by a
+     * per-row scaling factor `max_j |a_ij| / 32767` on access. This is only
+     * available for real value types.
+     */
+    scaled_int16
+};
+
+
+/**
+ * ReducedCsr is a CSR matrix that stores its values in a lower precision
+ * than the one used for computations.
+ *
+ * The sparsity pattern is stored exactly like in Csr. The values are stored
+ * in the format given by the @ref reduced_storage mode chosen at creation,
+ * and are converted back to ValueType when they are loaded, so `apply`
+ * computes entirely in ValueType. This reduces the memory traffic of SpMV,
+ * which is usually bandwidth-bound, at the cost of perturbing the matrix
+ * entries themselves. It is meant for operators where such a perturbation is
+ * acceptable, like preconditioner matrices or coarse levels of a multigrid
+ * hierarchy, while the solver itself keeps running in ValueType.
+ *
+ * A ReducedCsr matrix is filled by converting a Csr matrix into it or by
+ * reading matrix data. In both cases, the storage mode of the target is kept.
+ *
+ * @tparam ValueType  precision of the arithmetic and of the interface
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup reduced_csr
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class ReducedCsr : public EnableLinOp<ReducedCsr<ValueType, IndexType>>,
+                   public ConvertibleTo<Csr<ValueType, IndexType>>,
+                   public ReadableFromMatrixData<ValueType, IndexType>,
+                   public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<ReducedCsr, LinOp>;
+    friend class Csr<ValueType, IndexType>;
+
+public:
+    using EnableLinOp<ReducedCsr>::convert_to;
+    using EnableLinOp<ReducedCsr>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using scale_type = remove_complex<ValueType>;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* other) const override;
+
+    void move_to(Csr<ValueType, IndexType>* other) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    /**
+     * Returns the format in which the values are stored.
+     *
+     * @return the storage mode of the matrix.
+     */
+    reduced_storage get_storage_mode() const noexcept { return mode_; }
+
+    /**
+     * Returns the raw storage of the values. Its interpretation depends on
+     * get_storage_mode().
+     *
+     * @return the value storage of the matrix.
+     */
+    const uint8* get_const_storage() const noexcept
+    {
+        return storage_.get_const_data();
+    }
+
+    /**
+     * Returns the per-row scaling factors of the values. They are only stored
+     * for reduced_storage::scaled_int16, otherwise this is `nullptr`.
+     *
+     * @return the scaling factors of the matrix.
+     */
+    const scale_type* get_const_scales() const noexcept
+    {
+        return scales_.get_const_data();
+    }
+
+    /**
+     * Returns the column indexes of the matrix.
+     *
+     * @return the column indexes of the matrix.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the row pointers of the matrix.
+     *
+     * @return the row pointers of the matrix.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return col_idxs_.get_size();
+    }
+
+    /**
+     * Returns the size of the value storage in bytes.
+     *
+     * @return the size of the value storage in bytes
+     */
+    size_type get_num_storage_bytes() const noexcept
+    {
+        return storage_.get_size();
+    }
+
+    /**
+     * Creates an empty ReducedCsr matrix of the specified size. It can be
+     * filled by reading matrix data or converting a Csr matrix into it.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix
+     * @param mode  format in which the values are stored
+     *
+     * @return A smart pointer to the newly created matrix.
+     *
+     * @throws NotSupported  if `mode` is reduced_storage::scaled_int16 and
+     *                       ValueType is complex.
+     */
+    static std::unique_ptr<ReducedCsr> create(
+        std::shared_ptr<const Executor> exec, const dim<2>& size = {},
+        reduced_storage mode = reduced_storage::single_reduction);
+
+    /**
+     * Copy-assigns a ReducedCsr matrix. Preserves the executor, copies the
+     * data and the storage mode.
+     */
+    ReducedCsr& operator=(const ReducedCsr&);
+
+    /**
+     * Move-assigns a ReducedCsr matrix. Preserves the executor, moves the data
+     * and copies the storage mode. The moved-from object is empty (0x0 with
+     * valid row pointers).
+     */
+    ReducedCsr& operator=(ReducedCsr&&);
+
+    /**
+     * Copy-constructs a ReducedCsr matrix. Inherits the executor, copies the
+     * data and the storage mode.
+     */
+    ReducedCsr(const ReducedCsr&);
+
+    /**
+     * Move-constructs a ReducedCsr matrix. Inherits the executor, moves the
+     * data and copies the storage mode. The moved-from object is empty (0x0
+     * with valid row pointers).
+     */
+    ReducedCsr(ReducedCsr&&);
+
+protected:
+    ReducedCsr(std::shared_ptr<const Executor> exec, const dim<2>& size = {},
+               reduced_storage mode = reduced_storage::single_reduction);
+
+    /**
+     * Fills this matrix with the entries of `source`, converting its values
+     * to the storage format of this matrix.
+     */
+    void fill_from(const Csr<ValueType, IndexType>* source);
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    reduced_storage mode_;
+    array<uint8> storage_;
+    array<scale_type> scales_;
+    array<index_type> col_idxs_;
+    array<index_type> row_ptrs_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_REDUCED_CSR_HPP_
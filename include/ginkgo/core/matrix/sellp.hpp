@@ -16,6 +16,7 @@ namespace matrix {
 
 constexpr int default_slice_size = 64;
 constexpr int default_stride_factor = 1;
+constexpr int default_sorting_window = 1;
 
 
 template <typename ValueType>
@@ -32,6 +33,17 @@ class Csr;
  * This implementation uses the column index value invalid_index<IndexType>()
  * to mark padding entries that are not part of the sparsity pattern.
  *
+ * If a sorting window $\sigma > 1$ is set, the matrix is stored in the
+ * SELL-C-$\sigma$ format instead: within each window of $\sigma$ consecutive
+ * rows, the rows are sorted by decreasing number of nonzeros before they are
+ * assigned to slices, which reduces the padding needed within each slice.
+ * The resulting row permutation is stored in the matrix, where stored row `i`
+ * is row get_const_permutation()[i] of the original matrix, and all
+ * operations (application, conversions, write) use the original row order.
+ * Combined with a slice size matching the SIMD width of the CPU (see
+ * simd_slice_size()), this allows the CPU kernels to process all rows of a
+ * slice with a single vector instruction per stored column.
+ *
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  precision of matrix indexes
  *
@@ -213,6 +225,36 @@ public:
      */
     size_type get_stride_factor() const noexcept { return stride_factor_; }
 
+    /**
+     * Returns the size of the windows in which the rows are sorted by their
+     * number of nonzeros (the $\sigma$ of SELL-C-$\sigma$).
+     *
+     * @return the sorting window, 1 if the rows are not sorted.
+     */
+    size_type get_sorting_window() const noexcept { return sorting_window_; }
+
+    /**
+     * Returns the row permutation of the matrix: stored row `i` is row
+     * `get_const_permutation()[i]` of the original matrix.
+     *
+     * @return the row permutation, or nullptr if the rows are stored in their
+     *         original order.
+     */
+    const index_type* get_const_permutation() const noexcept
+    {
+        return permutation_.get_size() > 0 ? permutation_.get_const_data()
+                                           : nullptr;
+    }
+
+    /**
+     * Returns the slice size matching the SIMD width of the CPU Ginkgo was
+     * built for, i.e. the number of values of value_type that fit into one
+     * vector register, clamped to the range [4, 16].
+     *
+     * @return the slice size for SELL-C-$\sigma$ on the CPU.
+     */
+    static size_type simd_slice_size() noexcept;
+
     /**
      * Returns the total column number.
      *
@@ -321,6 +363,28 @@ public:
                                          size_type stride_factor,
                                          size_type total_cols);
 
+    /**
+     * Creates an uninitialized SELL-C-$\sigma$ matrix of the specified size.
+     * The rows are sorted when the matrix is read or converted to.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix
+     * @param slice_size  number of rows in each slice
+     * @param stride_factor  factor for the stride in each slice (strides
+     *                        should be multiples of the stride_factor)
+     * @param sorting_window  number of consecutive rows that are sorted by
+     *                        their number of nonzeros, 1 disables sorting
+     * @param total_cols   number of the sum of all cols in every slice.
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<Sellp> create(std::shared_ptr<const Executor> exec,
+                                         const dim<2>& size,
+                                         size_type slice_size,
+                                         size_type stride_factor,
+                                         size_type sorting_window,
+                                         size_type total_cols);
+
     /**
      * Copy-assigns a Sellp matrix. Preserves the executor, copies the data and
      * parameters.
@@ -354,6 +418,16 @@ protected:
     Sellp(std::shared_ptr<const Executor> exec, const dim<2>& size,
           size_type slice_size, size_type stride_factor, size_type total_cols);
 
+    Sellp(std::shared_ptr<const Executor> exec, const dim<2>& size,
+          size_type slice_size, size_type stride_factor,
+          size_type sorting_window, size_type total_cols);
+
+    /**
+     * Fills this matrix with the rows of `source`, sorted by their number of
+     * nonzeros within windows of get_sorting_window() rows.
+     */
+    void fill_sorted(const Csr<ValueType, IndexType>* source);
+
     void apply_impl(const LinOp* b, LinOp* x) const override;
 
     void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
@@ -372,6 +446,8 @@ private:
     array<size_type> slice_sets_;
     size_type slice_size_;
     size_type stride_factor_;
+    size_type sorting_window_;
+    array<index_type> permutation_;
 };
 
 
@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_STENCIL_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_STENCIL_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+template <typename ValueType>
+class Diagonal;
+
+
+/**
+ * Specifies the neighborhood of a grid point that is coupled by a Stencil.
+ */
+enum class stencil_type {
+    /** 2D stencil coupling a point to its 4 direct neighbors. */
+    five_point,
+    /** 2D stencil coupling a point to its 8 direct and diagonal neighbors. */
+    nine_point,
+    /** 3D stencil coupling a point to its 6 direct neighbors. */
+    seven_point,
+    /** 3D stencil coupling a point to all 26 neighbors in its unit cube. */
+    twenty_seven_point
+};
+
+
+/**
+ * Returns the number of points (including the center) of a stencil type.
+ */
+inline size_type get_num_stencil_points(stencil_type type)
+{
+    switch (type) {
+    case stencil_type::five_point:
+        return 5;
+    case stencil_type::nine_point:
+        return 9;
+    case stencil_type::seven_point:
+        return 7;
+    default:
+        return 27;
+    }
+}
+
+
+/**
+ * Stencil is a matrix-free operator representing a stencil on a structured
+ * 2D or 3D grid.
+ *
+ * The grid has `nx x ny x nz` points (`nz = 1` for 2D grids), and the point
+ * `(x, y, z)` corresponds to the row `x + nx * (y + ny * z)`. Row `i` of the
+ * operator couples the point `i` with its neighbors given by the
+ * @ref stencil_type. Neighbors outside of the grid are dropped, which
+ * corresponds to homogeneous Dirichlet boundary conditions.
+ *
+ * The stencil points are numbered by increasing column offset, i.e.
+ * lexicographically by their offsets `(dz, dy, dx)`, so the center point is
+ * always the point `(get_num_points() - 1) / 2`. The coefficients are either
+ * constant, with one coefficient per stencil point, or variable, with one
+ * coefficient per stencil point and grid point. Variable coefficients are
+ * stored point by point, i.e. the coefficient of stencil point `p` in row `i`
+ * is stored at position `p * num_rows + i`.
+ *
+ * Since no indexes need to be stored, applying a Stencil only reads the
+ * vector and (for variable coefficients) the coefficients, which is
+ * considerably less memory traffic than an assembled Csr matrix. Solvers and
+ * preconditioners that need explicit matrix entries can convert it to Csr.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of the matrix indexes of the Csr conversion
+ *
+ * @ingroup stencil
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Stencil : public EnableLinOp<Stencil<ValueType, IndexType>>,
+                public ConvertibleTo<Csr<ValueType, IndexType>>,
+                public DiagonalExtractable<ValueType>,
+                public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<Stencil, LinOp>;
+
+public:
+    using EnableLinOp<Stencil>::convert_to;
+    using EnableLinOp<Stencil>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* other) const override;
+
+    void move_to(Csr<ValueType, IndexType>* other) override;
+
+    void write(mat_data& data) const override;
+
+    std::unique_ptr<Diagonal<ValueType>> extract_diagonal() const override;
+
+    /**
+     * Returns the number of grid points in each dimension.
+     *
+     * @return the grid size `(nx, ny, nz)`
+     */
+    const dim<3>& get_grid_size() const noexcept { return grid_size_; }
+
+    /**
+     * Returns the type of the stencil.
+     *
+     * @return the type of the stencil
+     */
+    stencil_type get_stencil_type() const noexcept { return type_; }
+
+    /**
+     * Returns the number of points of the stencil, including the center.
+     *
+     * @return the number of points of the stencil
+     */
+    size_type get_num_points() const noexcept
+    {
+        return get_num_stencil_points(type_);
+    }
+
+    /**
+     * Returns true if the coefficients vary between grid points.
+     *
+     * @return true if the coefficients vary between grid points
+     */
+    bool has_variable_coefficients() const noexcept
+    {
+        return coefficients_.get_size() != this->get_num_points();
+    }
+
+    /**
+     * Returns the stencil coefficients.
+     *
+     * @return the stencil coefficients.
+     */
+    value_type* get_coefficients() noexcept
+    {
+        return coefficients_.get_data();
+    }
+
+    /**
+     * @copydoc Stencil::get_coefficients()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_coefficients() const noexcept
+    {
+        return coefficients_.get_const_data();
+    }
+
+    /**
+     * Creates a Stencil on a grid with the constant coefficients of the
+     * negative Laplacian, i.e. `get_num_points() - 1` for the center and `-1`
+     * for all other stencil points.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param grid_size  number of grid points in each dimension
+     * @param type  the type of the stencil. 2D stencil types require
+     *              `grid_size[2] == 1`.
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<Stencil> create(
+        std::shared_ptr<const Executor> exec, const dim<3>& grid_size = {},
+        stencil_type type = stencil_type::five_point);
+
+    /**
+     * Creates a Stencil on a grid with the given coefficients.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param grid_size  number of grid points in each dimension
+     * @param type  the type of the stencil. 2D stencil types require
+     *              `grid_size[2] == 1`.
+     * @param coefficients  either `get_num_points()` constant coefficients, or
+     *                      `get_num_points() * num_rows` variable
+     *                      coefficients.
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<Stencil> create(std::shared_ptr<const Executor> exec,
+                                           const dim<3>& grid_size,
+                                           stencil_type type,
+                                           array<value_type> coefficients);
+
+    /**
+     * Copy-assigns a Stencil matrix. Preserves the executor, copies the data.
+     */
+    Stencil& operator=(const Stencil&);
+
+    /**
+     * Move-assigns a Stencil matrix. Preserves the executor, moves the data.
+     * The moved-from object is an empty 5-point stencil.
+     */
+    Stencil& operator=(Stencil&&);
+
+    /**
+     * Copy-constructs a Stencil matrix. Inherits the executor, copies the
+     * data.
+     */
+    Stencil(const Stencil&);
+
+    /**
+     * Move-constructs a Stencil matrix. Inherits the executor, moves the data.
+     * The moved-from object is an empty 5-point stencil.
+     */
+    Stencil(Stencil&&);
+
+protected:
+    Stencil(std::shared_ptr<const Executor> exec, const dim<3>& grid_size = {},
+            stencil_type type = stencil_type::five_point);
+
+    Stencil(std::shared_ptr<const Executor> exec, const dim<3>& grid_size,
+            stencil_type type, array<value_type> coefficients);
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    dim<3> grid_size_;
+    stencil_type type_;
+    array<value_type> coefficients_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_STENCIL_HPP_
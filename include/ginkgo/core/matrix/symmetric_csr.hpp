@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_SYMMETRIC_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_SYMMETRIC_CSR_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+template <typename ValueType>
+class Diagonal;
+
+
+/**
+ * @brief Symmetric compressed sparse row storage matrix format
+ *
+ * SymmetricCsr stores a symmetric (or, for complex value types, Hermitian)
+ * matrix by storing only its diagonal and its upper triangle in CSR format,
+ * which halves the memory footprint and the memory traffic of the SpMV
+ * compared to Csr. Each stored off-diagonal entry `a_ij` with `i < j` also
+ * represents the entry `a_ji = conj(a_ij)` of the lower triangle.
+ *
+ * The column indexes within each row are sorted, so the diagonal entry, if
+ * present, is the first entry of each row.
+ *
+ * When filling the matrix from matrix data or a Csr matrix, only the entries
+ * on or above the diagonal are used, the lower triangle is assumed to match
+ * them and is ignored.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup symmetric_csr
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class SymmetricCsr
+    : public EnableLinOp<SymmetricCsr<ValueType, IndexType>>,
+      public ConvertibleTo<Csr<ValueType, IndexType>>,
+      public DiagonalExtractable<ValueType>,
+      public ReadableFromMatrixData<ValueType, IndexType>,
+      public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<SymmetricCsr, LinOp>;
+    friend class Csr<ValueType, IndexType>;
+
+public:
+    using EnableLinOp<SymmetricCsr>::convert_to;
+    using EnableLinOp<SymmetricCsr>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* other) const override;
+
+    void move_to(Csr<ValueType, IndexType>* other) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    std::unique_ptr<Diagonal<ValueType>> extract_diagonal() const override;
+
+    /**
+     * Returns the values of the upper triangle.
+     *
+     * @return the values of the upper triangle.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc SymmetricCsr::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the column indexes of the upper triangle.
+     *
+     * @return the column indexes of the upper triangle.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the row pointers of the upper triangle.
+     *
+     * @return the row pointers of the upper triangle.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix, i.e.
+     * the entries of the diagonal and the upper triangle.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_size();
+    }
+
+    /**
+     * Creates an empty SymmetricCsr matrix of the specified size.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<SymmetricCsr> create(
+        std::shared_ptr<const Executor> exec, const dim<2>& size = {});
+
+    /**
+     * Copy-assigns a SymmetricCsr matrix. Preserves the executor, copies the
+     * data.
+     */
+    SymmetricCsr& operator=(const SymmetricCsr&);
+
+    /**
+     * Move-assigns a SymmetricCsr matrix. Preserves the executor, moves the
+     * data. The moved-from object is empty (0x0 with valid row pointers).
+     */
+    SymmetricCsr& operator=(SymmetricCsr&&);
+
+    /**
+     * Copy-constructs a SymmetricCsr matrix. Inherits the executor, copies
+     * the data.
+     */
+    SymmetricCsr(const SymmetricCsr&);
+
+    /**
+     * Move-constructs a SymmetricCsr matrix. Inherits the executor, moves the
+     * data. The moved-from object is empty (0x0 with valid row pointers).
+     */
+    SymmetricCsr(SymmetricCsr&&);
+
+protected:
+    SymmetricCsr(std::shared_ptr<const Executor> exec,
+                 const dim<2>& size = {});
+
+    /**
+     * Fills this matrix with the diagonal and upper triangle of `source`.
+     */
+    void fill_from(const Csr<ValueType, IndexType>* source);
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    array<index_type> row_ptrs_;
+    array<index_type> col_idxs_;
+    array<value_type> values_;
+    // per-thread accumulation windows of the SpMV, reused between applies
+    mutable array<value_type> workspace_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_SYMMETRIC_CSR_HPP_
@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_VBCSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_VBCSR_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+/**
+ * @brief Variable-block compressed sparse row storage matrix format
+ *
+ * Vbcsr is a block CSR format for matrices made up of small, dense blocks of
+ * different sizes, e.g. finite element matrices whose nodes carry different
+ * numbers of unknowns. Unlike Fbcsr, which requires a single block size for
+ * the whole matrix, the rows (and equally the columns) of a Vbcsr matrix are
+ * partitioned into consecutive blocks of arbitrary sizes. Each stored block is
+ * the dense intersection of a row block and a column block.
+ *
+ * The partition is stored as block offsets, i.e. block `i` contains the rows
+ * and columns `[get_const_block_offsets()[i], get_const_block_offsets()[i+1])`.
+ * The block row pointers and block column indexes describe the nonzero blocks
+ * like in Csr, and `get_const_value_ptrs()[k]` is the offset of the values of
+ * block `k`, which are stored densely in row-major order.
+ *
+ * The partition is either given by the user as a list of block sizes, or it is
+ * detected automatically whenever the matrix is filled, by merging consecutive
+ * rows with identical sparsity patterns into one block. Entries within stored
+ * blocks which are missing from the source matrix are stored as explicit
+ * zeros.
+ *
+ * @note Since the same partition is used for rows and columns, Vbcsr only
+ *       supports square matrices.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup vbcsr
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Vbcsr : public EnableLinOp<Vbcsr<ValueType, IndexType>>,
+              public ConvertibleTo<Csr<ValueType, IndexType>>,
+              public ReadableFromMatrixData<ValueType, IndexType>,
+              public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<Vbcsr, LinOp>;
+    friend class Csr<ValueType, IndexType>;
+
+public:
+    using EnableLinOp<Vbcsr>::convert_to;
+    using EnableLinOp<Vbcsr>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* other) const override;
+
+    void move_to(Csr<ValueType, IndexType>* other) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    /**
+     * Returns the values of the matrix.
+     *
+     * @return the values of the matrix.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc Vbcsr::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the offsets of the row and column blocks.
+     *
+     * @return the block offsets of the matrix.
+     */
+    const index_type* get_const_block_offsets() const noexcept
+    {
+        return block_offsets_.get_const_data();
+    }
+
+    /**
+     * Returns the block row pointers of the matrix.
+     *
+     * @return the block row pointers of the matrix.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the block column indexes of the matrix.
+     *
+     * @return the block column indexes of the matrix.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the offsets of the values of each stored block.
+     *
+     * @return the value pointers of the matrix.
+     */
+    const index_type* get_const_value_ptrs() const noexcept
+    {
+        return value_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of row (and column) blocks.
+     *
+     * @return the number of row blocks
+     */
+    size_type get_num_block_rows() const noexcept
+    {
+        return block_offsets_.get_size() - 1;
+    }
+
+    /**
+     * Returns the number of stored blocks.
+     *
+     * @return the number of stored blocks
+     */
+    size_type get_num_stored_blocks() const noexcept
+    {
+        return col_idxs_.get_size();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix,
+     * including the explicit zeros within stored blocks.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_size();
+    }
+
+    /**
+     * Returns whether the block partition is detected from the sparsity
+     * pattern whenever the matrix is filled.
+     *
+     * @return true if the block partition is detected automatically
+     */
+    bool detects_blocks() const noexcept { return detect_blocks_; }
+
+    /**
+     * Creates an empty Vbcsr matrix of the specified size. The block
+     * partition is detected when reading matrix data or converting a Csr
+     * matrix into it.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<Vbcsr> create(std::shared_ptr<const Executor> exec,
+                                         const dim<2>& size = {});
+
+    /**
+     * Creates an empty Vbcsr matrix with a fixed block partition, which is
+     * kept when reading matrix data or converting a Csr matrix into it.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix
+     * @param block_sizes  the size of each row and column block, e.g. the
+     *                     number of unknowns per node. They need to add up to
+     *                     the number of rows.
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<Vbcsr> create(std::shared_ptr<const Executor> exec,
+                                         const dim<2>& size,
+                                         array<index_type> block_sizes);
+
+    /**
+     * Copy-assigns a Vbcsr matrix. Preserves the executor, copies the data
+     * and the block partition mode.
+     */
+    Vbcsr& operator=(const Vbcsr&);
+
+    /**
+     * Move-assigns a Vbcsr matrix. Preserves the executor, moves the data and
+     * copies the block partition mode. The moved-from object is empty (0x0
+     * with valid block offsets and row pointers).
+     */
+    Vbcsr& operator=(Vbcsr&&);
+
+    /**
+     * Copy-constructs a Vbcsr matrix. Inherits the executor, copies the data
+     * and the block partition mode.
+     */
+    Vbcsr(const Vbcsr&);
+
+    /**
+     * Move-constructs a Vbcsr matrix. Inherits the executor, moves the data
+     * and copies the block partition mode. The moved-from object is empty (0x0
+     * with valid block offsets and row pointers).
+     */
+    Vbcsr(Vbcsr&&);
+
+protected:
+    Vbcsr(std::shared_ptr<const Executor> exec, const dim<2>& size = {});
+
+    Vbcsr(std::shared_ptr<const Executor> exec, const dim<2>& size,
+          array<index_type> block_sizes);
+
+    /**
+     * Fills this matrix with the entries of `source`, grouping them into
+     * blocks according to the block partition, which is detected first if
+     * necessary.
+     */
+    void fill_from(const Csr<ValueType, IndexType>* source);
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    bool detect_blocks_;
+    array<index_type> block_offsets_;
+    array<index_type> row_ptrs_;
+    array<index_type> col_idxs_;
+    array<index_type> value_ptrs_;
+    array<value_type> values_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_VBCSR_HPP_
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ILU_HPP_
+#define GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ILU_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/batch_lin_op.hpp>
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace batch {
+namespace preconditioner {
+
+
+/**
+ * The batched ILU(0) preconditioner computes an incomplete LU factorization
+ * with zero fill-in of every item in the batch and applies it by a forward
+ * and a backward triangular solve.
+ *
+ * With the batched preconditioners, it is required that all items in the batch
+ * have the same sparsity pattern. The symbolic part of the factorization (the
+ * location of the diagonal entries and the list of updates performed by the
+ * elimination) is therefore computed only once, from the first batch item, and
+ * shared by all items. Only the numeric factors are stored per batch item.
+ *
+ * The input batch matrix must be in batch::Csr matrix format or must be
+ * convertible to batch::Csr matrix format. The column indices of each row need
+ * to be sorted and every row needs to store its diagonal entry.
+ *
+ * @tparam ValueType  value precision of matrix elements
+ * @tparam IndexType  index precision of matrix elements
+ *
+ * @ingroup precond
+ * @ingroup BatchLinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Ilu final : public EnableBatchLinOp<Ilu<ValueType, IndexType>> {
+    friend class EnableBatchLinOp<Ilu>;
+    friend class EnablePolymorphicObject<Ilu, BatchLinOp>;
+
+public:
+    using EnableBatchLinOp<Ilu>::convert_to;
+    using EnableBatchLinOp<Ilu>::move_to;
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = batch::matrix::Csr<ValueType, IndexType>;
+
+    /**
+     * Returns the row pointers of the common sparsity pattern of the factors.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the column indices of the common sparsity pattern of the
+     * factors.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the position of the diagonal entry of each row within the
+     * common sparsity pattern.
+     */
+    const index_type* get_const_diag_locations() const noexcept
+    {
+        return diag_locs_.get_const_data();
+    }
+
+    /**
+     * Returns the numeric factors of all batch items.
+     *
+     * The strictly lower triangular part of each item holds L (with an
+     * implicit unit diagonal), the remaining part holds U. The factors of the
+     * batch item with index `batch_id` start at
+     * get_const_factors() + batch_id * get_num_elements_per_item().
+     */
+    const value_type* get_const_factors() const noexcept
+    {
+        return factors_.get_const_data();
+    }
+
+    /**
+     * Returns the number of stored elements of a single batch item.
+     */
+    size_type get_num_elements_per_item() const noexcept
+    {
+        return col_idxs_.get_size();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored for the whole batch.
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return factors_.get_size();
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory){};
+    GKO_ENABLE_BATCH_LIN_OP_FACTORY(Ilu, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+private:
+    explicit Ilu(std::shared_ptr<const Executor> exec);
+
+    explicit Ilu(const Factory* factory,
+                 std::shared_ptr<const BatchLinOp> system_matrix);
+
+    void generate_precond(const BatchLinOp* const system_matrix);
+
+    array<index_type> row_ptrs_;
+    array<index_type> col_idxs_;
+    array<index_type> diag_locs_;
+    array<value_type> factors_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace batch
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ILU_HPP_
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ISAI_HPP_
+#define GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ISAI_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/batch_lin_op.hpp>
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace batch {
+namespace preconditioner {
+
+
+/**
+ * The batched ISAI (Incomplete Sparse Approximate Inverse) preconditioner
+ * computes, for every item in the batch, a sparse approximate inverse M of the
+ * system matrix A with the same sparsity pattern as A. Row i of M is obtained
+ * by solving the small dense system M(i, J_i) A(J_i, J_i) = e_i, where J_i is
+ * the set of column indices of row i of A. The preconditioner is applied as a
+ * sparse matrix-vector product with M.
+ *
+ * With the batched preconditioners, it is required that all items in the batch
+ * have the same sparsity pattern. The extraction pattern of the dense systems
+ * A(J_i, J_i) is therefore computed only once, from the first batch item, and
+ * shared by all items. Only the values of M are stored per batch item.
+ *
+ * The input batch matrix must be in batch::Csr matrix format or must be
+ * convertible to batch::Csr matrix format.
+ *
+ * @note If a local system is singular, the corresponding row of M falls back
+ *       to the inverse of the diagonal entry of A (or to the identity if that
+ *       is zero as well).
+ *
+ * @tparam ValueType  value precision of matrix elements
+ * @tparam IndexType  index precision of matrix elements
+ *
+ * @ingroup isai
+ * @ingroup precond
+ * @ingroup BatchLinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Isai final : public EnableBatchLinOp<Isai<ValueType, IndexType>> {
+    friend class EnableBatchLinOp<Isai>;
+    friend class EnablePolymorphicObject<Isai, BatchLinOp>;
+
+public:
+    using EnableBatchLinOp<Isai>::convert_to;
+    using EnableBatchLinOp<Isai>::move_to;
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = batch::matrix::Csr<ValueType, IndexType>;
+
+    /**
+     * Returns the row pointers of the common sparsity pattern of the
+     * approximate inverse.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the column indices of the common sparsity pattern of the
+     * approximate inverse.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the values of the approximate inverses of all batch items.
+     *
+     * The values of the batch item with index `batch_id` start at
+     * get_const_inverse_values() + batch_id * get_num_elements_per_item().
+     */
+    const value_type* get_const_inverse_values() const noexcept
+    {
+        return inverse_values_.get_const_data();
+    }
+
+    /**
+     * Returns the number of stored elements of a single batch item.
+     */
+    size_type get_num_elements_per_item() const noexcept
+    {
+        return col_idxs_.get_size();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored for the whole batch.
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return inverse_values_.get_size();
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory){};
+    GKO_ENABLE_BATCH_LIN_OP_FACTORY(Isai, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+private:
+    explicit Isai(std::shared_ptr<const Executor> exec);
+
+    explicit Isai(const Factory* factory,
+                  std::shared_ptr<const BatchLinOp> system_matrix);
+
+    void generate_precond(const BatchLinOp* const system_matrix);
+
+    array<index_type> row_ptrs_;
+    array<index_type> col_idxs_;
+    array<value_type> inverse_values_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace batch
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ISAI_HPP_
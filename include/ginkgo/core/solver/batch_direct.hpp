@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_BATCH_DIRECT_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_BATCH_DIRECT_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/batch_lin_op.hpp>
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils_helper.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+
+
+namespace gko {
+namespace batch {
+namespace solver {
+
+
+/**
+ * The batched direct solver computes an LU factorization of every item in the
+ * batch when it is generated and solves the systems by forward and backward
+ * substitution when it is applied. For the small systems batched solvers are
+ * typically used for (up to a few dozen unknowns), this is usually cheaper
+ * than running an iterative solver to convergence.
+ *
+ * Depending on the format of the system matrix, one of two factorizations is
+ * used:
+ * - For batch::matrix::Dense, an LU factorization with partial (row) pivoting
+ *   is computed for every item.
+ * - For every other format, the matrix is converted to batch::matrix::Csr and
+ *   a sparse LU factorization without pivoting is computed. As all items in
+ *   the batch share the same sparsity pattern, the symbolic factorization
+ *   (the fill-in pattern of the factors and the list of updates performed by
+ *   the elimination) is computed only once, from the first batch item, and
+ *   shared by all items. Only the numeric factors are stored per batch item.
+ *   The column indices of each row of the system matrix need to be sorted.
+ *
+ * If a batch item turns out to be numerically singular, i.e. a pivot is zero,
+ * not finite or tiny compared to the largest entry of the item, generating
+ * the solver throws an InvalidStateError naming that item.
+ *
+ * @note The sparse factorization does not pivot, so it is only suitable for
+ *       systems that can be factorized stably in their natural order, e.g.
+ *       diagonally dominant or symmetric positive definite systems.
+ *
+ * @tparam ValueType  value precision of matrix elements
+ * @tparam IndexType  index precision of the sparse factors and pivots
+ *
+ * @ingroup solvers
+ * @ingroup BatchLinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Direct final : public EnableBatchLinOp<Direct<ValueType, IndexType>> {
+    friend class EnableBatchLinOp<Direct>;
+    friend class EnablePolymorphicObject<Direct, BatchLinOp>;
+
+public:
+    using EnableBatchLinOp<Direct>::convert_to;
+    using EnableBatchLinOp<Direct>::move_to;
+    using value_type = ValueType;
+    using index_type = IndexType;
+
+    /**
+     * Returns true if the factors are stored in the sparse format given by
+     * get_const_row_ptrs() and get_const_col_idxs(), and false if they are
+     * stored as dense row-major matrices with row pivoting.
+     */
+    bool has_sparse_factors() const noexcept { return sparse_; }
+
+    /**
+     * Returns the row pointers of the common sparsity pattern of the sparse
+     * factors, including fill-in.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the column indices of the common sparsity pattern of the sparse
+     * factors, including fill-in.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the position of the diagonal entry of each row within the
+     * common sparsity pattern of the sparse factors.
+     */
+    const index_type* get_const_diag_locations() const noexcept
+    {
+        return diag_locs_.get_const_data();
+    }
+
+    /**
+     * Returns the row pivots of the dense factors of all batch items.
+     *
+     * During the elimination of column k of the batch item with index
+     * `batch_id`, row k was swapped with row
+     * get_const_pivots()[batch_id * num_rows + k].
+     */
+    const index_type* get_const_pivots() const noexcept
+    {
+        return pivots_.get_const_data();
+    }
+
+    /**
+     * Returns the numeric factors of all batch items.
+     *
+     * The strictly lower triangular part of each item holds L (with an
+     * implicit unit diagonal), the remaining part holds U. The factors of the
+     * batch item with index `batch_id` start at
+     * get_const_factors() + batch_id * get_num_elements_per_item().
+     */
+    const value_type* get_const_factors() const noexcept
+    {
+        return factors_.get_const_data();
+    }
+
+    /**
+     * Returns the number of stored factor elements of a single batch item.
+     */
+    size_type get_num_elements_per_item() const noexcept
+    {
+        const auto num_rows = this->get_common_size()[0];
+        return sparse_ ? col_idxs_.get_size() : num_rows * num_rows;
+    }
+
+    /**
+     * Returns the number of factor elements explicitly stored for the whole
+     * batch.
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return factors_.get_size();
+    }
+
+    /**
+     * Solves the systems A x = b of all batch items.
+     *
+     * @param b  the right-hand sides
+     * @param x  the solution
+     */
+    Direct* apply(ptr_param<const MultiVector<value_type>> b,
+                  ptr_param<MultiVector<value_type>> x);
+
+    /**
+     * Computes x = alpha * A^{-1} b + beta * x for all batch items.
+     *
+     * @param alpha  the scalar to scale the solution with
+     * @param b      the right-hand sides
+     * @param beta   the scalar to scale the x vector with
+     * @param x      the output multi-vector
+     */
+    Direct* apply(ptr_param<const MultiVector<value_type>> alpha,
+                  ptr_param<const MultiVector<value_type>> b,
+                  ptr_param<const MultiVector<value_type>> beta,
+                  ptr_param<MultiVector<value_type>> x);
+
+    /**
+     * @copydoc apply(const MultiVector<value_type>*, MultiVector<value_type>*)
+     */
+    const Direct* apply(ptr_param<const MultiVector<value_type>> b,
+                        ptr_param<MultiVector<value_type>> x) const;
+
+    /**
+     * @copydoc apply(const MultiVector<value_type>*, const
+     * MultiVector<value_type>*, const MultiVector<value_type>*,
+     * MultiVector<value_type>*)
+     */
+    const Direct* apply(ptr_param<const MultiVector<value_type>> alpha,
+                        ptr_param<const MultiVector<value_type>> b,
+                        ptr_param<const MultiVector<value_type>> beta,
+                        ptr_param<MultiVector<value_type>> x) const;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory){};
+    GKO_ENABLE_BATCH_LIN_OP_FACTORY(Direct, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+private:
+    explicit Direct(std::shared_ptr<const Executor> exec);
+
+    explicit Direct(const Factory* factory,
+                    std::shared_ptr<const BatchLinOp> system_matrix);
+
+    void generate_dense(const matrix::Dense<value_type>* sys_dense);
+
+    void generate_sparse(const BatchLinOp* system_matrix);
+
+    void apply_impl(const MultiVector<value_type>* b,
+                    MultiVector<value_type>* x) const;
+
+    void apply_impl(const MultiVector<value_type>* alpha,
+                    const MultiVector<value_type>* b,
+                    const MultiVector<value_type>* beta,
+                    MultiVector<value_type>* x) const;
+
+    bool sparse_;
+    array<index_type> row_ptrs_;
+    array<index_type> col_idxs_;
+    array<index_type> diag_locs_;
+    array<index_type> pivots_;
+    array<value_type> factors_;
+};
+
+
+}  // namespace solver
+}  // namespace batch
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_BATCH_DIRECT_HPP_
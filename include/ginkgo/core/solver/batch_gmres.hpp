@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_BATCH_GMRES_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_BATCH_GMRES_HPP_
+
+
+#include <vector>
+
+#include <ginkgo/core/base/batch_lin_op.hpp>
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/solver/batch_solver_base.hpp>
+#include <ginkgo/core/stop/batch_stop_enum.hpp>
+
+
+namespace gko {
+namespace batch {
+namespace solver {
+
+
+/**
+ * GMRES or the generalized minimal residual method is a Krylov subspace solver
+ * which is suitable for general, non-symmetric systems.
+ *
+ * This solver solves a batch of linear systems using a restarted,
+ * right-preconditioned GMRES algorithm. The Krylov basis of each system is
+ * orthogonalized with modified Gram-Schmidt and the Hessenberg matrix is
+ * reduced with Givens rotations. Each linear system in the batch can converge
+ * independently.
+ *
+ * Unless otherwise specified via the `preconditioner` factory parameter, this
+ * implementation does not use any preconditioner by default. The type of
+ * tolerance (absolute or relative), the maximum number of iterations and the
+ * restart length can be set via the factory parameters.
+ *
+ * @note The tolerance check is against the residual estimate obtained from the
+ * Givens rotations, which can diverge from the true residual (||b - Ax||) in
+ * finite precision. The true residual is recomputed at every restart.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup BatchLinOp
+ */
+template <typename ValueType = default_precision>
+class Gmres final : public EnableBatchSolver<Gmres<ValueType>, ValueType> {
+    friend class EnableBatchLinOp<Gmres>;
+    friend class EnablePolymorphicObject<Gmres, BatchLinOp>;
+
+public:
+    using value_type = ValueType;
+    using real_type = gko::remove_complex<ValueType>;
+
+    class Factory;
+
+    struct parameters_type
+        : enable_preconditioned_iterative_solver_factory_parameters<
+              parameters_type, Factory> {
+        /**
+         * Number of Krylov vectors generated before the method is restarted.
+         * The Krylov basis is stored in the per-system workspace, so its
+         * memory footprint grows linearly with this value.
+         */
+        int GKO_FACTORY_PARAMETER_SCALAR(restart, 10);
+    };
+    GKO_ENABLE_BATCH_LIN_OP_FACTORY(Gmres, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+private:
+    explicit Gmres(std::shared_ptr<const Executor> exec);
+
+    explicit Gmres(const Factory* factory,
+                   std::shared_ptr<const BatchLinOp> system_matrix);
+
+    void solver_apply(
+        const MultiVector<ValueType>* b, MultiVector<ValueType>* x,
+        log::detail::log_data<real_type>* log_data) const override;
+};
+
+
+}  // namespace solver
+}  // namespace batch
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_BATCH_GMRES_HPP_
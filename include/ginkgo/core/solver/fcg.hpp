@@ -165,6 +165,10 @@ struct workspace_traits<Fcg<ValueType>> {
     constexpr static int stop = 0;
     // reduction tmp array
     constexpr static int tmp = 1;
+    // fused reduction buffer array
+    constexpr static int fused_buffer = 2;
+    // fused reduction host buffer array
+    constexpr static int fused_host_buffer = 3;
 };
 
 
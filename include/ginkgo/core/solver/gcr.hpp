@@ -183,6 +183,10 @@ struct workspace_traits<Gcr<ValueType>> {
     constexpr static int tmp = 1;
     // final iteration number array
     constexpr static int final_iter_nums = 2;
+    // fused reduction buffer array
+    constexpr static int fused_buffer = 3;
+    // fused reduction host buffer array
+    constexpr static int fused_host_buffer = 4;
 };
 
 
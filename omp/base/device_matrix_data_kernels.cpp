@@ -135,10 +135,47 @@ template <typename ValueType, typename IndexType>
 void sort_row_major(std::shared_ptr<const DefaultExecutor> exec,
                     device_matrix_data<ValueType, IndexType>& data)
 {
-    array<matrix_data_entry<ValueType, IndexType>> tmp{
-        exec, data.get_num_stored_elements()};
-    soa_to_aos(exec, data, tmp);
-    std::sort(tmp.get_data(), tmp.get_data() + tmp.get_size());
+    using entry_type = matrix_data_entry<ValueType, IndexType>;
+    const auto size = data.get_num_stored_elements();
+    const auto num_rows = data.get_size()[0];
+    const auto row_idxs = data.get_const_row_idxs();
+    const auto col_idxs = data.get_const_col_idxs();
+    const auto values = data.get_const_values();
+    array<entry_type> tmp{exec, size};
+    bool valid_rows = true;
+#pragma omp parallel for reduction(&& : valid_rows)
+    for (size_type i = 0; i < size; i++) {
+        valid_rows = valid_rows && row_idxs[i] >= 0 &&
+                     static_cast<size_type>(row_idxs[i]) < num_rows;
+    }
+    if (!valid_rows) {
+        soa_to_aos(exec, data, tmp);
+        std::sort(tmp.get_data(), tmp.get_data() + tmp.get_size());
+        aos_to_soa(exec, tmp, data);
+        return;
+    }
+    // bucket the entries by row, then sort each row by column independently
+    vector<int64> row_ptrs(num_rows + 1, 0, {exec});
+#pragma omp parallel for
+    for (size_type i = 0; i < size; i++) {
+#pragma omp atomic
+        row_ptrs[row_idxs[i]]++;
+    }
+    components::prefix_sum_nonnegative(exec, row_ptrs.data(), num_rows + 1);
+    vector<int64> row_offsets(row_ptrs.begin(), row_ptrs.end(), {exec});
+    const auto entries = tmp.get_data();
+#pragma omp parallel for
+    for (size_type i = 0; i < size; i++) {
+        const auto row = row_idxs[i];
+        int64 out_idx{};
+#pragma omp atomic capture
+        out_idx = row_offsets[row]++;
+        entries[out_idx] = entry_type{row, col_idxs[i], values[i]};
+    }
+#pragma omp parallel for schedule(dynamic, 64)
+    for (size_type row = 0; row < num_rows; row++) {
+        std::sort(entries + row_ptrs[row], entries + row_ptrs[row + 1]);
+    }
     aos_to_soa(exec, tmp, data);
 }
 
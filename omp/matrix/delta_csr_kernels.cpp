@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+#include <omp.h>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/matrix/delta_csr_encoding.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The DeltaCsr matrix format namespace.
+ *
+ * @ingroup delta_csr
+ */
+namespace delta_csr {
+
+
+/**
+ * Computes the product of `a` and `b` row by row, passing the result for each
+ * output entry through `out`. Rows whose deltas all fit into a single byte
+ * (the common case for well-ordered matrices) are decoded without branching.
+ */
+template <typename ValueType, typename IndexType, typename OutFn>
+void spmv_impl(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::DeltaCsr<ValueType, IndexType>* a,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+               OutFn out)
+{
+    const auto vals = a->get_const_values();
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto base_cols = a->get_const_base_cols();
+    const auto delta_ptrs = a->get_const_delta_ptrs();
+    const auto deltas = a->get_const_deltas();
+    const auto num_rows = a->get_size()[0];
+    const auto num_rhs = b->get_size()[1];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto begin = row_ptrs[row];
+        const auto end = row_ptrs[row + 1];
+        const auto row_deltas = deltas + delta_ptrs[row];
+        const bool short_deltas =
+            delta_ptrs[row + 1] - delta_ptrs[row] == end - begin - 1;
+        for (size_type j = 0; j < num_rhs; j++) {
+            auto sum = zero<ValueType>();
+            auto col = base_cols[row];
+            if (begin < end) {
+                sum = vals[begin] * b->at(col, j);
+            }
+            if (short_deltas) {
+                for (auto nz = begin + 1; nz < end; nz++) {
+                    col += row_deltas[nz - begin - 1];
+                    sum += vals[nz] * b->at(col, j);
+                }
+            } else {
+                auto in = row_deltas;
+                for (auto nz = begin + 1; nz < end; nz++) {
+                    IndexType delta{};
+                    in = matrix::delta_csr::decode(in, delta);
+                    col += delta;
+                    sum += vals[nz] * b->at(col, j);
+                }
+            }
+            c->at(row, j) = out(row, j, sum);
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::DeltaCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    spmv_impl(exec, a, b, c, [](auto, auto, auto value) { return value; });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::DeltaCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    spmv_impl(exec, a, b, c, [&](size_type row, size_type col, ValueType sum) {
+        return valpha * sum + vbeta * c->at(row, col);
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_delta_bytes(std::shared_ptr<const OmpExecutor> exec,
+                       const matrix::Csr<ValueType, IndexType>* source,
+                       int64* row_bytes)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        int64 bytes{};
+        for (auto nz = row_ptrs[row] + 1; nz < row_ptrs[row + 1]; nz++) {
+            bytes += matrix::delta_csr::encoded_size(
+                static_cast<IndexType>(col_idxs[nz] - col_idxs[nz - 1]));
+        }
+        row_bytes[row] = bytes;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_COUNT_DELTA_BYTES_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_deltas(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* source,
+                    const int64* delta_ptrs, IndexType* base_cols,
+                    uint8* deltas)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto begin = row_ptrs[row];
+        const auto end = row_ptrs[row + 1];
+        base_cols[row] = begin < end ? col_idxs[begin] : zero<IndexType>();
+        auto out = deltas + delta_ptrs[row];
+        for (auto nz = begin + 1; nz < end; nz++) {
+            out = matrix::delta_csr::encode(
+                static_cast<IndexType>(col_idxs[nz] - col_idxs[nz - 1]), out);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_FILL_IN_DELTAS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_to_csr(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::DeltaCsr<ValueType, IndexType>* source,
+                    matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto base_cols = source->get_const_base_cols();
+    const auto delta_ptrs = source->get_const_delta_ptrs();
+    const auto deltas = source->get_const_deltas();
+    const auto num_rows = source->get_size()[0];
+    auto col_idxs = result->get_col_idxs();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        auto in = deltas + delta_ptrs[row];
+        auto col = base_cols[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (nz > row_ptrs[row]) {
+                IndexType delta{};
+                in = matrix::delta_csr::decode(in, delta);
+                col += delta;
+            }
+            col_idxs[nz] = col;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace delta_csr
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -5,6 +5,7 @@
 #include "core/matrix/fbcsr_kernels.hpp"
 
 #include <algorithm>
+#include <array>
 #include <numeric>
 #include <utility>
 
@@ -37,53 +38,91 @@ namespace omp {
 namespace fbcsr {
 
 
-template <typename ValueType, typename IndexType>
-void spmv(std::shared_ptr<const OmpExecutor> exec,
-          const matrix::Fbcsr<ValueType, IndexType>* a,
-          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+namespace {
+
+
+/**
+ * The block sizes for which the SpMV uses a kernel with a compile-time block
+ * size. Other block sizes use the generic kernel.
+ */
+using spmv_block_sizes = syn::value_list<int, 2, 3, 4, 5, 6, 7, 8>;
+
+/**
+ * The number of right-hand sides processed at once by the fixed-size kernel.
+ */
+constexpr int spmv_rhs_tile = 4;
+
+
+/**
+ * Computes the product of `a` and `b` for a compile-time block size, passing
+ * the result for each output entry through `out`. The accumulators for a tile
+ * of right-hand sides of the whole block row are kept in registers, and every
+ * block column is applied as a fused multiply-add of a contiguous column of
+ * the column-major block with a single entry of `b`.
+ */
+template <int block_size, typename ValueType, typename IndexType,
+          typename OutFn>
+void spmv_fixed_block(syn::value_list<int, block_size>,
+                      const matrix::Fbcsr<ValueType, IndexType>* a,
+                      const matrix::Dense<ValueType>* b,
+                      matrix::Dense<ValueType>* c, OutFn out)
 {
-    const int bs = a->get_block_size();
+    constexpr int bs2 = block_size * block_size;
     const auto nvecs = static_cast<IndexType>(b->get_size()[1]);
     const IndexType nbrows = a->get_num_block_rows();
-    const size_type nbnz = a->get_num_stored_blocks();
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
-    const acc::range<acc::block_col_major<const ValueType, 3>> avalues{
-        to_std_array<acc::size_type>(nbnz, bs, bs), a->get_const_values()};
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto values = a->get_const_values();
 
 #pragma omp parallel for
     for (IndexType ibrow = 0; ibrow < nbrows; ++ibrow) {
-        for (IndexType row = ibrow * bs; row < (ibrow + 1) * bs; ++row) {
-            for (IndexType rhs = 0; rhs < nvecs; rhs++) {
-                c->at(row, rhs) = zero<ValueType>();
+        for (IndexType rhs_begin = 0; rhs_begin < nvecs;
+             rhs_begin += spmv_rhs_tile) {
+            const auto num_rhs = std::min<IndexType>(spmv_rhs_tile,
+                                                     nvecs - rhs_begin);
+            std::array<std::array<ValueType, block_size>, spmv_rhs_tile> sums;
+            for (auto& rhs_sums : sums) {
+                rhs_sums.fill(zero<ValueType>());
             }
-        }
-        for (IndexType inz = row_ptrs[ibrow]; inz < row_ptrs[ibrow + 1];
-             ++inz) {
-            for (int ib = 0; ib < bs; ib++) {
-                const IndexType row = ibrow * bs + ib;
-                for (int jb = 0; jb < bs; jb++) {
-                    const auto val = avalues(inz, ib, jb);
-                    const auto col = col_idxs[inz] * bs + jb;
-                    for (size_type j = 0; j < nvecs; ++j) {
-                        c->at(row, j) += val * b->at(col, j);
+            for (IndexType inz = row_ptrs[ibrow]; inz < row_ptrs[ibrow + 1];
+                 ++inz) {
+                const auto block = values + inz * bs2;
+                const auto col_begin = col_idxs[inz] * block_size;
+                for (IndexType rhs = 0; rhs < num_rhs; rhs++) {
+                    auto& rhs_sums = sums[rhs];
+                    for (int jb = 0; jb < block_size; jb++) {
+                        const auto b_val =
+                            b->at(col_begin + jb, rhs_begin + rhs);
+#pragma omp simd
+                        for (int ib = 0; ib < block_size; ib++) {
+                            rhs_sums[ib] += block[jb * block_size + ib] * b_val;
+                        }
                     }
                 }
             }
+            for (IndexType rhs = 0; rhs < num_rhs; rhs++) {
+                for (int ib = 0; ib < block_size; ib++) {
+                    const auto row = ibrow * block_size + ib;
+                    const auto col = rhs_begin + rhs;
+                    c->at(row, col) = out(row, col, sums[rhs][ib]);
+                }
+            }
         }
     }
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_SPMV_KERNEL);
+GKO_ENABLE_IMPLEMENTATION_SELECTION(select_spmv_fixed_block,
+                                    spmv_fixed_block);
 
 
-template <typename ValueType, typename IndexType>
-void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
-                   const matrix::Dense<ValueType>* alpha,
-                   const matrix::Fbcsr<ValueType, IndexType>* a,
-                   const matrix::Dense<ValueType>* b,
-                   const matrix::Dense<ValueType>* beta,
-                   matrix::Dense<ValueType>* c)
+/**
+ * Computes the product of `a` and `b` for any block size, passing the result
+ * for each output entry through `out`.
+ */
+template <typename ValueType, typename IndexType, typename OutFn>
+void spmv_generic_block(const matrix::Fbcsr<ValueType, IndexType>* a,
+                        const matrix::Dense<ValueType>* b,
+                        matrix::Dense<ValueType>* c, OutFn out)
 {
     const int bs = a->get_block_size();
     const auto nvecs = static_cast<IndexType>(b->get_size()[1]);
@@ -91,33 +130,75 @@ void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
     const size_type nbnz = a->get_num_stored_blocks();
     auto row_ptrs = a->get_const_row_ptrs();
     auto col_idxs = a->get_const_col_idxs();
-    auto valpha = alpha->at(0, 0);
-    auto vbeta = beta->at(0, 0);
     const acc::range<acc::block_col_major<const ValueType, 3>> avalues{
         to_std_array<acc::size_type>(nbnz, bs, bs), a->get_const_values()};
 
 #pragma omp parallel for
     for (IndexType ibrow = 0; ibrow < nbrows; ++ibrow) {
-        for (IndexType row = ibrow * bs; row < (ibrow + 1) * bs; ++row) {
+        for (int ib = 0; ib < bs; ib++) {
+            const IndexType row = ibrow * bs + ib;
             for (IndexType rhs = 0; rhs < nvecs; rhs++) {
-                c->at(row, rhs) *= vbeta;
-            }
-        }
-        for (IndexType inz = row_ptrs[ibrow]; inz < row_ptrs[ibrow + 1];
-             ++inz) {
-            for (int ib = 0; ib < bs; ib++) {
-                const IndexType row = ibrow * bs + ib;
-                for (int jb = 0; jb < bs; jb++) {
-                    const auto val = avalues(inz, ib, jb);
-                    const auto col = col_idxs[inz] * bs + jb;
-                    for (size_type j = 0; j < nvecs; ++j)
-                        c->at(row, j) += valpha * val * b->at(col, j);
+                auto sum = zero<ValueType>();
+                for (IndexType inz = row_ptrs[ibrow];
+                     inz < row_ptrs[ibrow + 1]; ++inz) {
+                    for (int jb = 0; jb < bs; jb++) {
+                        const auto col = col_idxs[inz] * bs + jb;
+                        sum += avalues(inz, ib, jb) * b->at(col, rhs);
+                    }
                 }
+                c->at(row, rhs) = out(row, rhs, sum);
             }
         }
     }
 }
 
+
+template <typename ValueType, typename IndexType, typename OutFn>
+void spmv_impl(const matrix::Fbcsr<ValueType, IndexType>* a,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+               OutFn out)
+{
+    const int bs = a->get_block_size();
+    if (bs >= 2 && bs <= 8) {
+        select_spmv_fixed_block(
+            spmv_block_sizes(),
+            [bs](int compiled_block_size) { return bs == compiled_block_size; },
+            syn::value_list<int>(), syn::type_list<>(), a, b, c, out);
+    } else {
+        spmv_generic_block(a, b, c, out);
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Fbcsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    spmv_impl(a, b, c, [](auto, auto, auto value) { return value; });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::Fbcsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    spmv_impl(a, b, c, [&](auto row, auto col, ValueType sum) {
+        return valpha * sum + vbeta * c->at(row, col);
+    });
+}
+
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_FBCSR_ADVANCED_SPMV_KERNEL);
 
@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/reduced_csr_kernels.hpp"
+
+#include <algorithm>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/matrix/reduced_csr_storage.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The ReducedCsr matrix format namespace.
+ *
+ * @ingroup reduced_csr
+ */
+namespace reduced_csr {
+
+
+/**
+ * Computes the product of `a` and `b` row by row, passing the result for each
+ * output entry through `out`. The storage format is resolved once outside of
+ * the parallel loop, and the per-row scale of scaled formats is applied to the
+ * row sum instead of every single value.
+ */
+template <typename ValueType, typename IndexType, typename OutFn>
+void spmv_impl(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::ReducedCsr<ValueType, IndexType>* a,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+               OutFn out)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto scales = a->get_const_scales();
+    const auto num_rows = a->get_size()[0];
+    const auto num_rhs = b->get_size()[1];
+    matrix::reduced_csr::run_with_storage<ValueType>(
+        a->get_storage_mode(), [&](auto traits) {
+            using traits_type = decltype(traits);
+            const auto vals = matrix::reduced_csr::build_const_storage_accessor<
+                ValueType, typename traits_type::storage_type>(
+                a->get_const_storage(), a->get_num_stored_elements());
+#pragma omp parallel for
+            for (size_type row = 0; row < num_rows; row++) {
+                for (size_type j = 0; j < num_rhs; j++) {
+                    auto sum = zero<ValueType>();
+                    for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1];
+                         nz++) {
+                        ValueType val = vals(nz);
+                        sum += val * b->at(col_idxs[nz], j);
+                    }
+                    if constexpr (traits_type::is_scaled) {
+                        sum *= scales[row];
+                    }
+                    c->at(row, j) = out(row, j, sum);
+                }
+            }
+        });
+}
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::ReducedCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    spmv_impl(exec, a, b, c, [](auto, auto, auto value) { return value; });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::ReducedCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    spmv_impl(exec, a, b, c, [&](size_type row, size_type col, ValueType sum) {
+        return valpha * sum + vbeta * c->at(row, col);
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compress_values(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType>* source,
+                     matrix::reduced_storage mode, uint8* storage,
+                     remove_complex<ValueType>* scales)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto values = source->get_const_values();
+    const auto num_rows = source->get_size()[0];
+    const auto nnz = source->get_num_stored_elements();
+    matrix::reduced_csr::run_with_storage<ValueType>(mode, [&](auto traits) {
+        using traits_type = decltype(traits);
+        using storage_type = typename traits_type::storage_type;
+        if constexpr (traits_type::is_scaled) {
+            auto out = reinterpret_cast<storage_type*>(storage);
+#pragma omp parallel for
+            for (size_type row = 0; row < num_rows; row++) {
+                auto max_abs = zero<remove_complex<ValueType>>();
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    max_abs = std::max(max_abs, abs(values[nz]));
+                }
+                const auto scale = matrix::reduced_csr::compute_scale(max_abs);
+                scales[row] = scale;
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    out[nz] =
+                        matrix::reduced_csr::to_scaled_int16(values[nz], scale);
+                }
+            }
+        } else {
+            auto out = matrix::reduced_csr::build_storage_accessor<
+                ValueType, storage_type>(storage, nnz);
+#pragma omp parallel for
+            for (size_type nz = 0; nz < nnz; nz++) {
+                out(nz) = values[nz];
+            }
+        }
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_COMPRESS_VALUES_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void decompress_values(std::shared_ptr<const OmpExecutor> exec,
+                       const matrix::ReducedCsr<ValueType, IndexType>* source,
+                       ValueType* values)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto scales = source->get_const_scales();
+    const auto num_rows = source->get_size()[0];
+    matrix::reduced_csr::run_with_storage<ValueType>(
+        source->get_storage_mode(), [&](auto traits) {
+            using traits_type = decltype(traits);
+            const auto vals = matrix::reduced_csr::build_const_storage_accessor<
+                ValueType, typename traits_type::storage_type>(
+                source->get_const_storage(),
+                source->get_num_stored_elements());
+#pragma omp parallel for
+            for (size_type row = 0; row < num_rows; row++) {
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    values[nz] = vals(nz);
+                    if constexpr (traits_type::is_scaled) {
+                        values[nz] *= scales[row];
+                    }
+                }
+            }
+        });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_DECOMPRESS_VALUES_KERNEL);
+
+
+}  // namespace reduced_csr
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
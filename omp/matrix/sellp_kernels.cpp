@@ -4,12 +4,14 @@
 
 #include "core/matrix/sellp_kernels.hpp"
 
-#include <array>
+#include <algorithm>
 
 #include <omp.h>
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 
+#include "core/base/allocator.hpp"
+
 
 namespace gko {
 namespace kernels {
@@ -22,47 +24,13 @@ namespace omp {
 namespace sellp {
 
 
-template <int num_rhs, typename ValueType, typename IndexType, typename OutFn>
-void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
-                    const matrix::Sellp<ValueType, IndexType>* a,
-                    const matrix::Dense<ValueType>* b,
-                    matrix::Dense<ValueType>* c, OutFn out)
-{
-    GKO_ASSERT(b->get_size()[1] == num_rhs);
-    auto slice_lengths = a->get_const_slice_lengths();
-    auto slice_sets = a->get_const_slice_sets();
-    auto slice_size = a->get_slice_size();
-    auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
-#pragma omp parallel for collapse(2)
-    for (size_type slice = 0; slice < slice_num; slice++) {
-        for (size_type row = 0; row < slice_size; row++) {
-            size_type global_row = slice * slice_size + row;
-            if (global_row < a->get_size()[0]) {
-                std::array<ValueType, num_rhs> partial_sum;
-                partial_sum.fill(zero<ValueType>());
-                for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                    auto val = a->val_at(row, slice_sets[slice], i);
-                    auto col = a->col_at(row, slice_sets[slice], i);
-                    if (col != invalid_index<IndexType>()) {
-#pragma unroll
-                        for (size_type j = 0; j < num_rhs; j++) {
-                            partial_sum[j] += val * b->at(col, j);
-                        }
-                    }
-                }
-#pragma unroll
-                for (size_type j = 0; j < num_rhs; j++) {
-                    [&] {
-                        c->at(global_row, j) =
-                            out(global_row, j, partial_sum[j]);
-                    }();
-                }
-            }
-        }
-    }
-}
-
-
+/**
+ * Computes the product of `a` with a block of up to block_size columns of `b`
+ * at a time. The stored columns of each slice are contiguous over the rows of
+ * the slice, so the innermost loop runs over the rows of a slice and is
+ * vectorized: for a slice size matching the SIMD width (SELL-C-sigma), every
+ * stored column of a slice is processed by a single vector instruction.
+ */
 template <int block_size, typename ValueType, typename IndexType,
           typename OutFn>
 void spmv_blocked(std::shared_ptr<const OmpExecutor> exec,
@@ -70,56 +38,66 @@ void spmv_blocked(std::shared_ptr<const OmpExecutor> exec,
                   const matrix::Dense<ValueType>* b,
                   matrix::Dense<ValueType>* c, OutFn out)
 {
-    auto slice_lengths = a->get_const_slice_lengths();
-    auto slice_sets = a->get_const_slice_sets();
-    auto slice_size = a->get_slice_size();
-    auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
+    const auto vals = a->get_const_values();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto perm = a->get_const_permutation();
+    const auto slice_lengths = a->get_const_slice_lengths();
+    const auto slice_sets = a->get_const_slice_sets();
+    const auto slice_size = a->get_slice_size();
+    const auto num_rows = a->get_size()[0];
+    const auto slice_num = ceildiv(num_rows, slice_size);
     const auto num_rhs = b->get_size()[1];
-    const auto rounded_rhs = num_rhs / block_size * block_size;
-#pragma omp parallel for collapse(2)
-    for (size_type slice = 0; slice < slice_num; slice++) {
-        for (size_type row = 0; row < slice_size; row++) {
-            size_type global_row = slice * slice_size + row;
-            if (global_row < a->get_size()[0]) {
-                std::array<ValueType, block_size> partial_sum;
-                for (size_type rhs_base = 0; rhs_base < rounded_rhs;
-                     rhs_base += block_size) {
-                    partial_sum.fill(zero<ValueType>());
-                    for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                        auto val = a->val_at(row, slice_sets[slice], i);
-                        auto col = a->col_at(row, slice_sets[slice], i);
-                        if (col != invalid_index<IndexType>()) {
-#pragma unroll
-                            for (size_type j = 0; j < block_size; j++) {
-                                partial_sum[j] +=
-                                    val * b->at(col, j + rhs_base);
-                            }
+    const auto b_vals = b->get_const_values();
+    const auto b_stride = b->get_stride();
+#pragma omp parallel
+    {
+        // partial_sum[j * slice_size + row] for the rows of the current slice
+        vector<ValueType> partial_sum(block_size * slice_size, exec);
+#pragma omp for
+        for (size_type slice = 0; slice < slice_num; slice++) {
+            const auto slice_begin = slice * slice_size;
+            const auto slice_rows =
+                std::min(slice_size, num_rows - slice_begin);
+            for (size_type rhs_base = 0; rhs_base < num_rhs;
+                 rhs_base += block_size) {
+                const auto block_rhs =
+                    std::min<size_type>(block_size, num_rhs - rhs_base);
+                std::fill(partial_sum.begin(), partial_sum.end(),
+                          zero<ValueType>());
+                for (size_type i = 0; i < slice_lengths[slice]; i++) {
+                    const auto offset = (slice_sets[slice] + i) * slice_size;
+                    const auto slice_vals = vals + offset;
+                    const auto slice_cols = col_idxs + offset;
+                    for (size_type j = 0; j < block_rhs; j++) {
+                        const auto sum = partial_sum.data() + j * slice_size;
+                        const auto b_col = b_vals + rhs_base + j;
+#pragma omp simd
+                        for (size_type row = 0; row < slice_rows; row++) {
+                            const auto col = slice_cols[row];
+                            const bool valid =
+                                col != invalid_index<IndexType>();
+                            // padding entries read the first row of b instead
+                            // of an invalid one and discard the product
+                            const auto prod =
+                                slice_vals[row] *
+                                b_col[(valid ? col : 0) * b_stride];
+                            sum[row] += valid ? prod : zero<ValueType>();
                         }
                     }
-#pragma unroll
-                    for (size_type j = 0; j < block_size; j++) {
+                }
+                for (size_type j = 0; j < block_rhs; j++) {
+                    for (size_type row = 0; row < slice_rows; row++) {
+                        const auto global_row = slice_begin + row;
+                        const auto out_row =
+                            perm ? static_cast<size_type>(perm[global_row])
+                                 : global_row;
                         [&] {
-                            c->at(global_row, j + rhs_base) =
-                                out(global_row, j + rhs_base, partial_sum[j]);
+                            c->at(out_row, rhs_base + j) =
+                                out(out_row, rhs_base + j,
+                                    partial_sum[j * slice_size + row]);
                         }();
                     }
                 }
-                partial_sum.fill(zero<ValueType>());
-                for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                    auto val = a->val_at(row, slice_sets[slice], i);
-                    auto col = a->col_at(row, slice_sets[slice], i);
-                    if (col != invalid_index<IndexType>()) {
-                        for (size_type j = rounded_rhs; j < num_rhs; j++) {
-                            partial_sum[j - rounded_rhs] += val * b->at(col, j);
-                        }
-                    }
-                }
-                for (size_type j = rounded_rhs; j < num_rhs; j++) {
-                    [&] {
-                        c->at(global_row, j) =
-                            out(global_row, j, partial_sum[j - rounded_rhs]);
-                    }();
-                }
             }
         }
     }
@@ -137,19 +115,15 @@ void spmv(std::shared_ptr<const OmpExecutor> exec,
     }
     auto out = [](auto, auto, auto value) { return value; };
     if (num_rhs == 1) {
-        spmv_small_rhs<1>(exec, a, b, c, out);
+        spmv_blocked<1>(exec, a, b, c, out);
         return;
     }
     if (num_rhs == 2) {
-        spmv_small_rhs<2>(exec, a, b, c, out);
+        spmv_blocked<2>(exec, a, b, c, out);
         return;
     }
     if (num_rhs == 3) {
-        spmv_small_rhs<3>(exec, a, b, c, out);
-        return;
-    }
-    if (num_rhs == 4) {
-        spmv_small_rhs<4>(exec, a, b, c, out);
+        spmv_blocked<3>(exec, a, b, c, out);
         return;
     }
     spmv_blocked<4>(exec, a, b, c, out);
@@ -176,19 +150,15 @@ void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
         return alpha_val * value + beta_val * c->at(i, j);
     };
     if (num_rhs == 1) {
-        spmv_small_rhs<1>(exec, a, b, c, out);
+        spmv_blocked<1>(exec, a, b, c, out);
         return;
     }
     if (num_rhs == 2) {
-        spmv_small_rhs<2>(exec, a, b, c, out);
+        spmv_blocked<2>(exec, a, b, c, out);
         return;
     }
     if (num_rhs == 3) {
-        spmv_small_rhs<3>(exec, a, b, c, out);
-        return;
-    }
-    if (num_rhs == 4) {
-        spmv_small_rhs<4>(exec, a, b, c, out);
+        spmv_blocked<3>(exec, a, b, c, out);
         return;
     }
     spmv_blocked<4>(exec, a, b, c, out);
@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/stencil_kernels.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+#include "core/matrix/stencil_helpers.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The Stencil matrix format namespace.
+ *
+ * @ingroup stencil
+ */
+namespace stencil {
+namespace {
+
+
+/**
+ * Number of consecutive grid points of a grid line that are computed
+ * together. The corresponding parts of the (up to 9) neighboring grid lines
+ * stay in the L1 cache while the stencil points are applied one after the
+ * other.
+ */
+constexpr int64 line_tile_size = 256;
+
+
+/** The points of a stencil, stored as offsets to the center. */
+struct stencil_points {
+    explicit stencil_points(matrix::stencil_type type, int64 nx, int64 ny)
+        : num_points{0}
+    {
+        matrix::stencil::for_each_point(
+            type, [&](int point, int dx, int dy, int dz) {
+                this->dx[point] = dx;
+                this->dy[point] = dy;
+                this->dz[point] = dz;
+                offset[point] = dx + nx * (dy + ny * dz);
+                num_points++;
+            });
+    }
+
+    int num_points;
+    std::array<int, 27> dx;
+    std::array<int, 27> dy;
+    std::array<int, 27> dz;
+    std::array<int64, 27> offset;
+};
+
+
+/**
+ * Computes the product of `a` and `b`, passing the result for each output
+ * entry through `out`.
+ *
+ * The grid lines are distributed among the threads. Each line is processed
+ * in tiles, and each stencil point contributes to a whole tile at once. This
+ * makes the innermost loop a unit-stride loop without any index loads or
+ * boundary checks, which the compiler can vectorize.
+ */
+template <typename ValueType, typename IndexType, typename OutFn>
+void spmv_impl(const matrix::Stencil<ValueType, IndexType>* a,
+               const matrix::Dense<ValueType>* b, OutFn out)
+{
+    const auto grid = a->get_grid_size();
+    const auto nx = static_cast<int64>(grid[0]);
+    const auto ny = static_cast<int64>(grid[1]);
+    const auto nz = static_cast<int64>(grid[2]);
+    const auto num_rows = static_cast<int64>(a->get_size()[0]);
+    const auto num_rhs = b->get_size()[1];
+    const auto b_vals = b->get_const_values();
+    const auto b_stride = static_cast<int64>(b->get_stride());
+    const auto coefs = a->get_const_coefficients();
+    const auto variable = a->has_variable_coefficients();
+    const stencil_points points{a->get_stencil_type(), nx, ny};
+#pragma omp parallel for collapse(2)
+    for (int64 z = 0; z < nz; z++) {
+        for (int64 y = 0; y < ny; y++) {
+            const auto line = nx * (y + ny * z);
+            for (int64 tile = 0; tile < nx; tile += line_tile_size) {
+                const auto tile_end = std::min(nx, tile + line_tile_size);
+                for (size_type j = 0; j < num_rhs; j++) {
+                    std::array<ValueType, line_tile_size> sum{};
+                    for (int p = 0; p < points.num_points; p++) {
+                        if (!matrix::stencil::is_in_grid(y, points.dy[p],
+                                                         ny) ||
+                            !matrix::stencil::is_in_grid(z, points.dz[p],
+                                                         nz)) {
+                            continue;
+                        }
+                        // skip the neighbors outside of the line
+                        const auto begin =
+                            std::max<int64>(tile, -points.dx[p]);
+                        const auto end =
+                            std::min<int64>(tile_end, nx - points.dx[p]);
+                        const auto col_offset = line + points.offset[p];
+                        if (variable) {
+                            const auto line_coefs =
+                                coefs + p * num_rows + line;
+#pragma omp simd
+                            for (auto x = begin; x < end; x++) {
+                                sum[x - tile] +=
+                                    line_coefs[x] *
+                                    b_vals[(col_offset + x) * b_stride + j];
+                            }
+                        } else {
+                            const auto coef = coefs[p];
+#pragma omp simd
+                            for (auto x = begin; x < end; x++) {
+                                sum[x - tile] +=
+                                    coef *
+                                    b_vals[(col_offset + x) * b_stride + j];
+                            }
+                        }
+                    }
+                    for (auto x = tile; x < tile_end; x++) {
+                        out(line + x, j, sum[x - tile]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * Calls `callback(point, col)` for all entries of row `(x, y, z)` of a
+ * stencil matrix in increasing column order.
+ */
+template <typename Callback>
+void for_each_row_entry(const stencil_points& points, int64 x, int64 y,
+                        int64 z, int64 nx, int64 ny, int64 nz,
+                        Callback callback)
+{
+    const auto row = x + nx * (y + ny * z);
+    for (int p = 0; p < points.num_points; p++) {
+        if (matrix::stencil::is_in_grid(x, points.dx[p], nx) &&
+            matrix::stencil::is_in_grid(y, points.dy[p], ny) &&
+            matrix::stencil::is_in_grid(z, points.dz[p], nz)) {
+            callback(p, row + points.offset[p]);
+        }
+    }
+}
+
+
+}  // anonymous namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Stencil<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    spmv_impl(a, b, [&](int64 row, size_type col, ValueType sum) {
+        c->at(row, col) = sum;
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::Stencil<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    spmv_impl(a, b, [&](int64 row, size_type col, ValueType sum) {
+        c->at(row, col) = valpha * sum + vbeta * c->at(row, col);
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_row_nonzeros(std::shared_ptr<const OmpExecutor> exec,
+                        const matrix::Stencil<ValueType, IndexType>* source,
+                        IndexType* row_nnz)
+{
+    const auto grid = source->get_grid_size();
+    const auto nx = static_cast<int64>(grid[0]);
+    const auto ny = static_cast<int64>(grid[1]);
+    const auto nz = static_cast<int64>(grid[2]);
+    const stencil_points points{source->get_stencil_type(), nx, ny};
+#pragma omp parallel for collapse(3)
+    for (int64 z = 0; z < nz; z++) {
+        for (int64 y = 0; y < ny; y++) {
+            for (int64 x = 0; x < nx; x++) {
+                IndexType count{};
+                for_each_row_entry(points, x, y, z, nx, ny, nz,
+                                   [&](int, int64) { count++; });
+                row_nnz[x + nx * (y + ny * z)] = count;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_COUNT_ROW_NONZEROS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const OmpExecutor> exec,
+                 const matrix::Stencil<ValueType, IndexType>* source,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto grid = source->get_grid_size();
+    const auto nx = static_cast<int64>(grid[0]);
+    const auto ny = static_cast<int64>(grid[1]);
+    const auto nz = static_cast<int64>(grid[2]);
+    const auto num_rows = static_cast<int64>(source->get_size()[0]);
+    const auto coefs = source->get_const_coefficients();
+    const auto variable = source->has_variable_coefficients();
+    const auto row_ptrs = result->get_const_row_ptrs();
+    auto col_idxs = result->get_col_idxs();
+    auto vals = result->get_values();
+    const stencil_points points{source->get_stencil_type(), nx, ny};
+#pragma omp parallel for collapse(3)
+    for (int64 z = 0; z < nz; z++) {
+        for (int64 y = 0; y < ny; y++) {
+            for (int64 x = 0; x < nx; x++) {
+                const auto row = x + nx * (y + ny * z);
+                auto nz_idx = row_ptrs[row];
+                for_each_row_entry(
+                    points, x, y, z, nx, ny, nz, [&](int p, int64 col) {
+                        col_idxs[nz_idx] = static_cast<IndexType>(col);
+                        vals[nz_idx] =
+                            variable ? coefs[p * num_rows + row] : coefs[p];
+                        nz_idx++;
+                    });
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_FILL_IN_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::Stencil<ValueType, IndexType>* source,
+                      matrix::Diagonal<ValueType>* diag)
+{
+    const auto num_rows = source->get_size()[0];
+    const auto center = (source->get_num_points() - 1) / 2;
+    const auto coefs = source->get_const_coefficients();
+    const auto variable = source->has_variable_coefficients();
+    auto diag_values = diag->get_values();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        diag_values[row] =
+            variable ? coefs[center * num_rows + row] : coefs[center];
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace stencil
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
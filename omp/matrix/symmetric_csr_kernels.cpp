@@ -0,0 +1,336 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+#include <algorithm>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+#include "core/base/allocator.hpp"
+#include "core/base/iterator_factory.hpp"
+#include "omp/components/atomic.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The SymmetricCsr matrix format namespace.
+ *
+ * @ingroup symmetric_csr
+ */
+namespace symmetric_csr {
+
+
+/**
+ * Computes the product of `a` and `b`, passing the result for each output
+ * entry through `out`.
+ *
+ * Each thread handles a contiguous chunk of rows. Since the transposed
+ * contribution of an upper triangular entry goes to a row below the current
+ * one, a thread accumulates its results in a private window that covers its
+ * own chunk and the following one, and the windows of neighboring threads are
+ * summed up afterwards. Contributions to rows beyond the window are added
+ * atomically to a shared overflow area, so the workspace stays bounded by
+ * three times the size of the output independent of the matrix bandwidth.
+ * The workspace is kept between calls and only grows when necessary.
+ */
+template <typename ValueType, typename IndexType, typename OutFn>
+void spmv_impl(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::SymmetricCsr<ValueType, IndexType>* a,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+               array<ValueType>& workspace, OutFn out)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    const auto num_rows = a->get_size()[0];
+    const auto num_rhs = b->get_size()[1];
+    vector<size_type> window_ends(exec);
+    bool uses_overflow = false;
+#pragma omp parallel
+    {
+        const auto num_threads = static_cast<size_type>(omp_get_num_threads());
+        const auto tid = static_cast<size_type>(omp_get_thread_num());
+        const auto chunk_size = ceildiv(num_rows, num_threads);
+        const auto window_size = 2 * chunk_size;
+        const auto begin = std::min(chunk_size * tid, num_rows);
+        const auto end = std::min(begin + chunk_size, num_rows);
+        const auto window_limit = std::min(begin + window_size, num_rows);
+#pragma omp single
+        {
+            window_ends.resize(num_threads);
+            const auto required_size =
+                (window_size * num_threads + num_rows) * num_rhs;
+            if (workspace.get_size() < required_size) {
+                workspace.resize_and_reset(required_size);
+            }
+        }
+        auto window_end = end;
+        for (auto row = begin; row < end; row++) {
+            // the column indexes are sorted, so the last one is the largest
+            if (row_ptrs[row] < row_ptrs[row + 1]) {
+                window_end = std::max(
+                    window_end,
+                    static_cast<size_type>(col_idxs[row_ptrs[row + 1] - 1]) +
+                        1);
+            }
+        }
+        if (window_end > window_limit) {
+            window_end = window_limit;
+#pragma omp atomic write
+            uses_overflow = true;
+        }
+        window_ends[tid] = window_end;
+        const auto window = workspace.get_data() + tid * window_size * num_rhs;
+        const auto overflow =
+            workspace.get_data() + num_threads * window_size * num_rhs;
+        std::fill_n(window, (window_end - begin) * num_rhs, zero<ValueType>());
+#pragma omp barrier
+        if (uses_overflow) {
+#pragma omp for
+            for (size_type i = 0; i < num_rows * num_rhs; i++) {
+                overflow[i] = zero<ValueType>();
+            }
+        }
+        for (auto row = begin; row < end; row++) {
+            const auto local_row = window + (row - begin) * num_rhs;
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                const auto col = static_cast<size_type>(col_idxs[nz]);
+                const auto val = vals[nz];
+                for (size_type j = 0; j < num_rhs; j++) {
+                    local_row[j] += val * b->at(col, j);
+                }
+                if (col == row) {
+                    continue;
+                }
+                const auto conj_val = conj(val);
+                if (col < window_end) {
+                    const auto local_col = window + (col - begin) * num_rhs;
+                    for (size_type j = 0; j < num_rhs; j++) {
+                        local_col[j] += conj_val * b->at(row, j);
+                    }
+                } else {
+                    for (size_type j = 0; j < num_rhs; j++) {
+                        atomic_add(overflow[col * num_rhs + j],
+                                   conj_val * b->at(row, j));
+                    }
+                }
+            }
+        }
+#pragma omp barrier
+        // only the previous thread's window reaches into this chunk
+        const auto prev_window =
+            tid > 0 ? window - window_size * num_rhs : nullptr;
+        const auto prev_end = tid > 0 ? window_ends[tid - 1] : begin;
+        for (auto row = begin; row < end; row++) {
+            for (size_type j = 0; j < num_rhs; j++) {
+                auto sum = window[(row - begin) * num_rhs + j];
+                if (row < prev_end) {
+                    sum += prev_window[(row + chunk_size - begin) * num_rhs +
+                                       j];
+                }
+                if (uses_overflow) {
+                    sum += overflow[row * num_rhs + j];
+                }
+                c->at(row, j) = out(row, j, sum);
+            }
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::SymmetricCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+          array<ValueType>& workspace)
+{
+    spmv_impl(exec, a, b, c, workspace,
+              [](auto, auto, auto value) { return value; });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::SymmetricCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c, array<ValueType>& workspace)
+{
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    spmv_impl(exec, a, b, c, workspace,
+              [&](size_type row, size_type col, ValueType sum) {
+                  return valpha * sum + vbeta * c->at(row, col);
+              });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_upper_nonzeros(std::shared_ptr<const OmpExecutor> exec,
+                          const matrix::Csr<ValueType, IndexType>* source,
+                          IndexType* row_nnz)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        row_nnz[row] = static_cast<IndexType>(std::count_if(
+            col_idxs + row_ptrs[row], col_idxs + row_ptrs[row + 1],
+            [&](auto col) { return col >= static_cast<IndexType>(row); }));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NONZEROS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_upper(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Csr<ValueType, IndexType>* source,
+                   const IndexType* row_ptrs, IndexType* col_idxs,
+                   ValueType* values)
+{
+    auto src_row_ptrs = source->get_const_row_ptrs();
+    auto src_col_idxs = source->get_const_col_idxs();
+    auto src_vals = source->get_const_values();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        auto out = row_ptrs[row];
+        for (auto nz = src_row_ptrs[row]; nz < src_row_ptrs[row + 1]; nz++) {
+            if (src_col_idxs[nz] >= static_cast<IndexType>(row)) {
+                col_idxs[out] = src_col_idxs[nz];
+                values[out] = src_vals[nz];
+                out++;
+            }
+        }
+        auto it = detail::make_zip_iterator(col_idxs + row_ptrs[row],
+                                            values + row_ptrs[row]);
+        std::sort(it, it + (row_ptrs[row + 1] - row_ptrs[row]),
+                  [](auto a, auto b) { return get<0>(a) < get<0>(b); });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_UPPER_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_full_nonzeros(
+    std::shared_ptr<const OmpExecutor> exec,
+    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+    IndexType* row_nnz)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        row_nnz[row] = row_ptrs[row + 1] - row_ptrs[row];
+    }
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] != static_cast<IndexType>(row)) {
+#pragma omp atomic
+                row_nnz[col_idxs[nz]]++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_FULL_NONZEROS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const OmpExecutor> exec,
+                 const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    auto vals = source->get_const_values();
+    auto out_row_ptrs = result->get_const_row_ptrs();
+    auto out_col_idxs = result->get_col_idxs();
+    auto out_vals = result->get_values();
+    const auto num_rows = source->get_size()[0];
+    vector<IndexType> cursors(out_row_ptrs, out_row_ptrs + num_rows, exec);
+    // the lower triangle of each row is stored in front of its upper triangle
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        auto out = out_row_ptrs[row + 1] - (row_ptrs[row + 1] - row_ptrs[row]);
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            out_col_idxs[out] = col_idxs[nz];
+            out_vals[out] = vals[nz];
+            out++;
+            const auto col = col_idxs[nz];
+            if (col != static_cast<IndexType>(row)) {
+                IndexType mirror_out;
+#pragma omp atomic capture
+                mirror_out = cursors[col]++;
+                out_col_idxs[mirror_out] = static_cast<IndexType>(row);
+                out_vals[mirror_out] = conj(vals[nz]);
+            }
+        }
+    }
+    // the lower triangles were filled in arbitrary order
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto begin = out_row_ptrs[row];
+        const auto upper_size = row_ptrs[row + 1] - row_ptrs[row];
+        const auto lower_size = out_row_ptrs[row + 1] - begin - upper_size;
+        auto it = detail::make_zip_iterator(out_col_idxs + begin,
+                                            out_vals + begin);
+        std::sort(it, it + lower_size,
+                  [](auto a, auto b) { return get<0>(a) < get<0>(b); });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                      matrix::Diagonal<ValueType>* diag)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    auto vals = source->get_const_values();
+    auto diag_values = diag->get_values();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        const auto begin = row_ptrs[row];
+        if (begin < row_ptrs[row + 1] &&
+            col_idxs[begin] == static_cast<IndexType>(row)) {
+            diag_values[row] = vals[begin];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace symmetric_csr
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,345 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/vbcsr_kernels.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/base/allocator.hpp"
+#include "core/matrix/vbcsr_helpers.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The Vbcsr matrix format namespace.
+ *
+ * @ingroup vbcsr
+ */
+namespace vbcsr {
+
+
+/**
+ * Adds the product of the row-major `num_rows x num_cols` block `block` and
+ * the rows `[col_begin, col_begin + num_cols)` of column `j` of `b` to `sums`.
+ */
+template <int num_rows, int num_cols, typename ValueType, typename IndexType>
+inline void accumulate_block(const ValueType* block,
+                             const matrix::Dense<ValueType>* b,
+                             IndexType col_begin, size_type j,
+                             std::array<ValueType, num_rows>& sums)
+{
+    std::array<ValueType, num_cols> local_b;
+    for (int col = 0; col < num_cols; col++) {
+        local_b[col] = b->at(col_begin + col, j);
+    }
+    for (int row = 0; row < num_rows; row++) {
+        for (int col = 0; col < num_cols; col++) {
+            sums[row] += block[row * num_cols + col] * local_b[col];
+        }
+    }
+}
+
+
+/**
+ * Computes the product of block row `brow` of `a` and `b` for a fixed number
+ * of rows per block, keeping the partial sums of the whole block row in
+ * registers. Blocks with up to four columns use fully unrolled kernels.
+ */
+template <int num_rows, typename ValueType, typename IndexType, typename OutFn>
+void spmv_fixed_block_row(const matrix::Vbcsr<ValueType, IndexType>* a,
+                          const matrix::Dense<ValueType>* b,
+                          matrix::Dense<ValueType>* c, size_type brow,
+                          OutFn out)
+{
+    const auto block_offsets = a->get_const_block_offsets();
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto value_ptrs = a->get_const_value_ptrs();
+    const auto vals = a->get_const_values();
+    const auto row_begin = block_offsets[brow];
+    for (size_type j = 0; j < b->get_size()[1]; j++) {
+        std::array<ValueType, num_rows> sums{};
+        for (auto k = row_ptrs[brow]; k < row_ptrs[brow + 1]; k++) {
+            const auto col_begin = block_offsets[col_idxs[k]];
+            const auto num_cols = block_offsets[col_idxs[k] + 1] - col_begin;
+            const auto block = vals + value_ptrs[k];
+            switch (num_cols) {
+            case 1:
+                accumulate_block<num_rows, 1>(block, b, col_begin, j, sums);
+                break;
+            case 2:
+                accumulate_block<num_rows, 2>(block, b, col_begin, j, sums);
+                break;
+            case 3:
+                accumulate_block<num_rows, 3>(block, b, col_begin, j, sums);
+                break;
+            case 4:
+                accumulate_block<num_rows, 4>(block, b, col_begin, j, sums);
+                break;
+            default:
+                for (int row = 0; row < num_rows; row++) {
+                    for (IndexType col = 0; col < num_cols; col++) {
+                        sums[row] += block[row * num_cols + col] *
+                                     b->at(col_begin + col, j);
+                    }
+                }
+            }
+        }
+        for (int row = 0; row < num_rows; row++) {
+            c->at(row_begin + row, j) = out(row_begin + row, j, sums[row]);
+        }
+    }
+}
+
+
+/**
+ * Computes the product of block row `brow` of `a` and `b` for arbitrary block
+ * sizes, one row at a time.
+ */
+template <typename ValueType, typename IndexType, typename OutFn>
+void spmv_generic_block_row(const matrix::Vbcsr<ValueType, IndexType>* a,
+                            const matrix::Dense<ValueType>* b,
+                            matrix::Dense<ValueType>* c, size_type brow,
+                            OutFn out)
+{
+    const auto block_offsets = a->get_const_block_offsets();
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto value_ptrs = a->get_const_value_ptrs();
+    const auto vals = a->get_const_values();
+    const auto row_begin = block_offsets[brow];
+    const auto num_rows = block_offsets[brow + 1] - row_begin;
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (size_type j = 0; j < b->get_size()[1]; j++) {
+            auto sum = zero<ValueType>();
+            for (auto k = row_ptrs[brow]; k < row_ptrs[brow + 1]; k++) {
+                const auto col_begin = block_offsets[col_idxs[k]];
+                const auto num_cols =
+                    block_offsets[col_idxs[k] + 1] - col_begin;
+                const auto block = vals + value_ptrs[k] + row * num_cols;
+                for (IndexType col = 0; col < num_cols; col++) {
+                    sum += block[col] * b->at(col_begin + col, j);
+                }
+            }
+            c->at(row_begin + row, j) = out(row_begin + row, j, sum);
+        }
+    }
+}
+
+
+/**
+ * Computes the product of `a` and `b` in parallel over the block rows,
+ * passing the result for each output entry through `out`.
+ */
+template <typename ValueType, typename IndexType, typename OutFn>
+void spmv_impl(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::Vbcsr<ValueType, IndexType>* a,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+               OutFn out)
+{
+    const auto block_offsets = a->get_const_block_offsets();
+    const auto num_block_rows = a->get_num_block_rows();
+#pragma omp parallel for schedule(dynamic, 64)
+    for (size_type brow = 0; brow < num_block_rows; brow++) {
+        switch (block_offsets[brow + 1] - block_offsets[brow]) {
+        case 1:
+            spmv_fixed_block_row<1>(a, b, c, brow, out);
+            break;
+        case 2:
+            spmv_fixed_block_row<2>(a, b, c, brow, out);
+            break;
+        case 3:
+            spmv_fixed_block_row<3>(a, b, c, brow, out);
+            break;
+        case 4:
+            spmv_fixed_block_row<4>(a, b, c, brow, out);
+            break;
+        default:
+            spmv_generic_block_row(a, b, c, brow, out);
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Vbcsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    spmv_impl(exec, a, b, c, [](auto, auto, auto value) { return value; });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_VBCSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::Vbcsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    spmv_impl(exec, a, b, c, [&](size_type row, size_type col, ValueType sum) {
+        return valpha * sum + vbeta * c->at(row, col);
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_VBCSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_blocks(std::shared_ptr<const OmpExecutor> exec,
+                  const matrix::Csr<ValueType, IndexType>* source,
+                  const IndexType* block_offsets, size_type num_block_rows,
+                  IndexType* block_count, IndexType* value_count)
+{
+#pragma omp parallel
+    {
+        vector<IndexType> block_cols(exec);
+#pragma omp for
+        for (size_type brow = 0; brow < num_block_rows; brow++) {
+            matrix::vbcsr::collect_block_cols(
+                source, block_offsets, num_block_rows, brow, block_cols);
+            IndexType num_cols{};
+            for (auto bcol : block_cols) {
+                num_cols += block_offsets[bcol + 1] - block_offsets[bcol];
+            }
+            block_count[brow] = static_cast<IndexType>(block_cols.size());
+            value_count[brow] =
+                (block_offsets[brow + 1] - block_offsets[brow]) * num_cols;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_VBCSR_COUNT_BLOCKS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_blocks(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* source,
+                    const IndexType* block_offsets, size_type num_block_rows,
+                    const IndexType* row_ptrs, const IndexType* row_value_ptrs,
+                    IndexType* col_idxs, IndexType* value_ptrs,
+                    ValueType* values)
+{
+    auto src_row_ptrs = source->get_const_row_ptrs();
+    auto src_col_idxs = source->get_const_col_idxs();
+    auto src_vals = source->get_const_values();
+#pragma omp parallel
+    {
+        vector<IndexType> block_cols(exec);
+#pragma omp for
+        for (size_type brow = 0; brow < num_block_rows; brow++) {
+            matrix::vbcsr::collect_block_cols(
+                source, block_offsets, num_block_rows, brow, block_cols);
+            const auto row_begin = block_offsets[brow];
+            const auto num_rows = block_offsets[brow + 1] - row_begin;
+            auto value_ptr = row_value_ptrs[brow];
+            for (size_type i = 0; i < block_cols.size(); i++) {
+                const auto k = row_ptrs[brow] + i;
+                const auto bcol = block_cols[i];
+                const auto block_size =
+                    num_rows * (block_offsets[bcol + 1] - block_offsets[bcol]);
+                col_idxs[k] = bcol;
+                value_ptrs[k] = value_ptr;
+                std::fill_n(values + value_ptr, block_size,
+                            zero<ValueType>());
+                value_ptr += block_size;
+            }
+            for (auto row = row_begin; row < row_begin + num_rows; row++) {
+                // the block columns of a sorted row are non-decreasing
+                size_type i{};
+                for (auto nz = src_row_ptrs[row]; nz < src_row_ptrs[row + 1];
+                     nz++) {
+                    const auto col = src_col_idxs[nz];
+                    const auto bcol = matrix::vbcsr::find_block(
+                        block_offsets, num_block_rows, col);
+                    if (block_cols[i] != bcol) {
+                        i = std::lower_bound(block_cols.begin(),
+                                             block_cols.end(), bcol) -
+                            block_cols.begin();
+                    }
+                    const auto k = row_ptrs[brow] + i;
+                    const auto num_cols =
+                        block_offsets[bcol + 1] - block_offsets[bcol];
+                    values[value_ptrs[k] + (row - row_begin) * num_cols + col -
+                           block_offsets[bcol]] += src_vals[nz];
+                }
+            }
+        }
+    }
+    value_ptrs[row_ptrs[num_block_rows]] = row_value_ptrs[num_block_rows];
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_VBCSR_FILL_IN_BLOCKS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_to_csr(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Vbcsr<ValueType, IndexType>* source,
+                    matrix::Csr<ValueType, IndexType>* result)
+{
+    auto block_offsets = source->get_const_block_offsets();
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    auto value_ptrs = source->get_const_value_ptrs();
+    auto vals = source->get_const_values();
+    auto out_row_ptrs = result->get_row_ptrs();
+    auto out_col_idxs = result->get_col_idxs();
+    auto out_vals = result->get_values();
+    const auto num_block_rows = source->get_num_block_rows();
+#pragma omp parallel for
+    for (size_type brow = 0; brow < num_block_rows; brow++) {
+        const auto row_begin = block_offsets[brow];
+        const auto num_rows = block_offsets[brow + 1] - row_begin;
+        const auto begin = row_ptrs[brow];
+        const auto end = row_ptrs[brow + 1];
+        // all rows of a block row have the same number of entries
+        const auto row_width =
+            num_rows > 0
+                ? (value_ptrs[end] - value_ptrs[begin]) / num_rows
+                : IndexType{};
+        for (IndexType r = 0; r < num_rows; r++) {
+            auto out = value_ptrs[begin] + r * row_width;
+            out_row_ptrs[row_begin + r] = out;
+            for (auto k = begin; k < end; k++) {
+                const auto col_begin = block_offsets[col_idxs[k]];
+                const auto num_cols =
+                    block_offsets[col_idxs[k] + 1] - col_begin;
+                for (IndexType col = 0; col < num_cols; col++) {
+                    out_col_idxs[out] = col_begin + col;
+                    out_vals[out] = vals[value_ptrs[k] + r * num_cols + col];
+                    out++;
+                }
+            }
+        }
+    }
+    out_row_ptrs[source->get_size()[0]] =
+        static_cast<IndexType>(source->get_num_stored_elements());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_VBCSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace vbcsr
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
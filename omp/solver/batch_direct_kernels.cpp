@@ -0,0 +1,280 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/batch_direct_kernels.hpp"
+
+#include <algorithm>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/array.hpp>
+
+#include "core/base/allocator.hpp"
+#include "reference/solver/batch_direct_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+namespace batch_direct {
+
+
+/**
+ * Number of batch items that are factorized together by one thread. Their
+ * values are interleaved (structure-of-arrays), so that every step of the
+ * elimination is a contiguous loop over the items which the compiler can
+ * vectorize.
+ */
+constexpr size_type items_per_chunk = 8;
+
+
+template <typename ValueType, typename IndexType>
+void dense_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                     const batch::matrix::Dense<ValueType>* sys_dense,
+                     ValueType* factors, IndexType* pivots, bool* singular)
+{
+    constexpr auto width = items_per_chunk;
+    const auto num_batch = sys_dense->get_num_batch_items();
+    const auto num_rows =
+        static_cast<IndexType>(sys_dense->get_common_size()[0]);
+    const auto item_size = static_cast<size_type>(num_rows) * num_rows;
+    const auto num_chunks = static_cast<size_type>(ceildiv(num_batch, width));
+    const auto values = sys_dense->get_const_values();
+#pragma omp parallel
+    {
+        // lu[(row * num_rows + col) * width + item]
+        vector<ValueType> lu(item_size * width, exec);
+        vector<IndexType> pivot(width, exec);
+        vector<remove_complex<ValueType>> pivot_abs(width, exec);
+#pragma omp for
+        for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+            const auto begin = chunk * width;
+            const auto count = std::min(width, num_batch - begin);
+            for (size_type item = 0; item < count; item++) {
+                for (size_type i = 0; i < item_size; i++) {
+                    lu[i * width + item] =
+                        values[(begin + item) * item_size + i];
+                }
+            }
+            const auto at = [&](IndexType row, IndexType col) {
+                return lu.data() + (row * num_rows + col) * width;
+            };
+            for (IndexType k = 0; k < num_rows; k++) {
+                const auto diag = at(k, k);
+#pragma omp simd
+                for (size_type item = 0; item < count; item++) {
+                    pivot[item] = k;
+                    pivot_abs[item] = abs(diag[item]);
+                }
+                for (auto row = k + 1; row < num_rows; row++) {
+                    const auto candidate = at(row, k);
+#pragma omp simd
+                    for (size_type item = 0; item < count; item++) {
+                        const auto candidate_abs = abs(candidate[item]);
+                        const bool larger = candidate_abs > pivot_abs[item];
+                        pivot[item] = larger ? row : pivot[item];
+                        pivot_abs[item] =
+                            larger ? candidate_abs : pivot_abs[item];
+                    }
+                }
+                // row swaps differ between the items, so they stay scalar
+                for (size_type item = 0; item < count; item++) {
+                    pivots[(begin + item) * num_rows + k] = pivot[item];
+                    if (pivot[item] != k) {
+                        for (IndexType col = 0; col < num_rows; col++) {
+                            std::swap(at(k, col)[item],
+                                      at(pivot[item], col)[item]);
+                        }
+                    }
+                }
+                for (auto row = k + 1; row < num_rows; row++) {
+                    const auto factor = at(row, k);
+#pragma omp simd
+                    for (size_type item = 0; item < count; item++) {
+                        factor[item] /= diag[item];
+                    }
+                    for (auto col = k + 1; col < num_rows; col++) {
+                        const auto upper = at(k, col);
+                        const auto target = at(row, col);
+#pragma omp simd
+                        for (size_type item = 0; item < count; item++) {
+                            target[item] -= factor[item] * upper[item];
+                        }
+                    }
+                }
+            }
+            for (size_type item = 0; item < count; item++) {
+                const auto item_lu = factors + (begin + item) * item_size;
+                for (size_type i = 0; i < item_size; i++) {
+                    item_lu[i] = lu[i * width + item];
+                }
+                singular[begin + item] =
+                    batch_single_kernels::has_singular_pivot_impl(
+                        num_rows, values + (begin + item) * item_size,
+                        item_size, [&](IndexType row) {
+                            return item_lu[row * num_rows + row];
+                        });
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_DENSE_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void dense_solve(std::shared_ptr<const DefaultExecutor> exec,
+                 const ValueType* factors, const IndexType* pivots,
+                 batch::MultiVector<ValueType>* x)
+{
+    const auto num_batch = x->get_num_batch_items();
+    const auto num_rows = static_cast<IndexType>(x->get_common_size()[0]);
+    const auto num_rhs = static_cast<IndexType>(x->get_common_size()[1]);
+    const auto item_size = static_cast<size_type>(num_rows) * num_rows;
+#pragma omp parallel for
+    for (size_type batch_id = 0; batch_id < num_batch; batch_id++) {
+        batch_single_kernels::dense_lu_solve_impl(
+            num_rows, num_rhs, factors + batch_id * item_size,
+            pivots + batch_id * num_rows, x->get_values_for_item(batch_id));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_DENSE_SOLVE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void symbolic_factorize(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const gko::matrix::Csr<ValueType, IndexType>* first_sys_csr,
+    array<IndexType>& factor_row_ptrs, array<IndexType>& factor_col_idxs)
+{
+    const auto num_rows = static_cast<IndexType>(first_sys_csr->get_size()[0]);
+    vector<IndexType> row_ptrs(exec);
+    vector<IndexType> col_idxs(exec);
+    batch_single_kernels::symbolic_lu_impl(
+        num_rows, first_sys_csr->get_const_row_ptrs(),
+        first_sys_csr->get_const_col_idxs(), row_ptrs, col_idxs);
+    factor_row_ptrs.resize_and_reset(row_ptrs.size());
+    factor_col_idxs.resize_and_reset(col_idxs.size());
+    std::copy(row_ptrs.begin(), row_ptrs.end(), factor_row_ptrs.get_data());
+    std::copy(col_idxs.begin(), col_idxs.end(), factor_col_idxs.get_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SYMBOLIC_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void sparse_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                      const batch::matrix::Csr<ValueType, IndexType>* sys_csr,
+                      const IndexType* factor_row_ptrs,
+                      const IndexType* factor_col_idxs,
+                      const IndexType* diag_locs, const IndexType* update_ptrs,
+                      const IndexType* update_src, const IndexType* update_dst,
+                      ValueType* factors, bool* singular)
+{
+    constexpr auto width = items_per_chunk;
+    const auto num_batch = sys_csr->get_num_batch_items();
+    const auto num_rows =
+        static_cast<IndexType>(sys_csr->get_common_size()[0]);
+    const auto nnz = sys_csr->get_num_elements_per_item();
+    const auto row_ptrs = sys_csr->get_const_row_ptrs();
+    const auto col_idxs = sys_csr->get_const_col_idxs();
+    const auto values = sys_csr->get_const_values();
+    const auto factor_nnz = static_cast<size_type>(factor_row_ptrs[num_rows]);
+    const auto num_chunks = static_cast<size_type>(ceildiv(num_batch, width));
+    // position of every entry of the system matrix within the factors
+    vector<IndexType> scatter_map(nnz, exec);
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            scatter_map[nz] = batch_single_kernels::find_sorted_col(
+                factor_col_idxs, factor_row_ptrs[row],
+                factor_row_ptrs[row + 1], col_idxs[nz]);
+        }
+    }
+#pragma omp parallel
+    {
+        // lu[nz * width + item]
+        vector<ValueType> lu(factor_nnz * width, exec);
+#pragma omp for
+        for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+            const auto begin = chunk * width;
+            const auto count = std::min(width, num_batch - begin);
+            std::fill(lu.begin(), lu.end(), zero<ValueType>());
+            for (size_type item = 0; item < count; item++) {
+                for (size_type nz = 0; nz < nnz; nz++) {
+                    lu[scatter_map[nz] * width + item] +=
+                        values[(begin + item) * nnz + nz];
+                }
+            }
+            // replay the shared elimination on all items of the chunk at once
+            for (IndexType row = 0; row < num_rows; row++) {
+                for (auto nz = factor_row_ptrs[row]; nz < diag_locs[row];
+                     nz++) {
+                    const auto factor = lu.data() + nz * width;
+                    const auto diag =
+                        lu.data() + diag_locs[factor_col_idxs[nz]] * width;
+#pragma omp simd
+                    for (size_type item = 0; item < count; item++) {
+                        factor[item] /= diag[item];
+                    }
+                    for (auto upd = update_ptrs[nz]; upd < update_ptrs[nz + 1];
+                         upd++) {
+                        const auto upper = lu.data() + update_src[upd] * width;
+                        const auto target =
+                            lu.data() + update_dst[upd] * width;
+#pragma omp simd
+                        for (size_type item = 0; item < count; item++) {
+                            target[item] -= factor[item] * upper[item];
+                        }
+                    }
+                }
+            }
+            for (size_type item = 0; item < count; item++) {
+                const auto factor = factors + (begin + item) * factor_nnz;
+                for (size_type nz = 0; nz < factor_nnz; nz++) {
+                    factor[nz] = lu[nz * width + item];
+                }
+                singular[begin + item] =
+                    batch_single_kernels::has_singular_pivot_impl(
+                        num_rows, values + (begin + item) * nnz, nnz,
+                        [&](IndexType row) { return factor[diag_locs[row]]; });
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SPARSE_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void sparse_solve(std::shared_ptr<const DefaultExecutor> exec,
+                  const IndexType* factor_row_ptrs,
+                  const IndexType* factor_col_idxs, const IndexType* diag_locs,
+                  const ValueType* factors, batch::MultiVector<ValueType>* x)
+{
+    const auto num_batch = x->get_num_batch_items();
+    const auto num_rows = static_cast<IndexType>(x->get_common_size()[0]);
+    const auto num_rhs = static_cast<IndexType>(x->get_common_size()[1]);
+    const auto factor_nnz = factor_row_ptrs[num_rows];
+#pragma omp parallel for
+    for (size_type batch_id = 0; batch_id < num_batch; batch_id++) {
+        batch_single_kernels::sparse_lu_solve_impl(
+            num_rows, num_rhs, factor_row_ptrs, factor_col_idxs, diag_locs,
+            factors + batch_id * factor_nnz, x->get_values_for_item(batch_id));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SPARSE_SOLVE_KERNEL);
+
+
+}  // namespace batch_direct
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
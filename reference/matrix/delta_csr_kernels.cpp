@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/matrix/delta_csr_encoding.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The DeltaCsr matrix format namespace.
+ * @ref DeltaCsr
+ * @ingroup delta_csr
+ */
+namespace delta_csr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::DeltaCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    auto vals = a->get_const_values();
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto base_cols = a->get_const_base_cols();
+    auto delta_ptrs = a->get_const_delta_ptrs();
+    auto deltas = a->get_const_deltas();
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) = zero<ValueType>();
+        }
+        auto in = deltas + delta_ptrs[row];
+        auto col = base_cols[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (nz > row_ptrs[row]) {
+                IndexType delta{};
+                in = matrix::delta_csr::decode(in, delta);
+                col += delta;
+            }
+            for (size_type j = 0; j < c->get_size()[1]; j++) {
+                c->at(row, j) += vals[nz] * b->at(col, j);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::DeltaCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    auto vals = a->get_const_values();
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto base_cols = a->get_const_base_cols();
+    auto delta_ptrs = a->get_const_delta_ptrs();
+    auto deltas = a->get_const_deltas();
+    auto valpha = alpha->at(0, 0);
+    auto vbeta = beta->at(0, 0);
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) *= vbeta;
+        }
+        auto in = deltas + delta_ptrs[row];
+        auto col = base_cols[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (nz > row_ptrs[row]) {
+                IndexType delta{};
+                in = matrix::delta_csr::decode(in, delta);
+                col += delta;
+            }
+            for (size_type j = 0; j < c->get_size()[1]; j++) {
+                c->at(row, j) += valpha * vals[nz] * b->at(col, j);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_delta_bytes(std::shared_ptr<const ReferenceExecutor> exec,
+                       const matrix::Csr<ValueType, IndexType>* source,
+                       int64* row_bytes)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        int64 bytes{};
+        for (auto nz = row_ptrs[row] + 1; nz < row_ptrs[row + 1]; nz++) {
+            bytes += matrix::delta_csr::encoded_size(
+                static_cast<IndexType>(col_idxs[nz] - col_idxs[nz - 1]));
+        }
+        row_bytes[row] = bytes;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_COUNT_DELTA_BYTES_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_deltas(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* source,
+                    const int64* delta_ptrs, IndexType* base_cols,
+                    uint8* deltas)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        const auto begin = row_ptrs[row];
+        const auto end = row_ptrs[row + 1];
+        base_cols[row] = begin < end ? col_idxs[begin] : zero<IndexType>();
+        auto out = deltas + delta_ptrs[row];
+        for (auto nz = begin + 1; nz < end; nz++) {
+            out = matrix::delta_csr::encode(
+                static_cast<IndexType>(col_idxs[nz] - col_idxs[nz - 1]), out);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_FILL_IN_DELTAS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_to_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::DeltaCsr<ValueType, IndexType>* source,
+                    matrix::Csr<ValueType, IndexType>* result)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto base_cols = source->get_const_base_cols();
+    auto delta_ptrs = source->get_const_delta_ptrs();
+    auto deltas = source->get_const_deltas();
+    auto col_idxs = result->get_col_idxs();
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        auto in = deltas + delta_ptrs[row];
+        auto col = base_cols[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (nz > row_ptrs[row]) {
+                IndexType delta{};
+                in = matrix::delta_csr::decode(in, delta);
+                col += delta;
+            }
+            col_idxs[nz] = col;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace delta_csr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
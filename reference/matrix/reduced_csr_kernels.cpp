@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/reduced_csr_kernels.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/matrix/reduced_csr_storage.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The ReducedCsr matrix format namespace.
+ * @ref ReducedCsr
+ * @ingroup reduced_csr
+ */
+namespace reduced_csr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::ReducedCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto scales = a->get_const_scales();
+    matrix::reduced_csr::run_with_storage<ValueType>(
+        a->get_storage_mode(), [&](auto traits) {
+            using traits_type = decltype(traits);
+            const auto vals = matrix::reduced_csr::build_const_storage_accessor<
+                ValueType, typename traits_type::storage_type>(
+                a->get_const_storage(), a->get_num_stored_elements());
+            for (size_type row = 0; row < a->get_size()[0]; row++) {
+                for (size_type j = 0; j < c->get_size()[1]; j++) {
+                    c->at(row, j) = zero<ValueType>();
+                }
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    ValueType val = vals(nz);
+                    auto col = col_idxs[nz];
+                    for (size_type j = 0; j < c->get_size()[1]; j++) {
+                        c->at(row, j) += val * b->at(col, j);
+                    }
+                }
+                if constexpr (traits_type::is_scaled) {
+                    for (size_type j = 0; j < c->get_size()[1]; j++) {
+                        c->at(row, j) *= scales[row];
+                    }
+                }
+            }
+        });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::ReducedCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto scales = a->get_const_scales();
+    auto valpha = alpha->at(0, 0);
+    auto vbeta = beta->at(0, 0);
+    matrix::reduced_csr::run_with_storage<ValueType>(
+        a->get_storage_mode(), [&](auto traits) {
+            using traits_type = decltype(traits);
+            const auto vals = matrix::reduced_csr::build_const_storage_accessor<
+                ValueType, typename traits_type::storage_type>(
+                a->get_const_storage(), a->get_num_stored_elements());
+            for (size_type row = 0; row < a->get_size()[0]; row++) {
+                auto row_alpha = valpha;
+                if constexpr (traits_type::is_scaled) {
+                    row_alpha *= scales[row];
+                }
+                for (size_type j = 0; j < c->get_size()[1]; j++) {
+                    c->at(row, j) *= vbeta;
+                }
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    ValueType val = vals(nz);
+                    auto col = col_idxs[nz];
+                    for (size_type j = 0; j < c->get_size()[1]; j++) {
+                        c->at(row, j) += row_alpha * val * b->at(col, j);
+                    }
+                }
+            }
+        });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compress_values(std::shared_ptr<const ReferenceExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType>* source,
+                     matrix::reduced_storage mode, uint8* storage,
+                     remove_complex<ValueType>* scales)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto values = source->get_const_values();
+    const auto nnz = source->get_num_stored_elements();
+    matrix::reduced_csr::run_with_storage<ValueType>(mode, [&](auto traits) {
+        using traits_type = decltype(traits);
+        using storage_type = typename traits_type::storage_type;
+        if constexpr (traits_type::is_scaled) {
+            auto out = reinterpret_cast<storage_type*>(storage);
+            for (size_type row = 0; row < source->get_size()[0]; row++) {
+                auto max_abs = zero<remove_complex<ValueType>>();
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    max_abs = std::max(max_abs, abs(values[nz]));
+                }
+                scales[row] = matrix::reduced_csr::compute_scale(max_abs);
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    out[nz] = matrix::reduced_csr::to_scaled_int16(values[nz],
+                                                                   scales[row]);
+                }
+            }
+        } else {
+            auto out = matrix::reduced_csr::build_storage_accessor<
+                ValueType, storage_type>(storage, nnz);
+            for (size_type nz = 0; nz < nnz; nz++) {
+                out(nz) = values[nz];
+            }
+        }
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_COMPRESS_VALUES_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void decompress_values(std::shared_ptr<const ReferenceExecutor> exec,
+                       const matrix::ReducedCsr<ValueType, IndexType>* source,
+                       ValueType* values)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto scales = source->get_const_scales();
+    matrix::reduced_csr::run_with_storage<ValueType>(
+        source->get_storage_mode(), [&](auto traits) {
+            using traits_type = decltype(traits);
+            const auto vals = matrix::reduced_csr::build_const_storage_accessor<
+                ValueType, typename traits_type::storage_type>(
+                source->get_const_storage(),
+                source->get_num_stored_elements());
+            for (size_type row = 0; row < source->get_size()[0]; row++) {
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    values[nz] = vals(nz);
+                    if constexpr (traits_type::is_scaled) {
+                        values[nz] *= scales[row];
+                    }
+                }
+            }
+        });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_DECOMPRESS_VALUES_KERNEL);
+
+
+}  // namespace reduced_csr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
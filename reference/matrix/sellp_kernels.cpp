@@ -33,21 +33,23 @@ void spmv(std::shared_ptr<const ReferenceExecutor> exec,
     auto slice_sets = a->get_const_slice_sets();
     auto slice_size = a->get_slice_size();
     auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
+    auto perm = a->get_const_permutation();
     for (size_type slice = 0; slice < slice_num; slice++) {
         for (size_type row = 0; row < slice_size; row++) {
             size_type global_row = slice * slice_size + row;
             if (global_row >= a->get_size()[0]) {
                 break;
             }
+            size_type out_row = perm ? perm[global_row] : global_row;
             for (size_type j = 0; j < c->get_size()[1]; j++) {
-                c->at(global_row, j) = zero<ValueType>();
+                c->at(out_row, j) = zero<ValueType>();
             }
             for (size_type i = 0; i < slice_lengths[slice]; i++) {
                 auto val = a->val_at(row, slice_sets[slice], i);
                 auto col = a->col_at(row, slice_sets[slice], i);
                 if (col != invalid_index<IndexType>()) {
                     for (size_type j = 0; j < c->get_size()[1]; j++) {
-                        c->at(global_row, j) += val * b->at(col, j);
+                        c->at(out_row, j) += val * b->at(col, j);
                     }
                 }
             }
@@ -72,6 +74,7 @@ void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
     auto slice_sets = a->get_const_slice_sets();
     auto slice_size = a->get_slice_size();
     auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
+    auto perm = a->get_const_permutation();
     auto valpha = alpha->at(0, 0);
     auto vbeta = beta->at(0, 0);
     for (size_type slice = 0; slice < slice_num; slice++) {
@@ -80,15 +83,16 @@ void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
             if (global_row >= a->get_size()[0]) {
                 break;
             }
+            size_type out_row = perm ? perm[global_row] : global_row;
             for (size_type j = 0; j < c->get_size()[1]; j++) {
-                c->at(global_row, j) *= vbeta;
+                c->at(out_row, j) *= vbeta;
             }
             for (size_type i = 0; i < slice_lengths[slice]; i++) {
                 auto val = a->val_at(row, slice_sets[slice], i);
                 auto col = a->col_at(row, slice_sets[slice], i);
                 if (col != invalid_index<IndexType>()) {
                     for (size_type j = 0; j < c->get_size()[1]; j++) {
-                        c->at(global_row, j) += valpha * val * b->at(col, j);
+                        c->at(out_row, j) += valpha * val * b->at(col, j);
                     }
                 }
             }
@@ -181,17 +185,19 @@ void fill_in_dense(std::shared_ptr<const ReferenceExecutor> exec,
     auto slice_size = source->get_slice_size();
     auto slice_num =
         ceildiv(source->get_size()[0] + slice_size - 1, slice_size);
+    auto perm = source->get_const_permutation();
     for (size_type slice = 0; slice < slice_num; slice++) {
         for (size_type row = 0; row < slice_size; row++) {
             size_type global_row = slice * slice_size + row;
             if (global_row >= num_rows) {
                 break;
             }
+            size_type out_row = perm ? perm[global_row] : global_row;
             for (size_type i = slice_sets[slice]; i < slice_sets[slice + 1];
                  i++) {
                 const auto col = col_idxs[row + i * slice_size];
                 if (col != invalid_index<IndexType>()) {
-                    result->at(global_row, col) = vals[row + i * slice_size];
+                    result->at(out_row, col) = vals[row + i * slice_size];
                 }
             }
         }
@@ -215,6 +221,7 @@ void count_nonzeros_per_row(std::shared_ptr<const DefaultExecutor> exec,
     const auto slice_lengths = source->get_const_slice_lengths();
     const auto slice_sets = source->get_const_slice_sets();
     const auto col_idxs = source->get_const_col_idxs();
+    const auto perm = source->get_const_permutation();
 
     for (size_type slice = 0; slice < slice_num; slice++) {
         for (size_type row = 0; row < slice_size; row++) {
@@ -229,7 +236,7 @@ void count_nonzeros_per_row(std::shared_ptr<const DefaultExecutor> exec,
                 row_nnz +=
                     col_idxs[sellp_ind] != invalid_index<IndexType>() ? 1 : 0;
             }
-            result[global_row] = row_nnz;
+            result[perm ? perm[global_row] : global_row] = row_nnz;
         }
     }
 }
@@ -251,11 +258,19 @@ void convert_to_csr(std::shared_ptr<const ReferenceExecutor> exec,
     const auto source_slice_lengths = source->get_const_slice_lengths();
     const auto source_slice_sets = source->get_const_slice_sets();
     const auto source_col_idxs = source->get_const_col_idxs();
+    const auto perm = source->get_const_permutation();
 
     auto result_vals = result->get_values();
     auto result_row_ptrs = result->get_row_ptrs();
     auto result_col_idxs = result->get_col_idxs();
 
+    if (perm) {
+        // the rows are stored out of order, so compute the row pointers first
+        count_nonzeros_per_row(exec, source, result_row_ptrs);
+        components::prefix_sum_nonnegative(exec, result_row_ptrs,
+                                           num_rows + 1);
+    }
+
     size_type cur_ptr = 0;
 
     for (size_type slice = 0; slice < slice_num; slice++) {
@@ -264,7 +279,11 @@ void convert_to_csr(std::shared_ptr<const ReferenceExecutor> exec,
             if (global_row >= num_rows) {
                 break;
             }
-            result_row_ptrs[global_row] = cur_ptr;
+            if (perm) {
+                cur_ptr = result_row_ptrs[perm[global_row]];
+            } else {
+                result_row_ptrs[global_row] = cur_ptr;
+            }
             for (size_type sellp_ind =
                      source_slice_sets[slice] * slice_size + row;
                  sellp_ind < source_slice_sets[slice + 1] * slice_size + row;
@@ -277,7 +296,9 @@ void convert_to_csr(std::shared_ptr<const ReferenceExecutor> exec,
             }
         }
     }
-    result_row_ptrs[num_rows] = cur_ptr;
+    if (!perm) {
+        result_row_ptrs[num_rows] = cur_ptr;
+    }
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -297,14 +318,19 @@ void extract_diagonal(std::shared_ptr<const ReferenceExecutor> exec,
     const auto orig_slice_sets = orig->get_const_slice_sets();
     const auto orig_slice_lengths = orig->get_const_slice_lengths();
     const auto orig_col_idxs = orig->get_const_col_idxs();
+    const auto perm = orig->get_const_permutation();
     auto diag_values = diag->get_values();
 
     for (size_type slice = 0; slice < slice_num; slice++) {
         for (size_type row = 0; row < slice_size; row++) {
-            auto global_row = slice_size * slice + row;
-            if (global_row >= diag_size) {
+            auto stored_row = slice_size * slice + row;
+            if (stored_row >= orig->get_size()[0]) {
                 break;
             }
+            size_type global_row = perm ? perm[stored_row] : stored_row;
+            if (global_row >= diag_size) {
+                continue;
+            }
             for (size_type i = 0; i < orig_slice_lengths[slice]; i++) {
                 if (orig->col_at(row, orig_slice_sets[slice], i) ==
                     global_row) {
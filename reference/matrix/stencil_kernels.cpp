@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/stencil_kernels.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+#include "core/matrix/stencil_helpers.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The Stencil matrix format namespace.
+ * @ref Stencil
+ * @ingroup stencil
+ */
+namespace stencil {
+
+
+/**
+ * Calls `callback(row, point, col)` for all entries of the stencil matrix
+ * `a`, with the entries of each row in increasing column order.
+ */
+template <typename ValueType, typename IndexType, typename Callback>
+void for_each_entry(const matrix::Stencil<ValueType, IndexType>* a,
+                    Callback callback)
+{
+    const auto grid = a->get_grid_size();
+    const auto nx = static_cast<int64>(grid[0]);
+    const auto ny = static_cast<int64>(grid[1]);
+    const auto nz = static_cast<int64>(grid[2]);
+    for (int64 z = 0; z < nz; z++) {
+        for (int64 y = 0; y < ny; y++) {
+            for (int64 x = 0; x < nx; x++) {
+                const auto row = x + nx * (y + ny * z);
+                matrix::stencil::for_each_point(
+                    a->get_stencil_type(),
+                    [&](int point, int dx, int dy, int dz) {
+                        if (matrix::stencil::is_in_grid(x, dx, nx) &&
+                            matrix::stencil::is_in_grid(y, dy, ny) &&
+                            matrix::stencil::is_in_grid(z, dz, nz)) {
+                            callback(row, point,
+                                     row + dx + nx * (dy + ny * dz));
+                        }
+                    });
+            }
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+ValueType get_coefficient(const matrix::Stencil<ValueType, IndexType>* a,
+                          int64 row, int point)
+{
+    const auto coefs = a->get_const_coefficients();
+    return a->has_variable_coefficients()
+               ? coefs[point * a->get_size()[0] + row]
+               : coefs[point];
+}
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::Stencil<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    for (size_type row = 0; row < c->get_size()[0]; row++) {
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) = zero<ValueType>();
+        }
+    }
+    for_each_entry(a, [&](int64 row, int point, int64 col) {
+        const auto coef = get_coefficient(a, row, point);
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) += coef * b->at(col, j);
+        }
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::Stencil<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    auto valpha = alpha->at(0, 0);
+    auto vbeta = beta->at(0, 0);
+    for (size_type row = 0; row < c->get_size()[0]; row++) {
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) *= vbeta;
+        }
+    }
+    for_each_entry(a, [&](int64 row, int point, int64 col) {
+        const auto coef = get_coefficient(a, row, point);
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) += valpha * coef * b->at(col, j);
+        }
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_row_nonzeros(std::shared_ptr<const ReferenceExecutor> exec,
+                        const matrix::Stencil<ValueType, IndexType>* source,
+                        IndexType* row_nnz)
+{
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        row_nnz[row] = 0;
+    }
+    for_each_entry(source,
+                   [&](int64 row, int point, int64 col) { row_nnz[row]++; });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_COUNT_ROW_NONZEROS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                 const matrix::Stencil<ValueType, IndexType>* source,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    auto col_idxs = result->get_col_idxs();
+    auto vals = result->get_values();
+    size_type nz = 0;
+    for_each_entry(source, [&](int64 row, int point, int64 col) {
+        col_idxs[nz] = static_cast<IndexType>(col);
+        vals[nz] = get_coefficient(source, row, point);
+        nz++;
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_FILL_IN_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const ReferenceExecutor> exec,
+                      const matrix::Stencil<ValueType, IndexType>* source,
+                      matrix::Diagonal<ValueType>* diag)
+{
+    const auto center = static_cast<int>((source->get_num_points() - 1) / 2);
+    auto diag_values = diag->get_values();
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        diag_values[row] = get_coefficient(source, row, center);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace stencil
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,227 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+#include <algorithm>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+#include "core/base/allocator.hpp"
+#include "core/base/iterator_factory.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The SymmetricCsr matrix format namespace.
+ * @ref SymmetricCsr
+ * @ingroup symmetric_csr
+ */
+namespace symmetric_csr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::SymmetricCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+          array<ValueType>& workspace)
+{
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto vals = a->get_const_values();
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) = zero<ValueType>();
+        }
+    }
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = static_cast<size_type>(col_idxs[nz]);
+            for (size_type j = 0; j < c->get_size()[1]; j++) {
+                c->at(row, j) += vals[nz] * b->at(col, j);
+                if (col != row) {
+                    c->at(col, j) += conj(vals[nz]) * b->at(row, j);
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::SymmetricCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c, array<ValueType>& workspace)
+{
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto vals = a->get_const_values();
+    auto valpha = alpha->at(0, 0);
+    auto vbeta = beta->at(0, 0);
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) *= vbeta;
+        }
+    }
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = static_cast<size_type>(col_idxs[nz]);
+            for (size_type j = 0; j < c->get_size()[1]; j++) {
+                c->at(row, j) += valpha * vals[nz] * b->at(col, j);
+                if (col != row) {
+                    c->at(col, j) += valpha * conj(vals[nz]) * b->at(row, j);
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_upper_nonzeros(std::shared_ptr<const ReferenceExecutor> exec,
+                          const matrix::Csr<ValueType, IndexType>* source,
+                          IndexType* row_nnz)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        row_nnz[row] = static_cast<IndexType>(std::count_if(
+            col_idxs + row_ptrs[row], col_idxs + row_ptrs[row + 1],
+            [&](auto col) { return col >= static_cast<IndexType>(row); }));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NONZEROS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_upper(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Csr<ValueType, IndexType>* source,
+                   const IndexType* row_ptrs, IndexType* col_idxs,
+                   ValueType* values)
+{
+    auto src_row_ptrs = source->get_const_row_ptrs();
+    auto src_col_idxs = source->get_const_col_idxs();
+    auto src_vals = source->get_const_values();
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        auto out = row_ptrs[row];
+        for (auto nz = src_row_ptrs[row]; nz < src_row_ptrs[row + 1]; nz++) {
+            if (src_col_idxs[nz] >= static_cast<IndexType>(row)) {
+                col_idxs[out] = src_col_idxs[nz];
+                values[out] = src_vals[nz];
+                out++;
+            }
+        }
+        auto it = detail::make_zip_iterator(col_idxs + row_ptrs[row],
+                                            values + row_ptrs[row]);
+        std::sort(it, it + (row_ptrs[row + 1] - row_ptrs[row]),
+                  [](auto a, auto b) { return get<0>(a) < get<0>(b); });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_UPPER_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_full_nonzeros(
+    std::shared_ptr<const ReferenceExecutor> exec,
+    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+    IndexType* row_nnz)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+    for (size_type row = 0; row < num_rows; row++) {
+        row_nnz[row] = row_ptrs[row + 1] - row_ptrs[row];
+    }
+    for (size_type row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] != static_cast<IndexType>(row)) {
+                row_nnz[col_idxs[nz]]++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_FULL_NONZEROS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                 const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    auto vals = source->get_const_values();
+    auto out_col_idxs = result->get_col_idxs();
+    auto out_vals = result->get_values();
+    const auto num_rows = source->get_size()[0];
+    vector<IndexType> cursors(result->get_const_row_ptrs(),
+                              result->get_const_row_ptrs() + num_rows, exec);
+    // the lower triangle of each row is completed by the rows above it, in
+    // increasing column order, before the row's own entries are added
+    for (size_type row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            const auto out = cursors[row]++;
+            out_col_idxs[out] = col;
+            out_vals[out] = vals[nz];
+            if (col != static_cast<IndexType>(row)) {
+                const auto mirror_out = cursors[col]++;
+                out_col_idxs[mirror_out] = static_cast<IndexType>(row);
+                out_vals[mirror_out] = conj(vals[nz]);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const ReferenceExecutor> exec,
+                      const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                      matrix::Diagonal<ValueType>* diag)
+{
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    auto vals = source->get_const_values();
+    auto diag_values = diag->get_values();
+    for (size_type row = 0; row < source->get_size()[0]; row++) {
+        const auto begin = row_ptrs[row];
+        if (begin < row_ptrs[row + 1] &&
+            col_idxs[begin] == static_cast<IndexType>(row)) {
+            diag_values[row] = vals[begin];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace symmetric_csr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
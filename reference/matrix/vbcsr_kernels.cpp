@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/vbcsr_kernels.hpp"
+
+#include <algorithm>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/base/allocator.hpp"
+#include "core/matrix/vbcsr_helpers.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The Vbcsr matrix format namespace.
+ * @ref Vbcsr
+ * @ingroup vbcsr
+ */
+namespace vbcsr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::Vbcsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    auto block_offsets = a->get_const_block_offsets();
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto value_ptrs = a->get_const_value_ptrs();
+    auto vals = a->get_const_values();
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) = zero<ValueType>();
+        }
+    }
+    for (size_type brow = 0; brow < a->get_num_block_rows(); brow++) {
+        const auto row_begin = block_offsets[brow];
+        const auto num_rows = block_offsets[brow + 1] - row_begin;
+        for (auto k = row_ptrs[brow]; k < row_ptrs[brow + 1]; k++) {
+            const auto bcol = col_idxs[k];
+            const auto col_begin = block_offsets[bcol];
+            const auto num_cols = block_offsets[bcol + 1] - col_begin;
+            const auto block = vals + value_ptrs[k];
+            for (IndexType r = 0; r < num_rows; r++) {
+                for (IndexType col = 0; col < num_cols; col++) {
+                    for (size_type j = 0; j < c->get_size()[1]; j++) {
+                        c->at(row_begin + r, j) += block[r * num_cols + col] *
+                                                   b->at(col_begin + col, j);
+                    }
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_VBCSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::Vbcsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    auto block_offsets = a->get_const_block_offsets();
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto value_ptrs = a->get_const_value_ptrs();
+    auto vals = a->get_const_values();
+    auto valpha = alpha->at(0, 0);
+    auto vbeta = beta->at(0, 0);
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        for (size_type j = 0; j < c->get_size()[1]; j++) {
+            c->at(row, j) *= vbeta;
+        }
+    }
+    for (size_type brow = 0; brow < a->get_num_block_rows(); brow++) {
+        const auto row_begin = block_offsets[brow];
+        const auto num_rows = block_offsets[brow + 1] - row_begin;
+        for (auto k = row_ptrs[brow]; k < row_ptrs[brow + 1]; k++) {
+            const auto bcol = col_idxs[k];
+            const auto col_begin = block_offsets[bcol];
+            const auto num_cols = block_offsets[bcol + 1] - col_begin;
+            const auto block = vals + value_ptrs[k];
+            for (IndexType r = 0; r < num_rows; r++) {
+                for (IndexType col = 0; col < num_cols; col++) {
+                    for (size_type j = 0; j < c->get_size()[1]; j++) {
+                        c->at(row_begin + r, j) +=
+                            valpha * block[r * num_cols + col] *
+                            b->at(col_begin + col, j);
+                    }
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_VBCSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_blocks(std::shared_ptr<const ReferenceExecutor> exec,
+                  const matrix::Csr<ValueType, IndexType>* source,
+                  const IndexType* block_offsets, size_type num_block_rows,
+                  IndexType* block_count, IndexType* value_count)
+{
+    vector<IndexType> block_cols(exec);
+    for (size_type brow = 0; brow < num_block_rows; brow++) {
+        matrix::vbcsr::collect_block_cols(source, block_offsets,
+                                          num_block_rows, brow, block_cols);
+        IndexType num_cols{};
+        for (auto bcol : block_cols) {
+            num_cols += block_offsets[bcol + 1] - block_offsets[bcol];
+        }
+        block_count[brow] = static_cast<IndexType>(block_cols.size());
+        value_count[brow] =
+            (block_offsets[brow + 1] - block_offsets[brow]) * num_cols;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_VBCSR_COUNT_BLOCKS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_blocks(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* source,
+                    const IndexType* block_offsets, size_type num_block_rows,
+                    const IndexType* row_ptrs, const IndexType* row_value_ptrs,
+                    IndexType* col_idxs, IndexType* value_ptrs,
+                    ValueType* values)
+{
+    auto src_row_ptrs = source->get_const_row_ptrs();
+    auto src_col_idxs = source->get_const_col_idxs();
+    auto src_vals = source->get_const_values();
+    vector<IndexType> block_cols(exec);
+    for (size_type brow = 0; brow < num_block_rows; brow++) {
+        matrix::vbcsr::collect_block_cols(source, block_offsets,
+                                          num_block_rows, brow, block_cols);
+        const auto row_begin = block_offsets[brow];
+        const auto num_rows = block_offsets[brow + 1] - row_begin;
+        auto value_ptr = row_value_ptrs[brow];
+        for (size_type i = 0; i < block_cols.size(); i++) {
+            const auto k = row_ptrs[brow] + i;
+            const auto bcol = block_cols[i];
+            const auto block_size =
+                num_rows * (block_offsets[bcol + 1] - block_offsets[bcol]);
+            col_idxs[k] = bcol;
+            value_ptrs[k] = value_ptr;
+            std::fill_n(values + value_ptr, block_size, zero<ValueType>());
+            value_ptr += block_size;
+        }
+        for (auto row = row_begin; row < row_begin + num_rows; row++) {
+            for (auto nz = src_row_ptrs[row]; nz < src_row_ptrs[row + 1];
+                 nz++) {
+                const auto col = src_col_idxs[nz];
+                const auto bcol = matrix::vbcsr::find_block(
+                    block_offsets, num_block_rows, col);
+                const auto k = row_ptrs[brow] +
+                               (std::lower_bound(block_cols.begin(),
+                                                 block_cols.end(), bcol) -
+                                block_cols.begin());
+                const auto num_cols =
+                    block_offsets[bcol + 1] - block_offsets[bcol];
+                values[value_ptrs[k] + (row - row_begin) * num_cols + col -
+                       block_offsets[bcol]] += src_vals[nz];
+            }
+        }
+    }
+    value_ptrs[row_ptrs[num_block_rows]] = row_value_ptrs[num_block_rows];
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_VBCSR_FILL_IN_BLOCKS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void convert_to_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::Vbcsr<ValueType, IndexType>* source,
+                    matrix::Csr<ValueType, IndexType>* result)
+{
+    auto block_offsets = source->get_const_block_offsets();
+    auto row_ptrs = source->get_const_row_ptrs();
+    auto col_idxs = source->get_const_col_idxs();
+    auto value_ptrs = source->get_const_value_ptrs();
+    auto vals = source->get_const_values();
+    auto out_row_ptrs = result->get_row_ptrs();
+    auto out_col_idxs = result->get_col_idxs();
+    auto out_vals = result->get_values();
+    for (size_type brow = 0; brow < source->get_num_block_rows(); brow++) {
+        const auto row_begin = block_offsets[brow];
+        const auto num_rows = block_offsets[brow + 1] - row_begin;
+        const auto begin = row_ptrs[brow];
+        const auto end = row_ptrs[brow + 1];
+        // all rows of a block row have the same number of entries
+        const auto row_width =
+            num_rows > 0
+                ? (value_ptrs[end] - value_ptrs[begin]) / num_rows
+                : IndexType{};
+        for (IndexType r = 0; r < num_rows; r++) {
+            auto out = value_ptrs[begin] + r * row_width;
+            out_row_ptrs[row_begin + r] = out;
+            for (auto k = begin; k < end; k++) {
+                const auto col_begin = block_offsets[col_idxs[k]];
+                const auto num_cols =
+                    block_offsets[col_idxs[k] + 1] - col_begin;
+                for (IndexType col = 0; col < num_cols; col++) {
+                    out_col_idxs[out] = col_begin + col;
+                    out_vals[out] = vals[value_ptrs[k] + r * num_cols + col];
+                    out++;
+                }
+            }
+        }
+    }
+    out_row_ptrs[source->get_size()[0]] =
+        static_cast<IndexType>(source->get_num_stored_elements());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_VBCSR_CONVERT_TO_CSR_KERNEL);
+
+
+}  // namespace vbcsr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_REFERENCE_PRECONDITIONER_BATCH_ILU_HPP_
+#define GKO_REFERENCE_PRECONDITIONER_BATCH_ILU_HPP_
+
+
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+
+#include "core/base/batch_struct.hpp"
+#include "core/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace host {
+namespace batch_preconditioner {
+
+
+/**
+ * ILU(0) preconditioner for batch solvers. The factors are generated outside
+ * of the solver kernel, so generating it only selects the factors of the
+ * current batch item.
+ */
+template <typename ValueType>
+class Ilu final {
+public:
+    using value_type = ValueType;
+    using index_type = int;
+
+    /**
+     * @param num_nnz  Number of stored elements of a single batch item
+     * @param row_ptrs  row pointers of the common pattern of the factors
+     * @param col_idxs  column indices of the common pattern of the factors
+     * @param diag_locs  position of the diagonal entry of each row
+     * @param factors_batch  combined L and U factors of all batch items
+     */
+    Ilu(const index_type num_nnz, const index_type* const row_ptrs,
+        const index_type* const col_idxs, const index_type* const diag_locs,
+        const value_type* const factors_batch)
+        : num_nnz_{num_nnz},
+          row_ptrs_{row_ptrs},
+          col_idxs_{col_idxs},
+          diag_locs_{diag_locs},
+          factors_batch_{factors_batch},
+          factors_entry_{}
+    {}
+
+    /**
+     * The size of the work vector required in case of dynamic allocation.
+     */
+    static constexpr int dynamic_work_size(const int, int) { return 0; }
+
+    template <typename batch_item_type>
+    void generate(size_type batch_id, const batch_item_type&,
+                  value_type* const)
+    {
+        factors_entry_ = factors_batch_ + batch_id * num_nnz_;
+    }
+
+    void apply(const gko::batch::multi_vector::batch_item<const value_type>& r,
+               const gko::batch::multi_vector::batch_item<value_type>& z) const
+    {
+        const auto num_rows = r.num_rows;
+        // solve L y = r, L has an implicit unit diagonal
+        for (int row = 0; row < num_rows; row++) {
+            auto sum = r.values[row * r.stride];
+            for (auto nz = row_ptrs_[row]; nz < diag_locs_[row]; nz++) {
+                sum -= factors_entry_[nz] * z.values[col_idxs_[nz] * z.stride];
+            }
+            z.values[row * z.stride] = sum;
+        }
+        // solve U z = y
+        for (int row = num_rows - 1; row >= 0; row--) {
+            auto sum = z.values[row * z.stride];
+            for (auto nz = diag_locs_[row] + 1; nz < row_ptrs_[row + 1];
+                 nz++) {
+                sum -= factors_entry_[nz] * z.values[col_idxs_[nz] * z.stride];
+            }
+            z.values[row * z.stride] = sum / factors_entry_[diag_locs_[row]];
+        }
+    }
+
+private:
+    const index_type num_nnz_;
+    const index_type* const row_ptrs_;
+    const index_type* const col_idxs_;
+    const index_type* const diag_locs_;
+    const value_type* const factors_batch_;
+    const value_type* factors_entry_;
+};
+
+
+}  // namespace batch_preconditioner
+}  // namespace host
+}  // namespace kernels
+}  // namespace gko
+
+#endif  // GKO_REFERENCE_PRECONDITIONER_BATCH_ILU_HPP_
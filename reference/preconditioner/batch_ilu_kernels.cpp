@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+
+#include <ginkgo/core/base/array.hpp>
+
+#include "core/base/batch_struct.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/batch_struct.hpp"
+#include "reference/base/batch_struct.hpp"
+#include "reference/matrix/batch_struct.hpp"
+#include "reference/preconditioner/batch_ilu_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+namespace batch_ilu {
+
+
+template <typename ValueType, typename IndexType>
+void generate_common_pattern(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const gko::matrix::Csr<ValueType, IndexType>* first_sys_csr,
+    IndexType* diag_locs, array<IndexType>& update_ptrs,
+    array<IndexType>& update_src, array<IndexType>& update_dst)
+{
+    const auto num_rows = static_cast<IndexType>(first_sys_csr->get_size()[0]);
+    const auto nnz =
+        static_cast<IndexType>(first_sys_csr->get_num_stored_elements());
+    const auto row_ptrs = first_sys_csr->get_const_row_ptrs();
+    const auto col_idxs = first_sys_csr->get_const_col_idxs();
+    bool missing_diag = false;
+    for (IndexType row = 0; row < num_rows; row++) {
+        diag_locs[row] = batch_single_kernels::find_sorted_col(
+            col_idxs, row_ptrs[row], row_ptrs[row + 1], row);
+        missing_diag = missing_diag || diag_locs[row] < 0;
+    }
+    update_ptrs.resize_and_reset(nnz + 1);
+    update_ptrs.fill(zero<IndexType>());
+    if (missing_diag) {
+        // a structurally missing pivot is reported by the caller
+        update_src.resize_and_reset(0);
+        update_dst.resize_and_reset(0);
+        return;
+    }
+    const auto ptrs = update_ptrs.get_data();
+    for (IndexType row = 0; row < num_rows; row++) {
+        batch_single_kernels::for_each_ilu0_update(
+            row, row_ptrs, col_idxs, diag_locs,
+            [&](IndexType nz, IndexType, IndexType) { ptrs[nz]++; });
+    }
+    components::prefix_sum_nonnegative(exec, ptrs, nnz + 1);
+    update_src.resize_and_reset(ptrs[nnz]);
+    update_dst.resize_and_reset(ptrs[nnz]);
+    const auto src_data = update_src.get_data();
+    const auto dst_data = update_dst.get_data();
+    for (IndexType row = 0; row < num_rows; row++) {
+        // the updates of each nonzero are enumerated contiguously
+        IndexType out = ptrs[row_ptrs[row]];
+        batch_single_kernels::for_each_ilu0_update(
+            row, row_ptrs, col_idxs, diag_locs,
+            [&](IndexType, IndexType src, IndexType dst) {
+                src_data[out] = src;
+                dst_data[out] = dst;
+                out++;
+            });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_GENERATE_COMMON_PATTERN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_factors(std::shared_ptr<const DefaultExecutor> exec,
+                     const batch::matrix::Csr<ValueType, IndexType>* sys_csr,
+                     const IndexType* diag_locs, const IndexType* update_ptrs,
+                     const IndexType* update_src, const IndexType* update_dst,
+                     ValueType* factors)
+{
+    const auto num_batch = sys_csr->get_num_batch_items();
+    const auto num_rows =
+        static_cast<IndexType>(sys_csr->get_common_size()[0]);
+    const auto nnz =
+        static_cast<IndexType>(sys_csr->get_num_elements_per_item());
+    for (size_type batch_id = 0; batch_id < num_batch; batch_id++) {
+        batch_single_kernels::compute_ilu0_factors_impl(
+            batch_id, num_rows, nnz, sys_csr->get_const_row_ptrs(),
+            sys_csr->get_const_col_idxs(), diag_locs, update_ptrs, update_src,
+            update_dst, sys_csr->get_const_values(), factors);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_COMPUTE_FACTORS_KERNEL);
+
+
+}  // namespace batch_ilu
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
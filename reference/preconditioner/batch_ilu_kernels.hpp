@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_REFERENCE_PRECONDITIONER_BATCH_ILU_KERNELS_HPP_
+#define GKO_REFERENCE_PRECONDITIONER_BATCH_ILU_KERNELS_HPP_
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+namespace batch_single_kernels {
+
+
+/**
+ * Returns the position of column `col` within the sorted column indices in
+ * [begin, end), or -1 if the entry is not stored.
+ */
+template <typename IndexType>
+inline IndexType find_sorted_col(const IndexType* const col_idxs,
+                                 IndexType begin, IndexType end,
+                                 const IndexType col)
+{
+    while (begin < end) {
+        const auto mid = begin + (end - begin) / 2;
+        if (col_idxs[mid] == col) {
+            return mid;
+        } else if (col_idxs[mid] < col) {
+            begin = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    return -1;
+}
+
+
+/**
+ * Calls `callback(nz, src, dst)` for every update a[dst] -= a[nz] * a[src]
+ * that ILU(0) performs while eliminating the strictly lower entries `nz` of
+ * the given row. The updates are enumerated in elimination order.
+ */
+template <typename IndexType, typename Callback>
+inline void for_each_ilu0_update(const IndexType row,
+                                 const IndexType* const row_ptrs,
+                                 const IndexType* const col_idxs,
+                                 const IndexType* const diag_locs,
+                                 Callback callback)
+{
+    const auto row_begin = row_ptrs[row];
+    const auto row_end = row_ptrs[row + 1];
+    for (auto nz = row_begin; nz < diag_locs[row]; nz++) {
+        const auto pivot_row = col_idxs[nz];
+        for (auto src = diag_locs[pivot_row] + 1;
+             src < row_ptrs[pivot_row + 1]; src++) {
+            const auto dst =
+                find_sorted_col(col_idxs, nz + 1, row_end, col_idxs[src]);
+            if (dst >= 0) {
+                callback(nz, src, dst);
+            }
+        }
+    }
+}
+
+
+/**
+ * Computes the ILU(0) factors of one batch item by replaying the common list
+ * of updates on its values.
+ */
+template <typename ValueType, typename IndexType>
+inline void compute_ilu0_factors_impl(
+    const size_type batch_id, const IndexType num_rows, const IndexType nnz,
+    const IndexType* const row_ptrs, const IndexType* const col_idxs,
+    const IndexType* const diag_locs, const IndexType* const update_ptrs,
+    const IndexType* const update_src, const IndexType* const update_dst,
+    const ValueType* const sys_values, ValueType* const factors)
+{
+    const auto values = sys_values + batch_id * nnz;
+    const auto factor = factors + batch_id * nnz;
+    for (IndexType nz = 0; nz < nnz; nz++) {
+        factor[nz] = values[nz];
+    }
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < diag_locs[row]; nz++) {
+            factor[nz] /= factor[diag_locs[col_idxs[nz]]];
+            for (auto upd = update_ptrs[nz]; upd < update_ptrs[nz + 1];
+                 upd++) {
+                factor[update_dst[upd]] -= factor[nz] * factor[update_src[upd]];
+            }
+        }
+    }
+}
+
+
+}  // namespace batch_single_kernels
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_REFERENCE_PRECONDITIONER_BATCH_ILU_KERNELS_HPP_
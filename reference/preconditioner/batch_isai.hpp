@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_REFERENCE_PRECONDITIONER_BATCH_ISAI_HPP_
+#define GKO_REFERENCE_PRECONDITIONER_BATCH_ISAI_HPP_
+
+
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
+
+#include "core/base/batch_struct.hpp"
+#include "core/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace host {
+namespace batch_preconditioner {
+
+
+/**
+ * ISAI preconditioner for batch solvers. The approximate inverses are
+ * generated outside of the solver kernel, so generating it only selects the
+ * approximate inverse of the current batch item.
+ */
+template <typename ValueType>
+class Isai final {
+public:
+    using value_type = ValueType;
+    using index_type = int;
+
+    /**
+     * @param num_nnz  Number of stored elements of a single batch item
+     * @param row_ptrs  row pointers of the common pattern of the inverse
+     * @param col_idxs  column indices of the common pattern of the inverse
+     * @param inverse_batch  approximate inverse values of all batch items
+     */
+    Isai(const index_type num_nnz, const index_type* const row_ptrs,
+         const index_type* const col_idxs,
+         const value_type* const inverse_batch)
+        : num_nnz_{num_nnz},
+          row_ptrs_{row_ptrs},
+          col_idxs_{col_idxs},
+          inverse_batch_{inverse_batch},
+          inverse_entry_{}
+    {}
+
+    /**
+     * The size of the work vector required in case of dynamic allocation.
+     */
+    static constexpr int dynamic_work_size(const int, int) { return 0; }
+
+    template <typename batch_item_type>
+    void generate(size_type batch_id, const batch_item_type&,
+                  value_type* const)
+    {
+        inverse_entry_ = inverse_batch_ + batch_id * num_nnz_;
+    }
+
+    void apply(const gko::batch::multi_vector::batch_item<const value_type>& r,
+               const gko::batch::multi_vector::batch_item<value_type>& z) const
+    {
+        for (int row = 0; row < r.num_rows; row++) {
+            auto sum = zero<value_type>();
+            for (auto nz = row_ptrs_[row]; nz < row_ptrs_[row + 1]; nz++) {
+                sum += inverse_entry_[nz] * r.values[col_idxs_[nz] * r.stride];
+            }
+            z.values[row * z.stride] = sum;
+        }
+    }
+
+private:
+    const index_type num_nnz_;
+    const index_type* const row_ptrs_;
+    const index_type* const col_idxs_;
+    const value_type* const inverse_batch_;
+    const value_type* inverse_entry_;
+};
+
+
+}  // namespace batch_preconditioner
+}  // namespace host
+}  // namespace kernels
+}  // namespace gko
+
+#endif  // GKO_REFERENCE_PRECONDITIONER_BATCH_ISAI_HPP_
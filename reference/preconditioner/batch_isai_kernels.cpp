@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_isai_kernels.hpp"
+
+#include <algorithm>
+
+#include <ginkgo/core/base/array.hpp>
+
+#include "core/base/batch_struct.hpp"
+#include "core/matrix/batch_struct.hpp"
+#include "reference/base/batch_struct.hpp"
+#include "reference/matrix/batch_struct.hpp"
+#include "reference/preconditioner/batch_isai_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+namespace batch_isai {
+
+
+template <typename IndexType>
+void compute_cumulative_system_storage(
+    std::shared_ptr<const DefaultExecutor> exec, const size_type num_rows,
+    const IndexType* row_ptrs, IndexType* system_offsets)
+{
+    system_offsets[0] = 0;
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto size = row_ptrs[row + 1] - row_ptrs[row];
+        system_offsets[row + 1] = system_offsets[row] + size * size;
+    }
+}
+
+GKO_INSTANTIATE_FOR_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_COMPUTE_CUMULATIVE_SYSTEM_STORAGE);
+
+
+template <typename ValueType, typename IndexType>
+void extract_common_systems_pattern(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const gko::matrix::Csr<ValueType, IndexType>* first_sys_csr,
+    const IndexType* system_offsets, IndexType* systems_pattern)
+{
+    const auto num_rows = static_cast<IndexType>(first_sys_csr->get_size()[0]);
+    for (IndexType row = 0; row < num_rows; row++) {
+        batch_single_kernels::extract_system_pattern_impl(
+            row, first_sys_csr->get_const_row_ptrs(),
+            first_sys_csr->get_const_col_idxs(), system_offsets,
+            systems_pattern);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_EXTRACT_PATTERN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_isai(std::shared_ptr<const DefaultExecutor> exec,
+                  const batch::matrix::Csr<ValueType, IndexType>* sys_csr,
+                  const IndexType* system_offsets,
+                  const IndexType* systems_pattern, ValueType* inverse_values)
+{
+    const auto num_batch = sys_csr->get_num_batch_items();
+    const auto num_rows =
+        static_cast<IndexType>(sys_csr->get_common_size()[0]);
+    const auto nnz =
+        static_cast<IndexType>(sys_csr->get_num_elements_per_item());
+    const auto row_ptrs = sys_csr->get_const_row_ptrs();
+    IndexType max_size = 0;
+    for (IndexType row = 0; row < num_rows; row++) {
+        max_size = std::max(max_size, row_ptrs[row + 1] - row_ptrs[row]);
+    }
+    array<ValueType> work(exec, max_size * (max_size + 1));
+    for (size_type batch_id = 0; batch_id < num_batch; batch_id++) {
+        for (IndexType row = 0; row < num_rows; row++) {
+            batch_single_kernels::compute_isai_row_impl(
+                batch_id, row, nnz, row_ptrs, sys_csr->get_const_col_idxs(),
+                system_offsets, systems_pattern, sys_csr->get_const_values(),
+                inverse_values, work.get_data());
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_COMPUTE_KERNEL);
+
+
+}  // namespace batch_isai
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
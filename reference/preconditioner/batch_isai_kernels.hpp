@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_REFERENCE_PRECONDITIONER_BATCH_ISAI_KERNELS_HPP_
+#define GKO_REFERENCE_PRECONDITIONER_BATCH_ISAI_KERNELS_HPP_
+
+
+#include <utility>
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+namespace batch_single_kernels {
+
+
+/**
+ * Stores, for the dense system A(J_i, J_i) of the given row i, the position of
+ * every entry within the values of A, or -1 if the entry is not stored.
+ * The system is stored in row-major order.
+ */
+template <typename IndexType>
+inline void extract_system_pattern_impl(const IndexType row,
+                                        const IndexType* const row_ptrs,
+                                        const IndexType* const col_idxs,
+                                        const IndexType* const system_offsets,
+                                        IndexType* const systems_pattern)
+{
+    const auto row_begin = row_ptrs[row];
+    const auto size = row_ptrs[row + 1] - row_begin;
+    const auto pattern = systems_pattern + system_offsets[row];
+    for (IndexType i = 0; i < size; i++) {
+        const auto sys_row = col_idxs[row_begin + i];
+        for (IndexType j = 0; j < size; j++) {
+            const auto sys_col = col_idxs[row_begin + j];
+            IndexType pos = -1;
+            for (auto nz = row_ptrs[sys_row]; nz < row_ptrs[sys_row + 1];
+                 nz++) {
+                if (col_idxs[nz] == sys_col) {
+                    pos = nz;
+                    break;
+                }
+            }
+            pattern[i * size + j] = pos;
+        }
+    }
+}
+
+
+/**
+ * Computes row `row` of the approximate inverse of one batch item by solving
+ * A(J_i, J_i)^T m = e_i with Gaussian elimination and partial pivoting.
+ *
+ * @param work  workspace for at least size * (size + 1) values, where size is
+ *              the number of stored entries in the row.
+ */
+template <typename ValueType, typename IndexType>
+inline void compute_isai_row_impl(
+    const size_type batch_id, const IndexType row, const IndexType nnz,
+    const IndexType* const row_ptrs, const IndexType* const col_idxs,
+    const IndexType* const system_offsets,
+    const IndexType* const systems_pattern,
+    const ValueType* const sys_values, ValueType* const inverse_values,
+    ValueType* const work)
+{
+    const auto values = sys_values + batch_id * nnz;
+    const auto row_begin = row_ptrs[row];
+    const auto size = row_ptrs[row + 1] - row_begin;
+    const auto pattern = systems_pattern + system_offsets[row];
+    const auto result = inverse_values + batch_id * nnz + row_begin;
+    const auto mtx = work;
+    const auto rhs = work + size * size;
+    IndexType diag = -1;
+    for (IndexType i = 0; i < size; i++) {
+        rhs[i] = zero<ValueType>();
+        if (col_idxs[row_begin + i] == row) {
+            diag = i;
+            rhs[i] = one<ValueType>();
+        }
+        for (IndexType j = 0; j < size; j++) {
+            // transpose while gathering
+            const auto pos = pattern[j * size + i];
+            mtx[i * size + j] = pos >= 0 ? values[pos] : zero<ValueType>();
+        }
+    }
+    bool singular = diag < 0;
+    for (IndexType k = 0; k < size && !singular; k++) {
+        auto pivot = k;
+        for (auto i = k + 1; i < size; i++) {
+            if (abs(mtx[i * size + k]) > abs(mtx[pivot * size + k])) {
+                pivot = i;
+            }
+        }
+        if (mtx[pivot * size + k] == zero<ValueType>()) {
+            singular = true;
+            break;
+        }
+        if (pivot != k) {
+            for (IndexType j = k; j < size; j++) {
+                std::swap(mtx[k * size + j], mtx[pivot * size + j]);
+            }
+            std::swap(rhs[k], rhs[pivot]);
+        }
+        for (auto i = k + 1; i < size; i++) {
+            const auto factor = mtx[i * size + k] / mtx[k * size + k];
+            for (auto j = k + 1; j < size; j++) {
+                mtx[i * size + j] -= factor * mtx[k * size + j];
+            }
+            rhs[i] -= factor * rhs[k];
+        }
+    }
+    if (singular) {
+        // fall back to scalar Jacobi, or to the identity without a diagonal
+        for (IndexType i = 0; i < size; i++) {
+            result[i] = zero<ValueType>();
+        }
+        if (diag >= 0) {
+            const auto diag_val = values[row_begin + diag];
+            result[diag] = diag_val == zero<ValueType>()
+                               ? one<ValueType>()
+                               : one<ValueType>() / diag_val;
+        }
+        return;
+    }
+    for (auto i = size - 1; i >= 0; i--) {
+        auto sum = rhs[i];
+        for (auto j = i + 1; j < size; j++) {
+            sum -= mtx[i * size + j] * result[j];
+        }
+        result[i] = sum / mtx[i * size + i];
+    }
+}
+
+
+}  // namespace batch_single_kernels
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_REFERENCE_PRECONDITIONER_BATCH_ISAI_KERNELS_HPP_
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/batch_direct_kernels.hpp"
+
+#include <algorithm>
+
+#include <ginkgo/core/base/array.hpp>
+
+#include "core/base/allocator.hpp"
+#include "reference/solver/batch_direct_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+namespace batch_direct {
+
+
+template <typename ValueType, typename IndexType>
+void dense_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                     const batch::matrix::Dense<ValueType>* sys_dense,
+                     ValueType* factors, IndexType* pivots, bool* singular)
+{
+    const auto num_batch = sys_dense->get_num_batch_items();
+    const auto num_rows =
+        static_cast<IndexType>(sys_dense->get_common_size()[0]);
+    const auto item_size = static_cast<size_type>(num_rows) * num_rows;
+    std::copy_n(sys_dense->get_const_values(), num_batch * item_size, factors);
+    for (size_type batch_id = 0; batch_id < num_batch; batch_id++) {
+        const auto lu = factors + batch_id * item_size;
+        batch_single_kernels::dense_lu_factorize_impl(
+            num_rows, lu, pivots + batch_id * num_rows);
+        singular[batch_id] = batch_single_kernels::has_singular_pivot_impl(
+            num_rows, sys_dense->get_const_values() + batch_id * item_size,
+            item_size, [&](IndexType row) { return lu[row * num_rows + row]; });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_DENSE_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void dense_solve(std::shared_ptr<const DefaultExecutor> exec,
+                 const ValueType* factors, const IndexType* pivots,
+                 batch::MultiVector<ValueType>* x)
+{
+    const auto num_batch = x->get_num_batch_items();
+    const auto num_rows = static_cast<IndexType>(x->get_common_size()[0]);
+    const auto num_rhs = static_cast<IndexType>(x->get_common_size()[1]);
+    const auto item_size = static_cast<size_type>(num_rows) * num_rows;
+    for (size_type batch_id = 0; batch_id < num_batch; batch_id++) {
+        batch_single_kernels::dense_lu_solve_impl(
+            num_rows, num_rhs, factors + batch_id * item_size,
+            pivots + batch_id * num_rows, x->get_values_for_item(batch_id));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_DENSE_SOLVE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void symbolic_factorize(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const gko::matrix::Csr<ValueType, IndexType>* first_sys_csr,
+    array<IndexType>& factor_row_ptrs, array<IndexType>& factor_col_idxs)
+{
+    const auto num_rows = static_cast<IndexType>(first_sys_csr->get_size()[0]);
+    vector<IndexType> row_ptrs(exec);
+    vector<IndexType> col_idxs(exec);
+    batch_single_kernels::symbolic_lu_impl(
+        num_rows, first_sys_csr->get_const_row_ptrs(),
+        first_sys_csr->get_const_col_idxs(), row_ptrs, col_idxs);
+    factor_row_ptrs.resize_and_reset(row_ptrs.size());
+    factor_col_idxs.resize_and_reset(col_idxs.size());
+    std::copy(row_ptrs.begin(), row_ptrs.end(), factor_row_ptrs.get_data());
+    std::copy(col_idxs.begin(), col_idxs.end(), factor_col_idxs.get_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SYMBOLIC_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void sparse_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                      const batch::matrix::Csr<ValueType, IndexType>* sys_csr,
+                      const IndexType* factor_row_ptrs,
+                      const IndexType* factor_col_idxs,
+                      const IndexType* diag_locs, const IndexType* update_ptrs,
+                      const IndexType* update_src, const IndexType* update_dst,
+                      ValueType* factors, bool* singular)
+{
+    const auto num_batch = sys_csr->get_num_batch_items();
+    const auto num_rows =
+        static_cast<IndexType>(sys_csr->get_common_size()[0]);
+    const auto nnz =
+        static_cast<IndexType>(sys_csr->get_num_elements_per_item());
+    const auto factor_nnz = factor_row_ptrs[num_rows];
+    for (size_type batch_id = 0; batch_id < num_batch; batch_id++) {
+        const auto factor = factors + batch_id * factor_nnz;
+        batch_single_kernels::scatter_to_factor_pattern_impl(
+            num_rows, sys_csr->get_const_row_ptrs(),
+            sys_csr->get_const_col_idxs(),
+            sys_csr->get_const_values() + batch_id * nnz, factor_row_ptrs,
+            factor_col_idxs, factor);
+        // LU without pivoting is ILU(0) on the pattern including fill-in
+        batch_single_kernels::compute_ilu0_factors_impl(
+            size_type{}, num_rows, factor_nnz, factor_row_ptrs,
+            factor_col_idxs, diag_locs, update_ptrs, update_src, update_dst,
+            factor, factor);
+        singular[batch_id] = batch_single_kernels::has_singular_pivot_impl(
+            num_rows, sys_csr->get_const_values() + batch_id * nnz,
+            static_cast<size_type>(nnz),
+            [&](IndexType row) { return factor[diag_locs[row]]; });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SPARSE_FACTORIZE_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void sparse_solve(std::shared_ptr<const DefaultExecutor> exec,
+                  const IndexType* factor_row_ptrs,
+                  const IndexType* factor_col_idxs, const IndexType* diag_locs,
+                  const ValueType* factors, batch::MultiVector<ValueType>* x)
+{
+    const auto num_batch = x->get_num_batch_items();
+    const auto num_rows = static_cast<IndexType>(x->get_common_size()[0]);
+    const auto num_rhs = static_cast<IndexType>(x->get_common_size()[1]);
+    const auto factor_nnz = factor_row_ptrs[num_rows];
+    for (size_type batch_id = 0; batch_id < num_batch; batch_id++) {
+        batch_single_kernels::sparse_lu_solve_impl(
+            num_rows, num_rhs, factor_row_ptrs, factor_col_idxs, diag_locs,
+            factors + batch_id * factor_nnz, x->get_values_for_item(batch_id));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_DIRECT_SPARSE_SOLVE_KERNEL);
+
+
+}  // namespace batch_direct
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
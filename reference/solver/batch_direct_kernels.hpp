@@ -0,0 +1,245 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_REFERENCE_SOLVER_BATCH_DIRECT_KERNELS_HPP_
+#define GKO_REFERENCE_SOLVER_BATCH_DIRECT_KERNELS_HPP_
+
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+#include "core/base/allocator.hpp"
+#include "reference/preconditioner/batch_ilu_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+namespace batch_single_kernels {
+
+
+/**
+ * Computes the LU factorization with partial pivoting of the row-major dense
+ * matrix `lu` in-place. During the elimination of column k, row k is swapped
+ * with row pivots[k].
+ */
+template <typename ValueType, typename IndexType>
+inline void dense_lu_factorize_impl(const IndexType num_rows,
+                                    ValueType* const lu,
+                                    IndexType* const pivots)
+{
+    for (IndexType k = 0; k < num_rows; k++) {
+        auto pivot = k;
+        for (auto row = k + 1; row < num_rows; row++) {
+            if (abs(lu[row * num_rows + k]) > abs(lu[pivot * num_rows + k])) {
+                pivot = row;
+            }
+        }
+        pivots[k] = pivot;
+        if (pivot != k) {
+            for (IndexType col = 0; col < num_rows; col++) {
+                std::swap(lu[k * num_rows + col], lu[pivot * num_rows + col]);
+            }
+        }
+        const auto diag = lu[k * num_rows + k];
+        for (auto row = k + 1; row < num_rows; row++) {
+            const auto factor = lu[row * num_rows + k] / diag;
+            lu[row * num_rows + k] = factor;
+            for (auto col = k + 1; col < num_rows; col++) {
+                lu[row * num_rows + col] -= factor * lu[k * num_rows + col];
+            }
+        }
+    }
+}
+
+
+/**
+ * Returns true if a pivot of the LU factorization of an item is zero, not
+ * finite or tiny compared to the largest absolute value among the
+ * `num_values` entries of the item, i.e. the item is numerically singular.
+ * `get_pivot(row)` returns the diagonal entry of U in the given row.
+ */
+template <typename ValueType, typename IndexType, typename PivotAccessor>
+inline bool has_singular_pivot_impl(const IndexType num_rows,
+                                    const ValueType* const values,
+                                    const size_type num_values,
+                                    PivotAccessor get_pivot)
+{
+    using real_type = remove_complex<ValueType>;
+    auto max_abs = zero<real_type>();
+    for (size_type i = 0; i < num_values; i++) {
+        max_abs = std::max(max_abs, abs(values[i]));
+    }
+    const auto threshold = static_cast<real_type>(num_rows) *
+                           std::numeric_limits<real_type>::epsilon() *
+                           max_abs;
+    for (IndexType row = 0; row < num_rows; row++) {
+        const auto pivot = get_pivot(row);
+        if (!is_finite(pivot) || !(abs(pivot) > threshold)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * Solves L U x = P b in-place for all columns of the row-major multi-vector
+ * `x`, given the output of dense_lu_factorize_impl.
+ */
+template <typename ValueType, typename IndexType>
+inline void dense_lu_solve_impl(const IndexType num_rows,
+                                const IndexType num_rhs,
+                                const ValueType* const lu,
+                                const IndexType* const pivots,
+                                ValueType* const x)
+{
+    for (IndexType k = 0; k < num_rows; k++) {
+        if (pivots[k] != k) {
+            for (IndexType j = 0; j < num_rhs; j++) {
+                std::swap(x[k * num_rhs + j], x[pivots[k] * num_rhs + j]);
+            }
+        }
+    }
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (IndexType col = 0; col < row; col++) {
+            for (IndexType j = 0; j < num_rhs; j++) {
+                x[row * num_rhs + j] -=
+                    lu[row * num_rows + col] * x[col * num_rhs + j];
+            }
+        }
+    }
+    for (auto row = num_rows - 1; row >= 0; row--) {
+        for (auto col = row + 1; col < num_rows; col++) {
+            for (IndexType j = 0; j < num_rhs; j++) {
+                x[row * num_rhs + j] -=
+                    lu[row * num_rows + col] * x[col * num_rhs + j];
+            }
+        }
+        for (IndexType j = 0; j < num_rhs; j++) {
+            x[row * num_rhs + j] /= lu[row * num_rows + row];
+        }
+    }
+}
+
+
+/**
+ * Computes the sparsity pattern of the LU factors (including fill-in) of a
+ * matrix with the given sparsity pattern, eliminated in natural order without
+ * pivoting. The diagonal is always part of the factor pattern.
+ */
+template <typename IndexType>
+inline void symbolic_lu_impl(const IndexType num_rows,
+                             const IndexType* const row_ptrs,
+                             const IndexType* const col_idxs,
+                             vector<IndexType>& factor_row_ptrs,
+                             vector<IndexType>& factor_col_idxs)
+{
+    const auto alloc = factor_col_idxs.get_allocator();
+    factor_row_ptrs.assign(num_rows + 1, 0);
+    factor_col_idxs.clear();
+    vector<bool> marker(num_rows, false, ExecutorAllocator<bool>(alloc));
+    // positions of the diagonal entries of the rows computed so far
+    vector<IndexType> diag_locs(num_rows, 0, alloc);
+    for (IndexType row = 0; row < num_rows; row++) {
+        marker[row] = true;
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            marker[col_idxs[nz]] = true;
+        }
+        // eliminating (row, k) fills in the upper part of factor row k
+        for (IndexType k = 0; k < row; k++) {
+            if (marker[k]) {
+                for (auto nz = diag_locs[k] + 1; nz < factor_row_ptrs[k + 1];
+                     nz++) {
+                    marker[factor_col_idxs[nz]] = true;
+                }
+            }
+        }
+        for (IndexType col = 0; col < num_rows; col++) {
+            if (marker[col]) {
+                if (col == row) {
+                    diag_locs[row] = factor_col_idxs.size();
+                }
+                factor_col_idxs.push_back(col);
+                marker[col] = false;
+            }
+        }
+        factor_row_ptrs[row + 1] = factor_col_idxs.size();
+    }
+}
+
+
+/**
+ * Copies the values of one batch item of the system matrix into its position
+ * within the factor sparsity pattern, and zeroes the fill-in entries.
+ */
+template <typename ValueType, typename IndexType>
+inline void scatter_to_factor_pattern_impl(
+    const IndexType num_rows, const IndexType* const row_ptrs,
+    const IndexType* const col_idxs, const ValueType* const values,
+    const IndexType* const factor_row_ptrs,
+    const IndexType* const factor_col_idxs, ValueType* const factors)
+{
+    for (IndexType nz = 0; nz < factor_row_ptrs[num_rows]; nz++) {
+        factors[nz] = zero<ValueType>();
+    }
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto pos =
+                find_sorted_col(factor_col_idxs, factor_row_ptrs[row],
+                                factor_row_ptrs[row + 1], col_idxs[nz]);
+            factors[pos] += values[nz];
+        }
+    }
+}
+
+
+/**
+ * Solves L U x = b in-place for all columns of the row-major multi-vector `x`,
+ * where L (with implicit unit diagonal) and U are stored in the given sparse
+ * factor pattern.
+ */
+template <typename ValueType, typename IndexType>
+inline void sparse_lu_solve_impl(const IndexType num_rows,
+                                 const IndexType num_rhs,
+                                 const IndexType* const factor_row_ptrs,
+                                 const IndexType* const factor_col_idxs,
+                                 const IndexType* const diag_locs,
+                                 const ValueType* const factors,
+                                 ValueType* const x)
+{
+    for (IndexType row = 0; row < num_rows; row++) {
+        for (auto nz = factor_row_ptrs[row]; nz < diag_locs[row]; nz++) {
+            const auto col = factor_col_idxs[nz];
+            for (IndexType j = 0; j < num_rhs; j++) {
+                x[row * num_rhs + j] -= factors[nz] * x[col * num_rhs + j];
+            }
+        }
+    }
+    for (auto row = num_rows - 1; row >= 0; row--) {
+        for (auto nz = diag_locs[row] + 1; nz < factor_row_ptrs[row + 1];
+             nz++) {
+            const auto col = factor_col_idxs[nz];
+            for (IndexType j = 0; j < num_rhs; j++) {
+                x[row * num_rhs + j] -= factors[nz] * x[col * num_rhs + j];
+            }
+        }
+        for (IndexType j = 0; j < num_rhs; j++) {
+            x[row * num_rhs + j] /= factors[diag_locs[row]];
+        }
+    }
+}
+
+
+}  // namespace batch_single_kernels
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_REFERENCE_SOLVER_BATCH_DIRECT_KERNELS_HPP_
@@ -0,0 +1,293 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_REFERENCE_SOLVER_BATCH_GMRES_KERNELS_HPP_
+#define GKO_REFERENCE_SOLVER_BATCH_GMRES_KERNELS_HPP_
+
+
+#include "core/solver/batch_gmres_kernels.hpp"
+
+#include "core/base/batch_struct.hpp"
+#include "core/matrix/batch_struct.hpp"
+#include "reference/base/batch_multi_vector_kernels.hpp"
+#include "reference/base/batch_struct.hpp"
+#include "reference/matrix/batch_csr_kernels.hpp"
+#include "reference/matrix/batch_dense_kernels.hpp"
+#include "reference/matrix/batch_ell_kernels.hpp"
+#include "reference/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+namespace batch_single_kernels {
+
+
+constexpr int max_num_rhs = 1;
+
+
+/**
+ * Computes the Givens rotation that annihilates next_hess against this_hess,
+ * and applies it to the pair.
+ */
+template <typename ValueType>
+inline void compute_and_apply_givens_rotation(ValueType& this_hess,
+                                              ValueType& next_hess,
+                                              ValueType& givens_cos,
+                                              ValueType& givens_sin)
+{
+    if (this_hess == zero<ValueType>()) {
+        givens_cos = zero<ValueType>();
+        givens_sin = one<ValueType>();
+    } else {
+        const auto scale = abs(this_hess) + abs(next_hess);
+        const auto hypotenuse =
+            scale * sqrt(abs(this_hess / scale) * abs(this_hess / scale) +
+                         abs(next_hess / scale) * abs(next_hess / scale));
+        givens_cos = conj(this_hess) / hypotenuse;
+        givens_sin = conj(next_hess) / hypotenuse;
+    }
+    this_hess = givens_cos * this_hess + givens_sin * next_hess;
+    next_hess = zero<ValueType>();
+}
+
+
+/**
+ * Applies the first num_cols Givens rotations to one column of the
+ * Hessenberg matrix.
+ */
+template <typename ValueType>
+inline void apply_givens_rotations(const int num_cols,
+                                   const ValueType* const givens_cos,
+                                   const ValueType* const givens_sin,
+                                   ValueType* const hess_col)
+{
+    for (int i = 0; i < num_cols; i++) {
+        const auto temp =
+            givens_cos[i] * hess_col[i] + givens_sin[i] * hess_col[i + 1];
+        hess_col[i + 1] = -conj(givens_sin[i]) * hess_col[i] +
+                          conj(givens_cos[i]) * hess_col[i + 1];
+        hess_col[i] = temp;
+    }
+}
+
+
+/**
+ * Solves the upper triangular least-squares system H y = g of size
+ * num_cols x num_cols, where H is stored column-major with leading dimension
+ * ld.
+ */
+template <typename ValueType>
+inline void solve_upper_triangular(const int num_cols, const int ld,
+                                   const ValueType* const hess,
+                                   const ValueType* const rhs,
+                                   ValueType* const y)
+{
+    for (int i = num_cols - 1; i >= 0; i--) {
+        auto temp = rhs[i];
+        for (int j = i + 1; j < num_cols; j++) {
+            temp -= hess[i + j * ld] * y[j];
+        }
+        y[i] = temp / hess[i + i * ld];
+    }
+}
+
+
+/**
+ * x = x + M^{-1} V y, where V holds the first num_cols Krylov vectors.
+ */
+template <typename PrecType, typename ValueType>
+inline void update_x(
+    const PrecType& prec, const int num_cols, const ValueType* const krylov,
+    const ValueType* const y,
+    const gko::batch::multi_vector::batch_item<ValueType>& w_entry,
+    const gko::batch::multi_vector::batch_item<ValueType>& z_entry,
+    const gko::batch::multi_vector::batch_item<ValueType>& x_entry)
+{
+    const auto num_rows = w_entry.num_rows;
+    for (int row = 0; row < num_rows; row++) {
+        w_entry.values[row * w_entry.stride] = zero<ValueType>();
+    }
+    for (int col = 0; col < num_cols; col++) {
+        const auto v = krylov + col * num_rows;
+        for (int row = 0; row < num_rows; row++) {
+            w_entry.values[row * w_entry.stride] += y[col] * v[row];
+        }
+    }
+    prec.apply(gko::batch::to_const(w_entry), z_entry);
+    for (int row = 0; row < num_rows; row++) {
+        x_entry.values[row * x_entry.stride] +=
+            z_entry.values[row * z_entry.stride];
+    }
+}
+
+
+template <typename StopType, typename PrecType, typename LogType,
+          typename BatchMatrixType, typename ValueType>
+inline void batch_entry_gmres_impl(
+    const gko::kernels::batch_gmres::settings<remove_complex<ValueType>>&
+        settings,
+    LogType logger, PrecType prec, const BatchMatrixType& a,
+    const gko::batch::multi_vector::uniform_batch<const ValueType>& b,
+    const gko::batch::multi_vector::uniform_batch<ValueType>& x,
+    const size_type batch_item_id, unsigned char* const local_space)
+{
+    using real_type = typename gko::remove_complex<ValueType>;
+    const auto num_rows = a.num_rows;
+    const auto num_rhs = b.num_rhs;
+    const auto restart = settings.restart;
+    const auto ld_hess = restart + 1;
+    GKO_ASSERT(num_rhs <= max_num_rhs);
+
+    unsigned char* const shared_space = local_space;
+    ValueType* const r = reinterpret_cast<ValueType*>(shared_space);
+    ValueType* const z = r + num_rows * num_rhs;
+    ValueType* const w = z + num_rows * num_rhs;
+    ValueType* const krylov = w + num_rows * num_rhs;
+    ValueType* const hess = krylov + num_rows * num_rhs * (restart + 1);
+    ValueType* const givens_cos = hess + ld_hess * restart;
+    ValueType* const givens_sin = givens_cos + restart;
+    ValueType* const residual = givens_sin + restart;
+    ValueType* const y = residual + restart + 1;
+    ValueType* const prec_work = y + restart;
+    ValueType temp[max_num_rhs];
+    real_type norms_rhs[max_num_rhs];
+    real_type norms_res[max_num_rhs];
+
+    const auto A_entry = gko::batch::matrix::extract_batch_item(
+        gko::batch::matrix::to_const(a), batch_item_id);
+    const gko::batch::multi_vector::batch_item<const ValueType> b_entry =
+        gko::batch::extract_batch_item(gko::batch::to_const(b), batch_item_id);
+    const gko::batch::multi_vector::batch_item<ValueType> x_entry =
+        gko::batch::extract_batch_item(x, batch_item_id);
+
+    const gko::batch::multi_vector::batch_item<ValueType> r_entry{
+        r, num_rhs, num_rows, num_rhs};
+    const gko::batch::multi_vector::batch_item<ValueType> z_entry{
+        z, num_rhs, num_rows, num_rhs};
+    const gko::batch::multi_vector::batch_item<ValueType> w_entry{
+        w, num_rhs, num_rows, num_rhs};
+    const gko::batch::multi_vector::batch_item<ValueType> temp_entry{
+        temp, num_rhs, 1, num_rhs};
+    const gko::batch::multi_vector::batch_item<real_type> rhs_norms_entry{
+        norms_rhs, num_rhs, 1, num_rhs};
+    const gko::batch::multi_vector::batch_item<real_type> res_norms_entry{
+        norms_res, num_rhs, 1, num_rhs};
+    const auto krylov_entry = [&](int col) {
+        return gko::batch::multi_vector::batch_item<ValueType>{
+            krylov + col * num_rows * num_rhs, num_rhs, num_rows, num_rhs};
+    };
+
+    // generate preconditioner
+    prec.generate(batch_item_id, A_entry, prec_work);
+
+    // compute b norms
+    batch_single_kernels::compute_norm2_kernel<ValueType>(b_entry,
+                                                          rhs_norms_entry);
+    // r = b - A*x
+    batch_single_kernels::copy_kernel(b_entry, r_entry);
+    batch_single_kernels::advanced_apply(static_cast<ValueType>(-1.0), A_entry,
+                                         gko::batch::to_const(x_entry),
+                                         static_cast<ValueType>(1.0), r_entry);
+    batch_single_kernels::compute_norm2_kernel<ValueType>(
+        gko::batch::to_const(r_entry), res_norms_entry);
+
+    // stopping criterion object
+    StopType stop(settings.residual_tol, rhs_norms_entry.values);
+
+    int iter = 0;
+    bool converged = stop.check_converged(res_norms_entry.values);
+
+    while (!converged && iter < settings.max_iterations) {
+        // V_0 = r / ||r||, g = ||r|| e_1
+        const auto beta = res_norms_entry.values[0];
+        temp_entry.values[0] = one<ValueType>() / beta;
+        batch_single_kernels::copy_kernel(gko::batch::to_const(r_entry),
+                                          krylov_entry(0));
+        batch_single_kernels::scale_kernel(gko::batch::to_const(temp_entry),
+                                           krylov_entry(0));
+        residual[0] = beta;
+        for (int i = 1; i <= restart; i++) {
+            residual[i] = zero<ValueType>();
+        }
+
+        int num_cols = 0;
+        for (int j = 0; j < restart; j++) {
+            const auto hess_col = hess + j * ld_hess;
+            // w = A * M^{-1} * V_j
+            prec.apply(gko::batch::to_const(krylov_entry(j)), z_entry);
+            batch_single_kernels::simple_apply(
+                A_entry, gko::batch::to_const(z_entry), w_entry);
+
+            // modified Gram-Schmidt against V_0 ... V_j
+            for (int i = 0; i <= j; i++) {
+                batch_single_kernels::compute_conj_dot_product_kernel<
+                    ValueType>(gko::batch::to_const(krylov_entry(i)),
+                               gko::batch::to_const(w_entry), temp_entry);
+                hess_col[i] = temp_entry.values[0];
+                temp_entry.values[0] = -hess_col[i];
+                batch_single_kernels::add_scaled_kernel(
+                    gko::batch::to_const(temp_entry),
+                    gko::batch::to_const(krylov_entry(i)), w_entry);
+            }
+            batch_single_kernels::compute_norm2_kernel<ValueType>(
+                gko::batch::to_const(w_entry), res_norms_entry);
+            hess_col[j + 1] = res_norms_entry.values[0];
+
+            // V_{j+1} = w / H(j+1, j), unless the Krylov space is exhausted
+            batch_single_kernels::copy_kernel(gko::batch::to_const(w_entry),
+                                              krylov_entry(j + 1));
+            if (hess_col[j + 1] != zero<ValueType>()) {
+                temp_entry.values[0] = one<ValueType>() / hess_col[j + 1];
+                batch_single_kernels::scale_kernel(
+                    gko::batch::to_const(temp_entry), krylov_entry(j + 1));
+            }
+
+            // reduce the new Hessenberg column to upper triangular form
+            apply_givens_rotations(j, givens_cos, givens_sin, hess_col);
+            compute_and_apply_givens_rotation(hess_col[j], hess_col[j + 1],
+                                              givens_cos[j], givens_sin[j]);
+            residual[j + 1] = -conj(givens_sin[j]) * residual[j];
+            residual[j] = givens_cos[j] * residual[j];
+
+            ++iter;
+            num_cols = j + 1;
+            // use the implicit residual norm from the rotated rhs
+            res_norms_entry.values[0] = abs(residual[j + 1]);
+            converged = stop.check_converged(res_norms_entry.values);
+            if (converged || iter >= settings.max_iterations) {
+                break;
+            }
+        }
+
+        // x = x + M^{-1} V y with H y = g
+        solve_upper_triangular(num_cols, ld_hess, hess, residual, y);
+        update_x(prec, num_cols, krylov, y, w_entry, z_entry, x_entry);
+
+        if (converged || iter >= settings.max_iterations) {
+            break;
+        }
+
+        // restart from the explicit residual r = b - A*x
+        batch_single_kernels::copy_kernel(b_entry, r_entry);
+        batch_single_kernels::advanced_apply(
+            static_cast<ValueType>(-1.0), A_entry,
+            gko::batch::to_const(x_entry), static_cast<ValueType>(1.0),
+            r_entry);
+        batch_single_kernels::compute_norm2_kernel<ValueType>(
+            gko::batch::to_const(r_entry), res_norms_entry);
+        converged = stop.check_converged(res_norms_entry.values);
+    }
+
+    logger.log_iteration(batch_item_id, iter, res_norms_entry.values[0]);
+}
+
+
+}  // namespace batch_single_kernels
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/auto_format.hpp>
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/tuning_cache.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/hybrid.hpp>
+#include <ginkgo/core/matrix/sellp.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class AutoFormat : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::AutoFormat<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Coo = gko::matrix::Coo<value_type, index_type>;
+    using Hybrid = gko::matrix::Hybrid<value_type, index_type>;
+    using Sellp = gko::matrix::Sellp<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    AutoFormat()
+        : exec(gko::ReferenceExecutor::create()),
+          csr(gko::share(gko::initialize<Csr>({{1.0, 0.0, 2.0},
+                                                {0.0, 0.0, 0.0},
+                                                {0.0, 3.0, 0.0},
+                                                {4.0, 5.0, 6.0}},
+                                               exec))),
+          b(gko::initialize<Vec>({1.0, 2.0, 3.0}, exec)),
+          x(gko::initialize<Vec>({1.0, 1.0, 1.0, 1.0}, exec)),
+          cache(gko::TuningCache::create())
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Csr> csr;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> x;
+    std::shared_ptr<gko::TuningCache> cache;
+};
+
+TYPED_TEST_SUITE(AutoFormat, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(AutoFormat, TunesOnFirstApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, this->csr);
+    ASSERT_EQ(mtx->get_selected_format(), "");
+    ASSERT_EQ(mtx->get_selected_operator(), nullptr);
+
+    mtx->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, l({7.0, 0.0, 6.0, 32.0}), 0.0);
+    const auto candidates = mtx->get_candidates();
+    ASSERT_NE(std::find(candidates.begin(), candidates.end(),
+                        mtx->get_selected_format()),
+              candidates.end());
+    ASSERT_NE(mtx->get_selected_operator(), nullptr);
+}
+
+
+TYPED_TEST(AutoFormat, AppliesLinearCombination)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    auto mtx = Mtx::create(this->exec, this->csr);
+    auto alpha = gko::initialize<Vec>({2.0}, this->exec);
+    auto beta = gko::initialize<Vec>({-1.0}, this->exec);
+
+    mtx->apply(alpha, this->b, beta, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, l({13.0, -1.0, 11.0, 63.0}), 0.0);
+}
+
+
+TYPED_TEST(AutoFormat, ComputesFingerprint)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, this->csr);
+
+    const auto fingerprint = mtx->get_fingerprint();
+
+    // one empty row, one row of length 1 and two rows of length 2 or 3
+    const std::string suffix = "|4x3|6|1,1,2";
+    ASSERT_EQ(fingerprint.rfind("gko::ReferenceExecutor(-1)|", 0), 0);
+    ASSERT_GT(fingerprint.size(), suffix.size());
+    ASSERT_EQ(fingerprint.substr(fingerprint.size() - suffix.size()), suffix);
+}
+
+
+TYPED_TEST(AutoFormat, ListsCpuCandidates)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, this->csr);
+
+    ASSERT_EQ(mtx->get_candidates(),
+              std::vector<std::string>(
+                  {"csr", "coo", "ell", "hybrid", "hybrid_imbalance_limit",
+                   "hybrid_minimal_storage", "sellp", "sellp_32",
+                   "sellp_8"}));
+}
+
+
+TYPED_TEST(AutoFormat, SkipsEllForImbalancedRows)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::matrix_data<value_type, index_type> data{gko::dim<2>{10, 10}};
+    for (index_type i = 0; i < 10; i++) {
+        data.nonzeros.emplace_back(0, i, 1.0);
+        if (i > 0) {
+            data.nonzeros.emplace_back(i, i, 1.0);
+        }
+    }
+    auto csr = gko::share(Csr::create(this->exec));
+    csr->read(data);
+    auto mtx = Mtx::create(this->exec, csr);
+
+    ASSERT_EQ(mtx->get_candidates(),
+              std::vector<std::string>(
+                  {"csr", "coo", "hybrid", "hybrid_imbalance_limit",
+                   "hybrid_minimal_storage", "sellp", "sellp_32", "sellp_8"}));
+}
+
+
+TYPED_TEST(AutoFormat, StoresSelectionInCache)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, this->csr, this->cache);
+
+    mtx->tune();
+
+    ASSERT_EQ(this->cache->get_num_entries(), 1);
+    ASSERT_EQ(this->cache->lookup(mtx->get_fingerprint()),
+              mtx->get_selected_format());
+}
+
+
+TYPED_TEST(AutoFormat, UsesCachedSelection)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Coo = typename TestFixture::Coo;
+    auto mtx = Mtx::create(this->exec, this->csr, this->cache);
+    this->cache->store(mtx->get_fingerprint(), "coo");
+
+    mtx->apply(this->b, this->x);
+
+    ASSERT_EQ(mtx->get_selected_format(), "coo");
+    ASSERT_NE(dynamic_cast<const Coo*>(mtx->get_selected_operator().get()),
+              nullptr);
+    GKO_ASSERT_MTX_NEAR(this->x, l({7.0, 0.0, 6.0, 32.0}), 0.0);
+}
+
+
+TYPED_TEST(AutoFormat, ConvertsToSellpVariant)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Sellp = typename TestFixture::Sellp;
+    auto mtx = Mtx::create(this->exec, this->csr, this->cache);
+    this->cache->store(mtx->get_fingerprint(), "sellp_8");
+
+    mtx->apply(this->b, this->x);
+
+    auto sellp = dynamic_cast<const Sellp*>(mtx->get_selected_operator().get());
+    ASSERT_NE(sellp, nullptr);
+    ASSERT_EQ(sellp->get_slice_size(), 8);
+    GKO_ASSERT_MTX_NEAR(this->x, l({7.0, 0.0, 6.0, 32.0}), 0.0);
+}
+
+
+TYPED_TEST(AutoFormat, ConvertsToHybridVariant)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Hybrid = typename TestFixture::Hybrid;
+    auto mtx = Mtx::create(this->exec, this->csr, this->cache);
+    this->cache->store(mtx->get_fingerprint(), "hybrid_minimal_storage");
+
+    mtx->apply(this->b, this->x);
+
+    auto hybrid =
+        dynamic_cast<const Hybrid*>(mtx->get_selected_operator().get());
+    ASSERT_NE(hybrid, nullptr);
+    ASSERT_NE(std::dynamic_pointer_cast<
+                  const typename Hybrid::minimal_storage_limit>(
+                  hybrid->get_strategy()),
+              nullptr);
+    GKO_ASSERT_MTX_NEAR(this->x, l({7.0, 0.0, 6.0, 32.0}), 0.0);
+}
+
+
+TYPED_TEST(AutoFormat, IgnoresUnknownCachedSelection)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, this->csr, this->cache);
+    this->cache->store(mtx->get_fingerprint(), "unknown");
+
+    mtx->tune();
+
+    ASSERT_NE(mtx->get_selected_format(), "unknown");
+    ASSERT_EQ(this->cache->lookup(mtx->get_fingerprint()),
+              mtx->get_selected_format());
+}
+
+
+TYPED_TEST(AutoFormat, CopiesSelection)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, this->csr, this->cache);
+    mtx->tune();
+
+    auto copy = mtx->clone();
+
+    ASSERT_EQ(copy->get_size(), mtx->get_size());
+    ASSERT_EQ(copy->get_selected_format(), mtx->get_selected_format());
+    ASSERT_EQ(copy->get_tuning_cache(), this->cache);
+    copy->apply(this->b, this->x);
+    GKO_ASSERT_MTX_NEAR(this->x, l({7.0, 0.0, 6.0, 32.0}), 0.0);
+}
+
+
+TYPED_TEST(AutoFormat, HandlesEmptyMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    mtx->tune();
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>{});
+    ASSERT_EQ(mtx->get_selected_format(), "csr");
+}
+
+
+}  // namespace
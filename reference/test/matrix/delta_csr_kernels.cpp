@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/delta_csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class DeltaCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::DeltaCsr<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    DeltaCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx1(Mtx::create(exec)),
+          mtx2(Mtx::create(exec)),
+          // row 0 needs a short, a medium and a long delta,
+          // row 1 is unsorted and contains a duplicate entry
+          csr2(Csr::create(
+              exec, gko::dim<2>{3, 70002},
+              gko::array<value_type>{exec,
+                                     {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0}},
+              gko::array<index_type>{exec, {0, 1, 300, 70001, 5, 2, 2}},
+              gko::array<index_type>{exec, {0, 4, 4, 7}}))
+    {
+        mtx1->read(
+            {{2, 3}, {{0, 0, 1.0}, {0, 1, 3.0}, {0, 2, 2.0}, {1, 1, 5.0}}});
+        csr2->convert_to(mtx2);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx1;
+    std::unique_ptr<Mtx> mtx2;
+    std::unique_ptr<Csr> csr2;
+};
+
+TYPED_TEST_SUITE(DeltaCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(DeltaCsr, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx1->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({13.0, 5.0}), 0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesToMixedDenseVector)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx1->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({13.0, 5.0}), 0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    // clang-format off
+    auto x = gko::initialize<Vec>(
+        {I<T>{2.0, 3.0},
+         I<T>{1.0, -1.5},
+         I<T>{4.0, 2.5}}, this->exec);
+    // clang-format on
+    auto y = Vec::create(this->exec, gko::dim<2>{2});
+
+    this->mtx1->apply(x, y);
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(y,
+                    l({{13.0,  3.5},
+                       { 5.0, -7.5}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 2.0}, this->exec);
+
+    this->mtx1->apply(alpha, x, beta, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({-11.0, -1.0}), 0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesLinearCombinationToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    // clang-format off
+    auto x = gko::initialize<Vec>(
+        {I<T>{2.0, 3.0},
+         I<T>{1.0, -1.5},
+         I<T>{4.0, 2.5}}, this->exec);
+    auto y = gko::initialize<Vec>(
+        {I<T>{1.0, 0.5},
+         I<T>{2.0, -1.5}}, this->exec);
+    // clang-format on
+
+    this->mtx1->apply(alpha, x, beta, y);
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(y,
+                    l({{-11.0, -2.5},
+                       { -1.0,  4.5}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(DeltaCsr, ApplyFailsOnWrongInnerDimension)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{2});
+    auto y = Vec::create(this->exec, gko::dim<2>{2});
+
+    ASSERT_THROW(this->mtx1->apply(x, y), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(DeltaCsr, EncodesShortMediumAndLongDeltas)
+{
+    using index_type = typename TestFixture::index_type;
+    const auto p = this->mtx2->get_const_delta_ptrs();
+    const gko::int64 long_size = 3 + sizeof(index_type);
+
+    ASSERT_EQ(p[0], 0);
+    // 1 byte for delta 1, 3 bytes for delta 299, long delta 69701
+    ASSERT_EQ(p[1], 1 + 3 + long_size);
+    ASSERT_EQ(p[2], p[1]);
+    // long deltas -3 and 0
+    ASSERT_EQ(p[3], p[2] + 2 * long_size);
+    ASSERT_EQ(this->mtx2->get_num_delta_bytes(), p[3]);
+    ASSERT_EQ(this->mtx2->get_const_base_cols()[0], 0);
+    ASSERT_EQ(this->mtx2->get_const_base_cols()[2], 5);
+}
+
+
+TYPED_TEST(DeltaCsr, ConvertsToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx2->convert_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(csr, this->csr2, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(csr, this->csr2);
+    ASSERT_EQ(csr->get_const_col_idxs()[4], 5);
+    ASSERT_EQ(csr->get_const_col_idxs()[5], 2);
+    ASSERT_EQ(csr->get_const_col_idxs()[6], 2);
+}
+
+
+TYPED_TEST(DeltaCsr, MovesToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx2->move_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(csr, this->csr2, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(csr, this->csr2);
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesWithLongAndUnsortedDeltas)
+{
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto x = Vec::create(this->exec, gko::dim<2>{70002, 1});
+    x->fill(gko::zero<value_type>());
+    x->at(0, 0) = 1.0;
+    x->at(1, 0) = 2.0;
+    x->at(2, 0) = 3.0;
+    x->at(5, 0) = 4.0;
+    x->at(300, 0) = 5.0;
+    x->at(70001, 0) = 6.0;
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 1});
+    auto expected = y->clone();
+
+    this->mtx2->apply(x, y);
+    this->csr2->apply(x, expected);
+
+    GKO_ASSERT_MTX_NEAR(y, expected, 0.0);
+}
+
+
+}  // namespace
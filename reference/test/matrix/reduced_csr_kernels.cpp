@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/reduced_csr_kernels.hpp"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/reduced_csr.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class ReducedCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::ReducedCsr<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    ReducedCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx1(Mtx::create(exec)),
+          mtx2(Mtx::create(exec, gko::dim<2>{},
+                           gko::matrix::reduced_storage::double_reduction)),
+          // the values are not representable in float or half
+          csr3(Csr::create(
+              exec, gko::dim<2>{2, 3},
+              gko::array<value_type>{exec, {1.0, 0.1, -1.0 / 3.0, 2.2}},
+              gko::array<index_type>{exec, {0, 1, 2, 1}},
+              gko::array<index_type>{exec, {0, 3, 4}})),
+          // scaled storage has an absolute error of at most half the scale
+          int16_tol(std::max<double>(r<value_type>::value, 1e-4))
+    {
+        mtx1->read(
+            {{2, 3}, {{0, 0, 1.0}, {0, 1, 3.0}, {0, 2, 2.0}, {1, 1, 5.0}}});
+        mtx2->read(
+            {{2, 3}, {{0, 0, 1.0}, {0, 1, 3.0}, {0, 2, 2.0}, {1, 1, 5.0}}});
+        if (!gko::is_complex<value_type>()) {
+            mtx3 = Mtx::create(exec, gko::dim<2>{},
+                               gko::matrix::reduced_storage::scaled_int16);
+            mtx3->read(
+                {{2, 3}, {{0, 0, 1.0}, {0, 1, 3.0}, {0, 2, 2.0}, {1, 1, 5.0}}});
+        }
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx1;
+    std::unique_ptr<Mtx> mtx2;
+    std::unique_ptr<Mtx> mtx3;
+    std::unique_ptr<Csr> csr3;
+    double int16_tol;
+};
+
+TYPED_TEST_SUITE(ReducedCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(ReducedCsr, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx1->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({13.0, 5.0}), 0.0);
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesDoubleReductionToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx2->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({13.0, 5.0}), 0.0);
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesScaledInt16ToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    if (!this->mtx3) {
+        GTEST_SKIP() << "scaled storage is only available for real types";
+    }
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx3->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({13.0, 5.0}), this->int16_tol);
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesToMixedDenseVector)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx1->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({13.0, 5.0}), 0.0);
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    // clang-format off
+    auto x = gko::initialize<Vec>(
+        {I<T>{2.0, 3.0},
+         I<T>{1.0, -1.5},
+         I<T>{4.0, 2.5}}, this->exec);
+    // clang-format on
+    auto y = Vec::create(this->exec, gko::dim<2>{2});
+
+    this->mtx1->apply(x, y);
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(y,
+                    l({{13.0,  3.5},
+                       { 5.0, -7.5}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 2.0}, this->exec);
+
+    this->mtx1->apply(alpha, x, beta, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({-11.0, -1.0}), 0.0);
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesScaledInt16LinearCombinationToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    if (!this->mtx3) {
+        GTEST_SKIP() << "scaled storage is only available for real types";
+    }
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    // clang-format off
+    auto x = gko::initialize<Vec>(
+        {I<T>{2.0, 3.0},
+         I<T>{1.0, -1.5},
+         I<T>{4.0, 2.5}}, this->exec);
+    auto y = gko::initialize<Vec>(
+        {I<T>{1.0, 0.5},
+         I<T>{2.0, -1.5}}, this->exec);
+    // clang-format on
+
+    this->mtx3->apply(alpha, x, beta, y);
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(y,
+                    l({{-11.0, -2.5},
+                       { -1.0,  4.5}}), this->int16_tol);
+    // clang-format on
+}
+
+
+TYPED_TEST(ReducedCsr, ApplyFailsOnWrongInnerDimension)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{2});
+    auto y = Vec::create(this->exec, gko::dim<2>{2});
+
+    ASSERT_THROW(this->mtx1->apply(x, y), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(ReducedCsr, RoundsValuesToStoragePrecision)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    using storage_type = gko::reduce_precision<value_type>;
+    auto mtx = Mtx::create(this->exec);
+    auto result = Csr::create(this->exec);
+
+    this->csr3->convert_to(mtx);
+    mtx->convert_to(result);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->csr3);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(result->get_const_values()[i],
+                  static_cast<value_type>(static_cast<storage_type>(
+                      this->csr3->get_const_values()[i])));
+    }
+    GKO_ASSERT_MTX_NEAR(result, this->csr3, r<storage_type>::value);
+}
+
+
+TYPED_TEST(ReducedCsr, ConvertsScaledInt16ToCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    if (!this->mtx3) {
+        GTEST_SKIP() << "scaled storage is only available for real types";
+    }
+    auto mtx = Mtx::create(this->exec, gko::dim<2>{},
+                           gko::matrix::reduced_storage::scaled_int16);
+    auto result = Csr::create(this->exec);
+
+    this->csr3->convert_to(mtx);
+    mtx->convert_to(result);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->csr3);
+    GKO_ASSERT_MTX_NEAR(result, this->csr3, this->int16_tol);
+}
+
+
+TYPED_TEST(ReducedCsr, MovesToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx2->move_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(
+        csr, l({{1.0, 3.0, 2.0}, {0.0, 5.0, 0.0}}), 0.0);
+}
+
+
+}  // namespace
@@ -34,7 +34,8 @@ protected:
     Sellp()
         : exec(gko::ReferenceExecutor::create()),
           mtx1(Mtx::create(exec)),
-          mtx2(Mtx::create(exec))
+          mtx2(Mtx::create(exec)),
+          mtx3(Mtx::create(exec))
     {
         // clang-format off
         mtx1 = gko::initialize<Mtx>({{1.0, 3.0, 2.0},
@@ -42,12 +43,20 @@ protected:
         mtx2 = gko::initialize<Mtx>({{1.0, 3.0, 2.0},
                                      {0.0, 5.0, 0.0}}, exec,
                                      gko::dim<2>{}, 2, 2, 0);
+        mtx3 = gko::initialize<Mtx>({{1.0, 0.0, 0.0, 0.0},
+                                     {2.0, 3.0, 4.0, 0.0},
+                                     {0.0, 5.0, 0.0, 0.0},
+                                     {6.0, 7.0, 8.0, 9.0},
+                                     {0.0, 0.0, 0.0, 1.0}}, exec,
+                                     gko::dim<2>{}, 2, 1, 4, 0);
         // clang-format on
     }
 
     std::shared_ptr<const gko::ReferenceExecutor> exec;
     std::unique_ptr<Mtx> mtx1;
     std::unique_ptr<Mtx> mtx2;
+    // SELL-C-sigma with C = 2 and sigma = 4
+    std::unique_ptr<Mtx> mtx3;
 };
 
 TYPED_TEST_SUITE(Sellp, gko::test::ValueIndexTypes, PairTypenameNameGenerator);
@@ -605,6 +614,151 @@ TYPED_TEST(Sellp, ExtractsDiagonalWithSliceSizeAndStrideFactor)
 }
 
 
+TYPED_TEST(Sellp, SortsRowsWithinSortingWindow)
+{
+    auto perm = this->mtx3->get_const_permutation();
+
+    ASSERT_NE(perm, nullptr);
+    EXPECT_EQ(perm[0], 3);
+    EXPECT_EQ(perm[1], 1);
+    EXPECT_EQ(perm[2], 0);
+    EXPECT_EQ(perm[3], 2);
+    EXPECT_EQ(perm[4], 4);
+    // the unsorted matrix needs slice lengths 3, 4 and 1 instead of 4, 1, 1
+    EXPECT_EQ(this->mtx3->get_total_cols(), 6);
+    EXPECT_EQ(this->mtx3->get_num_stored_elements(), 12);
+}
+
+
+TYPED_TEST(Sellp, AppliesSortedToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{5, 1});
+
+    this->mtx3->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({1.0, 20.0, 10.0, 80.0, 4.0}), 0.0);
+}
+
+
+TYPED_TEST(Sellp, AppliesSortedToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    // clang-format off
+    auto x = gko::initialize<Vec>(
+        {I<T>{1.0, 1.0},
+         I<T>{2.0, 0.0},
+         I<T>{3.0, 0.0},
+         I<T>{4.0, 1.0}}, this->exec);
+    // clang-format on
+    auto y = Vec::create(this->exec, gko::dim<2>{5, 2});
+
+    this->mtx3->apply(x, y);
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(y,
+                    l({{ 1.0,  1.0},
+                       {20.0,  2.0},
+                       {10.0,  0.0},
+                       {80.0, 15.0},
+                       { 4.0,  1.0}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(Sellp, AppliesSortedLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0, 5.0}, this->exec);
+
+    this->mtx3->apply(alpha, x, beta, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({1.0, -16.0, -4.0, -72.0, 6.0}), 0.0);
+}
+
+
+TYPED_TEST(Sellp, ConvertsSortedToDense)
+{
+    using Vec = typename TestFixture::Vec;
+    auto dense_mtx = Vec::create(this->exec);
+
+    this->mtx3->convert_to(dense_mtx);
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(dense_mtx,
+                    l({{1.0, 0.0, 0.0, 0.0},
+                       {2.0, 3.0, 4.0, 0.0},
+                       {0.0, 5.0, 0.0, 0.0},
+                       {6.0, 7.0, 8.0, 9.0},
+                       {0.0, 0.0, 0.0, 1.0}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(Sellp, ConvertsSortedToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr_mtx = Csr::create(this->exec);
+
+    this->mtx3->convert_to(csr_mtx);
+
+    auto row_ptrs = csr_mtx->get_const_row_ptrs();
+    EXPECT_EQ(row_ptrs[0], 0);
+    EXPECT_EQ(row_ptrs[1], 1);
+    EXPECT_EQ(row_ptrs[2], 4);
+    EXPECT_EQ(row_ptrs[3], 5);
+    EXPECT_EQ(row_ptrs[4], 9);
+    EXPECT_EQ(row_ptrs[5], 10);
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(csr_mtx,
+                    l({{1.0, 0.0, 0.0, 0.0},
+                       {2.0, 3.0, 4.0, 0.0},
+                       {0.0, 5.0, 0.0, 0.0},
+                       {6.0, 7.0, 8.0, 9.0},
+                       {0.0, 0.0, 0.0, 1.0}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(Sellp, ConvertsCsrToSorted)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    auto csr_mtx = Csr::create(this->exec);
+    this->mtx3->convert_to(csr_mtx);
+    auto sellp_mtx = Mtx::create(this->exec, gko::dim<2>{}, 2, 1, 4, 0);
+
+    csr_mtx->convert_to(sellp_mtx);
+
+    ASSERT_EQ(sellp_mtx->get_num_stored_elements(), 12);
+    ASSERT_NE(sellp_mtx->get_const_permutation(), nullptr);
+    for (int row = 0; row < 5; row++) {
+        EXPECT_EQ(sellp_mtx->get_const_permutation()[row],
+                  this->mtx3->get_const_permutation()[row]);
+    }
+    GKO_ASSERT_MTX_NEAR(sellp_mtx, this->mtx3, 0.0);
+}
+
+
+TYPED_TEST(Sellp, ExtractsDiagonalSorted)
+{
+    using T = typename TestFixture::value_type;
+    auto diag = this->mtx3->extract_diagonal();
+
+    ASSERT_EQ(diag->get_size()[0], 4);
+    ASSERT_EQ(diag->get_size()[1], 4);
+    ASSERT_EQ(diag->get_values()[0], T{1.});
+    ASSERT_EQ(diag->get_values()[1], T{3.});
+    ASSERT_EQ(diag->get_values()[2], T{0.});
+    ASSERT_EQ(diag->get_values()[3], T{9.});
+}
+
+
 TYPED_TEST(Sellp, InplaceAbsolute)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -0,0 +1,305 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/stencil_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/matrix/stencil.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Stencil : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Stencil<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    Stencil()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec, gko::dim<3>{3, 2, 1})),
+          // clang-format off
+          csr(gko::initialize<Csr>(
+              {{ 4.0, -1.0,  0.0, -1.0,  0.0,  0.0},
+               {-1.0,  4.0, -1.0,  0.0, -1.0,  0.0},
+               { 0.0, -1.0,  4.0,  0.0,  0.0, -1.0},
+               {-1.0,  0.0,  0.0,  4.0, -1.0,  0.0},
+               { 0.0, -1.0,  0.0, -1.0,  4.0, -1.0},
+               { 0.0,  0.0, -1.0,  0.0, -1.0,  4.0}}, exec))
+    // clang-format on
+    {}
+
+    /**
+     * Assembles the stencil matrix from the grid coordinates, independently
+     * of the kernels under test.
+     */
+    std::unique_ptr<Csr> assemble(const Mtx* mtx)
+    {
+        const auto grid = mtx->get_grid_size();
+        const auto nx = static_cast<int>(grid[0]);
+        const auto ny = static_cast<int>(grid[1]);
+        const auto nz = static_cast<int>(grid[2]);
+        const auto num_rows = static_cast<int>(mtx->get_size()[0]);
+        const auto type = mtx->get_stencil_type();
+        const bool is_2d = type == gko::matrix::stencil_type::five_point ||
+                           type == gko::matrix::stencil_type::nine_point;
+        const bool is_star = type == gko::matrix::stencil_type::five_point ||
+                             type == gko::matrix::stencil_type::seven_point;
+        gko::matrix_data<value_type, index_type> data{mtx->get_size()};
+        for (int z = 0; z < nz; z++) {
+            for (int y = 0; y < ny; y++) {
+                for (int x = 0; x < nx; x++) {
+                    const auto row = x + nx * (y + ny * z);
+                    int point = 0;
+                    for (int dz = -1; dz <= 1; dz++) {
+                        for (int dy = -1; dy <= 1; dy++) {
+                            for (int dx = -1; dx <= 1; dx++) {
+                                const auto dist =
+                                    std::abs(dx) + std::abs(dy) + std::abs(dz);
+                                if ((is_2d && dz != 0) ||
+                                    (is_star && dist > 1)) {
+                                    continue;
+                                }
+                                if (x + dx >= 0 && x + dx < nx &&
+                                    y + dy >= 0 && y + dy < ny &&
+                                    z + dz >= 0 && z + dz < nz) {
+                                    const auto coef =
+                                        mtx->has_variable_coefficients()
+                                            ? mtx->get_const_coefficients()
+                                                  [point * num_rows + row]
+                                            : mtx->get_const_coefficients()
+                                                  [point];
+                                    data.nonzeros.emplace_back(
+                                        row, row + dx + nx * (dy + ny * dz),
+                                        coef);
+                                }
+                                point++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        auto result = Csr::create(exec);
+        result->read(data);
+        return result;
+    }
+
+    std::unique_ptr<Mtx> create_variable(const gko::dim<3>& grid,
+                                         gko::matrix::stencil_type type)
+    {
+        const auto num_rows = grid[0] * grid[1] * grid[2];
+        const auto num_points = gko::matrix::get_num_stencil_points(type);
+        gko::array<value_type> coefficients(exec, num_points * num_rows);
+        for (gko::size_type i = 0; i < coefficients.get_size(); i++) {
+            coefficients.get_data()[i] = static_cast<value_type>(
+                static_cast<double>(i % 7) - 3.0);
+        }
+        return Mtx::create(exec, grid, type, std::move(coefficients));
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Csr> csr;
+};
+
+TYPED_TEST_SUITE(Stencil, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(Stencil, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{6, 1});
+
+    this->mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({-2.0, -1.0, 4.0, 10.0, 8.0, 16.0}), 0.0);
+}
+
+
+TYPED_TEST(Stencil, AppliesToMixedDenseVector)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{6, 1});
+
+    this->mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({-2.0, -1.0, 4.0, 10.0, 8.0, 16.0}), 0.0);
+}
+
+
+TYPED_TEST(Stencil, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 1.0, 1.0, 1.0, 1.0, 1.0}, this->exec);
+
+    this->mtx->apply(alpha, x, beta, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({4.0, 3.0, -2.0, -8.0, -6.0, -14.0}), 0.0);
+}
+
+
+TYPED_TEST(Stencil, ApplyFailsOnWrongInnerDimension)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{2});
+    auto y = Vec::create(this->exec, gko::dim<2>{6});
+
+    ASSERT_THROW(this->mtx->apply(x, y), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(Stencil, ConvertsToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx->convert_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(csr, this->csr, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(csr, this->csr);
+    ASSERT_TRUE(csr->is_sorted_by_column_index());
+}
+
+
+TYPED_TEST(Stencil, MovesToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx->move_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(csr, this->csr, 0.0);
+}
+
+
+TYPED_TEST(Stencil, ConvertsAllStencilTypesToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    using gko::matrix::stencil_type;
+    for (auto config : {std::make_pair(stencil_type::five_point,
+                                       gko::dim<3>{4, 3, 1}),
+                        std::make_pair(stencil_type::nine_point,
+                                       gko::dim<3>{4, 3, 1}),
+                        std::make_pair(stencil_type::seven_point,
+                                       gko::dim<3>{4, 3, 2}),
+                        std::make_pair(stencil_type::twenty_seven_point,
+                                       gko::dim<3>{4, 3, 2})}) {
+        SCOPED_TRACE(static_cast<int>(config.first));
+        auto mtx = this->create_variable(config.second, config.first);
+        auto csr = Csr::create(this->exec);
+
+        mtx->convert_to(csr);
+
+        GKO_ASSERT_MTX_NEAR(csr, this->assemble(mtx.get()), 0.0);
+        GKO_ASSERT_MTX_EQ_SPARSITY(csr, this->assemble(mtx.get()));
+    }
+}
+
+
+TYPED_TEST(Stencil, AppliesAllStencilTypesLikeCsr)
+{
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using gko::matrix::stencil_type;
+    for (auto type :
+         {stencil_type::seven_point, stencil_type::twenty_seven_point}) {
+        SCOPED_TRACE(static_cast<int>(type));
+        auto mtx = this->create_variable(gko::dim<3>{5, 4, 3}, type);
+        auto csr = this->assemble(mtx.get());
+        auto x = gko::test::generate_random_matrix<Vec>(
+            60, 2, std::uniform_int_distribution<>(2, 2),
+            std::normal_distribution<>(0.0, 1.0),
+            std::default_random_engine(42), this->exec);
+        auto y = Vec::create(this->exec, gko::dim<2>{60, 2});
+        auto expected = y->clone();
+
+        mtx->apply(x, y);
+        csr->apply(x, expected);
+
+        GKO_ASSERT_MTX_NEAR(y, expected, r<value_type>::value);
+    }
+}
+
+
+TYPED_TEST(Stencil, ExtractsDiagonal)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = this->create_variable(gko::dim<3>{3, 2, 1},
+                                     gko::matrix::stencil_type::five_point);
+
+    auto diag = mtx->extract_diagonal();
+
+    ASSERT_EQ(diag->get_size(), gko::dim<2>(6, 6));
+    // the center is point 2, i.e. coefficients 12 to 17
+    EXPECT_EQ(diag->get_const_values()[0], value_type{2.0});
+    EXPECT_EQ(diag->get_const_values()[1], value_type{3.0});
+    EXPECT_EQ(diag->get_const_values()[5], value_type{0.0});
+}
+
+
+TYPED_TEST(Stencil, SolvesWithJacobiPreconditionedCg)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = gko::share(Mtx::create(this->exec, gko::dim<3>{6, 5, 4},
+                                      gko::matrix::stencil_type::seven_point));
+    auto solver =
+        gko::solver::Cg<value_type>::build()
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type, index_type>::build()
+                    .with_max_block_size(1u))
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(200u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .on(this->exec)
+            ->generate(mtx);
+    auto b = Vec::create(this->exec, gko::dim<2>{120, 1});
+    b->fill(gko::one<value_type>());
+    auto x = Vec::create(this->exec, gko::dim<2>{120, 1});
+    x->fill(gko::zero<value_type>());
+    auto res = b->clone();
+    auto one = gko::initialize<Vec>({1.0}, this->exec);
+    auto neg_one = gko::initialize<Vec>({-1.0}, this->exec);
+    auto res_norm = gko::matrix::Dense<gko::remove_complex<value_type>>::create(
+        this->exec, gko::dim<2>{1, 1});
+
+    solver->apply(b, x);
+    mtx->apply(neg_one, x, one, res);
+
+    res->compute_norm2(res_norm);
+    ASSERT_LT(res_norm->at(0, 0), r<value_type>::value * 1e3);
+}
+
+
+}  // namespace
@@ -0,0 +1,320 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SymmetricCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec)),
+          csr(gko::initialize<Csr>(
+              {{4.0, 1.0, 0.0}, {1.0, 5.0, 2.0}, {0.0, 2.0, 6.0}}, exec))
+    {
+        csr->convert_to(mtx);
+    }
+
+    std::unique_ptr<Csr> generate_laplacian(index_type size)
+    {
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>(size)};
+        for (index_type i = 0; i < size; i++) {
+            if (i > 0) {
+                data.nonzeros.emplace_back(i, i - 1, -1.0);
+            }
+            data.nonzeros.emplace_back(i, i, 2.0);
+            if (i < size - 1) {
+                data.nonzeros.emplace_back(i, i + 1, -1.0);
+            }
+        }
+        auto result = Csr::create(exec);
+        result->read(data);
+        return result;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Csr> csr;
+};
+
+TYPED_TEST_SUITE(SymmetricCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsr, ConvertsFromCsr)
+{
+    using value_type = typename TestFixture::value_type;
+    auto r = this->mtx->get_const_row_ptrs();
+    auto c = this->mtx->get_const_col_idxs();
+    auto v = this->mtx->get_const_values();
+
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 5);
+    EXPECT_EQ(r[1], 2);
+    EXPECT_EQ(r[2], 4);
+    EXPECT_EQ(r[3], 5);
+    EXPECT_EQ(c[0], 0);
+    EXPECT_EQ(c[1], 1);
+    EXPECT_EQ(c[2], 1);
+    EXPECT_EQ(c[3], 2);
+    EXPECT_EQ(c[4], 2);
+    EXPECT_EQ(v[1], value_type{1.0});
+    EXPECT_EQ(v[3], value_type{2.0});
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+    this->mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({9.0, 15.0, 26.0}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesToMixedDenseVector)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+    this->mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({9.0, 15.0, 26.0}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    // clang-format off
+    auto x = gko::initialize<Vec>(
+        {I<T>{2.0, 3.0},
+         I<T>{1.0, -1.5},
+         I<T>{4.0, 2.5}}, this->exec);
+    // clang-format on
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 2});
+
+    this->mtx->apply(x, y);
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(y,
+                    l({{ 9.0, 10.5},
+                       {15.0,  0.5},
+                       {26.0, 12.0}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 2.0, 3.0}, this->exec);
+
+    this->mtx->apply(alpha, x, beta, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({-7.0, -11.0, -20.0}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, ApplyFailsOnWrongInnerDimension)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{2});
+    auto y = Vec::create(this->exec, gko::dim<2>{3});
+
+    ASSERT_THROW(this->mtx->apply(x, y), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(SymmetricCsr, ConvertsToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx->convert_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(csr, this->csr, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(csr, this->csr);
+    ASSERT_TRUE(csr->is_sorted_by_column_index());
+}
+
+
+TYPED_TEST(SymmetricCsr, MovesToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx->move_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(csr, this->csr, 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, ExtractsDiagonal)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = Mtx::create(this->exec);
+    mtx->read({{3, 3}, {{0, 0, 4.0}, {0, 2, 1.0}, {2, 2, 6.0}}});
+
+    auto diag = mtx->extract_diagonal();
+
+    ASSERT_EQ(diag->get_size(), gko::dim<2>(3, 3));
+    EXPECT_EQ(diag->get_const_values()[0], value_type{4.0});
+    EXPECT_EQ(diag->get_const_values()[1], value_type{0.0});
+    EXPECT_EQ(diag->get_const_values()[2], value_type{6.0});
+}
+
+
+TYPED_TEST(SymmetricCsr, SolvesWithCgLikeCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto csr = gko::share(this->generate_laplacian(20));
+    auto mtx = gko::share(Mtx::create(this->exec));
+    csr->convert_to(mtx);
+    auto factory =
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(20u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .on(this->exec);
+    auto b = Vec::create(this->exec, gko::dim<2>{20, 1});
+    b->fill(gko::one<value_type>());
+    auto x = Vec::create(this->exec, gko::dim<2>{20, 1});
+    x->fill(gko::zero<value_type>());
+    auto expected = x->clone();
+
+    factory->generate(mtx)->apply(b, x);
+    factory->generate(csr)->apply(b, expected);
+
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value * 10);
+}
+
+
+TYPED_TEST(SymmetricCsr, SolvesWithMultigridLikeCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto csr = gko::share(this->generate_laplacian(20));
+    auto mtx = gko::share(Mtx::create(this->exec));
+    csr->convert_to(mtx);
+    auto factory =
+        gko::solver::Multigrid::build()
+            .with_mg_level(gko::multigrid::Pgm<value_type, index_type>::build()
+                               .with_deterministic(true))
+            .with_min_coarse_rows(2u)
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(5u))
+            .on(this->exec);
+    auto b = Vec::create(this->exec, gko::dim<2>{20, 1});
+    b->fill(gko::one<value_type>());
+    auto x = Vec::create(this->exec, gko::dim<2>{20, 1});
+    x->fill(gko::zero<value_type>());
+    auto expected = x->clone();
+
+    factory->generate(mtx)->apply(b, x);
+    factory->generate(csr)->apply(b, expected);
+
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value * 10);
+}
+
+
+template <typename ValueIndexType>
+class SymmetricCsrComplex : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsrComplex()
+        : exec(gko::ReferenceExecutor::create()), mtx(Mtx::create(exec))
+    {
+        mtx->read({{2, 2},
+                   {{0, 0, value_type{1.0, 0.0}},
+                    {0, 1, value_type{1.0, 2.0}},
+                    {1, 1, value_type{3.0, 0.0}}}});
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(SymmetricCsrComplex, gko::test::ComplexValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsrComplex, MirrorsConjugateOfUpperTriangle)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.nonzeros.size(), 4);
+    EXPECT_EQ(data.nonzeros[1], tpl(0, 1, value_type{1.0, 2.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(1, 0, value_type{1.0, -2.0}));
+}
+
+
+TYPED_TEST(SymmetricCsrComplex, AppliesAsHermitianMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto x = gko::initialize<Vec>({T{1.0, 0.0}, T{0.0, 1.0}}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx->apply(x, y);
+
+    // [1, 1+2i; 1-2i, 3] * [1; i]
+    GKO_ASSERT_MTX_NEAR(y, l({T{-1.0, 1.0}, T{1.0, 1.0}}), 0.0);
+}
+
+
+}  // namespace
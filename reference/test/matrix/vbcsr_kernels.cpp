@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/vbcsr_kernels.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/vbcsr.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Vbcsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Vbcsr<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    Vbcsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec)),
+          // rows 0-1 form a block, the 1x2 block in row 2 contains an
+          // explicit zero
+          csr(gko::initialize<Csr>(
+              {{1.0, 2.0, 0.0}, {4.0, 5.0, 0.0}, {0.0, 3.0, 6.0}}, exec))
+    {
+        csr->convert_to(mtx);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Csr> csr;
+};
+
+TYPED_TEST_SUITE(Vbcsr, gko::test::ValueIndexTypes, PairTypenameNameGenerator);
+
+
+TYPED_TEST(Vbcsr, ConvertsFromCsr)
+{
+    using value_type = typename TestFixture::value_type;
+    auto o = this->mtx->get_const_block_offsets();
+    auto r = this->mtx->get_const_row_ptrs();
+    auto c = this->mtx->get_const_col_idxs();
+    auto p = this->mtx->get_const_value_ptrs();
+    auto v = this->mtx->get_const_values();
+
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(this->mtx->get_num_block_rows(), 2);
+    ASSERT_EQ(this->mtx->get_num_stored_blocks(), 3);
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 7);
+    EXPECT_EQ(o[1], 2);
+    EXPECT_EQ(o[2], 3);
+    EXPECT_EQ(r[1], 1);
+    EXPECT_EQ(r[2], 3);
+    EXPECT_EQ(c[0], 0);
+    EXPECT_EQ(c[1], 0);
+    EXPECT_EQ(c[2], 1);
+    EXPECT_EQ(p[1], 4);
+    EXPECT_EQ(p[2], 6);
+    EXPECT_EQ(p[3], 7);
+    EXPECT_EQ(v[3], value_type{5.0});
+    EXPECT_EQ(v[4], value_type{0.0});
+    EXPECT_EQ(v[5], value_type{3.0});
+    EXPECT_EQ(v[6], value_type{6.0});
+}
+
+
+TYPED_TEST(Vbcsr, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+    this->mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({4.0, 13.0, 27.0}), 0.0);
+}
+
+
+TYPED_TEST(Vbcsr, AppliesToMixedDenseVector)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+    this->mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({4.0, 13.0, 27.0}), 0.0);
+}
+
+
+TYPED_TEST(Vbcsr, AppliesToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    // clang-format off
+    auto x = gko::initialize<Vec>(
+        {I<T>{2.0, 3.0},
+         I<T>{1.0, -1.5},
+         I<T>{4.0, 2.5}}, this->exec);
+    // clang-format on
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 2});
+
+    this->mtx->apply(x, y);
+
+    // clang-format off
+    GKO_ASSERT_MTX_NEAR(y,
+                    l({{ 4.0,  0.0},
+                       {13.0,  4.5},
+                       {27.0, 10.5}}), 0.0);
+    // clang-format on
+}
+
+
+TYPED_TEST(Vbcsr, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 2.0, 3.0}, this->exec);
+
+    this->mtx->apply(alpha, x, beta, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({-2.0, -9.0, -21.0}), 0.0);
+}
+
+
+TYPED_TEST(Vbcsr, ApplyFailsOnWrongInnerDimension)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{2});
+    auto y = Vec::create(this->exec, gko::dim<2>{3});
+
+    ASSERT_THROW(this->mtx->apply(x, y), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(Vbcsr, ConvertsToCsrWithExplicitZeros)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx->convert_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(csr, this->csr, 0.0);
+    ASSERT_EQ(csr->get_num_stored_elements(), 7);
+    EXPECT_EQ(csr->get_const_row_ptrs()[2], 4);
+    EXPECT_EQ(csr->get_const_col_idxs()[4], 0);
+    EXPECT_EQ(csr->get_const_values()[4], value_type{0.0});
+    EXPECT_EQ(csr->get_const_col_idxs()[5], 1);
+}
+
+
+TYPED_TEST(Vbcsr, MovesToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx->move_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(csr, this->csr, 0.0);
+}
+
+
+TYPED_TEST(Vbcsr, AppliesWithLargeBlocks)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto csr = gko::test::generate_random_matrix<Csr>(
+        12, 12, std::uniform_int_distribution<>(1, 12),
+        std::normal_distribution<>(0.0, 1.0), std::default_random_engine(42),
+        this->exec);
+    auto mtx = Mtx::create(this->exec, gko::dim<2>{12, 12},
+                           gko::array<index_type>{this->exec, {7, 5}});
+    csr->convert_to(mtx);
+    auto x = gko::test::generate_random_matrix<Vec>(
+        12, 3, std::uniform_int_distribution<>(3, 3),
+        std::normal_distribution<>(0.0, 1.0), std::default_random_engine(43),
+        this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{12, 3});
+    auto expected = y->clone();
+
+    mtx->apply(x, y);
+    csr->apply(x, expected);
+
+    GKO_ASSERT_MTX_NEAR(y, expected, r<value_type>::value);
+}
+
+
+}  // namespace
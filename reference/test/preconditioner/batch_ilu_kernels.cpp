@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/batch_logger.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+#include <ginkgo/core/solver/batch_bicgstab.hpp>
+
+#include "core/base/batch_utilities.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/batch_helpers.hpp"
+
+
+template <typename T>
+class BatchIlu : public ::testing::Test {
+protected:
+    using value_type = T;
+    using real_type = gko::remove_complex<value_type>;
+    using Mtx = gko::batch::matrix::Csr<value_type>;
+    using BIlu = gko::batch::preconditioner::Ilu<value_type>;
+    using solver_type = gko::batch::solver::Bicgstab<value_type>;
+    using Logger = gko::batch::log::BatchConvergence<value_type>;
+    using data_type = gko::matrix_data<value_type, int>;
+
+    BatchIlu()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::share(gko::batch::read<value_type, int, Mtx>(
+              exec, std::vector<data_type>{{{4.0, 1.0, 0.0},
+                                            {1.0, 4.0, 1.0},
+                                            {0.0, 1.0, 4.0}},
+                                           {{2.0, -1.0, 0.0},
+                                            {-1.0, 2.0, -1.0},
+                                            {0.0, -1.0, 2.0}}},
+              7)))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<const Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(BatchIlu, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchIlu, SharesSparsityPatternOfSystem)
+{
+    using BIlu = typename TestFixture::BIlu;
+
+    auto prec = BIlu::build().on(this->exec)->generate(this->mtx);
+
+    ASSERT_EQ(prec->get_num_elements_per_item(), 7);
+    ASSERT_EQ(prec->get_num_stored_elements(), 14);
+    const auto diag_locs = prec->get_const_diag_locations();
+    EXPECT_EQ(diag_locs[0], 0);
+    EXPECT_EQ(diag_locs[1], 3);
+    EXPECT_EQ(diag_locs[2], 6);
+}
+
+
+TYPED_TEST(BatchIlu, ComputesFactorsOfEveryItem)
+{
+    using value_type = typename TestFixture::value_type;
+    using BIlu = typename TestFixture::BIlu;
+    const auto tol = r<value_type>::value;
+
+    auto prec = BIlu::build().on(this->exec)->generate(this->mtx);
+
+    // without fill-in, ILU(0) of a tridiagonal matrix is its exact LU
+    const std::vector<double> expected{
+        4.0, 1.0,  0.25, 3.75, 1.0,  1.0 / 3.75,  4.0 - 1.0 / 3.75,
+        2.0, -1.0, -0.5, 1.5,  -1.0, -2.0 / 3.0, 4.0 / 3.0};
+    const auto factors = prec->get_const_factors();
+    for (int i = 0; i < expected.size(); i++) {
+        GKO_EXPECT_NEAR(factors[i], static_cast<value_type>(expected[i]), tol);
+    }
+}
+
+
+TYPED_TEST(BatchIlu, ThrowsOnMissingDiagonal)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using BIlu = typename TestFixture::BIlu;
+    using data_type = typename TestFixture::data_type;
+    auto mtx = gko::share(gko::batch::read<value_type, int, Mtx>(
+        this->exec, std::vector<data_type>{{{0.0, 1.0}, {1.0, 2.0}},
+                                           {{0.0, 2.0}, {3.0, 2.0}}},
+        3));
+
+    ASSERT_THROW(BIlu::build().on(this->exec)->generate(mtx),
+                 gko::InvalidStateError);
+}
+
+
+TYPED_TEST(BatchIlu, ThrowsOnUnsortedMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = int;
+    using Mtx = typename TestFixture::Mtx;
+    using BIlu = typename TestFixture::BIlu;
+    // {{4, 1}, {1, 4}} with the entries of the first row swapped
+    auto mtx = gko::share(Mtx::create(
+        this->exec, gko::batch_dim<2>(2, gko::dim<2>(2, 2)),
+        gko::array<value_type>(this->exec, {1.0, 4.0, 1.0, 4.0, 1.0, 4.0,
+                                            1.0, 4.0}),
+        gko::array<index_type>(this->exec, {1, 0, 0, 1}),
+        gko::array<index_type>(this->exec, {0, 2, 4})));
+
+    ASSERT_THROW(BIlu::build().on(this->exec)->generate(mtx),
+                 gko::InvalidStateError);
+}
+
+
+TYPED_TEST(BatchIlu, SolvesTridiagonalSystemInOneIteration)
+{
+    using value_type = typename TestFixture::value_type;
+    using real_type = typename TestFixture::real_type;
+    using Mtx = typename TestFixture::Mtx;
+    using solver_type = typename TestFixture::solver_type;
+    using BIlu = typename TestFixture::BIlu;
+    using Logger = typename TestFixture::Logger;
+    const real_type tol = 1e-5;
+    const int num_rows = 31;
+    const size_t num_batch_items = 3;
+    auto mat =
+        gko::share(gko::test::generate_3pt_stencil_batch_matrix<const Mtx>(
+            this->exec, num_batch_items, num_rows, 3 * num_rows - 2));
+    auto linear_system = gko::test::generate_batch_linear_system(mat, 1);
+    auto solver = gko::share(
+        solver_type::build()
+            .with_max_iterations(num_rows)
+            .with_tolerance(tol)
+            .with_tolerance_type(gko::batch::stop::tolerance_type::relative)
+            .with_preconditioner(BIlu::build())
+            .on(this->exec)
+            ->generate(linear_system.matrix));
+    std::shared_ptr<Logger> logger = Logger::create();
+    solver->add_logger(logger);
+
+    auto res =
+        gko::test::solve_linear_system(this->exec, linear_system, solver);
+
+    solver->remove_logger(logger);
+    const auto iter_counts = logger->get_num_iterations();
+    GKO_ASSERT_BATCH_MTX_NEAR(res.x, linear_system.exact_sol, tol * 500);
+    for (size_t i = 0; i < num_batch_items; i++) {
+        EXPECT_LE(iter_counts.get_const_data()[i], 1);
+    }
+}
+
+
+TYPED_TEST(BatchIlu, ImprovesConvergenceWithFillIn)
+{
+    using real_type = typename TestFixture::real_type;
+    using Mtx = typename TestFixture::Mtx;
+    using solver_type = typename TestFixture::solver_type;
+    using BIlu = typename TestFixture::BIlu;
+    using Logger = typename TestFixture::Logger;
+    const real_type tol = 1e-5;
+    const int num_rows = 65;
+    const size_t num_batch_items = 4;
+    auto mat =
+        gko::share(gko::test::generate_diag_dominant_batch_matrix<const Mtx>(
+            this->exec, num_batch_items, num_rows, false, 4 * num_rows - 3));
+    auto linear_system = gko::test::generate_batch_linear_system(mat, 1);
+    auto factory =
+        solver_type::build()
+            .with_max_iterations(num_rows)
+            .with_tolerance(tol)
+            .with_tolerance_type(gko::batch::stop::tolerance_type::relative);
+    auto solver = gko::share(factory.on(this->exec)->generate(mat));
+    auto prec_solver = gko::share(factory.with_preconditioner(BIlu::build())
+                                      .on(this->exec)
+                                      ->generate(mat));
+    std::shared_ptr<Logger> logger = Logger::create();
+    std::shared_ptr<Logger> prec_logger = Logger::create();
+    solver->add_logger(logger);
+    prec_solver->add_logger(prec_logger);
+
+    gko::test::solve_linear_system(this->exec, linear_system, solver);
+    auto res =
+        gko::test::solve_linear_system(this->exec, linear_system, prec_solver);
+
+    const auto iters = logger->get_num_iterations();
+    const auto prec_iters = prec_logger->get_num_iterations();
+    GKO_ASSERT_BATCH_MTX_NEAR(res.x, linear_system.exact_sol, tol * 500);
+    for (size_t i = 0; i < num_batch_items; i++) {
+        EXPECT_LE(prec_iters.get_const_data()[i], iters.get_const_data()[i]);
+    }
+}
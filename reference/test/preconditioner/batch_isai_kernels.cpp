@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_isai_kernels.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/batch_logger.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
+#include <ginkgo/core/solver/batch_bicgstab.hpp>
+
+#include "core/base/batch_utilities.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/batch_helpers.hpp"
+
+
+template <typename T>
+class BatchIsai : public ::testing::Test {
+protected:
+    using value_type = T;
+    using real_type = gko::remove_complex<value_type>;
+    using Mtx = gko::batch::matrix::Csr<value_type>;
+    using BIsai = gko::batch::preconditioner::Isai<value_type>;
+    using solver_type = gko::batch::solver::Bicgstab<value_type>;
+    using Logger = gko::batch::log::BatchConvergence<value_type>;
+    using data_type = gko::matrix_data<value_type, int>;
+
+    BatchIsai()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::share(gko::batch::read<value_type, int, Mtx>(
+              exec,
+              std::vector<data_type>{{{2.0, 1.0, 0.0, 0.0},
+                                      {1.0, 3.0, 0.0, 0.0},
+                                      {0.0, 0.0, 4.0, -1.0},
+                                      {0.0, 0.0, 2.0, 1.0}},
+                                     {{4.0, 2.0, 0.0, 0.0},
+                                      {2.0, 6.0, 0.0, 0.0},
+                                      {0.0, 0.0, 8.0, -2.0},
+                                      {0.0, 0.0, 4.0, 2.0}}},
+              8)))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<const Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(BatchIsai, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchIsai, SharesSparsityPatternOfSystem)
+{
+    using BIsai = typename TestFixture::BIsai;
+
+    auto prec = BIsai::build().on(this->exec)->generate(this->mtx);
+
+    ASSERT_EQ(prec->get_num_elements_per_item(), 8);
+    ASSERT_EQ(prec->get_num_stored_elements(), 16);
+    const auto col_idxs = prec->get_const_col_idxs();
+    for (int i = 0; i < 8; i++) {
+        EXPECT_EQ(col_idxs[i], this->mtx->get_const_col_idxs()[i]);
+    }
+}
+
+
+TYPED_TEST(BatchIsai, IsExactInverseOfBlockDiagonalMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using BIsai = typename TestFixture::BIsai;
+    const auto tol = r<value_type>::value;
+
+    auto prec = BIsai::build().on(this->exec)->generate(this->mtx);
+
+    // the inverse of a block-diagonal matrix has the same sparsity pattern
+    const std::vector<double> expected{
+        0.6,  -0.2, -0.2, 0.4,  1.0 / 6.0,  1.0 / 6.0,  -1.0 / 3.0, 2.0 / 3.0,
+        0.3,  -0.1, -0.1, 0.2,  1.0 / 12.0, 1.0 / 12.0, -1.0 / 6.0, 1.0 / 3.0};
+    const auto inverse = prec->get_const_inverse_values();
+    for (int i = 0; i < expected.size(); i++) {
+        GKO_EXPECT_NEAR(inverse[i], static_cast<value_type>(expected[i]), tol);
+    }
+}
+
+
+TYPED_TEST(BatchIsai, FallsBackToScalarJacobiForSingularLocalSystem)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using BIsai = typename TestFixture::BIsai;
+    using data_type = typename TestFixture::data_type;
+    const auto tol = r<value_type>::value;
+    auto mtx = gko::share(gko::batch::read<value_type, int, Mtx>(
+        this->exec,
+        std::vector<data_type>{{{1.0, 1.0}, {1.0, 1.0}},
+                               {{2.0, 2.0}, {2.0, 2.0}}},
+        4));
+
+    auto prec = BIsai::build().on(this->exec)->generate(mtx);
+
+    const std::vector<double> expected{1.0, 0.0, 0.0, 1.0,
+                                       0.5, 0.0, 0.0, 0.5};
+    const auto inverse = prec->get_const_inverse_values();
+    for (int i = 0; i < expected.size(); i++) {
+        GKO_EXPECT_NEAR(inverse[i], static_cast<value_type>(expected[i]), tol);
+    }
+}
+
+
+TYPED_TEST(BatchIsai, ImprovesConvergenceOfSolver)
+{
+    using real_type = typename TestFixture::real_type;
+    using Mtx = typename TestFixture::Mtx;
+    using solver_type = typename TestFixture::solver_type;
+    using BIsai = typename TestFixture::BIsai;
+    using Logger = typename TestFixture::Logger;
+    const real_type tol = 1e-5;
+    const int num_rows = 65;
+    const size_t num_batch_items = 4;
+    auto mat =
+        gko::share(gko::test::generate_diag_dominant_batch_matrix<const Mtx>(
+            this->exec, num_batch_items, num_rows, false, 4 * num_rows - 3));
+    auto linear_system = gko::test::generate_batch_linear_system(mat, 1);
+    auto factory =
+        solver_type::build()
+            .with_max_iterations(num_rows)
+            .with_tolerance(tol)
+            .with_tolerance_type(gko::batch::stop::tolerance_type::relative);
+    auto solver = gko::share(factory.on(this->exec)->generate(mat));
+    auto prec_solver = gko::share(factory.with_preconditioner(BIsai::build())
+                                      .on(this->exec)
+                                      ->generate(mat));
+    std::shared_ptr<Logger> logger = Logger::create();
+    std::shared_ptr<Logger> prec_logger = Logger::create();
+    solver->add_logger(logger);
+    prec_solver->add_logger(prec_logger);
+
+    gko::test::solve_linear_system(this->exec, linear_system, solver);
+    auto res =
+        gko::test::solve_linear_system(this->exec, linear_system, prec_solver);
+
+    const auto iters = logger->get_num_iterations();
+    const auto prec_iters = prec_logger->get_num_iterations();
+    GKO_ASSERT_BATCH_MTX_NEAR(res.x, linear_system.exact_sol, tol * 500);
+    for (size_t i = 0; i < num_batch_items; i++) {
+        EXPECT_LE(prec_iters.get_const_data()[i], iters.get_const_data()[i]);
+    }
+}
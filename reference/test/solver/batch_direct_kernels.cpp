@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/batch_direct_kernels.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/solver/batch_direct.hpp>
+
+#include "core/base/batch_utilities.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/batch_helpers.hpp"
+
+
+template <typename T>
+class BatchDirect : public ::testing::Test {
+protected:
+    using value_type = T;
+    using real_type = gko::remove_complex<value_type>;
+    using Mtx = gko::batch::matrix::Dense<value_type>;
+    using CsrMtx = gko::batch::matrix::Csr<value_type>;
+    using MVec = gko::batch::MultiVector<value_type>;
+    using Solver = gko::batch::solver::Direct<value_type>;
+    using data_type = gko::matrix_data<value_type, int>;
+
+    BatchDirect()
+        : exec(gko::ReferenceExecutor::create()),
+          // both items need row pivoting in the first step
+          pivot_data{{{0.0, 2.0, 1.0}, {1.0, 1.0, 1.0}, {2.0, 1.0, 0.0}},
+                     {{1.0, 2.0, 0.0}, {3.0, 1.0, 2.0}, {0.0, 1.0, 4.0}}},
+          // eliminating the first column fills in the whole matrix
+          arrow_data{{{4.0, 1.0, 1.0, 1.0},
+                      {1.0, 4.0, 0.0, 0.0},
+                      {1.0, 0.0, 4.0, 0.0},
+                      {1.0, 0.0, 0.0, 4.0}},
+                     {{8.0, -1.0, 2.0, 1.0},
+                      {2.0, 5.0, 0.0, 0.0},
+                      {-1.0, 0.0, 6.0, 0.0},
+                      {1.0, 0.0, 0.0, 3.0}}},
+          solver_factory(Solver::build().on(exec))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::vector<data_type> pivot_data;
+    std::vector<data_type> arrow_data;
+    std::unique_ptr<typename Solver::Factory> solver_factory;
+};
+
+TYPED_TEST_SUITE(BatchDirect, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchDirect, SolvesDenseSystemWithPivoting)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using MVec = typename TestFixture::MVec;
+    auto mtx = gko::share(gko::batch::read<value_type, int, Mtx>(
+        this->exec, this->pivot_data));
+    auto b = gko::batch::initialize<MVec>({{7.0, 6.0, 4.0}, {-1.0, 6.0, 7.0}},
+                                          this->exec);
+    auto x = MVec::create_with_config_of(b);
+    auto expected = gko::batch::initialize<MVec>(
+        {{1.0, 2.0, 3.0}, {1.0, -1.0, 2.0}}, this->exec);
+
+    auto solver = this->solver_factory->generate(mtx);
+    solver->apply(b, x);
+
+    ASSERT_FALSE(solver->has_sparse_factors());
+    EXPECT_EQ(solver->get_const_pivots()[0], 2);
+    EXPECT_EQ(solver->get_const_pivots()[3], 1);
+    GKO_ASSERT_BATCH_MTX_NEAR(x, expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(BatchDirect, SolvesSparseSystemWithFillIn)
+{
+    using value_type = typename TestFixture::value_type;
+    using CsrMtx = typename TestFixture::CsrMtx;
+    using MVec = typename TestFixture::MVec;
+    auto mtx = gko::share(gko::batch::read<value_type, int, CsrMtx>(
+        this->exec, this->arrow_data, 10));
+    auto b = gko::batch::initialize<MVec>(
+        {{13.0, 9.0, 13.0, 17.0}, {16.0, 12.0, 17.0, 13.0}}, this->exec);
+    auto x = MVec::create_with_config_of(b);
+    auto expected = gko::batch::initialize<MVec>(
+        {{1.0, 2.0, 3.0, 4.0}, {1.0, 2.0, 3.0, 4.0}}, this->exec);
+
+    auto solver = this->solver_factory->generate(mtx);
+    solver->apply(b, x);
+
+    ASSERT_TRUE(solver->has_sparse_factors());
+    ASSERT_EQ(solver->get_num_elements_per_item(), 16);
+    GKO_ASSERT_BATCH_MTX_NEAR(x, expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(BatchDirect, ThrowsOnSingularDenseItem)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using data_type = typename TestFixture::data_type;
+    auto mtx = gko::share(gko::batch::read<value_type, int, Mtx>(
+        this->exec,
+        std::vector<data_type>{{{2.0, 1.0}, {1.0, 2.0}},
+                               {{1.0, 2.0}, {2.0, 4.0}}}));
+
+    ASSERT_THROW(this->solver_factory->generate(mtx), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(BatchDirect, ThrowsOnSingularSparseItem)
+{
+    using value_type = typename TestFixture::value_type;
+    using CsrMtx = typename TestFixture::CsrMtx;
+    using data_type = typename TestFixture::data_type;
+    // the second item has a zero pivot, which the sparse LU does not avoid
+    auto mtx = gko::share(gko::batch::read<value_type, int, CsrMtx>(
+        this->exec,
+        std::vector<data_type>{{{2.0, 1.0}, {1.0, 2.0}},
+                               {{0.0, 1.0}, {1.0, 2.0}}},
+        4));
+
+    ASSERT_THROW(this->solver_factory->generate(mtx), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(BatchDirect, SparseAndDenseFactorizationsAgree)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using CsrMtx = typename TestFixture::CsrMtx;
+    using MVec = typename TestFixture::MVec;
+    const int num_rows = 17;
+    const gko::size_type num_batch_items = 4;
+    auto csr_mtx = gko::share(
+        gko::test::generate_diag_dominant_batch_matrix<const CsrMtx>(
+            this->exec, num_batch_items, num_rows, false, 4 * num_rows - 3));
+    auto dense_mtx = gko::share(Mtx::create(this->exec));
+    dense_mtx->copy_from(csr_mtx);
+    auto b = gko::test::generate_random_batch_matrix<MVec>(
+        num_batch_items, num_rows, 2,
+        std::uniform_int_distribution<>(2, 2),
+        std::normal_distribution<gko::remove_complex<value_type>>(),
+        std::default_random_engine(42), this->exec);
+    auto sparse_x = MVec::create_with_config_of(b);
+    auto dense_x = MVec::create_with_config_of(b);
+
+    this->solver_factory->generate(csr_mtx)->apply(b, sparse_x);
+    this->solver_factory->generate(dense_mtx)->apply(b, dense_x);
+
+    GKO_ASSERT_BATCH_MTX_NEAR(sparse_x, dense_x, r<value_type>::value * 10);
+}
+
+
+TYPED_TEST(BatchDirect, SolvesStencilSystem)
+{
+    using value_type = typename TestFixture::value_type;
+    using CsrMtx = typename TestFixture::CsrMtx;
+    const int num_rows = 33;
+    auto mtx =
+        gko::share(gko::test::generate_3pt_stencil_batch_matrix<const CsrMtx>(
+            this->exec, 3, num_rows, 3 * num_rows - 2));
+    auto linear_system = gko::test::generate_batch_linear_system(mtx, 1);
+    auto solver = gko::share(this->solver_factory->generate(mtx));
+
+    auto res =
+        gko::test::solve_linear_system(this->exec, linear_system, solver);
+
+    GKO_ASSERT_BATCH_MTX_NEAR(res.x, linear_system.exact_sol,
+                              r<value_type>::value * 10);
+}
+
+
+TYPED_TEST(BatchDirect, AdvancedApplySolvesDenseSystem)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using MVec = typename TestFixture::MVec;
+    auto mtx = gko::share(gko::batch::read<value_type, int, Mtx>(
+        this->exec, this->pivot_data));
+    auto b = gko::batch::initialize<MVec>({{7.0, 6.0, 4.0}, {-1.0, 6.0, 7.0}},
+                                          this->exec);
+    auto x = gko::batch::initialize<MVec>({{1.0, 1.0, 1.0}, {2.0, 2.0, 2.0}},
+                                          this->exec);
+    auto alpha = gko::batch::initialize<MVec>({{2.0}, {-1.0}}, this->exec);
+    auto beta = gko::batch::initialize<MVec>({{1.0}, {0.5}}, this->exec);
+    auto expected = gko::batch::initialize<MVec>(
+        {{3.0, 5.0, 7.0}, {0.0, 2.0, -1.0}}, this->exec);
+
+    this->solver_factory->generate(mtx)->apply(alpha, b, beta, x);
+
+    GKO_ASSERT_BATCH_MTX_NEAR(x, expected, r<value_type>::value);
+}
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/delta_csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/test/utils.hpp"
+#include "test/utils/common_fixture.hpp"
+
+
+class DeltaCsr : public CommonTestFixture {
+protected:
+    using Mtx = gko::matrix::DeltaCsr<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    DeltaCsr() : rand_engine(42) {}
+
+    template <typename MtxType = Vec>
+    std::unique_ptr<MtxType> gen_mtx(int num_rows, int num_cols,
+                                     int min_nnz_row = 1)
+    {
+        return gko::test::generate_random_matrix<MtxType>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(min_nnz_row,
+                                            std::min(num_cols, 40)),
+            std::normal_distribution<value_type>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    void set_up_apply_matrix(int num_cols = 231, int num_rhs = 1)
+    {
+        csr = gen_mtx<Csr>(532, num_cols);
+        mtx = Mtx::create(ref);
+        csr->convert_to(mtx);
+        expected = gen_mtx(532, num_rhs, num_rhs);
+        y = gen_mtx(num_cols, num_rhs, num_rhs);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        dcsr = gko::clone(exec, csr);
+        dmtx = gko::clone(exec, mtx);
+        dresult = gko::clone(exec, expected);
+        dy = gko::clone(exec, y);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    std::default_random_engine rand_engine;
+
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> expected;
+    std::unique_ptr<Vec> y;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+
+    std::unique_ptr<Csr> dcsr;
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> dresult;
+    std::unique_ptr<Vec> dy;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(DeltaCsr, SimpleApplyIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, AdvancedApplyIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, SimpleApplyWithLongDeltasIsEquivalentToRef)
+{
+    set_up_apply_matrix(200000);
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, AdvancedApplyMultipleRHSWithLongDeltasIsEquivalentToRef)
+{
+    set_up_apply_matrix(200000, 3);
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, ConvertFromCsrIsEquivalentToRef)
+{
+    set_up_apply_matrix(200000);
+    auto dres = Mtx::create(exec);
+
+    dcsr->convert_to(dres);
+
+    ASSERT_EQ(dres->get_num_delta_bytes(), mtx->get_num_delta_bytes());
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(exec, 533, dres->get_const_delta_ptrs())
+            .copy_to_array(),
+        gko::make_const_array_view(ref, 533, mtx->get_const_delta_ptrs())
+            .copy_to_array());
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(exec, dres->get_num_delta_bytes(),
+                                   dres->get_const_deltas())
+            .copy_to_array(),
+        gko::make_const_array_view(ref, mtx->get_num_delta_bytes(),
+                                   mtx->get_const_deltas())
+            .copy_to_array());
+}
+
+
+TEST_F(DeltaCsr, ConvertToCsrIsEquivalentToRef)
+{
+    set_up_apply_matrix(200000);
+    auto dres = Csr::create(exec);
+
+    dmtx->convert_to(dres);
+
+    GKO_ASSERT_MTX_NEAR(dres, csr, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(dres, csr);
+}
@@ -246,6 +246,46 @@ TYPED_TEST(Fbcsr, AdvancedSpmvMultiIsEquivalentToRefSorted)
 }
 
 
+TYPED_TEST(Fbcsr, AdvancedSpmvMultiIsEquivalentToRefForAllBlockSizes)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename Mtx::index_type;
+    if (this->exec->get_master() != this->exec) {
+        // FBCSR on accelerator does not have half precision apply through
+        // vendor libraries.
+        SKIP_IF_HALF(value_type);
+    }
+    // covers the fixed-size kernels, the generic kernel, and a partial tile
+    // of right-hand sides
+    for (int block_size = 2; block_size <= 9; block_size++) {
+        SCOPED_TRACE(block_size);
+        auto rmtx = gko::test::generate_random_fbcsr<value_type, index_type>(
+            this->ref, 30, 20, block_size, false, false,
+            std::default_random_engine(43));
+        auto dmtx = gko::clone(this->exec, rmtx);
+        auto x = Dense::create(this->ref, gko::dim<2>(rmtx->get_size()[1], 5));
+        this->generate_sin(x);
+        auto dx = gko::clone(this->exec, x);
+        auto prod =
+            Dense::create(this->ref, gko::dim<2>(rmtx->get_size()[0], 5));
+        this->generate_sin(prod);
+        auto dprod = gko::clone(this->exec, prod);
+        auto alpha = gko::initialize<Dense>({2.5}, this->ref);
+        auto beta = gko::initialize<Dense>({-1.5}, this->ref);
+        auto dalpha = gko::clone(this->exec, alpha);
+        auto dbeta = gko::clone(this->exec, beta);
+
+        dmtx->apply(dalpha, dx, dbeta, dprod);
+        rmtx->apply(alpha, x, beta, prod);
+
+        const double tol = r<value_type>::value;
+        GKO_ASSERT_MTX_NEAR(prod, dprod, 5 * tol);
+    }
+}
+
+
 TYPED_TEST(Fbcsr, ConjTransposeIsEquivalentToRefSortedBS3)
 {
     using Mtx = typename TestFixture::Mtx;
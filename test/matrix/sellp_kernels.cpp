@@ -53,6 +53,17 @@ protected:
         dbeta = gko::clone(exec, beta);
     }
 
+    void set_up_sorted_apply_matrix(int total_cols = 1)
+    {
+        set_up_apply_matrix(total_cols);
+        auto csr = gko::matrix::Csr<value_type>::create(ref);
+        mtx->convert_to(csr);
+        mtx = Mtx::create(ref, gko::dim<2>{}, Mtx::simd_slice_size(), 1, 32,
+                          0);
+        csr->convert_to(mtx);
+        dmtx = gko::clone(exec, mtx);
+    }
+
     std::default_random_engine rand_engine;
 
     std::unique_ptr<Mtx> mtx;
@@ -161,6 +172,28 @@ TEST_F(Sellp,
 }
 
 
+TEST_F(Sellp, SimpleApplyWithSortedRowsIsEquivalentToRef)
+{
+    set_up_sorted_apply_matrix();
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Sellp, AdvancedApplyMultipleRHSWithSortedRowsIsEquivalentToRef)
+{
+    set_up_sorted_apply_matrix(6);
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
 TEST_F(Sellp, ApplyToComplexIsEquivalentToRef)
 {
     set_up_apply_matrix(64);
@@ -217,6 +250,19 @@ TEST_F(Sellp, ConvertToCsrIsEquivalentToRef)
 }
 
 
+TEST_F(Sellp, ConvertWithSortedRowsToCsrIsEquivalentToRef)
+{
+    set_up_sorted_apply_matrix(64);
+    auto csr_mtx = gko::matrix::Csr<value_type>::create(ref);
+    auto dcsr_mtx = gko::matrix::Csr<value_type>::create(exec);
+
+    mtx->convert_to(csr_mtx);
+    dmtx->convert_to(dcsr_mtx);
+
+    GKO_ASSERT_MTX_NEAR(csr_mtx, dcsr_mtx, 0);
+}
+
+
 TEST_F(Sellp, ConvertEmptyToDenseIsEquivalentToRef)
 {
     set_up_apply_matrix(64);
@@ -265,6 +311,17 @@ TEST_F(Sellp, ExtractDiagonalWithSliceSizeAndStrideFactorIsEquivalentToRef)
 }
 
 
+TEST_F(Sellp, ExtractDiagonalWithSortedRowsIsEquivalentToRef)
+{
+    set_up_sorted_apply_matrix(64);
+
+    auto diag = mtx->extract_diagonal();
+    auto ddiag = dmtx->extract_diagonal();
+
+    GKO_ASSERT_MTX_NEAR(diag, ddiag, 0);
+}
+
+
 TEST_F(Sellp, InplaceAbsoluteMatrixIsEquivalentToRef)
 {
     set_up_apply_matrix(64, 32, 2);
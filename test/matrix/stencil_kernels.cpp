@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/stencil_kernels.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/matrix/stencil.hpp>
+
+#include "core/test/utils.hpp"
+#include "test/utils/common_fixture.hpp"
+
+
+class Stencil : public CommonTestFixture {
+protected:
+    using Mtx = gko::matrix::Stencil<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    Stencil() : rand_engine(42) {}
+
+    std::unique_ptr<Vec> gen_mtx(int num_rows, int num_cols)
+    {
+        return gko::test::generate_random_matrix<Vec>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<value_type>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    /**
+     * Returns all stencil types with a grid whose lines are longer than the
+     * tiles used by the kernels.
+     */
+    static std::vector<std::pair<gko::matrix::stencil_type, gko::dim<3>>>
+    get_configs()
+    {
+        using gko::matrix::stencil_type;
+        return {{stencil_type::five_point, gko::dim<3>{300, 11, 1}},
+                {stencil_type::nine_point, gko::dim<3>{300, 11, 1}},
+                {stencil_type::seven_point, gko::dim<3>{300, 5, 4}},
+                {stencil_type::twenty_seven_point, gko::dim<3>{300, 5, 4}}};
+    }
+
+    void set_up_apply_matrix(gko::matrix::stencil_type type,
+                             const gko::dim<3>& grid, bool variable,
+                             int num_rhs = 1)
+    {
+        const auto size = static_cast<int>(grid[0] * grid[1] * grid[2]);
+        if (variable) {
+            const auto num_points = gko::matrix::get_num_stencil_points(type);
+            auto coefficients = gen_mtx(num_points * size, 1);
+            const auto values = coefficients->get_const_values();
+            mtx = Mtx::create(ref, grid, type,
+                              gko::array<value_type>(
+                                  ref, values, values + num_points * size));
+        } else {
+            mtx = Mtx::create(ref, grid, type);
+        }
+        expected = gen_mtx(size, num_rhs);
+        y = gen_mtx(size, num_rhs);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        dmtx = gko::clone(exec, mtx);
+        dresult = gko::clone(exec, expected);
+        dy = gko::clone(exec, y);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    std::default_random_engine rand_engine;
+
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> expected;
+    std::unique_ptr<Vec> y;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> dresult;
+    std::unique_ptr<Vec> dy;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(Stencil, SimpleApplyIsEquivalentToRef)
+{
+    for (auto config : get_configs()) {
+        for (auto variable : {false, true}) {
+            SCOPED_TRACE(static_cast<int>(config.first));
+            SCOPED_TRACE(variable);
+            set_up_apply_matrix(config.first, config.second, variable);
+
+            mtx->apply(y, expected);
+            dmtx->apply(dy, dresult);
+
+            GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+        }
+    }
+}
+
+
+TEST_F(Stencil, AdvancedApplyIsEquivalentToRef)
+{
+    for (auto config : get_configs()) {
+        for (auto variable : {false, true}) {
+            SCOPED_TRACE(static_cast<int>(config.first));
+            SCOPED_TRACE(variable);
+            set_up_apply_matrix(config.first, config.second, variable);
+
+            mtx->apply(alpha, y, beta, expected);
+            dmtx->apply(dalpha, dy, dbeta, dresult);
+
+            GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+        }
+    }
+}
+
+
+TEST_F(Stencil, SimpleApplyToMultipleVectorsIsEquivalentToRef)
+{
+    for (auto config : get_configs()) {
+        SCOPED_TRACE(static_cast<int>(config.first));
+        set_up_apply_matrix(config.first, config.second, true, 3);
+
+        mtx->apply(y, expected);
+        dmtx->apply(dy, dresult);
+
+        GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+    }
+}
+
+
+TEST_F(Stencil, AdvancedApplyToMultipleVectorsIsEquivalentToRef)
+{
+    for (auto config : get_configs()) {
+        SCOPED_TRACE(static_cast<int>(config.first));
+        set_up_apply_matrix(config.first, config.second, true, 3);
+
+        mtx->apply(alpha, y, beta, expected);
+        dmtx->apply(dalpha, dy, dbeta, dresult);
+
+        GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+    }
+}
+
+
+TEST_F(Stencil, ConvertToCsrIsEquivalentToRef)
+{
+    for (auto config : get_configs()) {
+        SCOPED_TRACE(static_cast<int>(config.first));
+        set_up_apply_matrix(config.first, config.second, true);
+        auto res = Csr::create(ref);
+        auto dres = Csr::create(exec);
+
+        mtx->convert_to(res);
+        dmtx->convert_to(dres);
+
+        GKO_ASSERT_MTX_NEAR(dres, res, 0.0);
+        GKO_ASSERT_MTX_EQ_SPARSITY(dres, res);
+    }
+}
+
+
+TEST_F(Stencil, ExtractDiagonalIsEquivalentToRef)
+{
+    for (auto config : get_configs()) {
+        SCOPED_TRACE(static_cast<int>(config.first));
+        set_up_apply_matrix(config.first, config.second, true);
+
+        auto diag = mtx->extract_diagonal();
+        auto ddiag = dmtx->extract_diagonal();
+
+        GKO_ASSERT_MTX_NEAR(diag, ddiag, 0.0);
+    }
+}
@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+#include "core/test/utils.hpp"
+#include "core/utils/matrix_utils.hpp"
+#include "test/utils/common_fixture.hpp"
+
+
+class SymmetricCsr : public CommonTestFixture {
+protected:
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsr() : rand_engine(42) {}
+
+    std::unique_ptr<Vec> gen_mtx(int num_rows, int num_cols)
+    {
+        return gko::test::generate_random_matrix<Vec>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<value_type>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    void set_up_apply_matrix(int num_rhs = 1)
+    {
+        const int size = 1123;
+        auto data = gko::test::generate_random_matrix_data<value_type,
+                                                           index_type>(
+            size, size, std::uniform_int_distribution<>(1, 20),
+            std::normal_distribution<value_type>(-1.0, 1.0), rand_engine);
+        gko::utils::make_hermitian(data);
+        csr = Csr::create(ref);
+        csr->read(data);
+        mtx = Mtx::create(ref);
+        csr->convert_to(mtx);
+        expected = gen_mtx(size, num_rhs);
+        y = gen_mtx(size, num_rhs);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        dcsr = gko::clone(exec, csr);
+        dmtx = gko::clone(exec, mtx);
+        dresult = gko::clone(exec, expected);
+        dy = gko::clone(exec, y);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    std::default_random_engine rand_engine;
+
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> expected;
+    std::unique_ptr<Vec> y;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+
+    std::unique_ptr<Csr> dcsr;
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> dresult;
+    std::unique_ptr<Vec> dy;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(SymmetricCsr, SimpleApplyIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, AdvancedApplyIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, SimpleApplyToMultipleVectorsIsEquivalentToRef)
+{
+    set_up_apply_matrix(3);
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, AdvancedApplyToMultipleVectorsIsEquivalentToRef)
+{
+    set_up_apply_matrix(3);
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, RepeatedApplyReusesWorkspace)
+{
+    set_up_apply_matrix(3);
+    auto y1 = gen_mtx(y->get_size()[0], 1);
+    auto expected1 = gen_mtx(y->get_size()[0], 1);
+    auto dy1 = gko::clone(exec, y1);
+    auto dresult1 = gko::clone(exec, expected1);
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+    mtx->apply(y1, expected1);
+    dmtx->apply(dy1, dresult1);
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(dresult1, expected1, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, ApplyIsEquivalentToCsr)
+{
+    set_up_apply_matrix(3);
+
+    dcsr->apply(dy, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, ConvertFromCsrIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+    auto dres = Mtx::create(exec);
+
+    dcsr->convert_to(dres);
+
+    ASSERT_EQ(dres->get_num_stored_elements(), mtx->get_num_stored_elements());
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(exec, dres->get_size()[0] + 1,
+                                   dres->get_const_row_ptrs())
+            .copy_to_array(),
+        gko::make_const_array_view(ref, mtx->get_size()[0] + 1,
+                                   mtx->get_const_row_ptrs())
+            .copy_to_array());
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(exec, dres->get_num_stored_elements(),
+                                   dres->get_const_col_idxs())
+            .copy_to_array(),
+        gko::make_const_array_view(ref, mtx->get_num_stored_elements(),
+                                   mtx->get_const_col_idxs())
+            .copy_to_array());
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(exec, dres->get_num_stored_elements(),
+                                   dres->get_const_values())
+            .copy_to_array(),
+        gko::make_const_array_view(ref, mtx->get_num_stored_elements(),
+                                   mtx->get_const_values())
+            .copy_to_array());
+}
+
+
+TEST_F(SymmetricCsr, ConvertToCsrIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+    auto res = Csr::create(ref);
+    auto dres = Csr::create(exec);
+
+    mtx->convert_to(res);
+    dmtx->convert_to(dres);
+
+    GKO_ASSERT_MTX_NEAR(dres, res, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(dres, res);
+    GKO_ASSERT_MTX_NEAR(dres, csr, 0.0);
+    ASSERT_TRUE(dres->is_sorted_by_column_index());
+}
+
+
+TEST_F(SymmetricCsr, ExtractDiagonalIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+
+    auto diag = mtx->extract_diagonal();
+    auto ddiag = dmtx->extract_diagonal();
+
+    GKO_ASSERT_MTX_NEAR(diag, ddiag, 0.0);
+}
@@ -0,0 +1,194 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/vbcsr_kernels.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/vbcsr.hpp>
+
+#include "core/test/utils.hpp"
+#include "test/utils/common_fixture.hpp"
+
+
+class Vbcsr : public CommonTestFixture {
+protected:
+    using Mtx = gko::matrix::Vbcsr<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using mat_data = gko::matrix_data<value_type, index_type>;
+
+    Vbcsr() : rand_engine(42) {}
+
+    template <typename MtxType = Vec>
+    std::unique_ptr<MtxType> gen_mtx(int num_rows, int num_cols,
+                                     int min_nnz_row = 1)
+    {
+        return gko::test::generate_random_matrix<MtxType>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(min_nnz_row,
+                                            std::min(num_cols, 10)),
+            std::normal_distribution<value_type>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    /**
+     * Generates a random node-level pattern and expands each node into a
+     * dense block of 1 to 6 unknowns, to cover both the unrolled and the
+     * generic block kernels.
+     */
+    std::unique_ptr<Csr> gen_block_mtx(int num_nodes)
+    {
+        auto nodes = gen_mtx<Csr>(num_nodes, num_nodes);
+        std::uniform_int_distribution<index_type> size_dist(1, 6);
+        std::normal_distribution<value_type> value_dist(-1.0, 1.0);
+        std::vector<index_type> offsets{0};
+        for (int node = 0; node < num_nodes; node++) {
+            offsets.push_back(offsets.back() + size_dist(rand_engine));
+        }
+        mat_data data{gko::dim<2>(offsets.back(), offsets.back())};
+        const auto row_ptrs = nodes->get_const_row_ptrs();
+        const auto col_idxs = nodes->get_const_col_idxs();
+        for (int node = 0; node < num_nodes; node++) {
+            for (auto row = offsets[node]; row < offsets[node + 1]; row++) {
+                for (auto nz = row_ptrs[node]; nz < row_ptrs[node + 1]; nz++) {
+                    const auto col_node = col_idxs[nz];
+                    for (auto col = offsets[col_node];
+                         col < offsets[col_node + 1]; col++) {
+                        data.nonzeros.emplace_back(row, col,
+                                                   value_dist(rand_engine));
+                    }
+                }
+            }
+        }
+        auto result = Csr::create(ref);
+        result->read(data);
+        return result;
+    }
+
+    void set_up_apply_matrix(int num_rhs = 1)
+    {
+        csr = gen_block_mtx(213);
+        const auto size = static_cast<int>(csr->get_size()[0]);
+        mtx = Mtx::create(ref);
+        csr->convert_to(mtx);
+        expected = gen_mtx(size, num_rhs, num_rhs);
+        y = gen_mtx(size, num_rhs, num_rhs);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        dcsr = gko::clone(exec, csr);
+        dmtx = gko::clone(exec, mtx);
+        dresult = gko::clone(exec, expected);
+        dy = gko::clone(exec, y);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    std::default_random_engine rand_engine;
+
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> expected;
+    std::unique_ptr<Vec> y;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+
+    std::unique_ptr<Csr> dcsr;
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> dresult;
+    std::unique_ptr<Vec> dy;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(Vbcsr, SimpleApplyIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Vbcsr, AdvancedApplyIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Vbcsr, SimpleApplyToMultipleVectorsIsEquivalentToRef)
+{
+    set_up_apply_matrix(3);
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Vbcsr, AdvancedApplyToMultipleVectorsIsEquivalentToRef)
+{
+    set_up_apply_matrix(3);
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Vbcsr, ConvertFromCsrIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+    auto dres = Mtx::create(exec);
+
+    dcsr->convert_to(dres);
+
+    ASSERT_EQ(dres->get_num_block_rows(), mtx->get_num_block_rows());
+    ASSERT_EQ(dres->get_num_stored_blocks(), mtx->get_num_stored_blocks());
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(exec, mtx->get_num_stored_blocks() + 1,
+                                   dres->get_const_value_ptrs())
+            .copy_to_array(),
+        gko::make_const_array_view(ref, mtx->get_num_stored_blocks() + 1,
+                                   mtx->get_const_value_ptrs())
+            .copy_to_array());
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(exec, dres->get_num_stored_elements(),
+                                   dres->get_const_values())
+            .copy_to_array(),
+        gko::make_const_array_view(ref, mtx->get_num_stored_elements(),
+                                   mtx->get_const_values())
+            .copy_to_array());
+}
+
+
+TEST_F(Vbcsr, ConvertToCsrIsEquivalentToRef)
+{
+    set_up_apply_matrix();
+    auto res = Csr::create(ref);
+    auto dres = Csr::create(exec);
+
+    mtx->convert_to(res);
+    dmtx->convert_to(dres);
+
+    GKO_ASSERT_MTX_NEAR(dres, res, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(dres, res);
+    GKO_ASSERT_MTX_NEAR(dres, csr, 0.0);
+}
@@ -564,6 +564,54 @@ TYPED_TEST(Matrix, CanAdvancedApplyToMultipleVectorsLarge)
 }
 
 
+TYPED_TEST(Matrix, CanSplitPhaseApplyToMultipleVectorsLarge)
+{
+    this->init_large(100, 17);
+
+    this->dist_mat_large->apply_begin(this->x, this->y);
+    this->csr_mat->apply(this->dense_x, this->dense_y);
+    this->dist_mat_large->apply_end();
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanSplitPhaseAdvancedApplyToMultipleVectorsLarge)
+{
+    this->init_large(100, 17);
+
+    this->dist_mat_large->apply_begin(this->alpha, this->x, this->beta,
+                                      this->y);
+    this->csr_mat->apply(this->alpha, this->dense_x, this->beta, this->dense_y);
+    this->dist_mat_large->apply_end();
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, SplitPhaseApplyEndThrowsWithoutBegin)
+{
+    this->init_large(100, 1);
+
+    ASSERT_THROW(this->dist_mat_large->apply_end(), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(Matrix, SplitPhaseApplyBeginThrowsWhilePending)
+{
+    this->init_large(100, 1);
+    this->dist_mat_large->apply_begin(this->x, this->y);
+
+    ASSERT_THROW(this->dist_mat_large->apply_begin(this->x, this->y),
+                 gko::InvalidStateError);
+    this->dist_mat_large->apply_end();
+}
+
+
 TYPED_TEST(Matrix, CanColScale)
 {
     using value_type = typename TestFixture::value_type;
@@ -56,6 +56,32 @@ private:
 };
 
 
+class AllocationLogger : public gko::log::Logger {
+public:
+    void on_allocation_completed(const gko::Executor* exec,
+                                 const gko::size_type& num_bytes,
+                                 const gko::uintptr& location) const override
+    {
+        allocation_count_++;
+    }
+
+    int get_allocation_count() const { return allocation_count_; }
+
+    static std::unique_ptr<AllocationLogger> create()
+    {
+        return std::unique_ptr<AllocationLogger>(new AllocationLogger());
+    }
+
+protected:
+    AllocationLogger()
+        : gko::log::Logger(gko::log::Logger::allocation_completed_mask)
+    {}
+
+private:
+    mutable int allocation_count_ = 0;
+};
+
+
 template <typename ValueLocalGlobalIndexType>
 class VectorCreation : public CommonMpiTestFixture {
 public:
@@ -668,6 +694,144 @@ TYPED_TEST(VectorReductions, ComputesMeanWithTmpIsSameAsDense)
 }
 
 
+TYPED_TEST(VectorReductions, FusedReductionIsSameAsDense)
+{
+    using value_type = typename TestFixture::value_type;
+    using dense_type = typename TestFixture::dense_type;
+    using real_dense_type = typename TestFixture::real_dense_type;
+    this->init_result();
+    auto dot_res =
+        dense_type::create(this->exec, gko::dim<2>{1, this->size[1]});
+    auto dense_dot_res = dot_res->clone();
+    auto norm_res =
+        real_dense_type::create(this->exec, gko::dim<2>{1, this->size[1]});
+    auto dense_norm_res = norm_res->clone();
+    gko::experimental::distributed::FusedReduction<value_type> reduction{
+        this->x};
+
+    reduction.add_conj_dot(this->x, this->y, this->res)
+        .add_dot(this->y, this->x, dot_res)
+        .add_squared_norm2(this->x, this->real_res)
+        .add_norm2(this->y, norm_res);
+    reduction.compute(this->tmp);
+    this->dense_x->compute_conj_dot(this->dense_y, this->dense_res);
+    this->dense_y->compute_dot(this->dense_x, dense_dot_res);
+    this->dense_x->compute_squared_norm2(this->dense_real_res);
+    this->dense_y->compute_norm2(dense_norm_res);
+
+    GKO_ASSERT_MTX_NEAR(this->res, this->dense_res, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(dot_res, dense_dot_res, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(this->real_res, this->dense_real_res,
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(norm_res, dense_norm_res, r<value_type>::value);
+}
+
+
+TYPED_TEST(VectorReductions, NonBlockingFusedReductionIsSameAsDense)
+{
+    using value_type = typename TestFixture::value_type;
+    this->init_result();
+    gko::experimental::distributed::FusedReduction<value_type> reduction{
+        this->x};
+
+    reduction.add_conj_dot(this->x, this->y, this->res)
+        .add_squared_norm2(this->y, this->real_res);
+    reduction.start(this->tmp);
+    this->dense_x->compute_conj_dot(this->dense_y, this->dense_res);
+    this->dense_y->compute_squared_norm2(this->dense_real_res);
+    reduction.finish();
+
+    GKO_ASSERT_MTX_NEAR(this->res, this->dense_res, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(this->real_res, this->dense_real_res,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(VectorReductions, OverlappingFusedReductionsAreSameAsDense)
+{
+    using value_type = typename TestFixture::value_type;
+    this->init_result();
+    gko::experimental::distributed::FusedReduction<value_type> first{this->x};
+    gko::experimental::distributed::FusedReduction<value_type> second{
+        this->x};
+    first.add_conj_dot(this->x, this->y, this->res);
+    second.add_squared_norm2(this->y, this->real_res);
+
+    first.start(this->tmp);
+    second.start(this->tmp);
+    second.finish();
+    first.finish();
+    this->dense_x->compute_conj_dot(this->dense_y, this->dense_res);
+    this->dense_y->compute_squared_norm2(this->dense_real_res);
+
+    GKO_ASSERT_MTX_NEAR(this->res, this->dense_res, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(this->real_res, this->dense_real_res,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(VectorReductions, FusedReductionCanBeReused)
+{
+    using value_type = typename TestFixture::value_type;
+    this->init_result();
+    gko::experimental::distributed::FusedReduction<value_type> reduction{
+        this->x};
+    reduction.add_conj_dot(this->y, this->y, this->res);
+    reduction.compute(this->tmp);
+
+    reduction.clear();
+    reduction.add_squared_norm2(this->x, this->real_res);
+    reduction.compute(this->tmp);
+    this->dense_x->compute_squared_norm2(this->dense_real_res);
+
+    GKO_ASSERT_MTX_NEAR(this->real_res, this->dense_real_res,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(VectorReductions, FusedReductionReusesProvidedBuffers)
+{
+    using value_type = typename TestFixture::value_type;
+    using absolute_type = gko::remove_complex<value_type>;
+    this->init_result();
+    auto alloc_logger = gko::share(AllocationLogger::create());
+    gko::array<absolute_type> buffer{this->exec};
+    gko::array<absolute_type> host_buffer{this->exec->get_master()};
+    // the first iteration allocates the buffers
+    {
+        gko::experimental::distributed::FusedReduction<value_type> reduction{
+            this->x, buffer, host_buffer};
+        reduction.add_conj_dot(this->x, this->y, this->res)
+            .add_squared_norm2(this->y, this->real_res);
+        reduction.compute(this->tmp);
+    }
+    this->exec->add_logger(alloc_logger);
+    if (this->exec != this->exec->get_master()) {
+        this->exec->get_master()->add_logger(alloc_logger);
+    }
+
+    // the second iteration, with a new reduction of the same shape, reuses them
+    {
+        gko::experimental::distributed::FusedReduction<value_type> reduction{
+            this->x, buffer, host_buffer};
+        reduction.add_conj_dot(this->x, this->y, this->res)
+            .add_squared_norm2(this->y, this->real_res);
+        reduction.compute(this->tmp);
+    }
+    this->exec->remove_logger(alloc_logger);
+    if (this->exec != this->exec->get_master()) {
+        this->exec->get_master()->remove_logger(alloc_logger);
+    }
+    this->dense_x->compute_conj_dot(this->dense_y, this->dense_res);
+    this->dense_y->compute_squared_norm2(this->dense_real_res);
+
+    ASSERT_EQ(alloc_logger->get_allocation_count(), 0);
+    GKO_ASSERT_MTX_NEAR(this->res, this->dense_res, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(this->real_res, this->dense_real_res,
+                        r<value_type>::value);
+}
+
+
 TYPED_TEST(VectorReductions, ComputeDotCopiesToHostOnlyIfNecessary)
 {
     this->init_result();
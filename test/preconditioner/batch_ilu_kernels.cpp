@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+#include "core/test/utils/batch_helpers.hpp"
+#include "test/utils/common_fixture.hpp"
+
+
+class BatchIlu : public CommonTestFixture {
+protected:
+    using Mtx = gko::batch::matrix::Csr<value_type, int>;
+    using BIlu = gko::batch::preconditioner::Ilu<value_type>;
+
+    BatchIlu()
+        : ref_mtx(gko::share(
+              gko::test::generate_diag_dominant_batch_matrix<Mtx>(
+                  ref, nbatch, nrows, false, 4 * nrows - 3))),
+          d_mtx(gko::share(Mtx::create(exec)))
+    {
+        d_mtx->copy_from(ref_mtx.get());
+    }
+
+    const size_t nbatch = 9;
+    const int nrows = 100;
+    std::shared_ptr<Mtx> ref_mtx;
+    std::shared_ptr<Mtx> d_mtx;
+};
+
+
+TEST_F(BatchIlu, GenerationIsEquivalentToRef)
+{
+    auto ref_prec = BIlu::build().on(ref)->generate(ref_mtx);
+    auto d_prec = BIlu::build().on(exec)->generate(d_mtx);
+
+    const auto nnz = ref_prec->get_num_elements_per_item();
+    GKO_ASSERT_ARRAY_EQ(
+        gko::array<int>::const_view(exec, nrows,
+                                    d_prec->get_const_diag_locations()),
+        gko::array<int>::const_view(ref, nrows,
+                                    ref_prec->get_const_diag_locations()));
+    GKO_ASSERT_ARRAY_NEAR(
+        gko::array<value_type>::const_view(exec, nbatch * nnz,
+                                           d_prec->get_const_factors()),
+        gko::array<value_type>::const_view(ref, nbatch * nnz,
+                                           ref_prec->get_const_factors()),
+        10 * r<value_type>::value);
+}
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_isai_kernels.hpp"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+#include "core/test/utils/batch_helpers.hpp"
+#include "test/utils/common_fixture.hpp"
+
+
+class BatchIsai : public CommonTestFixture {
+protected:
+    using Mtx = gko::batch::matrix::Csr<value_type, int>;
+    using BIsai = gko::batch::preconditioner::Isai<value_type>;
+
+    BatchIsai()
+        : ref_mtx(gko::share(
+              gko::test::generate_diag_dominant_batch_matrix<Mtx>(
+                  ref, nbatch, nrows, false, 4 * nrows - 3))),
+          d_mtx(gko::share(Mtx::create(exec)))
+    {
+        d_mtx->copy_from(ref_mtx.get());
+    }
+
+    const size_t nbatch = 9;
+    const int nrows = 100;
+    std::shared_ptr<Mtx> ref_mtx;
+    std::shared_ptr<Mtx> d_mtx;
+};
+
+
+TEST_F(BatchIsai, GenerationIsEquivalentToRef)
+{
+    auto ref_prec = BIsai::build().on(ref)->generate(ref_mtx);
+    auto d_prec = BIsai::build().on(exec)->generate(d_mtx);
+
+    const auto nnz = ref_prec->get_num_elements_per_item();
+    GKO_ASSERT_ARRAY_NEAR(
+        gko::array<value_type>::const_view(exec, nbatch * nnz,
+                                           d_prec->get_const_inverse_values()),
+        gko::array<value_type>::const_view(
+            ref, nbatch * nnz, ref_prec->get_const_inverse_values()),
+        10 * r<value_type>::value);
+}
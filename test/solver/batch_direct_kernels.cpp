@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/batch_direct_kernels.hpp"
+
+#include <memory>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/solver/batch_direct.hpp>
+
+#include "core/base/batch_utilities.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+#include "core/test/utils/batch_helpers.hpp"
+#include "test/utils/common_fixture.hpp"
+
+
+class BatchDirect : public CommonTestFixture {
+protected:
+    using real_type = gko::remove_complex<value_type>;
+    using Mtx = gko::batch::matrix::Dense<value_type>;
+    using CsrMtx = gko::batch::matrix::Csr<value_type>;
+    using MVec = gko::batch::MultiVector<value_type>;
+    using Solver = gko::batch::solver::Direct<value_type>;
+
+    BatchDirect() : rand_engine(15)
+    {
+        b = gko::test::generate_random_batch_matrix<MVec>(
+            num_batch_items, num_rows, num_rhs,
+            std::uniform_int_distribution<>(num_rhs, num_rhs),
+            std::normal_distribution<real_type>(), rand_engine, ref);
+        d_b = gko::clone(exec, b);
+        x = MVec::create_with_config_of(b);
+        d_x = MVec::create_with_config_of(d_b);
+    }
+
+    template <typename Matrix>
+    void assert_equivalent_to_ref(std::shared_ptr<const Matrix> mtx)
+    {
+        auto d_mtx = gko::share(gko::clone(exec, mtx));
+        auto solver = Solver::build().on(ref)->generate(mtx);
+        auto d_solver = Solver::build().on(exec)->generate(d_mtx);
+
+        solver->apply(b, x);
+        d_solver->apply(d_b, d_x);
+
+        const auto tol = 10 * r<value_type>::value;
+        ASSERT_EQ(d_solver->get_num_stored_elements(),
+                  solver->get_num_stored_elements());
+        GKO_ASSERT_ARRAY_NEAR(
+            gko::array<value_type>::const_view(
+                exec, d_solver->get_num_stored_elements(),
+                d_solver->get_const_factors()),
+            gko::array<value_type>::const_view(
+                ref, solver->get_num_stored_elements(),
+                solver->get_const_factors()),
+            tol);
+        GKO_ASSERT_BATCH_MTX_NEAR(d_x, x, tol);
+    }
+
+    // not a multiple of the number of items factorized together
+    const gko::size_type num_batch_items = 21;
+    const int num_rows = 23;
+    const int num_rhs = 2;
+    std::default_random_engine rand_engine;
+    std::unique_ptr<MVec> b;
+    std::unique_ptr<MVec> d_b;
+    std::unique_ptr<MVec> x;
+    std::unique_ptr<MVec> d_x;
+};
+
+
+TEST_F(BatchDirect, DenseFactorizationIsEquivalentToRef)
+{
+    auto mtx = gko::share(gko::test::generate_random_batch_matrix<const Mtx>(
+        num_batch_items, num_rows, num_rows,
+        std::uniform_int_distribution<>(num_rows, num_rows),
+        std::normal_distribution<real_type>(), rand_engine, ref));
+
+    assert_equivalent_to_ref(mtx);
+}
+
+
+TEST_F(BatchDirect, SparseFactorizationIsEquivalentToRef)
+{
+    auto mtx = gko::share(
+        gko::test::generate_diag_dominant_batch_matrix<const CsrMtx>(
+            ref, num_batch_items, num_rows, false, 4 * num_rows - 3));
+
+    assert_equivalent_to_ref(mtx);
+}